@@ -8,6 +8,10 @@
 
 #include "DlApi.h"
 
+#include <cstring>
+
+#include "Memory/ResourceLedger.h"
+
 namespace Raidcore::Nexus::Core
 {
 	constexpr const char* LOG_CHANNEL = "DataLink";
@@ -43,7 +47,7 @@ namespace Raidcore::Nexus::Core
 				case ELinkedResourceType::Internal:
 					if (it->second.Pointer)
 					{
-						delete it->second.Pointer;
+						delete[] static_cast<char*>(it->second.Pointer);
 						it->second.Pointer = nullptr;
 					}
 					break;
@@ -51,6 +55,13 @@ namespace Raidcore::Nexus::Core
 
 			this->Logger.Info(LOG_CHANNEL, "Freed shared resource: \"%s\"", it->first.c_str());
 
+			auto handle = this->Handles.find(it->first);
+
+			if (handle != this->Handles.end())
+			{
+				this->HandleSlots[handle->second - 1]->store(nullptr, std::memory_order_release);
+			}
+
 			this->Registry.erase(it);
 		}
 	}
@@ -71,7 +82,40 @@ namespace Raidcore::Nexus::Core
 		return nullptr;
 	}
 
-	void* DataLinkApi::Share(const char* aIdentifier, size_t aResourceSize, const char* aUnderlyingName, bool aIsPublic)
+	uint32_t DataLinkApi::GetHandle(const char* aIdentifier)
+	{
+		if (aIdentifier == nullptr) { return DL_INVALID_HANDLE; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Handles.find(aIdentifier);
+
+		if (it != this->Handles.end())
+		{
+			return it->second;
+		}
+
+		auto res = this->Registry.find(aIdentifier);
+
+		return this->PublishHandle(aIdentifier, res != this->Registry.end() ? res->second.Pointer : nullptr);
+	}
+
+	void* DataLinkApi::GetByHandle(uint32_t aHandle) const
+	{
+		if (aHandle == DL_INVALID_HANDLE) { return nullptr; }
+
+		HandleTable_t* table = this->HandleTable.load(std::memory_order_acquire);
+
+		if (table == nullptr) { return nullptr; }
+
+		uint32_t idx = aHandle - 1;
+
+		if (idx >= table->Count.load(std::memory_order_acquire)) { return nullptr; }
+
+		return table->Slots[idx]->load(std::memory_order_acquire);
+	}
+
+	void* DataLinkApi::Share(const char* aIdentifier, size_t aResourceSize, const char* aUnderlyingName, bool aIsPublic, void* aOwner)
 	{
 		if (aIdentifier == nullptr) { return nullptr; }
 		if (aResourceSize == 0) { return nullptr; }
@@ -166,7 +210,7 @@ namespace Raidcore::Nexus::Core
 			}
 			case ELinkedResourceType::Internal:
 			{
-				resource.Pointer = new char[resource.Size];
+				resource.Pointer = new char[resource.Size]();
 
 				this->Logger.Info(LOG_CHANNEL, "Created internal shared resource: \"%s\"", aIdentifier);
 				break;
@@ -176,13 +220,94 @@ namespace Raidcore::Nexus::Core
 		/* store linkedresource */
 		this->Registry.emplace(aIdentifier, resource);
 
+		Memory::ResourceLedger::Get()->Add(
+			aOwner ? Memory::GetOwnerModule(aOwner) : nullptr,
+			Memory::EResource::DataLinkBytes,
+			static_cast<int64_t>(resource.Size)
+		);
+
+		/* resolve handles acquired before the resource existed */
+		if (this->Handles.find(aIdentifier) != this->Handles.end())
+		{
+			this->PublishHandle(aIdentifier, resource.Pointer);
+		}
+
 		return resource.Pointer;
 	}
 
+	VersionedHeader_t* DataLinkApi::ShareVersioned(const char* aIdentifier, size_t aPayloadSize, uint32_t aBufferCount, const char* aUnderlyingName, bool aIsPublic, void* aOwner)
+	{
+		if (aBufferCount != 1 && aBufferCount != 2)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Versioned resource \"%s\" requested with %u buffers. Only 1 or 2 are supported.", aIdentifier, aBufferCount);
+			return nullptr;
+		}
+
+		if (aPayloadSize > UINT32_MAX) { return nullptr; }
+
+		VersionedHeader_t* header = static_cast<VersionedHeader_t*>(this->Share(aIdentifier, GetVersionedSize(aPayloadSize, aBufferCount), aUnderlyingName, aIsPublic, aOwner));
+
+		if (!header) { return nullptr; }
+
+		/* Sharing the same resource concurrently must not initialize it twice. */
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!InitVersioned(header, aPayloadSize, aBufferCount))
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Resource with name \"%s\" already exists with a different versioned layout.", aIdentifier);
+			return nullptr;
+		}
+
+		return header;
+	}
+
 	std::unordered_map<std::string, LinkedResource_t> DataLinkApi::GetRegistry() const
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
 		return this->Registry;
 	}
+
+	uint32_t DataLinkApi::PublishHandle(const std::string& aIdentifier, void* aPointer)
+	{
+		auto it = this->Handles.find(aIdentifier);
+
+		if (it != this->Handles.end())
+		{
+			this->HandleSlots[it->second - 1]->store(aPointer, std::memory_order_release);
+			return it->second;
+		}
+
+		HandleTable_t* table = this->HandleTable.load(std::memory_order_relaxed);
+		uint32_t count = table ? table->Count.load(std::memory_order_relaxed) : 0;
+
+		this->HandleSlots.push_back(std::make_unique<std::atomic<void*>>(aPointer));
+
+		/* table full, copy the slot pointers into one twice the size and swap it in */
+		if (table == nullptr || count == table->Capacity)
+		{
+			std::unique_ptr<HandleTable_t> grown = std::make_unique<HandleTable_t>();
+			grown->Capacity = table ? table->Capacity * 2 : 64;
+			grown->Slots = std::make_unique<std::atomic<void*>*[]>(grown->Capacity);
+
+			for (uint32_t i = 0; i < count; i++)
+			{
+				grown->Slots[i] = table->Slots[i];
+			}
+
+			grown->Count.store(count, std::memory_order_relaxed);
+
+			table = grown.get();
+			this->HandleTables.push_back(std::move(grown));
+			this->HandleTable.store(table, std::memory_order_release);
+		}
+
+		table->Slots[count] = this->HandleSlots.back().get();
+		table->Count.store(count + 1, std::memory_order_release);
+
+		uint32_t handle = count + 1;
+		this->Handles.emplace(aIdentifier, handle);
+
+		return handle;
+	}
 }
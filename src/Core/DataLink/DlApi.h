@@ -8,11 +8,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "DlHandleTable.h"
 #include "DlLinkedResource.h"
+#include "DlVersioned.h"
 #include "Core/Logging/LogApi.h"
 
 ///----------------------------------------------------------------------------------------------------
@@ -41,16 +46,46 @@ namespace Raidcore::Nexus::Core
 		///----------------------------------------------------------------------------------------------------
 		void* Get(const char* aIdentifier);
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetHandle:
+		/// 	Returns a stable handle for the given identifier, to be resolved with GetByHandle.
+		/// 	The resource does not have to exist yet, the handle resolves once it is shared.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetHandle(const char* aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetByHandle:
+		/// 	Retrieves the resource with the given handle. Wait-free.
+		/// 	Returns nullptr, if the handle is invalid or the resource was not shared yet.
+		///----------------------------------------------------------------------------------------------------
+		void* GetByHandle(uint32_t aHandle) const;
+
 		///----------------------------------------------------------------------------------------------------
 		/// Share:
 		/// 	Allocates memory of the given size, accessible via the provided identifier,
 		/// 	but with a different internal/underlying name.
+		/// 	[optional] aOwner: Address within the module the allocation is accounted to.
 		///----------------------------------------------------------------------------------------------------
 		void* Share(
 			const char* aIdentifier,
 			size_t      aResourceSize,
 			const char* aUnderlyingName = "",
-			bool        aIsPublic = false
+			bool        aIsPublic = false,
+			void*       aOwner = nullptr
+		);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ShareVersioned:
+		/// 	Allocates a versioned resource with one or two payload buffers of the given size.
+		/// 	Written with BeginWrite/EndWrite and read with ReadVersioned.
+		///----------------------------------------------------------------------------------------------------
+		VersionedHeader_t* ShareVersioned(
+			const char* aIdentifier,
+			size_t      aPayloadSize,
+			uint32_t    aBufferCount,
+			const char* aUnderlyingName = "",
+			bool        aIsPublic = false,
+			void*       aOwner = nullptr
 		);
 
 		///----------------------------------------------------------------------------------------------------
@@ -64,5 +99,17 @@ namespace Raidcore::Nexus::Core
 
 		mutable std::mutex                                Mutex;
 		std::unordered_map<std::string, LinkedResource_t> Registry;
+
+		std::unordered_map<std::string, uint32_t>         Handles;
+		std::vector<std::unique_ptr<std::atomic<void*>>>  HandleSlots;
+		std::atomic<HandleTable_t*>                       HandleTable{ nullptr };
+		std::vector<std::unique_ptr<HandleTable_t>>       HandleTables; /* Replaced tables stay alive for readers. */
+
+		///----------------------------------------------------------------------------------------------------
+		/// PublishHandle:
+		/// 	Updates or appends the handle slot of an identifier.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t PublishHandle(const std::string& aIdentifier, void* aPointer);
 	};
 }
@@ -0,0 +1,33 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  DlHandleTable.h
+/// Description  :  Append-only table resolving resource handles without locking.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/* Handles are index + 1, 0 is never a valid handle. */
+constexpr const uint32_t DL_INVALID_HANDLE = 0;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Core Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Core
+{
+	///----------------------------------------------------------------------------------------------------
+	/// HandleTable_t Struct
+	/// 	Slots below Count are published and never move, the table itself is only replaced when full.
+	///----------------------------------------------------------------------------------------------------
+	struct HandleTable_t
+	{
+		uint32_t                               Capacity;
+		std::atomic<uint32_t>                  Count;
+		std::unique_ptr<std::atomic<void*>*[]> Slots;
+	};
+}
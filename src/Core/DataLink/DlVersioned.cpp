@@ -0,0 +1,110 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  DlVersioned.cpp
+/// Description  :  Sequence-versioned layout for shared resources read while being written.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "DlVersioned.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace Raidcore::Nexus::Core
+{
+	static_assert(sizeof(VersionedHeader_t) % DL_VERSIONED_ALIGNMENT == 0);
+
+	static size_t GetStride(size_t aPayloadSize)
+	{
+		return (aPayloadSize + DL_VERSIONED_ALIGNMENT - 1) & ~static_cast<size_t>(DL_VERSIONED_ALIGNMENT - 1);
+	}
+
+	static char* GetBuffer(const VersionedHeader_t* aHeader, uint32_t aIndex)
+	{
+		return (char*)(aHeader + 1) + GetStride(aHeader->PayloadSize) * aIndex;
+	}
+
+	size_t GetVersionedSize(size_t aPayloadSize, uint32_t aBufferCount)
+	{
+		return sizeof(VersionedHeader_t) + GetStride(aPayloadSize) * aBufferCount;
+	}
+
+	bool InitVersioned(VersionedHeader_t* aHeader, size_t aPayloadSize, uint32_t aBufferCount)
+	{
+		if (aHeader->Magic == DL_VERSIONED_MAGIC)
+		{
+			return aHeader->PayloadSize == aPayloadSize && aHeader->BufferCount == aBufferCount;
+		}
+
+		aHeader->Sequence    = 0;
+		aHeader->BufferCount = aBufferCount;
+		aHeader->PayloadSize = static_cast<uint32_t>(aPayloadSize);
+
+		/* Magic last, the header is only valid once complete. */
+		std::atomic_ref<uint32_t>(aHeader->Magic).store(DL_VERSIONED_MAGIC, std::memory_order_release);
+
+		return true;
+	}
+
+	void* BeginWrite(VersionedHeader_t* aHeader)
+	{
+		std::atomic_ref<uint32_t> sequence(aHeader->Sequence);
+		uint32_t seq = sequence.load(std::memory_order_relaxed);
+
+		if (aHeader->BufferCount == 2)
+		{
+			/* Orders the previous EndWrite before the writes into the buffer it retired, a reader still
+			 * copying that buffer then always observes a changed sequence. */
+			std::atomic_thread_fence(std::memory_order_release);
+
+			/* Carry the published version over, so partial updates keep the remaining fields. */
+			char* next = GetBuffer(aHeader, (seq + 1) & 1);
+			std::memcpy(next, GetBuffer(aHeader, seq & 1), aHeader->PayloadSize);
+			return next;
+		}
+
+		/* Odd: write in progress. */
+		sequence.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		return GetBuffer(aHeader, 0);
+	}
+
+	void EndWrite(VersionedHeader_t* aHeader)
+	{
+		std::atomic_ref<uint32_t> sequence(aHeader->Sequence);
+
+		sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	bool ReadVersioned(const VersionedHeader_t* aHeader, void* aOut, size_t aSize, uint32_t aRetries, uint32_t* aOutRetries)
+	{
+		std::atomic_ref<uint32_t> sequence(const_cast<uint32_t&>(aHeader->Sequence));
+		bool isDoubleBuffered = aHeader->BufferCount == 2;
+		size_t size = std::min(aSize, static_cast<size_t>(aHeader->PayloadSize));
+
+		for (uint32_t attempt = 0; attempt <= aRetries; attempt++)
+		{
+			uint32_t before = sequence.load(std::memory_order_acquire);
+
+			if (!isDoubleBuffered && (before & 1))
+			{
+				continue;
+			}
+
+			std::memcpy(aOut, GetBuffer(aHeader, isDoubleBuffered ? before & 1 : 0), size);
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (sequence.load(std::memory_order_relaxed) == before)
+			{
+				if (aOutRetries) { *aOutRetries = attempt; }
+				return true;
+			}
+		}
+
+		if (aOutRetries) { *aOutRetries = aRetries; }
+		return false;
+	}
+}
@@ -0,0 +1,77 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  DlVersioned.h
+/// Description  :  Sequence-versioned layout for shared resources read while being written.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr const uint32_t DL_VERSIONED_MAGIC        = 0x5644584E; /* "NXDV" */
+constexpr const uint32_t DL_VERSIONED_ALIGNMENT    = 16;
+constexpr const uint32_t DL_VERSIONED_READ_RETRIES = 64;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Core Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Core
+{
+	///----------------------------------------------------------------------------------------------------
+	/// VersionedHeader_t Struct
+	/// 	Precedes the payload buffer(s) of a versioned resource. There must only be one writer.
+	/// 	Single buffer: Sequence is odd while the payload is being written.
+	/// 	Double buffer: The writer fills the buffer not currently published and then increments
+	/// 	Sequence, whose lowest bit selects the published buffer. Readers only retry if a write
+	/// 	completed while they were copying.
+	///----------------------------------------------------------------------------------------------------
+	struct VersionedHeader_t
+	{
+		uint32_t Sequence;
+		uint32_t Magic;       /* DL_VERSIONED_MAGIC                          */
+		uint32_t BufferCount; /* 1 or 2.                                     */
+		uint32_t PayloadSize; /* Size of one buffer, excluding padding.      */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetVersionedSize:
+	/// 	Returns the total size of a versioned resource, including header and padding.
+	///----------------------------------------------------------------------------------------------------
+	size_t GetVersionedSize(size_t aPayloadSize, uint32_t aBufferCount);
+
+	///----------------------------------------------------------------------------------------------------
+	/// InitVersioned:
+	/// 	Initializes the header of a zeroed versioned resource.
+	/// 	Returns false, if the memory already holds a header with a different layout.
+	///----------------------------------------------------------------------------------------------------
+	bool InitVersioned(VersionedHeader_t* aHeader, size_t aPayloadSize, uint32_t aBufferCount);
+
+	///----------------------------------------------------------------------------------------------------
+	/// BeginWrite:
+	/// 	Returns the payload buffer to write the next version into.
+	///----------------------------------------------------------------------------------------------------
+	void* BeginWrite(VersionedHeader_t* aHeader);
+
+	///----------------------------------------------------------------------------------------------------
+	/// EndWrite:
+	/// 	Publishes the version written since BeginWrite.
+	///----------------------------------------------------------------------------------------------------
+	void EndWrite(VersionedHeader_t* aHeader);
+
+	///----------------------------------------------------------------------------------------------------
+	/// ReadVersioned:
+	/// 	Copies a consistent version of the payload to aOut, at most aSize bytes.
+	/// 	Returns false, if no consistent copy could be made within aRetries attempts.
+	/// 	aOutRetries optionally receives the amount of retries that were needed.
+	///----------------------------------------------------------------------------------------------------
+	bool ReadVersioned(
+		const VersionedHeader_t* aHeader,
+		void*                    aOut,
+		size_t                   aSize,
+		uint32_t                 aRetries    = DL_VERSIONED_READ_RETRIES,
+		uint32_t*                aOutRetries = nullptr
+	);
+}
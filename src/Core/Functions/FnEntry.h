@@ -8,20 +8,58 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <string>
+
+/* Handles are index + 1, 0 is never a valid handle. */
+constexpr const uint32_t FN_INVALID_HANDLE = 0;
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Core Namespace
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::Core
 {
+	/* FuncEntry_t::State: reference count in the low half, flags in the high half. */
+	constexpr const uint64_t FN_STATE_REFCOUNT     = 0xFFFFFFFF;
+	constexpr const uint64_t FN_STATE_REGISTERED   = 1ull << 32;
+	constexpr const uint64_t FN_STATE_SHOULDDELETE = 1ull << 33;
+
+	/* Buckets of interned identifiers, chains grow past a few hundred functions. */
+	constexpr const uint32_t FN_HANDLE_BUCKETS     = 1024;
+
 	///----------------------------------------------------------------------------------------------------
 	/// FuncEntry_t Struct
+	/// 	Reference count and flags share one word, so taking a reference and deregistering can not
+	/// 	interleave. Function is only written while the entry is unregistered and unreferenced.
 	///----------------------------------------------------------------------------------------------------
 	struct FuncEntry_t
 	{
-		int32_t RefCount;
-		bool    ShouldDelete;
-		void*   Function;
+		std::atomic<uint64_t> State{ 0 };
+		std::atomic<void*>    Function{ nullptr };
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// FuncHandle_t Struct
+	/// 	Interned identifier, chained into a bucket by its hash. Published once and never changed,
+	/// 	so the chains can be walked without the lock.
+	///----------------------------------------------------------------------------------------------------
+	struct FuncHandle_t
+	{
+		std::string   Identifier;
+		uint32_t      Handle;
+		FuncHandle_t* Next;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// FuncTable_t Struct
+	/// 	Entries below Count are published and never move, the table itself is only replaced when full.
+	///----------------------------------------------------------------------------------------------------
+	struct FuncTable_t
+	{
+		uint32_t                        Capacity;
+		std::atomic<uint32_t>           Count;
+		std::unique_ptr<FuncEntry_t*[]> Entries;
 	};
 }
@@ -8,14 +8,31 @@
 
 #include "FnRegistry.h"
 
+#include <string_view>
+
 namespace Raidcore::Nexus::Core
 {
 	constexpr const char* LOG_CHANNEL = "Functions";
 
+	static uint32_t GetBucket(std::string_view aIdentifier)
+	{
+		return static_cast<uint32_t>(std::hash<std::string_view>{}(aIdentifier) % FN_HANDLE_BUCKETS);
+	}
+
 	FuncRegistry::FuncRegistry(LogApi& aLogger)
-		: Logger(aLogger)
+		: IRefCleaner("FunctionRegistry")
+		, Logger(aLogger)
 	{}
 
+	uint32_t FuncRegistry::GetHandle(const char* aIdentifier)
+	{
+		if (aIdentifier == nullptr) { return FN_INVALID_HANDLE; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Intern(aIdentifier);
+	}
+
 	bool FuncRegistry::Register(const char* aIdentifier, void* aFunction)
 	{
 		if (aIdentifier == nullptr) { return false; }
@@ -23,9 +40,11 @@ namespace Raidcore::Nexus::Core
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = this->Registry.find(aIdentifier);
+		uint32_t handle = this->Intern(aIdentifier);
+		FuncEntry_t* entry = this->GetEntry(handle);
 
-		if (it != this->Registry.end())
+		/* Still registered or waiting for its references to be released. */
+		if (entry->State.load(std::memory_order_acquire) != 0)
 		{
 			this->Logger.Debug(
 				LOG_CHANNEL,
@@ -35,11 +54,11 @@ namespace Raidcore::Nexus::Core
 			return false;
 		}
 
-		FuncEntry_t entry{};
-		entry.RefCount = 0;
-		entry.Function = aFunction;
+		/* Unreferenced and unregistered, no reader accesses the function. */
+		entry->Function.store(aFunction, std::memory_order_relaxed);
+		entry->State.store(FN_STATE_REGISTERED, std::memory_order_release);
 
-		this->Registry.emplace(aIdentifier, entry);
+		this->Owners.Add(aFunction, handle);
 
 		return true;
 	}
@@ -51,18 +70,28 @@ namespace Raidcore::Nexus::Core
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = this->Registry.find(aIdentifier);
+		uint32_t handle = this->Find(aIdentifier);
 
-		if (it == this->Registry.end())
+		if (handle == FN_INVALID_HANDLE)
 		{
 			/* Identifier not registered. */
 			return;
 		}
 
-		if (it->second.RefCount == 0)
+		FuncEntry_t* entry = this->GetEntry(handle);
+		void* function = entry->Function.load(std::memory_order_relaxed);
+		bool deleted = false;
+
+		if (!this->Retire(entry, deleted))
 		{
-			this->Registry.erase(it);
+			/* Not registered or already flagged. */
+			return;
+		}
 
+		this->Owners.Remove(function, handle);
+
+		if (deleted)
+		{
 			this->Logger.Debug(
 				LOG_CHANNEL,
 				"\"%s\" already at reference count zero. Deleted.",
@@ -71,8 +100,6 @@ namespace Raidcore::Nexus::Core
 		}
 		else
 		{
-			it->second.ShouldDelete = true;
-
 			this->Logger.Debug(
 				LOG_CHANNEL,
 				"\"%s\" flagged for deletion. Will be deleted when reaching a reference count of zero.",
@@ -83,58 +110,206 @@ namespace Raidcore::Nexus::Core
 
 	void* FuncRegistry::Query(const char* aIdentifier)
 	{
-		if (aIdentifier == nullptr) { return nullptr; }
+		return this->QueryHandle(this->Find(aIdentifier));
+	}
 
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+	void FuncRegistry::Release(const char* aIdentifier)
+	{
+		this->ReleaseHandle(this->Find(aIdentifier));
+	}
+
+	void* FuncRegistry::QueryHandle(uint32_t aHandle)
+	{
+		FuncEntry_t* entry = this->GetEntry(aHandle);
+
+		if (!entry) { return nullptr; }
 
-		auto it = this->Registry.find(aIdentifier);
+		uint64_t state = entry->State.load(std::memory_order_acquire);
 
-		if (it != this->Registry.end())
+		do
 		{
 			/* Do not allow new references to function flagged for deletion. */
-			if (it->second.ShouldDelete)
+			if ((state & FN_STATE_REGISTERED) == 0 || (state & FN_STATE_SHOULDDELETE) != 0)
 			{
 				return nullptr;
 			}
+		} while (!entry->State.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire));
 
-			it->second.RefCount++;
-			return it->second.Function;
-		}
+		/* The reference keeps the entry registered, the function can not change anymore. */
+		return entry->Function.load(std::memory_order_relaxed);
+	}
+
+	void FuncRegistry::ReleaseHandle(uint32_t aHandle)
+	{
+		FuncEntry_t* entry = this->GetEntry(aHandle);
+
+		if (!entry) { return; }
+
+		uint64_t state = entry->State.load(std::memory_order_acquire);
+		uint64_t desired;
+
+		do
+		{
+			if ((state & FN_STATE_REFCOUNT) == 0)
+			{
+				if (state & FN_STATE_REGISTERED)
+				{
+					this->Logger.Critical(
+						LOG_CHANNEL,
+						"\"%s\" reference count less than zero. Query/Release mismatch. Function may be freed prematurely.",
+						this->GetIdentifier(aHandle).c_str()
+					);
+				}
+				return;
+			}
+
+			desired = state - 1;
+
+			/* Last reference to a deregistered function, the entry may be registered again. */
+			if ((desired & FN_STATE_REFCOUNT) == 0 && (desired & FN_STATE_SHOULDDELETE) != 0)
+			{
+				desired = 0;
+			}
+		} while (!entry->State.compare_exchange_weak(state, desired, std::memory_order_acq_rel, std::memory_order_acquire));
 
-		return nullptr;
+		if (desired == 0)
+		{
+			this->Logger.Debug(
+				LOG_CHANNEL,
+				"\"%s\" deleted after reaching reference count zero.",
+				this->GetIdentifier(aHandle).c_str()
+			);
+		}
 	}
 
-	void FuncRegistry::Release(const char* aIdentifier)
+	uint32_t FuncRegistry::CleanupRefs(void* aStartAddress, void* aEndAddress)
 	{
-		if (aIdentifier == nullptr) { return; }
+		uint32_t refCounter = 0;
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = this->Registry.find(aIdentifier);
-
-		if (it != this->Registry.end())
+		for (uint32_t handle : this->Owners.Take(aStartAddress, aEndAddress))
 		{
-			it->second.RefCount--;
+			FuncEntry_t* entry = this->GetEntry(handle);
+			void* function = entry->Function.load(std::memory_order_relaxed);
+
+			if (function < aStartAddress || function > aEndAddress) { continue; }
 
-			if (it->second.RefCount < 0)
+			bool deleted = false;
+
+			if (this->Retire(entry, deleted))
 			{
-				this->Logger.Critical(
-					LOG_CHANNEL,
-					"\"%s\" reference count less than zero. Query/Release mismatch. Function may be freed prematurely.",
-					aIdentifier
-				);
+				refCounter++;
 			}
+		}
 
-			if (it->second.RefCount == 0 && it->second.ShouldDelete == true)
+		return refCounter;
+	}
+
+	uint32_t FuncRegistry::Find(const char* aIdentifier)
+	{
+		if (aIdentifier == nullptr) { return FN_INVALID_HANDLE; }
+
+		std::string_view identifier = aIdentifier;
+
+		for (FuncHandle_t* node = this->Buckets[GetBucket(identifier)].load(std::memory_order_acquire); node; node = node->Next)
+		{
+			if (node->Identifier == identifier)
 			{
-				this->Registry.erase(it);
+				return node->Handle;
+			}
+		}
 
-				this->Logger.Debug(
-					LOG_CHANNEL,
-					"\"%s\" deleted after reaching reference count zero.",
-					aIdentifier
-				);
+		return FN_INVALID_HANDLE;
+	}
+
+	uint32_t FuncRegistry::Intern(const std::string& aIdentifier)
+	{
+		uint32_t existing = this->Find(aIdentifier.c_str());
+
+		if (existing != FN_INVALID_HANDLE)
+		{
+			return existing;
+		}
+
+		FuncTable_t* table = this->Table.load(std::memory_order_relaxed);
+		uint32_t count = table ? table->Count.load(std::memory_order_relaxed) : 0;
+
+		this->Entries.push_back(std::make_unique<FuncEntry_t>());
+
+		/* Table full, copy the entry pointers into one twice the size and swap it in. */
+		if (table == nullptr || count == table->Capacity)
+		{
+			std::unique_ptr<FuncTable_t> grown = std::make_unique<FuncTable_t>();
+			grown->Capacity = table ? table->Capacity * 2 : 64;
+			grown->Entries = std::make_unique<FuncEntry_t*[]>(grown->Capacity);
+
+			for (uint32_t i = 0; i < count; i++)
+			{
+				grown->Entries[i] = table->Entries[i];
 			}
+
+			grown->Count.store(count, std::memory_order_relaxed);
+
+			table = grown.get();
+			this->Tables.push_back(std::move(grown));
+			this->Table.store(table, std::memory_order_release);
 		}
+
+		table->Entries[count] = this->Entries.back().get();
+		table->Count.store(count + 1, std::memory_order_release);
+
+		uint32_t handle = count + 1;
+
+		/* Published after the entry, a reader finding the identifier can resolve its handle. */
+		std::atomic<FuncHandle_t*>& bucket = this->Buckets[GetBucket(aIdentifier)];
+		this->Identifiers.push_back(std::make_unique<FuncHandle_t>(FuncHandle_t{ aIdentifier, handle, bucket.load(std::memory_order_relaxed) }));
+		bucket.store(this->Identifiers.back().get(), std::memory_order_release);
+
+		return handle;
+	}
+
+	FuncEntry_t* FuncRegistry::GetEntry(uint32_t aHandle) const
+	{
+		if (aHandle == FN_INVALID_HANDLE) { return nullptr; }
+
+		FuncTable_t* table = this->Table.load(std::memory_order_acquire);
+
+		if (table == nullptr) { return nullptr; }
+
+		uint32_t idx = aHandle - 1;
+
+		if (idx >= table->Count.load(std::memory_order_acquire)) { return nullptr; }
+
+		return table->Entries[idx];
+	}
+
+	bool FuncRegistry::Retire(FuncEntry_t* aEntry, bool& aOutDeleted)
+	{
+		uint64_t state = aEntry->State.load(std::memory_order_acquire);
+		uint64_t desired;
+
+		do
+		{
+			if ((state & FN_STATE_REGISTERED) == 0 || (state & FN_STATE_SHOULDDELETE) != 0)
+			{
+				return false;
+			}
+
+			desired = (state & FN_STATE_REFCOUNT) == 0
+				? 0
+				: state | FN_STATE_SHOULDDELETE;
+		} while (!aEntry->State.compare_exchange_weak(state, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+
+		aOutDeleted = desired == 0;
+
+		return true;
+	}
+
+	std::string FuncRegistry::GetIdentifier(uint32_t aHandle)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return aHandle - 1 < this->Identifiers.size() ? this->Identifiers[aHandle - 1]->Identifier : std::string{};
 	}
 }
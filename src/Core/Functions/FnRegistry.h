@@ -8,12 +8,17 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
-#include <unordered_map>
 #include <string>
+#include <vector>
 
 #include "FnEntry.h"
 #include "Core/Logging/LogApi.h"
+#include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Core Namespace
@@ -22,8 +27,11 @@ namespace Raidcore::Nexus::Core
 {
 	///----------------------------------------------------------------------------------------------------
 	/// FuncRegistry Class
+	/// 	Identifiers are interned to handles. Registering and deregistering is serialized, querying
+	/// 	and releasing is lock-free, by handle and by identifier. Deregistered functions are kept until
+	/// 	the last reference is released, no new references are handed out in the meantime.
 	///----------------------------------------------------------------------------------------------------
-	class FuncRegistry
+	class FuncRegistry : public virtual Memory::IRefCleaner
 	{
 		public:
 		///----------------------------------------------------------------------------------------------------
@@ -36,6 +44,12 @@ namespace Raidcore::Nexus::Core
 		///----------------------------------------------------------------------------------------------------
 		~FuncRegistry() = default;
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetHandle:
+		/// 	Returns the handle of the given identifier. The function does not have to be registered yet.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetHandle(const char* aIdentifier);
+
 		///----------------------------------------------------------------------------------------------------
 		/// Register:
 		/// 	Registers a function with the given identifier.
@@ -52,20 +66,76 @@ namespace Raidcore::Nexus::Core
 		///----------------------------------------------------------------------------------------------------
 		/// Query:
 		/// 	Queries for a function with the given identifier and returns it or nullptr.
-		/// 	If a function is returned, the refcount is incremented.
+		/// 	If a function is returned, the refcount is incremented. Lock-free.
 		///----------------------------------------------------------------------------------------------------
 		void* Query(const char* aIdentifier);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Release:
-		/// 	Decrements the refcount of the function with the given identifier.
+		/// 	Decrements the refcount of the function with the given identifier. Lock-free.
 		///----------------------------------------------------------------------------------------------------
 		void Release(const char* aIdentifier);
 
+		///----------------------------------------------------------------------------------------------------
+		/// QueryHandle:
+		/// 	Same as Query, but lock-free.
+		///----------------------------------------------------------------------------------------------------
+		void* QueryHandle(uint32_t aHandle);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ReleaseHandle:
+		/// 	Same as Release, but lock-free.
+		///----------------------------------------------------------------------------------------------------
+		void ReleaseHandle(uint32_t aHandle);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CleanupRefs:
+		/// 	Deregisters all functions within the provided address space.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t CleanupRefs(void* aStartAddress, void* aEndAddress) override;
+
 		private:
 		LogApi& Logger;
 
 		std::mutex                                   Mutex;
-		std::unordered_map<std::string, FuncEntry_t> Registry;
+		std::array<std::atomic<FuncHandle_t*>, FN_HANDLE_BUCKETS> Buckets{};
+		std::vector<std::unique_ptr<FuncHandle_t>>   Identifiers; /* By handle - 1. */
+		std::vector<std::unique_ptr<FuncEntry_t>>    Entries;
+		std::atomic<FuncTable_t*>                    Table{ nullptr };
+		std::vector<std::unique_ptr<FuncTable_t>>    Tables;      /* Replaced tables stay alive for readers. */
+		Memory::OwnerIndex<uint32_t>                 Owners;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Retire:
+		/// 	Stops handing out new references to an entry and deletes it once it is unreferenced.
+		/// 	Sets aOutDeleted, if the entry was deleted right away.
+		/// 	Returns false, if the entry was not registered or already flagged.
+		///----------------------------------------------------------------------------------------------------
+		bool Retire(FuncEntry_t* aEntry, bool& aOutDeleted);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the handle of an interned identifier or FN_INVALID_HANDLE. Lock-free.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Find(const char* aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Intern:
+		/// 	Returns the handle of an identifier, appending a new entry if needed.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Intern(const std::string& aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetEntry:
+		/// 	Resolves a handle. Lock-free.
+		///----------------------------------------------------------------------------------------------------
+		FuncEntry_t* GetEntry(uint32_t aHandle) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetIdentifier:
+		/// 	Returns the identifier of a handle, for logging.
+		///----------------------------------------------------------------------------------------------------
+		std::string GetIdentifier(uint32_t aHandle);
 	};
 }
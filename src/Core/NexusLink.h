@@ -10,7 +10,8 @@
 
 #include <cstdint>
 
-constexpr const char* DL_NEXUS_LINK = "DL_NEXUS_LINK";
+constexpr const char* DL_NEXUS_LINK           = "DL_NEXUS_LINK";
+constexpr const char* DL_NEXUS_LINK_VERSIONED = "DL_NEXUS_LINK_VERSIONED"; /* Double-buffered copy, see VersionedHeader_t. */
 
 ///----------------------------------------------------------------------------------------------------
 /// NexusLinkData_t Struct
@@ -32,3 +32,9 @@ constexpr const char* OPT_CAMCTRL_LOCKCURSOR       = "CameraControl_LockCursor";
 constexpr const char* OPT_CAMCTRL_RESETCURSOR      = "CameraControl_ResetCursor";
 constexpr const char* OPT_UI_CLICK_MODSONLY        = "UI_ClickingRequiresModifiers";
 constexpr const char* OPT_UI_MODS                  = "UI_Modifiers";
+constexpr const char* OPT_UI_IDLEFRAMES            = "UI_SkipIdleFrames";
+constexpr const char* OPT_TEXTUREATLAS             = "TextureAtlas";
+constexpr const char* OPT_TEXTUREBUDGET            = "TextureBudgetMB";
+constexpr const char* OPT_RENDERBUDGET             = "RenderBudgetMs";
+constexpr const char* OPT_RENDERTHROTTLE           = "RenderThrottleInterval";
+constexpr const char* OPT_LOADER_SHADOWCOPY        = "Loader_ShadowCopy";
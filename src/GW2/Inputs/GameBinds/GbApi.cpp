@@ -105,6 +105,17 @@ namespace Raidcore::Nexus::GW2
 		: RawInputApi(aRawInputApi)
 		, Logger(aLogger)
 		, EventApi(aEventApi)
+		, Sequencer([this](EGameBinds aGameBind, EGameBindAction aAction)
+		{
+			if (aAction == EGameBindAction::Press)
+			{
+				this->Press(aGameBind);
+			}
+			else
+			{
+				this->Release(aGameBind);
+			}
+		})
 	{
 		this->ConfigPath = aConfigPath;
 
@@ -160,15 +171,22 @@ namespace Raidcore::Nexus::GW2
 
 	void GameBindsApi::InvokeAsync(EGameBinds aGameBind, int aDuration)
 	{
-		Clockwork::Run<void>(Raidcore::Clockwork::ETaskPriority::Low, [this, aGameBind, aDuration](Clockwork::CancellationToken aToken)
-		{
-			this->Press(aGameBind);
-			if (aDuration > 0)
-			{
-				Sleep(aDuration);
-			}
-			this->Release(aGameBind);
-		});
+		GameBindStep_t steps[2] = {
+			{ aGameBind, EGameBindAction::Press,   0 },
+			{ aGameBind, EGameBindAction::Release, aDuration > 0 ? static_cast<uint32_t>(aDuration) : 0 }
+		};
+
+		this->Sequencer.Submit(steps, 2);
+	}
+
+	uint64_t GameBindsApi::SubmitSequence(const GameBindStep_t* aSteps, size_t aCount)
+	{
+		return this->Sequencer.Submit(aSteps, aCount);
+	}
+
+	bool GameBindsApi::CancelSequence(uint64_t aSequenceID)
+	{
+		return this->Sequencer.Cancel(aSequenceID);
 	}
 
 	void GameBindsApi::Press(EGameBinds aGameBind)
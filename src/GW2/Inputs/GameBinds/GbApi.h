@@ -14,6 +14,8 @@
 
 #include "Core/Logging/LogApi.h"
 #include "GbEnum.h"
+#include "GbSequence.h"
+#include "GbSequencer.h"
 #include "Host/Events/EvtApi.h"
 #include "Inputs/InputBinds/IbBindV2.h"
 #include "Platform/RawInput/RiApi.h"
@@ -99,6 +101,20 @@ namespace Raidcore::Nexus::GW2
 		///----------------------------------------------------------------------------------------------------
 		void InvokeAsync(EGameBinds aGameBind, int aDuration);
 
+		///----------------------------------------------------------------------------------------------------
+		/// SubmitSequence:
+		/// 	Schedules a sequence of press and release steps.
+		/// 	Returns the sequence ID or 0, if no steps were passed.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t SubmitSequence(const GameBindStep_t* aSteps, size_t aCount);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CancelSequence:
+		/// 	Cancels a sequence and releases the game binds it still holds.
+		/// 	Returns false, if the sequence already finished.
+		///----------------------------------------------------------------------------------------------------
+		bool CancelSequence(uint64_t aSequenceID);
+
 		///----------------------------------------------------------------------------------------------------
 		/// Press:
 		/// 	Presses the keys of a game bind.
@@ -158,6 +174,8 @@ namespace Raidcore::Nexus::GW2
 		mutable std::mutex                               Mutex;
 		std::unordered_map<EGameBinds, MultiInputBind_t> Registry;
 
+		GameBindSequencer                                Sequencer;
+
 		///----------------------------------------------------------------------------------------------------
 		/// AddDefaultBinds:
 		/// 	Adds the default binds, if they don't already exist.
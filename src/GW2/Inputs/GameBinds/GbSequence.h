@@ -0,0 +1,38 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbSequence.h
+/// Description  :  Game bind sequence step definition.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "GbEnum.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EGameBindAction Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EGameBindAction : uint32_t
+	{
+		Press,
+		Release
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// GameBindStep_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct GameBindStep_t
+	{
+		EGameBinds      GameBind;
+		EGameBindAction Action;
+		uint32_t        DelayMs;  /* Wait time after the previous step, or after submission for the first. */
+	};
+}
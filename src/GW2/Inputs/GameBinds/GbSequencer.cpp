@@ -0,0 +1,244 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbSequencer.cpp
+/// Description  :  Non-blocking scheduler for game bind press and release sequences.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "GbSequencer.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::GW2
+{
+	GameBindSequencer::GameBindSequencer(SINK aSink)
+		: Sink(aSink)
+	{
+		this->Epoch = std::chrono::steady_clock::now();
+
+		this->IsRunning = true;
+		this->ProcThread = std::thread(&GameBindSequencer::ProcessorLoop, this);
+	}
+
+	GameBindSequencer::~GameBindSequencer()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			this->IsRunning = false;
+
+			for (auto& [id, sequence] : this->Sequences)
+			{
+				this->ReleaseHeld(sequence);
+			}
+
+			this->Sequences.clear();
+		}
+
+		this->ConVar.notify_all();
+
+		if (this->ProcThread.joinable())
+		{
+			this->ProcThread.join();
+		}
+	}
+
+	uint64_t GameBindSequencer::Submit(const GameBindStep_t* aSteps, size_t aCount)
+	{
+		if (!aSteps || aCount == 0) { return 0; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!this->IsRunning) { return 0; }
+
+		uint64_t now = this->GetTick();
+
+		/* The wheel only advances while something is pending, catch it up so it does not replay the idle time. */
+		if (this->Wheel.Count() == 0)
+		{
+			std::vector<TimerWheelEntry_t> none;
+			this->Wheel.Advance(now, none);
+		}
+
+		uint64_t id = this->NextID++;
+
+		Sequence_t& sequence = this->Sequences[id];
+		sequence.Steps.assign(aSteps, aSteps + aCount);
+		sequence.Next = 0;
+		sequence.DueTick = now + aSteps[0].DelayMs;
+
+		this->Wheel.Schedule(sequence.DueTick, id);
+		this->ConVar.notify_one();
+
+		return id;
+	}
+
+	bool GameBindSequencer::Cancel(uint64_t aSequenceID)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Sequences.find(aSequenceID);
+
+		if (it == this->Sequences.end()) { return false; }
+
+		/* The pending wheel entry stays, it is discarded once it expires. */
+		this->ReleaseHeld(it->second);
+		this->Sequences.erase(it);
+
+		return true;
+	}
+
+	size_t GameBindSequencer::Count() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Sequences.size();
+	}
+
+	uint64_t GameBindSequencer::GetMaxLatenessMs() const
+	{
+		return this->MaxLateness;
+	}
+
+	uint64_t GameBindSequencer::GetTick() const
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->Epoch).count();
+	}
+
+	void GameBindSequencer::ProcessorLoop()
+	{
+		std::vector<TimerWheelEntry_t> expired;
+
+		while (true)
+		{
+			std::unique_lock<std::mutex> lock(this->Mutex);
+
+			if (this->Wheel.Count() == 0)
+			{
+				this->ConVar.wait(lock, [this]
+				{
+					return !this->IsRunning || this->Wheel.Count() > 0;
+				});
+			}
+			else
+			{
+				/* Until the earliest pending step. Woken early by submissions. */
+				uint64_t next = this->Wheel.GetNextDueTick();
+
+				if (next > this->GetTick())
+				{
+					this->ConVar.wait_until(lock, this->Epoch + std::chrono::milliseconds(next));
+				}
+			}
+
+			if (!this->IsRunning) { break; }
+
+			uint64_t now = this->GetTick();
+
+			expired.clear();
+			this->Wheel.Advance(now, expired);
+
+			for (const TimerWheelEntry_t& entry : expired)
+			{
+				uint64_t lateness = now - entry.DueTick;
+
+				if (lateness > this->MaxLateness)
+				{
+					this->MaxLateness = lateness;
+				}
+
+				this->Step(entry.Payload, now);
+			}
+		}
+	}
+
+	void GameBindSequencer::Step(uint64_t aSequenceID, uint64_t aNowTick)
+	{
+		auto it = this->Sequences.find(aSequenceID);
+
+		/* Cancelled. */
+		if (it == this->Sequences.end()) { return; }
+
+		Sequence_t& sequence = it->second;
+
+		while (true)
+		{
+			const GameBindStep_t& step = sequence.Steps[sequence.Next];
+
+			auto held = std::find(sequence.Held.begin(), sequence.Held.end(), step.GameBind);
+
+			switch (step.Action)
+			{
+				case EGameBindAction::Press:
+				{
+					/* Already held by this sequence. */
+					if (held != sequence.Held.end()) { break; }
+
+					sequence.Held.push_back(step.GameBind);
+
+					if (this->HoldCount[step.GameBind]++ == 0)
+					{
+						this->Sink(step.GameBind, EGameBindAction::Press);
+					}
+					break;
+				}
+				case EGameBindAction::Release:
+				{
+					if (held != sequence.Held.end())
+					{
+						sequence.Held.erase(held);
+
+						if (--this->HoldCount[step.GameBind] == 0)
+						{
+							this->HoldCount.erase(step.GameBind);
+							this->Sink(step.GameBind, EGameBindAction::Release);
+						}
+					}
+					else if (this->HoldCount.find(step.GameBind) == this->HoldCount.end())
+					{
+						/* Not held by any sequence, release whatever pressed it outside of the sequencer. */
+						this->Sink(step.GameBind, EGameBindAction::Release);
+					}
+					break;
+				}
+			}
+
+			sequence.Next++;
+
+			if (sequence.Next >= sequence.Steps.size())
+			{
+				/* A finished sequence never leaves keys held. */
+				this->ReleaseHeld(sequence);
+				this->Sequences.erase(it);
+				return;
+			}
+
+			sequence.DueTick += sequence.Steps[sequence.Next].DelayMs;
+
+			/* Next step is already due, e.g. zero delay or catching up. Keeps the steps in order. */
+			if (sequence.DueTick <= aNowTick) { continue; }
+
+			this->Wheel.Schedule(sequence.DueTick, aSequenceID);
+			return;
+		}
+	}
+
+	void GameBindSequencer::ReleaseHeld(Sequence_t& aSequence)
+	{
+		for (EGameBinds gameBind : aSequence.Held)
+		{
+			auto it = this->HoldCount.find(gameBind);
+
+			if (it == this->HoldCount.end()) { continue; }
+
+			if (--it->second == 0)
+			{
+				this->HoldCount.erase(it);
+				this->Sink(gameBind, EGameBindAction::Release);
+			}
+		}
+
+		aSequence.Held.clear();
+	}
+}
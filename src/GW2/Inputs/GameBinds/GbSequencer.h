@@ -0,0 +1,136 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbSequencer.h
+/// Description  :  Non-blocking scheduler for game bind press and release sequences.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "GbEnum.h"
+#include "GbSequence.h"
+#include "GbTimerWheel.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// GameBindSequencer Class
+	/// 	Runs all sequences on a single timer thread, no thread is blocked for the duration of a hold.
+	/// 	Holds are reference counted per game bind, overlapping sequences only send the outermost
+	/// 	press and release, so one sequence can not cut short the hold of another.
+	///----------------------------------------------------------------------------------------------------
+	class GameBindSequencer
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Receives the actual press and release. Invoked with the sequencer locked to keep the order,
+		/// 	it must not call back into the sequencer.
+		///----------------------------------------------------------------------------------------------------
+		using SINK = std::function<void(EGameBinds aGameBind, EGameBindAction aAction)>;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		GameBindSequencer(SINK aSink);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		/// 	Cancels all pending sequences.
+		///----------------------------------------------------------------------------------------------------
+		~GameBindSequencer();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Submit:
+		/// 	Schedules a sequence of steps. The steps are copied.
+		/// 	Returns the sequence ID or 0, if no steps were passed.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t Submit(const GameBindStep_t* aSteps, size_t aCount);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Cancel:
+		/// 	Cancels a sequence and releases the game binds it still holds.
+		/// 	Returns false, if the sequence already finished.
+		///----------------------------------------------------------------------------------------------------
+		bool Cancel(uint64_t aSequenceID);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Count:
+		/// 	Returns the amount of unfinished sequences.
+		///----------------------------------------------------------------------------------------------------
+		size_t Count() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetMaxLatenessMs:
+		/// 	Returns the largest delay between a step's due time and its execution.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetMaxLatenessMs() const;
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Sequence_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Sequence_t
+		{
+			std::vector<GameBindStep_t> Steps;
+			size_t                      Next;
+			uint64_t                    DueTick;
+			std::vector<EGameBinds>     Held;
+		};
+
+		SINK                                     Sink;
+
+		std::chrono::steady_clock::time_point    Epoch;
+
+		mutable std::mutex                       Mutex;
+		std::condition_variable                  ConVar;
+		std::thread                              ProcThread;
+		bool                                     IsRunning  = false;
+
+		TimerWheel                               Wheel;
+		uint64_t                                 NextID     = 1;
+		std::unordered_map<uint64_t, Sequence_t> Sequences;
+		std::unordered_map<EGameBinds, uint32_t> HoldCount;
+
+		std::atomic<uint64_t>                    MaxLateness = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetTick:
+		/// 	Returns the milliseconds since construction.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetTick() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ProcessorLoop:
+		/// 	Advances the wheel and executes due steps.
+		///----------------------------------------------------------------------------------------------------
+		void ProcessorLoop();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Step:
+		/// 	Executes the due steps of a sequence and reschedules it or finishes it.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Step(uint64_t aSequenceID, uint64_t aNowTick);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ReleaseHeld:
+		/// 	Drops all holds of a sequence and releases binds no other sequence holds.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void ReleaseHeld(Sequence_t& aSequence);
+	};
+}
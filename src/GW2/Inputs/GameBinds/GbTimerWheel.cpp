@@ -0,0 +1,153 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbTimerWheel.cpp
+/// Description  :  Hierarchical timer wheel with millisecond ticks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "GbTimerWheel.h"
+
+namespace Raidcore::Nexus::GW2
+{
+	TimerWheel::TimerWheel(uint64_t aStartTick)
+	{
+		this->CurrentTick = aStartTick;
+	}
+
+	void TimerWheel::Schedule(uint64_t aDueTick, uint64_t aPayload)
+	{
+		this->Pending++;
+
+		if (aDueTick <= this->CurrentTick)
+		{
+			this->Overdue.push_back(TimerWheelEntry_t{ aDueTick, aPayload });
+			return;
+		}
+
+		this->Insert(TimerWheelEntry_t{ aDueTick, aPayload });
+	}
+
+	void TimerWheel::Advance(uint64_t aNowTick, std::vector<TimerWheelEntry_t>& aExpired)
+	{
+		if (!this->Overdue.empty())
+		{
+			aExpired.insert(aExpired.end(), this->Overdue.begin(), this->Overdue.end());
+			this->Pending -= this->Overdue.size();
+			this->Overdue.clear();
+		}
+
+		while (this->CurrentTick < aNowTick)
+		{
+			/* Nothing left to expire, skip ahead. */
+			if (this->Pending == 0)
+			{
+				this->CurrentTick = aNowTick;
+				break;
+			}
+
+			this->CurrentTick++;
+
+			/* Find the highest level that wrapped with this tick and cascade top-down. */
+			uint32_t wrapped = 0;
+			while (wrapped + 1 < TIMERWHEEL_LEVELS &&
+				(this->CurrentTick & ((1ull << ((wrapped + 1) * TIMERWHEEL_SLOT_BITS)) - 1)) == 0)
+			{
+				wrapped++;
+			}
+
+			for (uint32_t level = wrapped; level > 0; level--)
+			{
+				this->Cascade(level);
+			}
+
+			std::vector<TimerWheelEntry_t>& slot = this->Slots[0][this->CurrentTick & (TIMERWHEEL_SLOTS - 1)];
+
+			if (!slot.empty())
+			{
+				aExpired.insert(aExpired.end(), slot.begin(), slot.end());
+				this->Pending -= slot.size();
+				slot.clear();
+			}
+		}
+	}
+
+	uint64_t TimerWheel::GetCurrentTick() const
+	{
+		return this->CurrentTick;
+	}
+
+	uint64_t TimerWheel::GetNextDueTick() const
+	{
+		if (!this->Overdue.empty()) { return this->CurrentTick; }
+
+		uint64_t next = UINT64_MAX;
+
+		if (this->Pending == 0) { return next; }
+
+		/* The slots of a level cover ascending ranges starting after the current one, the first occupied one
+		 * holds the earliest entries of that level. Parked entries beyond the range only overestimate, the
+		 * wheel catches up on cascades when it is advanced. */
+		for (uint32_t level = 0; level < TIMERWHEEL_LEVELS; level++)
+		{
+			uint64_t current = this->CurrentTick >> (level * TIMERWHEEL_SLOT_BITS);
+
+			for (uint32_t i = 1; i <= TIMERWHEEL_SLOTS; i++)
+			{
+				const std::vector<TimerWheelEntry_t>& slot = this->Slots[level][(current + i) & (TIMERWHEEL_SLOTS - 1)];
+
+				if (slot.empty()) { continue; }
+
+				for (const TimerWheelEntry_t& entry : slot)
+				{
+					if (entry.DueTick < next)
+					{
+						next = entry.DueTick;
+					}
+				}
+
+				break;
+			}
+		}
+
+		return next;
+	}
+
+	size_t TimerWheel::Count() const
+	{
+		return this->Pending;
+	}
+
+	void TimerWheel::Insert(const TimerWheelEntry_t& aEntry)
+	{
+		uint64_t delta = aEntry.DueTick - this->CurrentTick;
+
+		for (uint32_t level = 0; level < TIMERWHEEL_LEVELS; level++)
+		{
+			if (delta < (1ull << ((level + 1) * TIMERWHEEL_SLOT_BITS)))
+			{
+				uint64_t idx = (aEntry.DueTick >> (level * TIMERWHEEL_SLOT_BITS)) & (TIMERWHEEL_SLOTS - 1);
+				this->Slots[level][idx].push_back(aEntry);
+				return;
+			}
+		}
+
+		/* Beyond the range, park it in the furthest top level slot. It is re-inserted when that slot cascades. */
+		uint64_t furthest = this->CurrentTick + TIMERWHEEL_RANGE - 1;
+		uint64_t idx = (furthest >> ((TIMERWHEEL_LEVELS - 1) * TIMERWHEEL_SLOT_BITS)) & (TIMERWHEEL_SLOTS - 1);
+		this->Slots[TIMERWHEEL_LEVELS - 1][idx].push_back(aEntry);
+	}
+
+	void TimerWheel::Cascade(uint32_t aLevel)
+	{
+		uint64_t idx = (this->CurrentTick >> (aLevel * TIMERWHEEL_SLOT_BITS)) & (TIMERWHEEL_SLOTS - 1);
+
+		std::vector<TimerWheelEntry_t> entries;
+		entries.swap(this->Slots[aLevel][idx]);
+
+		for (const TimerWheelEntry_t& entry : entries)
+		{
+			this->Insert(entry);
+		}
+	}
+}
@@ -0,0 +1,108 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbTimerWheel.h
+/// Description  :  Hierarchical timer wheel with millisecond ticks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr const uint32_t TIMERWHEEL_LEVELS    = 4;
+constexpr const uint32_t TIMERWHEEL_SLOT_BITS = 6;
+constexpr const uint32_t TIMERWHEEL_SLOTS     = 1 << TIMERWHEEL_SLOT_BITS;
+
+/* Ticks covered by all levels, ~4.6 hours at 1 ms. Timers further out are clamped and re-cascaded. */
+constexpr const uint64_t TIMERWHEEL_RANGE     = 1ull << (TIMERWHEEL_LEVELS * TIMERWHEEL_SLOT_BITS);
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// TimerWheelEntry_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct TimerWheelEntry_t
+	{
+		uint64_t DueTick;
+		uint64_t Payload;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// TimerWheel Class
+	/// 	Scheduling and expiring are O(1) amortized, independent of the amount of pending timers.
+	/// 	Not thread-safe, the owner has to synchronize access.
+	///----------------------------------------------------------------------------------------------------
+	class TimerWheel
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		TimerWheel(uint64_t aStartTick = 0);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~TimerWheel() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Schedule:
+		/// 	Schedules a payload to expire at the given tick.
+		/// 	Ticks that already passed expire on the next advance.
+		///----------------------------------------------------------------------------------------------------
+		void Schedule(uint64_t aDueTick, uint64_t aPayload);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Advance:
+		/// 	Advances the wheel up to and including the given tick.
+		/// 	Appends the expired entries to aExpired in due order.
+		///----------------------------------------------------------------------------------------------------
+		void Advance(uint64_t aNowTick, std::vector<TimerWheelEntry_t>& aExpired);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCurrentTick:
+		/// 	Returns the tick the wheel was last advanced to.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetCurrentTick() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetNextDueTick:
+		/// 	Returns the due tick of the earliest pending entry, or UINT64_MAX if none is pending.
+		/// 	Overdue entries return the current tick.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetNextDueTick() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Count:
+		/// 	Returns the amount of pending entries.
+		///----------------------------------------------------------------------------------------------------
+		size_t Count() const;
+
+		private:
+		uint64_t                       CurrentTick;
+		size_t                         Pending = 0;
+
+		std::vector<TimerWheelEntry_t> Slots[TIMERWHEEL_LEVELS][TIMERWHEEL_SLOTS];
+
+		/* Entries that were due when they were scheduled. */
+		std::vector<TimerWheelEntry_t> Overdue;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Insert:
+		/// 	Places an entry in the level matching its distance to the current tick.
+		///----------------------------------------------------------------------------------------------------
+		void Insert(const TimerWheelEntry_t& aEntry);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Cascade:
+		/// 	Redistributes the current slot of a level into the lower levels.
+		///----------------------------------------------------------------------------------------------------
+		void Cascade(uint32_t aLevel);
+	};
+}
@@ -0,0 +1,111 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDelta.cpp
+/// Description  :  Delta encoding of MumbleLink recording snapshots.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "MblDelta.h"
+
+#include <cstring>
+
+namespace Raidcore::Nexus::GW2::MumbleDelta
+{
+	/* Unchanged gaps shorter than this are folded into the surrounding literal, as a new token would cost more. */
+	constexpr const size_t MIN_SKIP = 4;
+
+	static void WriteVarint(std::vector<uint8_t>& aOut, size_t aValue)
+	{
+		while (aValue >= 0x80)
+		{
+			aOut.push_back(static_cast<uint8_t>(aValue | 0x80));
+			aValue >>= 7;
+		}
+
+		aOut.push_back(static_cast<uint8_t>(aValue));
+	}
+
+	static bool ReadVarint(const uint8_t*& aCursor, const uint8_t* aEnd, size_t& aValue)
+	{
+		aValue = 0;
+
+		for (size_t shift = 0; aCursor < aEnd && shift < sizeof(size_t) * 8; shift += 7)
+		{
+			uint8_t byte = *aCursor++;
+			aValue |= static_cast<size_t>(byte & 0x7F) << shift;
+
+			if (!(byte & 0x80))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static inline uint8_t At(const uint8_t* aBuffer, size_t aIndex)
+	{
+		return aBuffer ? aBuffer[aIndex] : 0;
+	}
+
+	bool Encode(const uint8_t* aPrevious, const uint8_t* aCurrent, size_t aSize, std::vector<uint8_t>& aOut)
+	{
+		aOut.clear();
+
+		size_t pos = 0;
+
+		while (pos < aSize)
+		{
+			/* Find the start of the next changed range. */
+			size_t start = pos;
+			while (start < aSize && At(aPrevious, start) == aCurrent[start]) { start++; }
+
+			if (start == aSize) { break; }
+
+			/* Extend the range until a long enough unchanged gap follows. */
+			size_t end = start + 1;
+			size_t gap = 0;
+			while (end < aSize && gap < MIN_SKIP)
+			{
+				gap = At(aPrevious, end) == aCurrent[end] ? gap + 1 : 0;
+				end++;
+			}
+			end -= gap;
+
+			WriteVarint(aOut, start - pos);
+			WriteVarint(aOut, end - start);
+			aOut.insert(aOut.end(), aCurrent + start, aCurrent + end);
+
+			pos = end;
+		}
+
+		return !aOut.empty();
+	}
+
+	bool Decode(const uint8_t* aEncoded, size_t aEncodedSize, uint8_t* aBuffer, size_t aSize)
+	{
+		const uint8_t* cursor = aEncoded;
+		const uint8_t* end = aEncoded + aEncodedSize;
+
+		size_t pos = 0;
+
+		while (cursor < end)
+		{
+			size_t skip = 0;
+			size_t length = 0;
+
+			if (!ReadVarint(cursor, end, skip))                  { return false; }
+			if (!ReadVarint(cursor, end, length))                { return false; }
+			if (skip > aSize - pos || length > aSize - pos - skip) { return false; }
+			if (length > static_cast<size_t>(end - cursor))      { return false; }
+
+			pos += skip;
+			std::memcpy(aBuffer + pos, cursor, length);
+			pos += length;
+			cursor += length;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,42 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDelta.h
+/// Description  :  Delta encoding of MumbleLink recording snapshots.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// MumbleDelta Namespace
+	/// 	Run-length delta coding of snapshots.
+	/// 	A payload is a sequence of [varint skip][varint length][length bytes].
+	///----------------------------------------------------------------------------------------------------
+	namespace MumbleDelta
+	{
+		///----------------------------------------------------------------------------------------------------
+		/// Encode:
+		/// 	Encodes the bytes of aCurrent that differ from aPrevious into aOut.
+		/// 	If aPrevious is nullptr, the snapshot is encoded against zeroes.
+		/// 	Returns false if both buffers are identical and nothing was written.
+		///----------------------------------------------------------------------------------------------------
+		bool Encode(const uint8_t* aPrevious, const uint8_t* aCurrent, size_t aSize, std::vector<uint8_t>& aOut);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Decode:
+		/// 	Applies an encoded payload on top of aBuffer in place.
+		/// 	Returns false if the payload is malformed or exceeds the buffer.
+		///----------------------------------------------------------------------------------------------------
+		bool Decode(const uint8_t* aEncoded, size_t aEncodedSize, uint8_t* aBuffer, size_t aSize);
+	}
+}
@@ -0,0 +1,57 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDerived.cpp
+/// Description  :  States derived from consecutive MumbleLink samples.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "MblDerived.h"
+
+#include <cmath>
+
+namespace Raidcore::Nexus::GW2
+{
+	/* Same precision as the Mumble::Vector3 comparison, jitter below a thousandth is not movement. */
+	static bool IsSame(const float aLeft[3], const float aRight[3])
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			if (std::trunc(1000. * aLeft[i]) != std::trunc(1000. * aRight[i])) { return false; }
+		}
+
+		return true;
+	}
+
+	uint32_t DerivedTracker::Advance(const DerivedSample_t& aSample)
+	{
+		bool wasGameplay = (this->State & static_cast<uint32_t>(EDerivedState::IsGameplay)) != 0;
+		bool tickChanged = this->Previous.UITick != aSample.UITick;
+		bool gameFrozen = this->Previous.FrameCount == aSample.FrameCount;
+
+		uint32_t state = 0;
+
+		/* Either the ui is ticking or the ui *was* ticking and the game is frozen. */
+		if (tickChanged || (gameFrozen && wasGameplay))                    { state |= static_cast<uint32_t>(EDerivedState::IsGameplay); }
+		if (!IsSame(this->Previous.AvatarPosition, aSample.AvatarPosition)) { state |= static_cast<uint32_t>(EDerivedState::IsMoving); }
+		if (!IsSame(this->Previous.CameraFront, aSample.CameraFront))       { state |= static_cast<uint32_t>(EDerivedState::IsCameraMoving); }
+
+		this->State = state;
+		this->Previous = aSample;
+
+		return state;
+	}
+
+	uint32_t DerivedTracker::Get() const
+	{
+		return this->State;
+	}
+
+	uint64_t InterpolateFrameCount(uint64_t aFromMs, uint64_t aFromCount, uint64_t aToMs, uint64_t aToCount, uint64_t aAtMs)
+	{
+		if (aAtMs <= aFromMs || aToMs <= aFromMs || aToCount < aFromCount) { return aFromCount; }
+		if (aAtMs >= aToMs)                                                { return aToCount; }
+
+		return aFromCount + (aToCount - aFromCount) * (aAtMs - aFromMs) / (aToMs - aFromMs);
+	}
+}
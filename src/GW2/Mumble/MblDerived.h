@@ -0,0 +1,70 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDerived.h
+/// Description  :  States derived from consecutive MumbleLink samples.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EDerivedState Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EDerivedState : uint32_t
+	{
+		IsGameplay     = 1 << 0,
+		IsMoving       = 1 << 1,
+		IsCameraMoving = 1 << 2
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// DerivedSample_t Struct
+	/// 	The MumbleLink fields the derived states depend on.
+	///----------------------------------------------------------------------------------------------------
+	struct DerivedSample_t
+	{
+		uint32_t UITick;
+		float    AvatarPosition[3];
+		float    CameraFront[3];
+		uint64_t FrameCount;        /* Render frames at the time of the sample. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// DerivedTracker Class
+	/// 	Derives gameplay, movement and camera movement from the previous sample.
+	///----------------------------------------------------------------------------------------------------
+	class DerivedTracker
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Advance:
+		/// 	Compares the sample to the previous one and returns the derived states, see EDerivedState.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Advance(const DerivedSample_t& aSample);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Get:
+		/// 	Returns the states of the last advance.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Get() const;
+
+		private:
+		uint32_t        State    = 0;
+		DerivedSample_t Previous = {};
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// InterpolateFrameCount:
+	/// 	Returns the frame count at aAtMs between two recorded snapshots.
+	/// 	Unchanged snapshots are not recorded, so frames rendered during a gap are spread across it.
+	///----------------------------------------------------------------------------------------------------
+	uint64_t InterpolateFrameCount(uint64_t aFromMs, uint64_t aFromCount, uint64_t aToMs, uint64_t aToCount, uint64_t aAtMs);
+}
@@ -8,6 +8,8 @@
 
 #include "MblReader.h"
 
+#include <cstring>
+
 #include "thirdparty/Clockwork/Clockwork.h"
 namespace Clockwork = Raidcore::Clockwork;
 
@@ -21,6 +23,7 @@ using namespace Mumble;
 #include "Runtime/Runtime.h"
 using namespace Raidcore::Nexus;
 
+#include "Index/Index.h"
 #include "Util/CmdLine.h"
 #include "MblExtensions.h"
 
@@ -40,26 +43,88 @@ namespace Raidcore::Nexus::GW2
 			this->Name = "MumbleLink";
 		}
 
+		bool isReplay = CmdLine::HasArgument("-mumblereplay");
+
+		/* A replay writes into its own region, so the live link of the game does not interfere. */
+		std::string underlyingName = isReplay ? this->Name + "_Replay" : this->Name;
+
 		/* share the linked mem regardless whether it's disabled, for dependant addons */
-		this->MumbleLink = (Mumble::Data*)this->DataLinkApi.Share(DL_MUMBLE_LINK, sizeof(Mumble::Data), this->Name.c_str(), true);
+		this->MumbleLink = (Mumble::Data*)this->DataLinkApi.Share(DL_MUMBLE_LINK, sizeof(Mumble::Data), underlyingName.c_str(), true);
 		this->MumbleIdentity = (Mumble::Identity*)this->DataLinkApi.Share(DL_MUMBLE_LINK_IDENTITY, sizeof(Mumble::Identity), "", false);
 		this->NexusLink = (NexusLinkData_t*)this->DataLinkApi.Share(DL_NEXUS_LINK, sizeof(NexusLinkData_t), "", true);
 
-		if (this->Name != "0")
+		/* versioned copies, for readers on other threads that must not observe a half-written update */
+		this->VersionedIdentity = this->DataLinkApi.ShareVersioned(DL_MUMBLE_LINK_IDENTITY_VERSIONED, sizeof(Mumble::Identity), 2);
+		this->VersionedNexusLink = this->DataLinkApi.ShareVersioned(DL_NEXUS_LINK_VERSIONED, sizeof(NexusLinkData_t), 2);
+
+		if (this->Name == "0") { return; }
+
+		if (isReplay)
 		{
-			Clockwork::Schedule(std::chrono::milliseconds{ 50 }, [this](Clockwork::CancellationToken aToken)
+			float speed = 1.0f;
+
+			if (CmdLine::HasArgument("-mumblereplayspeed"))
 			{
-				this->AdvanceIdentity();
-			});
-			Clockwork::Schedule(std::chrono::milliseconds{ 100 }, [this](Clockwork::CancellationToken aToken)
+				try
+				{
+					speed = std::stof(CmdLine::GetArgumentValue("-mumblereplayspeed"));
+				}
+				catch (...)
+				{
+					this->Logger.Warning(LOG_CHANNEL, "Invalid -mumblereplayspeed. Replaying at original speed.");
+				}
+			}
+
+			this->Replayer = std::make_unique<MumbleReplayer>(
+				this->Logger,
+				CmdLine::GetArgumentValue("-mumblereplay"),
+				this->MumbleLink,
+				speed
+			);
+			this->ReplayThread = std::thread(&MumbleReader::Replay, this);
+			return;
+		}
+
+		Clockwork::Schedule(std::chrono::milliseconds{ 50 }, [this](Clockwork::CancellationToken aToken)
+		{
+			this->AdvanceIdentity();
+		});
+		Clockwork::Schedule(std::chrono::milliseconds{ 100 }, [this](Clockwork::CancellationToken aToken)
+		{
+			this->AdvanceDerived(Runtime::Get().GrMetrics().GetFrameCount());
+		});
+
+		if (CmdLine::HasArgument("-mumblerecord"))
+		{
+			std::filesystem::path path = CmdLine::GetArgumentValue("-mumblerecord");
+
+			if (path.empty())
+			{
+				path = Index(EPath::DIR_NEXUS) / "MumbleLink.nxmr";
+			}
+
+			this->Recorder = std::make_unique<MumbleRecorder>(this->Logger, path);
+
+			/* Capture faster than the game ticks the link, unchanged snapshots are not written. */
+			Clockwork::Schedule(std::chrono::milliseconds{ 10 }, [this](Clockwork::CancellationToken aToken)
 			{
-				this->AdvanceDerived();
+				this->Recorder->Capture(this->MumbleLink, this->NexusLink, Runtime::Get().GrMetrics().GetFrameCount());
 			});
 		}
 	}
 
 	MumbleReader::~MumbleReader()
-	{}
+	{
+		if (this->Replayer)
+		{
+			this->Replayer->Stop();
+		}
+
+		if (this->ReplayThread.joinable())
+		{
+			this->ReplayThread.join();
+		}
+	}
 
 	std::string MumbleReader::GetName()
 	{
@@ -86,8 +151,33 @@ namespace Raidcore::Nexus::GW2
 		return this->NexusLink;
 	}
 
-	void MumbleReader::AdvanceIdentity()
+	void MumbleReader::PublishNexusLink()
 	{
+		if (!this->NexusLink || !this->VersionedNexusLink) { return; }
+
+		/* The derived fields are written on the Mumble thread, do not read them from the live link. */
+		uint32_t derived = this->Derived.load(std::memory_order_acquire);
+
+		NexusLinkData_t* target = (NexusLinkData_t*)Core::BeginWrite(this->VersionedNexusLink);
+		target->Width                 = this->NexusLink->Width;
+		target->Height                = this->NexusLink->Height;
+		target->Scaling               = this->NexusLink->Scaling;
+		target->IsMoving              = (derived & static_cast<uint32_t>(EDerivedState::IsMoving)) != 0;
+		target->IsCameraMoving        = (derived & static_cast<uint32_t>(EDerivedState::IsCameraMoving)) != 0;
+		target->IsGameplay            = (derived & static_cast<uint32_t>(EDerivedState::IsGameplay)) != 0;
+		target->Font                  = this->NexusLink->Font;
+		target->FontBig               = this->NexusLink->FontBig;
+		target->FontUI                = this->NexusLink->FontUI;
+		target->QuickAccessIconsCount = this->NexusLink->QuickAccessIconsCount;
+		target->QuickAccessMode       = this->NexusLink->QuickAccessMode;
+		target->QuickAccessIsVertical = this->NexusLink->QuickAccessIsVertical;
+		Core::EndWrite(this->VersionedNexusLink);
+	}
+
+	bool MumbleReader::AdvanceIdentity()
+	{
+		bool changed = false;
+
 		if (this->MumbleLink->Identity[0])
 		{
 			/* cache identity */
@@ -126,29 +216,105 @@ namespace Raidcore::Nexus::GW2
 			/* notify (also notifies the GUI to update its scaling factor) */
 			if (*this->MumbleIdentity != this->PreviousIdentity)
 			{
+				if (this->VersionedIdentity)
+				{
+					std::memcpy(Core::BeginWrite(this->VersionedIdentity), this->MumbleIdentity, sizeof(Mumble::Identity));
+					Core::EndWrite(this->VersionedIdentity);
+				}
+
 				this->EventApi.Raise(EV_MUMBLE_IDENTITY_UPDATED, this->MumbleIdentity);
+				changed = true;
 			}
 		}
+
+		return changed;
 	}
 
-	void MumbleReader::AdvanceDerived()
+	void MumbleReader::AdvanceDerived(uint64_t aFrameCount)
 	{
-		Runtime& ctx = Runtime::Get();
-		Graphics::Metrics_t& metrics = ctx.GrMetrics();
-
-		bool tickChanged = this->PreviousTick != this->MumbleLink->UITick;
-		bool gameFrozen = this->PreviousFrameCounter == metrics.FrameCount;
+		DerivedSample_t sample{};
+		sample.UITick            = this->MumbleLink->UITick;
+		sample.AvatarPosition[0] = this->MumbleLink->AvatarPosition.X;
+		sample.AvatarPosition[1] = this->MumbleLink->AvatarPosition.Y;
+		sample.AvatarPosition[2] = this->MumbleLink->AvatarPosition.Z;
+		sample.CameraFront[0]    = this->MumbleLink->CameraFront.X;
+		sample.CameraFront[1]    = this->MumbleLink->CameraFront.Y;
+		sample.CameraFront[2]    = this->MumbleLink->CameraFront.Z;
+		sample.FrameCount        = aFrameCount;
 
-		/* Either the ui is ticking or the ui *was* ticking and the game is frozen. */
-		this->NexusLink->IsGameplay = tickChanged || (gameFrozen && this->NexusLink->IsGameplay);
-		this->NexusLink->IsMoving = this->PreviousAvatarPosition != this->MumbleLink->AvatarPosition;
-		this->NexusLink->IsCameraMoving = this->PreviousCameraFront != this->MumbleLink->CameraFront;
+		uint32_t derived = this->Derivation.Advance(sample);
 
-		this->PreviousFrameCounter = metrics.FrameCount;
-		this->PreviousTick = this->MumbleLink->UITick;
-		this->PreviousAvatarPosition = this->MumbleLink->AvatarPosition;
-		this->PreviousCameraFront = this->MumbleLink->CameraFront;
+		this->NexusLink->IsGameplay     = (derived & static_cast<uint32_t>(EDerivedState::IsGameplay)) != 0;
+		this->NexusLink->IsMoving       = (derived & static_cast<uint32_t>(EDerivedState::IsMoving)) != 0;
+		this->NexusLink->IsCameraMoving = (derived & static_cast<uint32_t>(EDerivedState::IsCameraMoving)) != 0;
+		this->Derived.store(derived, std::memory_order_release);
 
 		//this->Logger->Trace(LOG_CHANNEL, "MumbleReader::AdvanceDerived()");
 	}
+
+	void MumbleReader::Replay()
+	{
+		constexpr uint64_t IDENTITY_INTERVAL_MS = 50;
+		constexpr uint64_t DERIVED_INTERVAL_MS = 100;
+
+		uint64_t nextIdentity = 0;
+		uint64_t nextDerived = 0;
+		uint64_t lastTimeMs = 0;
+		uint64_t lastFrameCount = 0;
+
+		uint64_t identityUpdates = 0;
+		uint64_t derivedTicks = 0;
+		uint64_t gameplayChanges = 0;
+		uint64_t movingChanges = 0;
+		uint64_t cameraChanges = 0;
+
+		ReplayStats_t stats = this->Replayer->Run([&](uint64_t aTimeMs, uint64_t aFrameCount)
+		{
+			/* Catch up on the ticks the live schedules would have run until this snapshot, while the link still
+			 * holds the previous one. */
+			for (; nextIdentity < aTimeMs; nextIdentity += IDENTITY_INTERVAL_MS)
+			{
+				if (this->AdvanceIdentity())
+				{
+					identityUpdates++;
+				}
+			}
+
+			for (; nextDerived < aTimeMs; nextDerived += DERIVED_INTERVAL_MS)
+			{
+				NexusLinkData_t prev = *this->NexusLink;
+
+				this->AdvanceDerived(InterpolateFrameCount(lastTimeMs, lastFrameCount, aTimeMs, aFrameCount, nextDerived));
+				derivedTicks++;
+
+				if (prev.IsGameplay != this->NexusLink->IsGameplay)         { gameplayChanges++; }
+				if (prev.IsMoving != this->NexusLink->IsMoving)             { movingChanges++; }
+				if (prev.IsCameraMoving != this->NexusLink->IsCameraMoving) { cameraChanges++; }
+			}
+
+			lastTimeMs = aTimeMs;
+			lastFrameCount = aFrameCount;
+		});
+
+		this->Logger.Info(
+			LOG_CHANNEL,
+			"MumbleLink replay %s.\n"
+			"\tSnapshots: %llu (Keyframes: %llu, Bytes: %llu)\n"
+			"\tRecorded: %llums | Wall: %llums | CPU: %lluus (Reader: %lluus)\n"
+			"\tIdentity updates: %llu | Derived ticks: %llu | Gameplay changes: %llu | Moving changes: %llu | Camera changes: %llu",
+			stats.IsComplete ? "finished" : "aborted",
+			stats.Snapshots,
+			stats.Keyframes,
+			stats.BytesRead,
+			stats.RecordedMs,
+			stats.WallMs,
+			stats.CpuUs,
+			stats.CallbackUs,
+			identityUpdates,
+			derivedTicks,
+			gameplayChanges,
+			movingChanges,
+			cameraChanges
+		);
+	}
 }
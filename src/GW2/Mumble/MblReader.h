@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <thread>
 
 #include "thirdparty/mumble/Mumble.h"
 
@@ -16,9 +20,13 @@
 #include "Core/DataLink/DlApi.h"
 #include "Host/Events/EvtApi.h"
 #include "Core/Logging/LogApi.h"
+#include "MblDerived.h"
+#include "MblRecorder.h"
+#include "MblReplayer.h"
 
 constexpr const char* DL_MUMBLE_LINK = "DL_MUMBLE_LINK";
 constexpr const char* DL_MUMBLE_LINK_IDENTITY = "DL_MUMBLE_LINK_IDENTITY";
+constexpr const char* DL_MUMBLE_LINK_IDENTITY_VERSIONED = "DL_MUMBLE_LINK_IDENTITY_VERSIONED"; /* Double-buffered copy, see VersionedHeader_t. */
 constexpr const char* EV_MUMBLE_IDENTITY_UPDATED = "EV_MUMBLE_IDENTITY_UPDATED";
 
 ///----------------------------------------------------------------------------------------------------
@@ -72,6 +80,13 @@ namespace Raidcore::Nexus::GW2
 		///----------------------------------------------------------------------------------------------------
 		NexusLinkData_t* GetNexusLink() const;
 
+		///----------------------------------------------------------------------------------------------------
+		/// PublishNexusLink:
+		/// 	Publishes the versioned copy of the nexus link. Called on the render thread, which writes all
+		/// 	but the derived fields, those are taken from the last derived tick.
+		///----------------------------------------------------------------------------------------------------
+		void PublishNexusLink();
+
 		private:
 		Core::DataLinkApi& DataLinkApi;
 		Host::EventApi& EventApi;
@@ -82,22 +97,37 @@ namespace Raidcore::Nexus::GW2
 		Mumble::Identity* MumbleIdentity = nullptr;
 		NexusLinkData_t*  NexusLink = nullptr;
 
-		unsigned          PreviousTick = 0;
-		Mumble::Vector3   PreviousAvatarPosition = {};
-		Mumble::Vector3   PreviousCameraFront = {};
+		Core::VersionedHeader_t* VersionedIdentity = nullptr;
+		Core::VersionedHeader_t* VersionedNexusLink = nullptr;
+
 		Mumble::Identity  PreviousIdentity = Mumble::Identity{};
-		long long         PreviousFrameCounter = 0;
+		DerivedTracker    Derivation;
+
+		/* Derived states of the last tick, see EDerivedState. Written together, so they are published consistently. */
+		std::atomic<uint32_t> Derived = 0;
+
+		std::unique_ptr<MumbleRecorder> Recorder;
+		std::unique_ptr<MumbleReplayer> Replayer;
+		std::thread                     ReplayThread;
 
 		///----------------------------------------------------------------------------------------------------
 		/// AdvanceIdentity:
 		/// 	Thread function to parse the mumble identity.
+		/// 	Returns true if the identity changed.
 		///----------------------------------------------------------------------------------------------------
-		void AdvanceIdentity();
+		bool AdvanceIdentity();
 
 		///----------------------------------------------------------------------------------------------------
 		/// AdvanceDerived:
 		/// 	Thread function to update derived states.
 		///----------------------------------------------------------------------------------------------------
-		void AdvanceDerived();
+		void AdvanceDerived(uint64_t aFrameCount);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Replay:
+		/// 	Thread function to feed a recording through the reader.
+		/// 	Identity and derived states advance on the recorded clock, so the result does not depend on the replay speed.
+		///----------------------------------------------------------------------------------------------------
+		void Replay();
 	};
 }
@@ -0,0 +1,116 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblRecorder.cpp
+/// Description  :  Records MumbleLink and NexusLink snapshots to a file.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "MblRecorder.h"
+
+#include <cstring>
+
+namespace Raidcore::Nexus::GW2
+{
+	constexpr const char* LOG_CHANNEL = "Mumble";
+
+	MumbleRecorder::MumbleRecorder(Core::LogApi& aLogger, std::filesystem::path aPath, uint32_t aKeyframeInterval)
+		: Logger(aLogger)
+		, Path(aPath)
+		, KeyframeInterval(aKeyframeInterval > 0 ? aKeyframeInterval : MBLREC_KEYFRAME_INTERVAL)
+	{
+		this->File.open(this->Path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+		if (!this->File.is_open())
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Failed to open MumbleLink recording \"%s\".", this->Path.string().c_str());
+			return;
+		}
+
+		MumbleRecordingHeader_t header{};
+		header.Magic            = MBLREC_MAGIC;
+		header.Version          = MBLREC_VERSION;
+		header.MumbleDataSize   = sizeof(Mumble::Data);
+		header.NexusLinkSize    = sizeof(NexusLinkData_t);
+		header.KeyframeInterval = this->KeyframeInterval;
+
+		this->File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		this->BytesWritten += sizeof(header);
+
+		this->Previous.resize(MBLREC_SNAPSHOT_SIZE);
+		this->Current.resize(MBLREC_SNAPSHOT_SIZE);
+		this->StartTime = std::chrono::steady_clock::now();
+
+		this->Logger.Info(LOG_CHANNEL, "Recording MumbleLink to \"%s\".", this->Path.string().c_str());
+	}
+
+	MumbleRecorder::~MumbleRecorder()
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!this->File.is_open()) { return; }
+
+		this->File.flush();
+		this->File.close();
+
+		this->Logger.Info(
+			LOG_CHANNEL,
+			"MumbleLink recording finished. Snapshots: %llu (unchanged skipped: %llu). Size: %llu bytes (raw: %llu bytes).",
+			this->SnapshotsWritten,
+			this->SnapshotsSkipped,
+			this->BytesWritten,
+			(this->SnapshotsWritten + this->SnapshotsSkipped) * MBLREC_SNAPSHOT_SIZE
+		);
+	}
+
+	bool MumbleRecorder::IsRecording() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->File.is_open();
+	}
+
+	void MumbleRecorder::Capture(const Mumble::Data* aMumbleLink, const NexusLinkData_t* aNexusLink, uint64_t aFrameCount)
+	{
+		if (!aMumbleLink || !aNexusLink) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!this->File.is_open()) { return; }
+
+		std::memcpy(this->Current.data(), aMumbleLink, sizeof(Mumble::Data));
+		std::memcpy(this->Current.data() + sizeof(Mumble::Data), aNexusLink, sizeof(NexusLinkData_t));
+
+		bool isKeyframe = this->SnapshotsWritten % this->KeyframeInterval == 0;
+
+		if (!MumbleDelta::Encode(isKeyframe ? nullptr : this->Previous.data(), this->Current.data(), MBLREC_SNAPSHOT_SIZE, this->Encoded))
+		{
+			/* A keyframe of an all-zero link still has to be written, so the replay has a starting point. */
+			if (!isKeyframe)
+			{
+				this->SnapshotsSkipped++;
+				return;
+			}
+		}
+
+		MumbleSnapshotHeader_t header{};
+		header.TimeOffsetMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->StartTime).count());
+		header.EncodedSize  = static_cast<uint32_t>(this->Encoded.size());
+		header.FrameCount   = aFrameCount;
+		header.Flags        = isKeyframe ? ESnapshotFlags::Keyframe : ESnapshotFlags::None;
+
+		this->File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		this->File.write(reinterpret_cast<const char*>(this->Encoded.data()), this->Encoded.size());
+
+		this->BytesWritten += sizeof(header) + this->Encoded.size();
+		this->SnapshotsWritten++;
+
+		this->Previous.swap(this->Current);
+
+		/* Flush on every keyframe, the process might be killed without destructing. */
+		if (isKeyframe)
+		{
+			this->File.flush();
+		}
+	}
+}
@@ -0,0 +1,75 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblRecorder.h
+/// Description  :  Records MumbleLink and NexusLink snapshots to a file.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "thirdparty/mumble/Mumble.h"
+
+#include "Core/Logging/LogApi.h"
+#include "Core/NexusLink.h"
+#include "MblRecording.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// MumbleRecorder Class
+	///----------------------------------------------------------------------------------------------------
+	class MumbleRecorder
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		MumbleRecorder(Core::LogApi& aLogger, std::filesystem::path aPath, uint32_t aKeyframeInterval = MBLREC_KEYFRAME_INTERVAL);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~MumbleRecorder();
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsRecording:
+		/// 	Returns true if the recording file is open.
+		///----------------------------------------------------------------------------------------------------
+		bool IsRecording() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Capture:
+		/// 	Writes a snapshot of the given data, if it changed since the last capture.
+		///----------------------------------------------------------------------------------------------------
+		void Capture(const Mumble::Data* aMumbleLink, const NexusLinkData_t* aNexusLink, uint64_t aFrameCount);
+
+		private:
+		Core::LogApi&                         Logger;
+
+		std::filesystem::path                 Path;
+		uint32_t                              KeyframeInterval;
+
+		mutable std::mutex                    Mutex;
+		std::ofstream                         File;
+		std::chrono::steady_clock::time_point StartTime;
+
+		std::vector<uint8_t>                  Previous;
+		std::vector<uint8_t>                  Current;
+		std::vector<uint8_t>                  Encoded;
+
+		uint64_t                              SnapshotsWritten = 0;
+		uint64_t                              SnapshotsSkipped = 0;
+		uint64_t                              BytesWritten     = 0;
+	};
+}
@@ -0,0 +1,64 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblRecording.h
+/// Description  :  File format and delta encoding for MumbleLink recordings.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "thirdparty/mumble/Mumble.h"
+
+#include "Core/NexusLink.h"
+#include "MblDelta.h"
+
+constexpr const uint32_t MBLREC_MAGIC             = 0x524D584E; /* "NXMR" */
+constexpr const uint32_t MBLREC_VERSION           = 1;
+constexpr const uint32_t MBLREC_KEYFRAME_INTERVAL = 600;
+
+/* A snapshot is the raw MumbleLink followed by the raw NexusLink. */
+constexpr const size_t   MBLREC_SNAPSHOT_SIZE     = sizeof(Mumble::Data) + sizeof(NexusLinkData_t);
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ESnapshotFlags Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class ESnapshotFlags : uint32_t
+	{
+		None     = 0,
+		Keyframe = 1 << 0 /* Encoded against a zeroed buffer instead of the previous snapshot. */
+	};
+
+#pragma pack(push, 1)
+	///----------------------------------------------------------------------------------------------------
+	/// MumbleRecordingHeader_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct MumbleRecordingHeader_t
+	{
+		uint32_t Magic;            /* MBLREC_MAGIC                                     */
+		uint32_t Version;          /* MBLREC_VERSION                                   */
+		uint32_t MumbleDataSize;   /* sizeof(Mumble::Data) at the time of recording.   */
+		uint32_t NexusLinkSize;    /* sizeof(NexusLinkData_t) at the time of recording. */
+		uint32_t KeyframeInterval; /* Snapshots between two keyframes.                 */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// MumbleSnapshotHeader_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct MumbleSnapshotHeader_t
+	{
+		uint32_t       TimeOffsetMs; /* Milliseconds since the recording started.     */
+		uint32_t       EncodedSize;  /* Size of the delta payload following the header. */
+		uint64_t       FrameCount;   /* Graphics::FrameMetrics frame count at capture.  */
+		ESnapshotFlags Flags;
+	};
+#pragma pack(pop)
+}
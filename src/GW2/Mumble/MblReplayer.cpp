@@ -0,0 +1,183 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblReplayer.cpp
+/// Description  :  Replays a MumbleLink recording into a simulated MumbleLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "MblReplayer.h"
+
+#include <chrono>
+#include <cstring>
+#include <windows.h>
+
+namespace Raidcore::Nexus::GW2
+{
+	constexpr const char* LOG_CHANNEL = "Mumble";
+
+	static uint64_t GetThreadCpuTimeUs()
+	{
+		FILETIME creation{}, exit{}, kernel{}, user{};
+
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+		{
+			return 0;
+		}
+
+		ULARGE_INTEGER k{ kernel.dwLowDateTime, kernel.dwHighDateTime };
+		ULARGE_INTEGER u{ user.dwLowDateTime, user.dwHighDateTime };
+
+		/* FILETIME is in 100ns units. */
+		return (k.QuadPart + u.QuadPart) / 10;
+	}
+
+	MumbleReplayer::MumbleReplayer(Core::LogApi& aLogger, std::filesystem::path aPath, Mumble::Data* aTarget, float aSpeed)
+		: Logger(aLogger)
+		, Path(aPath)
+		, Target(aTarget)
+		, Speed(aSpeed > 0 ? aSpeed : 0)
+	{
+		this->Snapshot.resize(MBLREC_SNAPSHOT_SIZE);
+	}
+
+	ReplayStats_t MumbleReplayer::Run(ADVANCECALLBACK aCallback)
+	{
+		ReplayStats_t stats{};
+
+		if (!this->Target) { return stats; }
+
+		std::ifstream file(this->Path, std::ios::in | std::ios::binary);
+
+		if (!file.is_open())
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Failed to open MumbleLink recording \"%s\".", this->Path.string().c_str());
+			return stats;
+		}
+
+		if (!this->ReadHeader(file)) { return stats; }
+
+		stats.BytesRead = sizeof(MumbleRecordingHeader_t);
+
+		this->Logger.Info(LOG_CHANNEL, "Replaying MumbleLink recording \"%s\" at speed %.2f.", this->Path.string().c_str(), this->Speed);
+
+		std::vector<uint8_t> encoded;
+		bool hasKeyframe = false;
+
+		auto wallStart = std::chrono::steady_clock::now();
+		uint64_t cpuStart = GetThreadCpuTimeUs();
+
+		while (!this->IsStopRequested)
+		{
+			MumbleSnapshotHeader_t header{};
+
+			if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+			{
+				/* Clean end of the recording. */
+				stats.IsComplete = file.eof() && file.gcount() == 0;
+				break;
+			}
+
+			encoded.resize(header.EncodedSize);
+
+			if (!file.read(reinterpret_cast<char*>(encoded.data()), header.EncodedSize))
+			{
+				this->Logger.Warning(LOG_CHANNEL, "MumbleLink recording is truncated after %llu snapshots.", stats.Snapshots);
+				break;
+			}
+
+			stats.BytesRead += sizeof(header) + header.EncodedSize;
+
+			bool isKeyframe = (static_cast<uint32_t>(header.Flags) & static_cast<uint32_t>(ESnapshotFlags::Keyframe)) != 0;
+
+			if (isKeyframe)
+			{
+				std::memset(this->Snapshot.data(), 0, this->Snapshot.size());
+				hasKeyframe = true;
+				stats.Keyframes++;
+			}
+
+			/* Deltas before the first keyframe have no base. */
+			if (!hasKeyframe) { continue; }
+
+			if (!MumbleDelta::Decode(encoded.data(), encoded.size(), this->Snapshot.data(), this->Snapshot.size()))
+			{
+				this->Logger.Warning(LOG_CHANNEL, "MumbleLink recording is malformed at snapshot %llu.", stats.Snapshots);
+				break;
+			}
+
+			/* Pace to the recorded timing. */
+			if (this->Speed > 0)
+			{
+				auto due = wallStart + std::chrono::microseconds(static_cast<uint64_t>(header.TimeOffsetMs * 1000.0 / this->Speed));
+
+				/* Unchanged snapshots are not recorded, the gap to the next one may be minutes. */
+				std::unique_lock<std::mutex> lock(this->Mutex);
+				if (this->ConVar.wait_until(lock, due, [this] { return this->IsStopRequested.load(); }))
+				{
+					break;
+				}
+			}
+
+			if (aCallback)
+			{
+				uint64_t cbStart = GetThreadCpuTimeUs();
+				aCallback(header.TimeOffsetMs, header.FrameCount);
+				stats.CallbackUs += GetThreadCpuTimeUs() - cbStart;
+			}
+
+			std::memcpy(this->Target, this->Snapshot.data(), sizeof(Mumble::Data));
+
+			stats.Snapshots++;
+			stats.RecordedMs = header.TimeOffsetMs;
+		}
+
+		stats.WallMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wallStart).count();
+		stats.CpuUs = GetThreadCpuTimeUs() - cpuStart;
+
+		return stats;
+	}
+
+	void MumbleReplayer::Stop()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			this->IsStopRequested = true;
+		}
+
+		this->ConVar.notify_all();
+	}
+
+	bool MumbleReplayer::ReadHeader(std::ifstream& aFile)
+	{
+		MumbleRecordingHeader_t header{};
+
+		if (!aFile.read(reinterpret_cast<char*>(&header), sizeof(header)))
+		{
+			this->Logger.Warning(LOG_CHANNEL, "MumbleLink recording \"%s\" has no header.", this->Path.string().c_str());
+			return false;
+		}
+
+		if (header.Magic != MBLREC_MAGIC || header.Version != MBLREC_VERSION)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "MumbleLink recording \"%s\" has an unsupported format.", this->Path.string().c_str());
+			return false;
+		}
+
+		if (header.MumbleDataSize != sizeof(Mumble::Data) || header.NexusLinkSize != sizeof(NexusLinkData_t))
+		{
+			this->Logger.Warning(
+				LOG_CHANNEL,
+				"MumbleLink recording \"%s\" was made with different structures. Mumble: %u (expected %u). NexusLink: %u (expected %u).",
+				this->Path.string().c_str(),
+				header.MumbleDataSize,
+				sizeof(Mumble::Data),
+				header.NexusLinkSize,
+				sizeof(NexusLinkData_t)
+			);
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,99 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblReplayer.h
+/// Description  :  Replays a MumbleLink recording into a simulated MumbleLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "thirdparty/mumble/Mumble.h"
+
+#include "Core/Logging/LogApi.h"
+#include "Core/NexusLink.h"
+#include "MblRecording.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GW2 Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GW2
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ReplayStats_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct ReplayStats_t
+	{
+		uint64_t Snapshots;    /* Snapshots applied to the target.              */
+		uint64_t Keyframes;    /* Of which keyframes.                           */
+		uint64_t BytesRead;    /* Bytes read from the recording.                */
+		uint64_t RecordedMs;   /* Duration of the recorded session.             */
+		uint64_t WallMs;       /* Wall time the replay took.                    */
+		uint64_t CpuUs;        /* CPU time of the replaying thread.             */
+		uint64_t CallbackUs;   /* Of which spent in the advance callback.       */
+		bool     IsComplete;   /* False if the replay was stopped or malformed. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// MumbleReplayer Class
+	///----------------------------------------------------------------------------------------------------
+	class MumbleReplayer
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Called before every snapshot is applied with its recorded time and frame count.
+		/// The target still holds the previous snapshot, as it did until the recorded time.
+		///----------------------------------------------------------------------------------------------------
+		using ADVANCECALLBACK = std::function<void(uint64_t aTimeMs, uint64_t aFrameCount)>;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		/// 	aSpeed scales the recorded timing, 0 replays as fast as possible.
+		///----------------------------------------------------------------------------------------------------
+		MumbleReplayer(Core::LogApi& aLogger, std::filesystem::path aPath, Mumble::Data* aTarget, float aSpeed = 1.0f);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~MumbleReplayer() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Run:
+		/// 	Blocking. Replays the recording into the target and invokes the callback before each snapshot.
+		///----------------------------------------------------------------------------------------------------
+		ReplayStats_t Run(ADVANCECALLBACK aCallback);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Stop:
+		/// 	Requests an ongoing replay to stop after the current snapshot. Interrupts pacing.
+		///----------------------------------------------------------------------------------------------------
+		void Stop();
+
+		private:
+		Core::LogApi&           Logger;
+
+		std::filesystem::path   Path;
+		Mumble::Data*           Target;
+		float                   Speed;
+
+		std::mutex              Mutex;
+		std::condition_variable ConVar;
+		std::atomic_bool        IsStopRequested = false;
+		std::vector<uint8_t>    Snapshot;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ReadHeader:
+		/// 	Reads and validates the recording header.
+		///----------------------------------------------------------------------------------------------------
+		bool ReadHeader(std::ifstream& aFile);
+	};
+}
@@ -0,0 +1,119 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameMetrics.cpp
+/// Description  :  Measures frame timings and publishes them via DataLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "GrFrameMetrics.h"
+
+#include <cstring>
+
+namespace Raidcore::Nexus::Graphics
+{
+	/* Frames between two percentile selections. */
+	constexpr const uint32_t PERCENTILE_INTERVAL = 10;
+
+	/* Gaps longer than this are the game not presenting, e.g. minimized, not a slow frame. */
+	constexpr const float    PAUSE_THRESHOLD_MS  = 1000.0f;
+
+	static float ElapsedMs(std::chrono::steady_clock::time_point aStart, std::chrono::steady_clock::time_point aEnd)
+	{
+		return std::chrono::duration<float, std::milli>(aEnd - aStart).count();
+	}
+
+	FrameMetrics::FrameMetrics(Core::DataLinkApi& aDataLink)
+	{
+		this->Published = aDataLink.ShareVersioned(DL_FRAME_METRICS, sizeof(Metrics_t), 2, "", false);
+
+		if (this->Published)
+		{
+			Metrics_t* data = (Metrics_t*)Core::BeginWrite(this->Published);
+			data->Version = FRAMEMETRICS_VERSION;
+			Core::EndWrite(this->Published);
+		}
+	}
+
+	void FrameMetrics::BeginFrame()
+	{
+		uint64_t frame = ++this->FrameCount;
+
+		Clock::time_point now = Clock::now();
+
+		if (this->LastPresent != Clock::time_point{})
+		{
+			this->FrameTimeMs = ElapsedMs(this->LastPresent, now);
+
+			if (this->FrameTimeMs < PAUSE_THRESHOLD_MS && this->Stats.Push(this->FrameTimeMs))
+			{
+				this->HitchCount++;
+				this->LastHitchFrame = frame;
+				this->LastHitchMs = this->FrameTimeMs;
+			}
+		}
+
+		this->LastPresent = now;
+
+		std::memset(this->SectionMs, 0, sizeof(this->SectionMs));
+	}
+
+	void FrameMetrics::EndFrame()
+	{
+		if (++this->FramesSinceCompute >= PERCENTILE_INTERVAL)
+		{
+			this->Stats.ComputePercentiles();
+			this->FramesSinceCompute = 0;
+		}
+
+		this->Publish();
+	}
+
+	void FrameMetrics::BeginSection(EFrameSection aSection)
+	{
+		this->SectionStart[static_cast<uint32_t>(aSection)] = Clock::now();
+	}
+
+	void FrameMetrics::EndSection(EFrameSection aSection)
+	{
+		uint32_t idx = static_cast<uint32_t>(aSection);
+
+		this->SectionMs[idx] += ElapsedMs(this->SectionStart[idx], Clock::now());
+	}
+
+	uint64_t FrameMetrics::GetFrameCount() const
+	{
+		return this->FrameCount;
+	}
+
+	bool FrameMetrics::Read(Metrics_t& aOut) const
+	{
+		if (!this->Published) { return false; }
+
+		return Core::ReadVersioned(this->Published, &aOut, sizeof(Metrics_t));
+	}
+
+	void FrameMetrics::Publish()
+	{
+		if (!this->Published) { return; }
+
+		/* Carries the version over from the published buffer. */
+		Metrics_t* data = (Metrics_t*)Core::BeginWrite(this->Published);
+		data->FrameCount      = this->FrameCount;
+		data->FrameTimeMs     = this->FrameTimeMs;
+		data->AverageMs       = this->Stats.GetAverage();
+		data->P50Ms           = this->Stats.GetP50();
+		data->P90Ms           = this->Stats.GetP90();
+		data->P99Ms           = this->Stats.GetP99();
+		data->MaxMs           = this->Stats.GetMax();
+		data->SampleCount     = this->Stats.Count();
+		data->TextureLoaderMs = this->SectionMs[static_cast<uint32_t>(EFrameSection::TextureLoader)];
+		data->UIRenderMs      = this->SectionMs[static_cast<uint32_t>(EFrameSection::UIRender)];
+		data->HitchCount      = this->HitchCount;
+		data->LastHitchFrame  = this->LastHitchFrame;
+		data->LastHitchMs     = this->LastHitchMs;
+		std::memcpy(data->Histogram, this->Stats.GetHistogram(), sizeof(data->Histogram));
+
+		Core::EndWrite(this->Published);
+	}
+}
@@ -0,0 +1,115 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameMetrics.h
+/// Description  :  Measures frame timings and publishes them via DataLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "Core/DataLink/DlApi.h"
+#include "Core/DataLink/DlVersioned.h"
+#include "GrFrameStats.h"
+#include "GrMetrics.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EFrameSection Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EFrameSection : uint32_t
+	{
+		TextureLoader,
+		UIRender,
+		COUNT
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// FrameMetrics Class
+	/// 	Only the render thread writes. Other threads may only call GetFrameCount or read the
+	/// 	published Metrics_t.
+	///----------------------------------------------------------------------------------------------------
+	class FrameMetrics
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		FrameMetrics(Core::DataLinkApi& aDataLink);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~FrameMetrics() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// BeginFrame:
+		/// 	Call at the start of Present. Records the present-to-present interval.
+		///----------------------------------------------------------------------------------------------------
+		void BeginFrame();
+
+		///----------------------------------------------------------------------------------------------------
+		/// EndFrame:
+		/// 	Call at the end of Present. Publishes the metrics of the frame.
+		///----------------------------------------------------------------------------------------------------
+		void EndFrame();
+
+		///----------------------------------------------------------------------------------------------------
+		/// BeginSection:
+		/// 	Starts timing a section of Nexus' own per-frame work.
+		///----------------------------------------------------------------------------------------------------
+		void BeginSection(EFrameSection aSection);
+
+		///----------------------------------------------------------------------------------------------------
+		/// EndSection:
+		/// 	Stops timing a section.
+		///----------------------------------------------------------------------------------------------------
+		void EndSection(EFrameSection aSection);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetFrameCount:
+		/// 	Returns the amount of presented frames.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetFrameCount() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Read:
+		/// 	Copies the last published metrics into aOut, without blocking the writer.
+		/// 	Returns false, if no consistent copy could be made.
+		///----------------------------------------------------------------------------------------------------
+		bool Read(Metrics_t& aOut) const;
+
+		private:
+		using Clock = std::chrono::steady_clock;
+
+		Core::VersionedHeader_t* Published;
+
+		std::atomic<uint64_t>    FrameCount         = 0;
+		FrameStats               Stats;
+		uint32_t                 FramesSinceCompute = 0;
+
+		Clock::time_point        LastPresent{};
+		float                    FrameTimeMs        = 0;
+
+		Clock::time_point        SectionStart[static_cast<uint32_t>(EFrameSection::COUNT)]{};
+		float                    SectionMs[static_cast<uint32_t>(EFrameSection::COUNT)]{};
+
+		uint64_t                 HitchCount         = 0;
+		uint64_t                 LastHitchFrame     = 0;
+		float                    LastHitchMs        = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Writes the current state to the DataLink resource.
+		///----------------------------------------------------------------------------------------------------
+		void Publish();
+	};
+}
@@ -0,0 +1,134 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameStats.cpp
+/// Description  :  Rolling frame time statistics.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "GrFrameStats.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Raidcore::Nexus::Graphics
+{
+	FrameStats::FrameStats(uint32_t aCapacity)
+	{
+		this->Samples.resize(aCapacity > 0 ? aCapacity : FRAMESTATS_CAPACITY);
+		this->Scratch.reserve(this->Samples.size());
+	}
+
+	bool FrameStats::Push(float aIntervalMs)
+	{
+		if (aIntervalMs < 0) { aIntervalMs = 0; }
+
+		uint32_t capacity = static_cast<uint32_t>(this->Samples.size());
+
+		if (this->Size == capacity)
+		{
+			float evicted = this->Samples[this->Head];
+			this->Sum -= evicted;
+			this->Histogram[GetBucket(evicted)]--;
+		}
+		else
+		{
+			this->Size++;
+		}
+
+		this->Samples[this->Head] = aIntervalMs;
+		this->Head = (this->Head + 1) % capacity;
+		this->Sum += aIntervalMs;
+		this->Histogram[GetBucket(aIntervalMs)]++;
+
+		/* No baseline yet. */
+		if (this->P50 <= 0) { return false; }
+
+		return aIntervalMs > this->P50 * FRAMESTATS_HITCH_FACTOR
+			&& aIntervalMs > this->P50 + FRAMESTATS_HITCH_MIN_MS;
+	}
+
+	void FrameStats::ComputePercentiles()
+	{
+		if (this->Size == 0) { return; }
+
+		this->Scratch.assign(this->Samples.begin(), this->Samples.begin() + this->Size);
+
+		auto rank = [this](float aPercentile)
+		{
+			return static_cast<size_t>(aPercentile * (this->Size - 1));
+		};
+
+		/* Each selection partitions the range, so the next one only has to look above the previous rank. */
+		auto begin = this->Scratch.begin();
+		auto end = this->Scratch.end();
+
+		size_t r50 = rank(0.50f);
+		std::nth_element(begin, begin + r50, end);
+		this->P50 = this->Scratch[r50];
+
+		size_t r90 = rank(0.90f);
+		std::nth_element(begin + r50, begin + r90, end);
+		this->P90 = this->Scratch[r90];
+
+		size_t r99 = rank(0.99f);
+		std::nth_element(begin + r90, begin + r99, end);
+		this->P99 = this->Scratch[r99];
+
+		this->Max = *std::max_element(begin + r99, end);
+	}
+
+	void FrameStats::Clear()
+	{
+		this->Head = 0;
+		this->Size = 0;
+		this->Sum = 0;
+		std::memset(this->Histogram, 0, sizeof(this->Histogram));
+		this->P50 = 0;
+		this->P90 = 0;
+		this->P99 = 0;
+		this->Max = 0;
+	}
+
+	uint32_t FrameStats::Count() const
+	{
+		return this->Size;
+	}
+
+	float FrameStats::GetAverage() const
+	{
+		return this->Size > 0 ? static_cast<float>(this->Sum / this->Size) : 0;
+	}
+
+	float FrameStats::GetP50() const
+	{
+		return this->P50;
+	}
+
+	float FrameStats::GetP90() const
+	{
+		return this->P90;
+	}
+
+	float FrameStats::GetP99() const
+	{
+		return this->P99;
+	}
+
+	float FrameStats::GetMax() const
+	{
+		return this->Max;
+	}
+
+	const uint32_t* FrameStats::GetHistogram() const
+	{
+		return this->Histogram;
+	}
+
+	uint32_t FrameStats::GetBucket(float aIntervalMs)
+	{
+		uint32_t bucket = static_cast<uint32_t>(aIntervalMs / FRAMEMETRICS_HISTOGRAM_WIDTH_MS);
+
+		return std::min(bucket, FRAMEMETRICS_HISTOGRAM_BUCKETS - 1);
+	}
+}
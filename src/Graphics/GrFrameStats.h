@@ -0,0 +1,126 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameStats.h
+/// Description  :  Rolling frame time statistics.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GrMetrics.h"
+
+constexpr const uint32_t FRAMESTATS_CAPACITY     = 1024;
+
+/* A frame is a hitch if it exceeds the rolling median by both the factor and the margin. */
+constexpr const float    FRAMESTATS_HITCH_FACTOR = 2.0f;
+constexpr const float    FRAMESTATS_HITCH_MIN_MS = 8.0f;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// FrameStats Class
+	/// 	Ring buffer of frame intervals with an incrementally maintained sum and histogram.
+	/// 	Percentiles are selected on demand, not sorted.
+	///----------------------------------------------------------------------------------------------------
+	class FrameStats
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		FrameStats(uint32_t aCapacity = FRAMESTATS_CAPACITY);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~FrameStats() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Push:
+		/// 	Adds a frame interval, evicting the oldest once the window is full.
+		/// 	Returns true if the frame is a hitch compared to the last computed median.
+		///----------------------------------------------------------------------------------------------------
+		bool Push(float aIntervalMs);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ComputePercentiles:
+		/// 	Updates P50, P90, P99 and the maximum of the current window.
+		///----------------------------------------------------------------------------------------------------
+		void ComputePercentiles();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Drops all samples, e.g. after the game was minimized.
+		///----------------------------------------------------------------------------------------------------
+		void Clear();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Count:
+		/// 	Returns the amount of samples in the window.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Count() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetAverage:
+		/// 	Returns the average frame interval of the window.
+		///----------------------------------------------------------------------------------------------------
+		float GetAverage() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetP50:
+		/// 	Returns the median as of the last ComputePercentiles.
+		///----------------------------------------------------------------------------------------------------
+		float GetP50() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetP90:
+		/// 	Returns the 90th percentile as of the last ComputePercentiles.
+		///----------------------------------------------------------------------------------------------------
+		float GetP90() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetP99:
+		/// 	Returns the 99th percentile as of the last ComputePercentiles.
+		///----------------------------------------------------------------------------------------------------
+		float GetP99() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetMax:
+		/// 	Returns the longest frame as of the last ComputePercentiles.
+		///----------------------------------------------------------------------------------------------------
+		float GetMax() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetHistogram:
+		/// 	Returns the FRAMEMETRICS_HISTOGRAM_BUCKETS bucket counts of the window.
+		///----------------------------------------------------------------------------------------------------
+		const uint32_t* GetHistogram() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetBucket:
+		/// 	Returns the histogram bucket of a frame interval.
+		///----------------------------------------------------------------------------------------------------
+		static uint32_t GetBucket(float aIntervalMs);
+
+		private:
+		std::vector<float> Samples;
+		std::vector<float> Scratch;
+		uint32_t           Head = 0;
+		uint32_t           Size = 0;
+		double             Sum  = 0;
+
+		uint32_t           Histogram[FRAMEMETRICS_HISTOGRAM_BUCKETS]{};
+
+		float              P50  = 0;
+		float              P90  = 0;
+		float              P99  = 0;
+		float              Max  = 0;
+	};
+}
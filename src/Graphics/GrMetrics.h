@@ -10,6 +10,12 @@
 
 #include <cstdint>
 
+constexpr const char*    DL_FRAME_METRICS                = "DL_NEXUS_FRAME_METRICS"; /* Double-buffered, see VersionedHeader_t. */
+
+constexpr const uint32_t FRAMEMETRICS_VERSION            = 1;
+constexpr const uint32_t FRAMEMETRICS_HISTOGRAM_BUCKETS  = 32;
+constexpr const float    FRAMEMETRICS_HISTOGRAM_WIDTH_MS = 2.0f; /* Last bucket holds everything above. */
+
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Graphics Namespace
 ///----------------------------------------------------------------------------------------------------
@@ -17,9 +23,29 @@ namespace Raidcore::Nexus::Graphics
 {
 	///----------------------------------------------------------------------------------------------------
 	/// Metrics_t Struct
+	/// 	Published as DL_FRAME_METRICS, read it with ReadVersioned.
 	///----------------------------------------------------------------------------------------------------
 	struct Metrics_t
 	{
-		uint64_t FrameCount = 0;
+		uint32_t Version;                                    /* FRAMEMETRICS_VERSION                      */
+
+		uint64_t FrameCount;
+
+		float    FrameTimeMs;                                /* Present-to-present of the last frame.     */
+		float    AverageMs;                                  /* Over the sample window.                   */
+		float    P50Ms;
+		float    P90Ms;
+		float    P99Ms;
+		float    MaxMs;
+		uint32_t SampleCount;                                /* Frames in the sample window.              */
+
+		float    TextureLoaderMs;                            /* Time spent in TextureLoader::Advance.     */
+		float    UIRenderMs;                                 /* Time spent in UI rendering and addons.    */
+
+		uint64_t HitchCount;
+		uint64_t LastHitchFrame;
+		float    LastHitchMs;
+
+		uint32_t Histogram[FRAMEMETRICS_HISTOGRAM_BUCKETS];  /* Frame times of the sample window.         */
 	};
 }
@@ -0,0 +1,253 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlas.cpp
+/// Description  :  Packs small textures into shared atlas pages.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxAtlas.h"
+
+#include <algorithm>
+#include <d3d11.h>
+
+namespace Raidcore::Nexus::Graphics
+{
+	constexpr const char* LOG_CHANNEL = "TextureAtlas";
+
+	TextureAtlas::TextureAtlas(Core::LogApi& aLogger, Graphics::Window_t& aGrWindow)
+		: Logger(aLogger)
+		, GrWindow(aGrWindow)
+	{
+	}
+
+	/*static*/ bool TextureAtlas::IsEligible(uint32_t aWidth, uint32_t aHeight)
+	{
+		return aWidth > 0 && aHeight > 0 && aWidth <= TEXATLAS_MAXSIZE && aHeight <= TEXATLAS_MAXSIZE;
+	}
+
+	bool TextureAtlas::Add(Texture_t* aTexture, const uint8_t* aData)
+	{
+		if (!aTexture || !aData)                                     { return false; }
+		if (!IsEligible(aTexture->Width, aTexture->Height))          { return false; }
+		if (!this->GrWindow.Device || !this->GrWindow.DeviceContext) { return false; }
+
+		uint32_t width  = aTexture->Width + TEXATLAS_PADDING * 2;
+		uint32_t height = aTexture->Height + TEXATLAS_PADDING * 2;
+
+		uint32_t    page = 0;
+		AtlasRect_t rect{};
+
+		bool isPlaced = this->Layout.Place(
+			aTexture,
+			width,
+			height,
+			[this]()
+			{
+				std::unique_ptr<AtlasPage_t> created = this->CreatePage();
+
+				if (!created) { return false; }
+
+				this->Pages.push_back(std::move(created));
+				return true;
+			},
+			[this](uint32_t aPage, const std::vector<AtlasMove_t>& aMoves)
+			{
+				return this->Repack(*this->Pages[aPage], aMoves);
+			},
+			page,
+			rect
+		);
+
+		if (!isPlaced) { return false; }
+
+		this->Upload(*this->Pages[page], rect, aData, aTexture->Width, aTexture->Height);
+
+		Assign(*this->Pages[page], aTexture, rect);
+
+		return true;
+	}
+
+	void TextureAtlas::Remove(Texture_t* aTexture)
+	{
+		if (!aTexture || !aTexture->AtlasResource) { return; }
+
+		this->Layout.Remove(aTexture);
+		this->Generation++;
+
+		aTexture->AtlasResource = nullptr;
+		aTexture->AtlasUV0[0] = aTexture->AtlasUV0[1] = 0;
+		aTexture->AtlasUV1[0] = aTexture->AtlasUV1[1] = 0;
+	}
+
+	void TextureAtlas::Clear()
+	{
+		for (uint32_t i = 0; i < this->Layout.GetPageCount(); i++)
+		{
+			for (const AtlasEntry_t& entry : this->Layout.GetPage(i).Entries)
+			{
+				static_cast<Texture_t*>(entry.Key)->AtlasResource = nullptr;
+			}
+		}
+
+		for (std::unique_ptr<AtlasPage_t>& page : this->Pages)
+		{
+			ReleasePage(*page);
+		}
+
+		this->Layout.Clear();
+		this->Pages.clear();
+		this->Generation++;
+	}
+
+	uint32_t TextureAtlas::GetPageCount() const
+	{
+		return this->Layout.GetPageCount();
+	}
+
+	uint32_t TextureAtlas::GetSlotCount() const
+	{
+		return this->Layout.GetEntryCount();
+	}
+
+	uint64_t TextureAtlas::GetGeneration() const
+	{
+		return this->Generation;
+	}
+
+	std::unique_ptr<AtlasPage_t> TextureAtlas::CreatePage()
+	{
+		D3D11_TEXTURE2D_DESC desc{};
+		desc.Width            = TEXATLAS_PAGESIZE;
+		desc.Height           = TEXATLAS_PAGESIZE;
+		desc.MipLevels        = 1;
+		desc.ArraySize        = 1;
+		desc.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage            = D3D11_USAGE_DEFAULT;
+		desc.BindFlags        = D3D11_BIND_SHADER_RESOURCE;
+		desc.CPUAccessFlags   = 0;
+
+		std::unique_ptr<AtlasPage_t> page = std::make_unique<AtlasPage_t>();
+
+		this->GrWindow.Device->CreateTexture2D(&desc, nullptr, &page->Texture);
+
+		if (!page->Texture)
+		{
+			this->Logger.Debug(LOG_CHANNEL, "Page texture could not be created.");
+			return nullptr;
+		}
+
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+		srvDesc.Format                    = DXGI_FORMAT_R8G8B8A8_UNORM;
+		srvDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels       = desc.MipLevels;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+
+		this->GrWindow.Device->CreateShaderResourceView(page->Texture, &srvDesc, &page->Resource);
+
+		if (!page->Resource)
+		{
+			this->Logger.Debug(LOG_CHANNEL, "Page resource could not be created.");
+			ReleasePage(*page);
+			return nullptr;
+		}
+
+		return page;
+	}
+
+	/*static*/ void TextureAtlas::ReleasePage(AtlasPage_t& aPage)
+	{
+		if (aPage.Resource)
+		{
+			aPage.Resource->Release();
+			aPage.Resource = nullptr;
+		}
+
+		if (aPage.Texture)
+		{
+			aPage.Texture->Release();
+			aPage.Texture = nullptr;
+		}
+	}
+
+	bool TextureAtlas::Repack(AtlasPage_t& aPage, const std::vector<AtlasMove_t>& aMoves)
+	{
+		std::unique_ptr<AtlasPage_t> repacked = this->CreatePage();
+
+		if (!repacked) { return false; }
+
+		for (const AtlasMove_t& move : aMoves)
+		{
+			D3D11_BOX box{};
+			box.left   = move.From.X;
+			box.top    = move.From.Y;
+			box.front  = 0;
+			box.right  = move.From.X + move.From.Width;
+			box.bottom = move.From.Y + move.From.Height;
+			box.back   = 1;
+
+			this->GrWindow.DeviceContext->CopySubresourceRegion(repacked->Texture, 0, move.To.X, move.To.Y, 0, aPage.Texture, 0, &box);
+		}
+
+		ReleasePage(aPage);
+		this->Generation++;
+
+		aPage.Texture  = repacked->Texture;
+		aPage.Resource = repacked->Resource;
+
+		for (const AtlasMove_t& move : aMoves)
+		{
+			Assign(aPage, static_cast<Texture_t*>(move.Key), move.To);
+		}
+
+		this->Logger.Trace(LOG_CHANNEL, "Repacked page with %u textures.", static_cast<uint32_t>(aMoves.size()));
+
+		return true;
+	}
+
+	void TextureAtlas::Upload(AtlasPage_t& aPage, const AtlasRect_t& aRect, const uint8_t* aData, uint32_t aWidth, uint32_t aHeight)
+	{
+		std::vector<uint8_t> padded(static_cast<size_t>(aRect.Width) * aRect.Height * 4);
+
+		/* Repeat the outermost pixels into the padding. */
+		for (uint32_t y = 0; y < aRect.Height; y++)
+		{
+			uint32_t srcY = (std::min)((std::max)(y, TEXATLAS_PADDING) - TEXATLAS_PADDING, aHeight - 1);
+
+			for (uint32_t x = 0; x < aRect.Width; x++)
+			{
+				uint32_t srcX = (std::min)((std::max)(x, TEXATLAS_PADDING) - TEXATLAS_PADDING, aWidth - 1);
+
+				const uint8_t* src = aData + (static_cast<size_t>(srcY) * aWidth + srcX) * 4;
+				uint8_t* dst = padded.data() + (static_cast<size_t>(y) * aRect.Width + x) * 4;
+
+				dst[0] = src[0];
+				dst[1] = src[1];
+				dst[2] = src[2];
+				dst[3] = src[3];
+			}
+		}
+
+		D3D11_BOX box{};
+		box.left   = aRect.X;
+		box.top    = aRect.Y;
+		box.front  = 0;
+		box.right  = aRect.X + aRect.Width;
+		box.bottom = aRect.Y + aRect.Height;
+		box.back   = 1;
+
+		this->GrWindow.DeviceContext->UpdateSubresource(aPage.Texture, 0, &box, padded.data(), aRect.Width * 4, 0);
+	}
+
+	/*static*/ void TextureAtlas::Assign(const AtlasPage_t& aPage, Texture_t* aTexture, const AtlasRect_t& aRect)
+	{
+		constexpr float scale = 1.0f / TEXATLAS_PAGESIZE;
+
+		aTexture->AtlasUV0[0] = (aRect.X + TEXATLAS_PADDING) * scale;
+		aTexture->AtlasUV0[1] = (aRect.Y + TEXATLAS_PADDING) * scale;
+		aTexture->AtlasUV1[0] = (aRect.X + TEXATLAS_PADDING + aTexture->Width) * scale;
+		aTexture->AtlasUV1[1] = (aRect.Y + TEXATLAS_PADDING + aTexture->Height) * scale;
+		aTexture->AtlasResource = aPage.Resource;
+	}
+}
@@ -0,0 +1,137 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlas.h
+/// Description  :  Packs small textures into shared atlas pages.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Core/Logging/LogApi.h"
+#include "Graphics/GrWindow.h"
+#include "TxAtlasBase.h"
+#include "TxAtlasLayout.h"
+#include "TxAtlasPacker.h"
+#include "TxTexture.h"
+
+constexpr const uint32_t TEXATLAS_PAGESIZE = 1024;
+constexpr const uint32_t TEXATLAS_MAXPAGES = 4;
+constexpr const uint32_t TEXATLAS_MAXSIZE  = 64; /* Textures up to this size on both axes are packed. */
+constexpr const uint32_t TEXATLAS_PADDING  = 1;  /* Extruded edge, so filtering does not bleed into neighbours. */
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasPage_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AtlasPage_t
+	{
+		ID3D11Texture2D*          Texture  = nullptr;
+		ID3D11ShaderResourceView* Resource = nullptr;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// TextureAtlas Class
+	/// 	Textures keep their own resource, the atlas holds an additional copy for batched drawing.
+	/// 	Not thread-safe, only used on the render thread.
+	///----------------------------------------------------------------------------------------------------
+	class TextureAtlas : public virtual ITextureAtlas
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		TextureAtlas(Core::LogApi& aLogger, Graphics::Window_t& aGrWindow);
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsEligible:
+		/// 	Returns true, if a texture of the given size is packed.
+		///----------------------------------------------------------------------------------------------------
+		static bool IsEligible(uint32_t aWidth, uint32_t aHeight);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Add:
+		/// 	Copies the RGBA pixels of the texture into a page and assigns its atlas coordinates.
+		/// 	Returns false, if no page has space left.
+		///----------------------------------------------------------------------------------------------------
+		bool Add(Texture_t* aTexture, const uint8_t* aData) override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Drops the atlas copy of a texture.
+		///----------------------------------------------------------------------------------------------------
+		void Remove(Texture_t* aTexture) override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Drops all atlas copies and releases the pages.
+		///----------------------------------------------------------------------------------------------------
+		void Clear() override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPageCount:
+		/// 	Returns the number of allocated pages.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetPageCount() const override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetSlotCount:
+		/// 	Returns the number of packed textures.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetSlotCount() const override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time a page or the coordinates of a packed texture
+		/// 	become invalid.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const override;
+
+		private:
+		Core::LogApi&                             Logger;
+		Graphics::Window_t&                       GrWindow;
+
+		AtlasLayout                               Layout{ TEXATLAS_PAGESIZE, TEXATLAS_MAXPAGES };
+		std::vector<std::unique_ptr<AtlasPage_t>> Pages;     /* Resources of the layout pages, same order. */
+		uint64_t                                  Generation = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// CreatePage:
+		/// 	Creates the resources of a page.
+		///----------------------------------------------------------------------------------------------------
+		std::unique_ptr<AtlasPage_t> CreatePage();
+
+		///----------------------------------------------------------------------------------------------------
+		/// ReleasePage:
+		/// 	Releases the resources of a page.
+		///----------------------------------------------------------------------------------------------------
+		static void ReleasePage(AtlasPage_t& aPage);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Repack:
+		/// 	Copies the textures of a page to their new rects in a new page, reclaiming the space of
+		/// 	removed textures.
+		///----------------------------------------------------------------------------------------------------
+		bool Repack(AtlasPage_t& aPage, const std::vector<AtlasMove_t>& aMoves);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Upload:
+		/// 	Writes the pixels with extruded edges into the given rect of a page.
+		///----------------------------------------------------------------------------------------------------
+		void Upload(AtlasPage_t& aPage, const AtlasRect_t& aRect, const uint8_t* aData, uint32_t aWidth, uint32_t aHeight);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Assign:
+		/// 	Publishes the page and coordinates of a rect, including padding, to its texture.
+		///----------------------------------------------------------------------------------------------------
+		static void Assign(const AtlasPage_t& aPage, Texture_t* aTexture, const AtlasRect_t& aRect);
+	};
+}
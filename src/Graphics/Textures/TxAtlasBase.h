@@ -0,0 +1,70 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasBase.h
+/// Description  :  TextureAtlas interface definition.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "TxTexture.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ITextureAtlas Interface Class
+	/// 	Packs small textures into shared pages for batched drawing. Only used on the render thread.
+	///----------------------------------------------------------------------------------------------------
+	class ITextureAtlas
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		virtual ~ITextureAtlas() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Add:
+		/// 	Copies the RGBA pixels of the texture into a page and assigns its atlas coordinates.
+		/// 	Returns false, if the texture is not eligible or no page has space left.
+		///----------------------------------------------------------------------------------------------------
+		virtual bool Add(Texture_t* aTexture, const uint8_t* aData) = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Drops the atlas copy of a texture.
+		///----------------------------------------------------------------------------------------------------
+		virtual void Remove(Texture_t* aTexture) = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Drops all atlas copies and releases the pages.
+		///----------------------------------------------------------------------------------------------------
+		virtual void Clear() = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPageCount:
+		/// 	Returns the number of allocated pages.
+		///----------------------------------------------------------------------------------------------------
+		virtual uint32_t GetPageCount() const = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetSlotCount:
+		/// 	Returns the number of packed textures.
+		///----------------------------------------------------------------------------------------------------
+		virtual uint32_t GetSlotCount() const = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time a page or the coordinates of a packed texture
+		/// 	become invalid.
+		///----------------------------------------------------------------------------------------------------
+		virtual uint64_t GetGeneration() const = 0;
+	};
+}
@@ -0,0 +1,174 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasLayout.cpp
+/// Description  :  Page management of the texture atlas, independent of the graphics API.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxAtlasLayout.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::Graphics
+{
+	AtlasLayout::AtlasLayout(uint32_t aPageSize, uint32_t aMaxPages)
+		: PageSize(aPageSize)
+		, MaxPages(aMaxPages)
+	{
+	}
+
+	bool AtlasLayout::Place(
+		void*        aKey,
+		uint32_t     aWidth,
+		uint32_t     aHeight,
+		CREATEPAGE   aCreatePage,
+		REPACKPAGE   aRepackPage,
+		uint32_t&    aOutPage,
+		AtlasRect_t& aOutRect
+	)
+	{
+		if (aWidth == 0 || aHeight == 0) { return false; }
+
+		uint64_t area = static_cast<uint64_t>(aWidth) * aHeight;
+
+		uint32_t target = UINT32_MAX;
+
+		for (uint32_t i = 0; i < this->Pages.size(); i++)
+		{
+			if (this->Pages[i].Packer.Pack(aWidth, aHeight, aOutRect))
+			{
+				target = i;
+				break;
+			}
+		}
+
+		/* Reclaim space of removed entries, before allocating another page. */
+		if (target == UINT32_MAX)
+		{
+			for (uint32_t i = 0; i < this->Pages.size(); i++)
+			{
+				AtlasLayoutPage_t& page = this->Pages[i];
+
+				if (page.Packer.GetUsedArea() - page.LiveArea < area) { continue; }
+
+				if (this->Repack(i, aRepackPage) && page.Packer.Pack(aWidth, aHeight, aOutRect))
+				{
+					target = i;
+					break;
+				}
+			}
+		}
+
+		if (target == UINT32_MAX && this->Pages.size() < this->MaxPages)
+		{
+			AtlasLayoutPage_t page{ AtlasPacker{ this->PageSize, this->PageSize }, {}, 0 };
+
+			if (page.Packer.Pack(aWidth, aHeight, aOutRect) && aCreatePage && aCreatePage())
+			{
+				target = static_cast<uint32_t>(this->Pages.size());
+				this->Pages.push_back(std::move(page));
+			}
+		}
+
+		if (target == UINT32_MAX) { return false; }
+
+		AtlasLayoutPage_t& page = this->Pages[target];
+		page.Entries.push_back(AtlasEntry_t{ aKey, aOutRect });
+		page.LiveArea += area;
+
+		aOutPage = target;
+
+		return true;
+	}
+
+	bool AtlasLayout::Remove(void* aKey)
+	{
+		for (AtlasLayoutPage_t& page : this->Pages)
+		{
+			auto it = std::find_if(page.Entries.begin(), page.Entries.end(), [aKey](const AtlasEntry_t& aEntry)
+			{
+				return aEntry.Key == aKey;
+			});
+
+			if (it == page.Entries.end()) { continue; }
+
+			page.LiveArea -= static_cast<uint64_t>(it->Rect.Width) * it->Rect.Height;
+			page.Entries.erase(it);
+
+			/* Last reference gone, the page is reused as is. */
+			if (page.Entries.empty())
+			{
+				page.Packer.Reset();
+				page.LiveArea = 0;
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	void AtlasLayout::Clear()
+	{
+		this->Pages.clear();
+	}
+
+	uint32_t AtlasLayout::GetPageCount() const
+	{
+		return static_cast<uint32_t>(this->Pages.size());
+	}
+
+	uint32_t AtlasLayout::GetEntryCount() const
+	{
+		uint32_t count = 0;
+
+		for (const AtlasLayoutPage_t& page : this->Pages)
+		{
+			count += static_cast<uint32_t>(page.Entries.size());
+		}
+
+		return count;
+	}
+
+	const AtlasLayoutPage_t& AtlasLayout::GetPage(uint32_t aPage) const
+	{
+		return this->Pages[aPage];
+	}
+
+	bool AtlasLayout::Repack(uint32_t aPage, REPACKPAGE& aRepackPage)
+	{
+		if (!aRepackPage) { return false; }
+
+		AtlasLayoutPage_t& page = this->Pages[aPage];
+
+		AtlasPacker packer{ this->PageSize, this->PageSize };
+		std::vector<AtlasEntry_t> entries = page.Entries;
+
+		/* Tallest first, packs tighter on a skyline. */
+		std::stable_sort(entries.begin(), entries.end(), [](const AtlasEntry_t& aLeft, const AtlasEntry_t& aRight)
+		{
+			return aLeft.Rect.Height > aRight.Rect.Height;
+		});
+
+		std::vector<AtlasMove_t> moves;
+		moves.reserve(entries.size());
+
+		for (AtlasEntry_t& entry : entries)
+		{
+			AtlasRect_t rect{};
+
+			if (!packer.Pack(entry.Rect.Width, entry.Rect.Height, rect)) { return false; }
+
+			moves.push_back(AtlasMove_t{ entry.Key, entry.Rect, rect });
+			entry.Rect = rect;
+		}
+
+		if (!aRepackPage(aPage, moves)) { return false; }
+
+		page.Packer = packer;
+		page.Entries = std::move(entries);
+
+		return true;
+	}
+}
@@ -0,0 +1,134 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasLayout.h
+/// Description  :  Page management of the texture atlas, independent of the graphics API.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "TxAtlasPacker.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasEntry_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AtlasEntry_t
+	{
+		void*       Key;
+		AtlasRect_t Rect;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasMove_t Struct
+	/// 	An entry relocated by repacking a page.
+	///----------------------------------------------------------------------------------------------------
+	struct AtlasMove_t
+	{
+		void*       Key;
+		AtlasRect_t From;
+		AtlasRect_t To;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasLayoutPage_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AtlasLayoutPage_t
+	{
+		AtlasPacker               Packer;
+		std::vector<AtlasEntry_t> Entries;      /* Live entries, the page is reset when the last one leaves. */
+		uint64_t                  LiveArea = 0; /* Packed area still in use, the rest is reclaimed by repacking. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasLayout Class
+	/// 	Decides which page and rect an entry is placed at. The owner creates the resources of new pages
+	/// 	and moves the contents of repacked pages through the callbacks, the layout only changes if
+	/// 	they succeed. Not thread-safe.
+	///----------------------------------------------------------------------------------------------------
+	class AtlasLayout
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Creates the resources of the page appended next. Returns false on failure.
+		///----------------------------------------------------------------------------------------------------
+		using CREATEPAGE = std::function<bool()>;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Moves the contents of a page to the new rects. Returns false on failure, the page is kept as is.
+		///----------------------------------------------------------------------------------------------------
+		using REPACKPAGE = std::function<bool(uint32_t aPage, const std::vector<AtlasMove_t>& aMoves)>;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		AtlasLayout(uint32_t aPageSize, uint32_t aMaxPages);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Place:
+		/// 	Places an entry of the given size. Tries the existing pages first, then reclaims the space of
+		/// 	removed entries by repacking, then appends a page.
+		/// 	Returns false, if there is no space left.
+		///----------------------------------------------------------------------------------------------------
+		bool Place(
+			void*        aKey,
+			uint32_t     aWidth,
+			uint32_t     aHeight,
+			CREATEPAGE   aCreatePage,
+			REPACKPAGE   aRepackPage,
+			uint32_t&    aOutPage,
+			AtlasRect_t& aOutRect
+		);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Removes an entry. Returns false, if it was not placed.
+		///----------------------------------------------------------------------------------------------------
+		bool Remove(void* aKey);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Removes all entries and pages.
+		///----------------------------------------------------------------------------------------------------
+		void Clear();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPageCount:
+		/// 	Returns the number of pages.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetPageCount() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetEntryCount:
+		/// 	Returns the number of placed entries.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetEntryCount() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPage:
+		/// 	Returns a page.
+		///----------------------------------------------------------------------------------------------------
+		const AtlasLayoutPage_t& GetPage(uint32_t aPage) const;
+
+		private:
+		uint32_t                       PageSize;
+		uint32_t                       MaxPages;
+		std::vector<AtlasLayoutPage_t> Pages;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Repack:
+		/// 	Packs the live entries of a page anew, tallest first.
+		/// 	Returns false, if they do not fit or the owner failed to move them.
+		///----------------------------------------------------------------------------------------------------
+		bool Repack(uint32_t aPage, REPACKPAGE& aRepackPage);
+	};
+}
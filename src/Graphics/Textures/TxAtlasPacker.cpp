@@ -0,0 +1,137 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasPacker.cpp
+/// Description  :  Skyline rectangle packer for texture atlas pages.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxAtlasPacker.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::Graphics
+{
+	AtlasPacker::AtlasPacker(uint32_t aWidth, uint32_t aHeight)
+		: Width(aWidth)
+		, Height(aHeight)
+	{
+		this->Reset();
+	}
+
+	bool AtlasPacker::Pack(uint32_t aWidth, uint32_t aHeight, AtlasRect_t& aOutRect)
+	{
+		if (aWidth == 0 || aHeight == 0) { return false; }
+
+		size_t   bestIndex  = this->Skyline.size();
+		uint32_t bestY      = UINT32_MAX;
+		uint32_t bestWidth  = UINT32_MAX;
+
+		/* Lowest top edge wins, ties go to the narrower segment to keep wide gaps open. */
+		for (size_t i = 0; i < this->Skyline.size(); i++)
+		{
+			uint32_t y = 0;
+
+			if (!this->Fit(i, aWidth, aHeight, y)) { continue; }
+
+			if (y < bestY || (y == bestY && this->Skyline[i].Width < bestWidth))
+			{
+				bestIndex = i;
+				bestY     = y;
+				bestWidth = this->Skyline[i].Width;
+			}
+		}
+
+		if (bestIndex == this->Skyline.size()) { return false; }
+
+		aOutRect = AtlasRect_t{ this->Skyline[bestIndex].X, bestY, aWidth, aHeight };
+
+		/* Raise the skyline under the new rectangle. */
+		this->Skyline.insert(this->Skyline.begin() + bestIndex, SkylineNode_t{ aOutRect.X, bestY + aHeight, aWidth });
+
+		uint32_t right = aOutRect.X + aWidth;
+
+		for (size_t i = bestIndex + 1; i < this->Skyline.size();)
+		{
+			SkylineNode_t& node = this->Skyline[i];
+
+			if (node.X >= right) { break; }
+
+			uint32_t overlap = right - node.X;
+
+			if (overlap >= node.Width)
+			{
+				this->Skyline.erase(this->Skyline.begin() + i);
+				continue;
+			}
+
+			node.X     += overlap;
+			node.Width -= overlap;
+			break;
+		}
+
+		/* Merge neighbours at the same height. */
+		for (size_t i = 0; i + 1 < this->Skyline.size();)
+		{
+			if (this->Skyline[i].Y == this->Skyline[i + 1].Y)
+			{
+				this->Skyline[i].Width += this->Skyline[i + 1].Width;
+				this->Skyline.erase(this->Skyline.begin() + i + 1);
+				continue;
+			}
+
+			i++;
+		}
+
+		this->UsedArea += static_cast<uint64_t>(aWidth) * aHeight;
+
+		return true;
+	}
+
+	void AtlasPacker::Reset()
+	{
+		this->Skyline.clear();
+		this->Skyline.push_back(SkylineNode_t{ 0, 0, this->Width });
+		this->UsedArea = 0;
+	}
+
+	uint32_t AtlasPacker::GetWidth() const
+	{
+		return this->Width;
+	}
+
+	uint32_t AtlasPacker::GetHeight() const
+	{
+		return this->Height;
+	}
+
+	uint64_t AtlasPacker::GetUsedArea() const
+	{
+		return this->UsedArea;
+	}
+
+	bool AtlasPacker::Fit(size_t aIndex, uint32_t aWidth, uint32_t aHeight, uint32_t& aOutY) const
+	{
+		uint32_t x = this->Skyline[aIndex].X;
+
+		if (x + aWidth > this->Width) { return false; }
+
+		uint32_t y = 0;
+		uint32_t remaining = aWidth;
+
+		/* The rectangle rests on the highest node it spans. */
+		for (size_t i = aIndex; remaining > 0; i++)
+		{
+			if (i >= this->Skyline.size()) { return false; }
+
+			y = (std::max)(y, this->Skyline[i].Y);
+
+			if (y + aHeight > this->Height) { return false; }
+
+			remaining -= (std::min)(remaining, this->Skyline[i].Width);
+		}
+
+		aOutY = y;
+		return true;
+	}
+}
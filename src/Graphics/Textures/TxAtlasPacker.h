@@ -0,0 +1,97 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasPacker.h
+/// Description  :  Skyline rectangle packer for texture atlas pages.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasRect_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AtlasRect_t
+	{
+		uint32_t X;
+		uint32_t Y;
+		uint32_t Width;
+		uint32_t Height;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AtlasPacker Class
+	/// 	Bottom-left skyline packer. Rectangles cannot be freed individually, a page is repacked instead.
+	///----------------------------------------------------------------------------------------------------
+	class AtlasPacker
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		AtlasPacker(uint32_t aWidth, uint32_t aHeight);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Pack:
+		/// 	Finds a place for a rectangle of the given size.
+		/// 	Returns false, if it does not fit anymore.
+		///----------------------------------------------------------------------------------------------------
+		bool Pack(uint32_t aWidth, uint32_t aHeight, AtlasRect_t& aOutRect);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Reset:
+		/// 	Clears all packed rectangles.
+		///----------------------------------------------------------------------------------------------------
+		void Reset();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetWidth:
+		/// 	Returns the width of the packed area.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetWidth() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetHeight:
+		/// 	Returns the height of the packed area.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetHeight() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetUsedArea:
+		/// 	Returns the area of all rectangles packed since the last reset.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetUsedArea() const;
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// SkylineNode_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct SkylineNode_t
+		{
+			uint32_t X;
+			uint32_t Y;
+			uint32_t Width;
+		};
+
+		uint32_t                   Width;
+		uint32_t                   Height;
+		uint64_t                   UsedArea = 0;
+		std::vector<SkylineNode_t> Skyline;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Fit:
+		/// 	Returns the lowest y at which a rectangle starting at the given node fits.
+		/// 	Returns false, if it does not fit at that node.
+		///----------------------------------------------------------------------------------------------------
+		bool Fit(size_t aIndex, uint32_t aWidth, uint32_t aHeight, uint32_t& aOutY) const;
+	};
+}
@@ -0,0 +1,213 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxBudget.cpp
+/// Description  :  Texture memory accounting and least recently used eviction policy.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxBudget.h"
+
+#include <algorithm>
+
+#include "Memory/ResourceLedger.h"
+
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// Account:
+	/// 	Adds or removes a resident texture from the usage of its owner.
+	///----------------------------------------------------------------------------------------------------
+	static void Account(const TextureRecord_t& aRecord, int64_t aSign)
+	{
+		Memory::ResourceLedger* ledger = Memory::ResourceLedger::Get();
+		ledger->Add(aRecord.Owner, Memory::EResource::Textures, aSign);
+		ledger->Add(aRecord.Owner, Memory::EResource::TextureBytes, aSign * static_cast<int64_t>(aRecord.Size));
+	}
+
+	/*static*/ uint64_t TextureBudget::GetSize(uint32_t aWidth, uint32_t aHeight, uint32_t aBytesPerPixel, uint32_t aMipLevels)
+	{
+		uint64_t size = 0;
+		uint64_t width = aWidth;
+		uint64_t height = aHeight;
+
+		for (uint32_t i = 0; i < aMipLevels; i++)
+		{
+			size += width * height * aBytesPerPixel;
+			width = (std::max)(width / 2, uint64_t{ 1 });
+			height = (std::max)(height / 2, uint64_t{ 1 });
+		}
+
+		return size;
+	}
+
+	void TextureBudget::Track(const std::string& aIdentifier, Texture_t* aTexture, uint64_t aSize, void* aOwner, uint64_t aCacheKey, const TextureSource_t& aSource)
+	{
+		TextureSource_t source = aSource;
+
+		auto it = this->Records.find(aIdentifier);
+
+		if (it != this->Records.end())
+		{
+			if (!it->second.IsEvicted)
+			{
+				this->ResidentSize -= it->second.Size;
+				Account(it->second, -1);
+			}
+
+			/* A restore keeps the original owner and, if mapped from the cache, the source. */
+			aOwner = it->second.Owner;
+
+			if (source.Kind == ETextureSource::None)
+			{
+				source = it->second.Source;
+			}
+		}
+
+		TextureRecord_t& record = this->Records[aIdentifier];
+		record.Texture   = aTexture;
+		record.Size      = aSize;
+		record.Owner     = aOwner;
+		record.CacheKey  = aCacheKey;
+		record.Source    = source;
+		record.IsEvicted = false;
+		record.EvictedAt = 0;
+
+		this->ResidentSize += aSize;
+		Account(record, 1);
+	}
+
+	void TextureBudget::Rename(const std::string& aIdentifier, const std::string& aNewIdentifier)
+	{
+		auto it = this->Records.find(aIdentifier);
+
+		if (it == this->Records.end()) { return; }
+
+		this->Records[aNewIdentifier] = it->second;
+		this->Records.erase(aIdentifier);
+	}
+
+	void TextureBudget::Remove(const std::string& aIdentifier)
+	{
+		auto it = this->Records.find(aIdentifier);
+
+		if (it == this->Records.end()) { return; }
+
+		if (!it->second.IsEvicted)
+		{
+			this->ResidentSize -= it->second.Size;
+			Account(it->second, -1);
+		}
+
+		this->Records.erase(it);
+	}
+
+	void TextureBudget::SetEvicted(const std::string& aIdentifier, long long aTime)
+	{
+		auto it = this->Records.find(aIdentifier);
+
+		if (it == this->Records.end() || it->second.IsEvicted) { return; }
+
+		it->second.IsEvicted = true;
+		it->second.EvictedAt = aTime;
+
+		this->ResidentSize -= it->second.Size;
+		Account(it->second, -1);
+	}
+
+	void TextureBudget::ClearSources(void* aStartAddress, void* aEndAddress)
+	{
+		for (auto& [identifier, record] : this->Records)
+		{
+			if (record.Source.Kind != ETextureSource::Resource) { continue; }
+
+			if (record.Source.Module >= aStartAddress && record.Source.Module <= aEndAddress)
+			{
+				record.Source = TextureSource_t{};
+			}
+		}
+	}
+
+	void TextureBudget::Clear()
+	{
+		for (const auto& [identifier, record] : this->Records)
+		{
+			if (!record.IsEvicted)
+			{
+				Account(record, -1);
+			}
+		}
+
+		this->Records.clear();
+		this->ResidentSize = 0;
+	}
+
+	const TextureRecord_t* TextureBudget::Find(const std::string& aIdentifier) const
+	{
+		auto it = this->Records.find(aIdentifier);
+
+		return it != this->Records.end() ? &it->second : nullptr;
+	}
+
+	std::vector<std::string> TextureBudget::SelectEvictions(
+		uint64_t                                                             aBudget,
+		long long                                                            aNow,
+		long long                                                            aMinIdleMs,
+		const std::function<bool(const std::string&, const TextureRecord_t&)>& aCanEvict
+	) const
+	{
+		std::vector<std::string> result;
+
+		if (aBudget == 0 || this->ResidentSize <= aBudget) { return result; }
+
+		std::vector<std::pair<long long, const std::string*>> candidates;
+
+		for (const auto& [identifier, record] : this->Records)
+		{
+			if (record.IsEvicted)                             { continue; }
+			if (aNow - record.Texture->LastUsed < aMinIdleMs) { continue; }
+			if (aCanEvict && !aCanEvict(identifier, record))  { continue; }
+
+			candidates.emplace_back(record.Texture->LastUsed, &identifier);
+		}
+
+		std::sort(candidates.begin(), candidates.end());
+
+		uint64_t resident = this->ResidentSize;
+
+		for (const auto& [lastUsed, identifier] : candidates)
+		{
+			if (resident <= aBudget) { break; }
+
+			resident -= this->Records.at(*identifier).Size;
+			result.push_back(*identifier);
+		}
+
+		return result;
+	}
+
+	std::vector<std::string> TextureBudget::SelectRestores() const
+	{
+		std::vector<std::string> result;
+
+		for (const auto& [identifier, record] : this->Records)
+		{
+			if (record.IsEvicted && record.Texture->LastUsed > record.EvictedAt)
+			{
+				result.push_back(identifier);
+			}
+		}
+
+		return result;
+	}
+
+	uint64_t TextureBudget::GetResidentSize() const
+	{
+		return this->ResidentSize;
+	}
+
+	const std::map<std::string, TextureRecord_t>& TextureBudget::GetRecords() const
+	{
+		return this->Records;
+	}
+}
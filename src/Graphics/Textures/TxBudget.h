@@ -0,0 +1,131 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxBudget.h
+/// Description  :  Texture memory accounting and least recently used eviction policy.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "TxSource.h"
+#include "TxTexture.h"
+
+constexpr const long long TEXBUDGET_MINIDLE_MS = 30000; /* Textures used more recently are never evicted. */
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// TextureRecord_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct TextureRecord_t
+	{
+		Texture_t*      Texture;
+		uint64_t        Size;      /* Width * Height * Bytes per pixel * Mips */
+		void*           Owner;     /* Module that requested the texture, nullptr for Nexus. */
+		uint64_t        CacheKey;  /* Disk cache key of the pixels, 0 if not cached. */
+		TextureSource_t Source;    /* Decoded again, if the pixels are no longer cached. */
+		bool            IsEvicted;
+		long long       EvictedAt;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// TextureBudget Class
+	/// 	Not thread-safe, guarded by the owning loader.
+	///----------------------------------------------------------------------------------------------------
+	class TextureBudget
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// GetSize:
+		/// 	Returns the bytes a texture occupies in video memory.
+		///----------------------------------------------------------------------------------------------------
+		static uint64_t GetSize(uint32_t aWidth, uint32_t aHeight, uint32_t aBytesPerPixel = 4, uint32_t aMipLevels = 1);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Track:
+		/// 	Adds or refreshes a resident texture.
+		///----------------------------------------------------------------------------------------------------
+		void Track(const std::string& aIdentifier, Texture_t* aTexture, uint64_t aSize, void* aOwner, uint64_t aCacheKey, const TextureSource_t& aSource);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Rename:
+		/// 	Moves a record to another identifier.
+		///----------------------------------------------------------------------------------------------------
+		void Rename(const std::string& aIdentifier, const std::string& aNewIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Drops the record of a texture.
+		///----------------------------------------------------------------------------------------------------
+		void Remove(const std::string& aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetEvicted:
+		/// 	Marks a texture as evicted.
+		///----------------------------------------------------------------------------------------------------
+		void SetEvicted(const std::string& aIdentifier, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ClearSources:
+		/// 	Forgets the sources of embedded resources within the given address space, e.g. of a module that
+		/// 	is about to be unloaded.
+		///----------------------------------------------------------------------------------------------------
+		void ClearSources(void* aStartAddress, void* aEndAddress);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Drops all records.
+		///----------------------------------------------------------------------------------------------------
+		void Clear();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the record of a texture or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const TextureRecord_t* Find(const std::string& aIdentifier) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// SelectEvictions:
+		/// 	Returns the least recently used textures to evict until the resident size fits the budget.
+		/// 	Textures used within aMinIdleMs and those rejected by aCanEvict are kept.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<std::string> SelectEvictions(
+			uint64_t                                                             aBudget,
+			long long                                                            aNow,
+			long long                                                            aMinIdleMs,
+			const std::function<bool(const std::string&, const TextureRecord_t&)>& aCanEvict
+		) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// SelectRestores:
+		/// 	Returns evicted textures that were used again since their eviction.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<std::string> SelectRestores() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetResidentSize:
+		/// 	Returns the bytes of all resident textures.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetResidentSize() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRecords:
+		/// 	Returns all records.
+		///----------------------------------------------------------------------------------------------------
+		const std::map<std::string, TextureRecord_t>& GetRecords() const;
+
+		private:
+		std::map<std::string, TextureRecord_t> Records;
+		uint64_t                               ResidentSize = 0;
+	};
+}
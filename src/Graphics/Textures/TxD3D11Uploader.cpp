@@ -0,0 +1,74 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxD3D11Uploader.cpp
+/// Description  :  Creates texture resources on the game's D3D11 device.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxD3D11Uploader.h"
+
+#include <d3d11.h>
+
+namespace Raidcore::Nexus::Graphics
+{
+	D3D11TextureUploader::D3D11TextureUploader(Graphics::Window_t& aGrWindow)
+		: GrWindow(aGrWindow)
+	{
+	}
+
+	bool D3D11TextureUploader::IsReady() const
+	{
+		return this->GrWindow.Device != nullptr && this->GrWindow.DeviceContext != nullptr;
+	}
+
+	ID3D11ShaderResourceView* D3D11TextureUploader::Create(uint32_t aWidth, uint32_t aHeight, const uint8_t* aData)
+	{
+		if (this->GrWindow.Device == nullptr) { return nullptr; }
+
+		/* Create texture description. */
+		D3D11_TEXTURE2D_DESC desc{};
+		desc.Width            = aWidth;
+		desc.Height           = aHeight;
+		desc.MipLevels        = 1;
+		desc.ArraySize        = 1;
+		desc.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage            = D3D11_USAGE_DEFAULT;
+		desc.BindFlags        = D3D11_BIND_SHADER_RESOURCE;
+		desc.CPUAccessFlags   = 0;
+
+		/* Create Texture. */
+		D3D11_SUBRESOURCE_DATA subResource{};
+		subResource.pSysMem          = aData;
+		subResource.SysMemPitch      = desc.Width * 4;
+		subResource.SysMemSlicePitch = 0;
+
+		ID3D11Texture2D* pTexture = nullptr;
+		this->GrWindow.Device->CreateTexture2D(&desc, &subResource, &pTexture);
+
+		if (!pTexture) { return nullptr; }
+
+		/* Create SRV. */
+		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+		srvDesc.Format                    = DXGI_FORMAT_R8G8B8A8_UNORM;
+		srvDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MipLevels       = desc.MipLevels;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+
+		ID3D11ShaderResourceView* srv = nullptr;
+		this->GrWindow.Device->CreateShaderResourceView(pTexture, &srvDesc, &srv);
+
+		/* The view holds its own reference. */
+		pTexture->Release();
+
+		return srv;
+	}
+
+	void D3D11TextureUploader::Release(ID3D11ShaderResourceView* aResource)
+	{
+		if (!aResource) { return; }
+
+		aResource->Release();
+	}
+}
@@ -0,0 +1,51 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxD3D11Uploader.h
+/// Description  :  Creates texture resources on the game's D3D11 device.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "TxUploader.h"
+#include "Graphics/GrWindow.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// D3D11TextureUploader Class
+	///----------------------------------------------------------------------------------------------------
+	class D3D11TextureUploader : public virtual ITextureUploader
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		D3D11TextureUploader(Graphics::Window_t& aGrWindow);
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsReady:
+		/// 	Returns true if the device and its context are set.
+		///----------------------------------------------------------------------------------------------------
+		bool IsReady() const override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Create:
+		/// 	Creates a shader resource from RGBA8 pixels.
+		///----------------------------------------------------------------------------------------------------
+		ID3D11ShaderResourceView* Create(uint32_t aWidth, uint32_t aHeight, const uint8_t* aData) override;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Release:
+		/// 	Releases a shader resource.
+		///----------------------------------------------------------------------------------------------------
+		void Release(ID3D11ShaderResourceView* aResource) override;
+
+		private:
+		Graphics::Window_t& GrWindow;
+	};
+}
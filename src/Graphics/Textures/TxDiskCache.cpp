@@ -0,0 +1,319 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxDiskCache.cpp
+/// Description  :  Persistent cache of decoded textures, keyed by their source data.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxDiskCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TxFileMapping.h"
+
+namespace Raidcore::Nexus::Graphics
+{
+	constexpr const char* LOG_CHANNEL = "TextureCache";
+
+	static uint64_t Now()
+	{
+		return std::filesystem::file_time_type::clock::now().time_since_epoch().count();
+	}
+
+	TextureDiskCache::TextureDiskCache(Core::LogApi& aLogger, std::filesystem::path aDirectory, uint64_t aCapacity)
+		: Logger(aLogger)
+		, Directory(aDirectory)
+		, Capacity(aCapacity)
+	{
+		std::error_code ec;
+
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->Directory, ec))
+		{
+			if (!entry.is_regular_file(ec)) { continue; }
+
+			std::filesystem::path path = entry.path();
+
+			/* Leftovers of an interrupted write. */
+			if (path.extension() != TEXCACHE_EXT)
+			{
+				std::filesystem::remove(path, ec);
+				continue;
+			}
+
+			uint64_t key = 0;
+
+			try
+			{
+				key = std::stoull(path.stem().string(), nullptr, 16);
+			}
+			catch (...)
+			{
+				std::filesystem::remove(path, ec);
+				continue;
+			}
+
+			Entry_t cached{};
+			cached.Size    = entry.file_size(ec);
+			cached.LastUse = entry.last_write_time(ec).time_since_epoch().count();
+
+			this->Entries.emplace(key, cached);
+			this->Size += cached.Size;
+		}
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		this->Evict();
+
+		this->Logger.Debug(LOG_CHANNEL, "%u cached textures (%llu bytes).", static_cast<uint32_t>(this->Entries.size()), this->Size);
+	}
+
+	/*static*/ uint64_t TextureDiskCache::GetKey(const void* aData, size_t aSize)
+	{
+		/* FNV-1a, seeded with the decode parameters. */
+		uint64_t hash = 0xCBF29CE484222325;
+
+		auto mix = [&hash](const uint8_t* aBytes, size_t aLength)
+		{
+			for (size_t i = 0; i < aLength; i++)
+			{
+				hash ^= aBytes[i];
+				hash *= 0x100000001B3;
+			}
+		};
+
+		const uint32_t params[] = { TEXCACHE_VERSION, 4 /* RGBA8 */ };
+		mix(reinterpret_cast<const uint8_t*>(params), sizeof(params));
+		mix(static_cast<const uint8_t*>(aData), aSize);
+
+		return hash;
+	}
+
+	bool TextureDiskCache::Contains(uint64_t aKey) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Entries.find(aKey) != this->Entries.end();
+	}
+
+	bool TextureDiskCache::Load(uint64_t aKey, CachedTexture_t& aOutTexture)
+	{
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			if (this->Entries.find(aKey) == this->Entries.end())
+			{
+				this->Misses++;
+				return false;
+			}
+		}
+
+		std::filesystem::path path = this->GetPath(aKey);
+
+		uint64_t fileSize = 0;
+		void* view = MapFile(path, fileSize);
+
+		const TexCacheHeader_t* header = static_cast<const TexCacheHeader_t*>(view);
+
+		bool isValid = header
+			&& fileSize >= sizeof(TexCacheHeader_t)
+			&& header->Magic == TEXCACHE_MAGIC
+			&& header->Version == TEXCACHE_VERSION
+			&& header->Key == aKey
+			&& header->DataSize == static_cast<uint64_t>(header->Width) * header->Height * 4
+			&& sizeof(TexCacheHeader_t) + header->DataSize <= fileSize;
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!isValid)
+		{
+			UnmapFile(view);
+
+			this->Logger.Debug(LOG_CHANNEL, "Dropped invalid cache file %s.", path.filename().string().c_str());
+			this->Remove(aKey);
+			this->Misses++;
+			return false;
+		}
+
+		auto it = this->Entries.find(aKey);
+
+		if (it != this->Entries.end())
+		{
+			std::error_code ec;
+			it->second.LastUse = Now();
+			std::filesystem::last_write_time(path, std::filesystem::file_time_type(std::filesystem::file_time_type::duration(it->second.LastUse)), ec);
+		}
+
+		aOutTexture.Width  = header->Width;
+		aOutTexture.Height = header->Height;
+		aOutTexture.Data   = reinterpret_cast<const uint8_t*>(header + 1);
+		aOutTexture.View   = view;
+
+		this->Hits++;
+		return true;
+	}
+
+	/*static*/ void TextureDiskCache::Release(void* aView)
+	{
+		UnmapFile(aView);
+	}
+
+	void TextureDiskCache::Store(uint64_t aKey, uint32_t aWidth, uint32_t aHeight, const uint8_t* aData)
+	{
+		if (!aData || aWidth == 0 || aHeight == 0) { return; }
+
+		TexCacheHeader_t header{};
+		header.Magic    = TEXCACHE_MAGIC;
+		header.Version  = TEXCACHE_VERSION;
+		header.Key      = aKey;
+		header.Width    = aWidth;
+		header.Height   = aHeight;
+		header.DataSize = static_cast<uint64_t>(aWidth) * aHeight * 4;
+
+		uint64_t size = sizeof(TexCacheHeader_t) + header.DataSize;
+
+		/* Larger than the whole cache, would only evict everything else. */
+		if (size > this->Capacity) { return; }
+
+		std::filesystem::path path = this->GetPath(aKey);
+		std::filesystem::path tmpPath = path;
+		tmpPath += ".";
+		tmpPath += std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+		std::error_code ec;
+
+		{
+			std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(aData), header.DataSize);
+
+			if (!file)
+			{
+				file.close();
+				std::filesystem::remove(tmpPath, ec);
+				this->Logger.Debug(LOG_CHANNEL, "Failed writing %s.", tmpPath.filename().string().c_str());
+				return;
+			}
+		}
+
+		/* Readers only ever see complete files. */
+		std::filesystem::rename(tmpPath, path, ec);
+
+		if (ec)
+		{
+			std::filesystem::remove(tmpPath, ec);
+			return;
+		}
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Entries.find(aKey);
+
+		if (it != this->Entries.end())
+		{
+			this->Size -= it->second.Size;
+		}
+
+		this->Entries[aKey] = Entry_t{ size, Now() };
+		this->Size += size;
+
+		this->Evict();
+	}
+
+	void TextureDiskCache::Pin(uint64_t aKey)
+	{
+		if (aKey == 0) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Pins[aKey]++;
+	}
+
+	void TextureDiskCache::Unpin(uint64_t aKey)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Pins.find(aKey);
+
+		if (it == this->Pins.end()) { return; }
+
+		if (--it->second == 0)
+		{
+			this->Pins.erase(it);
+		}
+	}
+
+	uint64_t TextureDiskCache::GetSize() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Size;
+	}
+
+	uint64_t TextureDiskCache::GetHits() const
+	{
+		return this->Hits;
+	}
+
+	uint64_t TextureDiskCache::GetMisses() const
+	{
+		return this->Misses;
+	}
+
+	std::filesystem::path TextureDiskCache::GetPath(uint64_t aKey) const
+	{
+		char name[17]{};
+		std::snprintf(name, sizeof(name), "%016llX", static_cast<unsigned long long>(aKey));
+
+		return this->Directory / (name + std::string{ TEXCACHE_EXT });
+	}
+
+	void TextureDiskCache::Remove(uint64_t aKey)
+	{
+		auto it = this->Entries.find(aKey);
+
+		if (it == this->Entries.end()) { return; }
+
+		std::error_code ec;
+		std::filesystem::remove(this->GetPath(aKey), ec);
+
+		this->Size -= it->second.Size;
+		this->Entries.erase(it);
+	}
+
+	void TextureDiskCache::Evict()
+	{
+		if (this->Size <= this->Capacity) { return; }
+
+		std::vector<std::pair<uint64_t, uint64_t>> byLastUse;
+		byLastUse.reserve(this->Entries.size());
+
+		for (const auto& [key, entry] : this->Entries)
+		{
+			if (this->Pins.find(key) != this->Pins.end()) { continue; }
+
+			byLastUse.emplace_back(entry.LastUse, key);
+		}
+
+		std::sort(byLastUse.begin(), byLastUse.end());
+
+		/* Evict down to three quarters, so a full cache does not evict on every store. */
+		uint64_t target = this->Capacity / 4 * 3;
+		uint32_t evicted = 0;
+
+		for (const auto& [lastUse, key] : byLastUse)
+		{
+			if (this->Size <= target) { break; }
+
+			this->Remove(key);
+			evicted++;
+		}
+
+		this->Logger.Debug(LOG_CHANNEL, "Evicted %u textures, %llu bytes remaining.", evicted, this->Size);
+	}
+}
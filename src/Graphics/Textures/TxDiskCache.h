@@ -0,0 +1,175 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxDiskCache.h
+/// Description  :  Persistent cache of decoded textures, keyed by their source data.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+#include "Core/Logging/LogApi.h"
+
+constexpr const uint32_t TEXCACHE_MAGIC    = 0x4354584E; /* "NXTC" */
+constexpr const uint32_t TEXCACHE_VERSION  = 1;          /* Part of the key, bump when decoding changes. */
+constexpr const uint64_t TEXCACHE_CAPACITY = 256ull * 1024 * 1024;
+constexpr const char*    TEXCACHE_EXT      = ".nxtc";
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// TexCacheHeader_t Struct
+	/// 	Precedes the RGBA8 pixels in a cache file.
+	///----------------------------------------------------------------------------------------------------
+	struct TexCacheHeader_t
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t Key;
+		uint32_t Width;
+		uint32_t Height;
+		uint64_t DataSize;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// CachedTexture_t Struct
+	/// 	Pixels point into the mapped file, valid until released.
+	///----------------------------------------------------------------------------------------------------
+	struct CachedTexture_t
+	{
+		uint32_t       Width;
+		uint32_t       Height;
+		const uint8_t* Data;
+		void*          View;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// TextureDiskCache Class
+	/// 	One file per decoded texture, named after its key. Hits are mapped instead of read, the least
+	/// 	recently used files are deleted once the cache exceeds its capacity.
+	///----------------------------------------------------------------------------------------------------
+	class TextureDiskCache
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		TextureDiskCache(Core::LogApi& aLogger, std::filesystem::path aDirectory, uint64_t aCapacity = TEXCACHE_CAPACITY);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~TextureDiskCache() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetKey:
+		/// 	Returns the cache key of encoded image data.
+		///----------------------------------------------------------------------------------------------------
+		static uint64_t GetKey(const void* aData, size_t aSize);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Contains:
+		/// 	Returns true, if the cache holds a texture for the given key.
+		///----------------------------------------------------------------------------------------------------
+		bool Contains(uint64_t aKey) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Load:
+		/// 	Maps the cached texture of the given key.
+		/// 	Returns false on a miss.
+		///----------------------------------------------------------------------------------------------------
+		bool Load(uint64_t aKey, CachedTexture_t& aOutTexture);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Release:
+		/// 	Unmaps a texture returned by Load.
+		///----------------------------------------------------------------------------------------------------
+		static void Release(void* aView);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Store:
+		/// 	Writes decoded RGBA8 pixels to the cache.
+		///----------------------------------------------------------------------------------------------------
+		void Store(uint64_t aKey, uint32_t aWidth, uint32_t aHeight, const uint8_t* aData);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Pin:
+		/// 	Keeps the file of a key from being evicted, e.g. while it is the only copy of a texture.
+		///----------------------------------------------------------------------------------------------------
+		void Pin(uint64_t aKey);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Unpin:
+		/// 	Releases a pin, the file is evicted as usual once all pins are released.
+		///----------------------------------------------------------------------------------------------------
+		void Unpin(uint64_t aKey);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetSize:
+		/// 	Returns the size of all cached files in bytes.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetSize() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetHits:
+		/// 	Returns the amount of loads served from the cache.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetHits() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetMisses:
+		/// 	Returns the amount of loads that had to be decoded.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetMisses() const;
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Entry_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Entry_t
+		{
+			uint64_t Size;
+			uint64_t LastUse; /* Ticks of the file write time, touched on every hit. */
+		};
+
+		Core::LogApi&                          Logger;
+		std::filesystem::path                  Directory;
+		uint64_t                               Capacity;
+
+		mutable std::mutex                     Mutex;
+		std::unordered_map<uint64_t, Entry_t>  Entries;
+		std::unordered_map<uint64_t, uint32_t> Pins; /* Pin count by key. */
+		uint64_t                               Size = 0;
+
+		std::atomic<uint64_t>                  Hits{ 0 };
+		std::atomic<uint64_t>                  Misses{ 0 };
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPath:
+		/// 	Returns the file path of a key.
+		///----------------------------------------------------------------------------------------------------
+		std::filesystem::path GetPath(uint64_t aKey) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Deletes the file of a key. Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Remove(uint64_t aKey);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Evict:
+		/// 	Deletes the least recently used files that are not pinned, until the cache is below its capacity.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Evict();
+	};
+}
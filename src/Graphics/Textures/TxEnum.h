@@ -26,4 +26,16 @@ namespace Raidcore::Nexus::Graphics
 		Done = 3,
 		INVALID = UINT32_MAX
 	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// ETextureSource Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class ETextureSource : uint32_t
+	{
+		None = 0,
+		File = 1,
+		Resource = 2,
+		Remote = 3,
+		Memory = 4
+	};
 }
@@ -0,0 +1,51 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxFileMapping.cpp
+/// Description  :  Read-only file mappings of the texture disk cache.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxFileMapping.h"
+
+#include <windows.h>
+
+namespace Raidcore::Nexus::Graphics
+{
+	void* MapFile(const std::filesystem::path& aPath, uint64_t& aOutSize)
+	{
+		aOutSize = 0;
+
+		/* Share delete, so eviction does not fail on a mapped file. */
+		HANDLE file = CreateFileW(aPath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE) { return nullptr; }
+
+		LARGE_INTEGER fileSize{};
+		GetFileSizeEx(file, &fileSize);
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+
+		if (!mapping) { return nullptr; }
+
+		/* The view keeps the mapping alive. */
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+
+		if (view)
+		{
+			aOutSize = static_cast<uint64_t>(fileSize.QuadPart);
+		}
+
+		return view;
+	}
+
+	void UnmapFile(void* aView)
+	{
+		if (aView)
+		{
+			UnmapViewOfFile(aView);
+		}
+	}
+}
@@ -0,0 +1,31 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxFileMapping.h
+/// Description  :  Read-only file mappings of the texture disk cache.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// MapFile:
+	/// 	Maps a whole file read-only. The file may be deleted while it is mapped.
+	/// 	Returns the view or nullptr, if the file could not be mapped.
+	///----------------------------------------------------------------------------------------------------
+	void* MapFile(const std::filesystem::path& aPath, uint64_t& aOutSize);
+
+	///----------------------------------------------------------------------------------------------------
+	/// UnmapFile:
+	/// 	Releases a view returned by MapFile.
+	///----------------------------------------------------------------------------------------------------
+	void UnmapFile(void* aView);
+}
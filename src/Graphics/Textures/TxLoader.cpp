@@ -8,18 +8,18 @@
 
 #include "TxLoader.h"
 
-#include <d3d11.h>
 #include <filesystem>
+#include <vector>
 
 #pragma warning(push, 0)
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb/stb_image.h"
 #include "httplib/httplib.h"
 #pragma warning(pop)
 
 #include "thirdparty/Clockwork/Dispatcher.h"
 namespace Clockwork = Raidcore::Clockwork;
 
+#include "Core/Settings/SettingsConst.h"
+#include "Memory/ResourceLedger.h"
 #include "Util/Time.h"
 #include "Util/Url.h"
 
@@ -30,17 +30,47 @@ namespace Raidcore::Nexus::Graphics
 	TextureLoader::TextureLoader(
 		Core::LogApi&         aLogger,
 		Graphics::Window_t&   aGrWindow,
-		std::filesystem::path aOverridesDirectory
+		ITextureUploader&     aUploader,
+		Core::SettingsMgr&    aSettings,
+		std::filesystem::path aOverridesDirectory,
+		std::filesystem::path aCacheDirectory
 	)
 		: IRefCleaner("TextureLoader")
 		, Logger(aLogger)
-		, GrWindow(aGrWindow)
-		, OverridesDirectory(aOverridesDirectory)
+		, Settings(aSettings)
+		, Atlas(aLogger, aGrWindow)
+		, Store(aLogger, aUploader, Atlas, aCacheDirectory)
+		, Overrides(aLogger, aOverridesDirectory)
 	{
+		this->Store.SetAtlasEnabled(this->Settings.Get<bool>(OPT_TEXTUREATLAS, false));
+
+		this->Settings.Subscribe<bool>(OPT_TEXTUREATLAS, [&](bool aEnabled)
+		{
+			this->Store.SetAtlasEnabled(aEnabled);
+		});
+
+		this->Store.SetBudget(static_cast<uint64_t>(this->Settings.Get<uint32_t>(OPT_TEXTUREBUDGET, 0)) * 1024 * 1024);
+
+		this->Settings.Subscribe<uint32_t>(OPT_TEXTUREBUDGET, [&](uint32_t aMegabytes)
+		{
+			this->Store.SetBudget(static_cast<uint64_t>(aMegabytes) * 1024 * 1024);
+		});
+
 		this->TextureWorker = Clockwork::Dispatcher<void>{[this](Clockwork::CancellationToken aToken)
 		{
 			this->ProcessDownloads(aToken);
 		}};
+
+		this->Overrides.Watch(
+			[this](const std::string& aIdentifier, const std::filesystem::path& aPath)
+			{
+				this->HotSwap(aIdentifier, aPath);
+			},
+			[this](const std::string& aIdentifier)
+			{
+				this->RevertOverride(aIdentifier);
+			}
+		);
 	}
 
 	TextureLoader::~TextureLoader()
@@ -50,312 +80,241 @@ namespace Raidcore::Nexus::Graphics
 
 	void TextureLoader::Shutdown()
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
-
-		for (auto it = this->Registry.begin(); it != this->Registry.end();)
-		{
-			/* Release texture. */
-			it->second->Resource->Release();
-
-			/* Deallocate wrapper. */
-			delete it->second;
-
-			/* Erase entry. */
-			it = this->Registry.erase(it);
-		}
+		this->Store.Shutdown();
 	}
 
 	void TextureLoader::Advance()
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		std::vector<std::pair<std::string, Texture_t*>> created;
+		std::vector<std::string> reloads;
 
-		long long now = Time::GetTimestampMs();
+		this->Store.Advance(Time::GetTimestampMs(), created, reloads);
 
-		for (auto it = this->QueuedTextures.begin(); it != this->QueuedTextures.end();)
+		/* Decoding locks on its own, the queue entries are already in place. */
+		for (const std::string& identifier : reloads)
 		{
-			switch (it->second.Stage)
-			{
-				default:
-				case ETextureStage::None:
-				case ETextureStage::Prepare:
-				{
-					if (now - it->second.Time > 60000)
-					{
-						this->Logger.Debug(LOG_CHANNEL, "Dropped texture with ID \"%s\" from queue after %dms at stage %d.", it->first.c_str(), now - it->second.Time, it->second.Stage);
-						it->second.Stage = ETextureStage::INVALID;
-						++it;
-					}
-					else
-					{
-						++it;
-					}
-					break;
-				}
-				case ETextureStage::Ready:
-				{
-					this->CreateTexture(it->first, it->second);
-					++it;
-					break;
-				}
-				case ETextureStage::Done:
-				case ETextureStage::INVALID:
-				{
-					if (it->second.Data)
-					{
-						stbi_image_free(it->second.Data);
-						it->second.Data = nullptr;
-					}
+			this->Reload(identifier);
+		}
 
-					/* Only dispatch invalid textures. Created (Done) already were dispatched. */
-					if (it->second.Stage == ETextureStage::INVALID && it->second.Callback)
-					{
-						this->DispatchTexture(it->first, nullptr, it->second.Callback);
-					}
+		if (created.empty()) { return; }
 
-					it = this->QueuedTextures.erase(it);
-					break;
-				}
+		/* Listeners may look up textures, so they are notified without holding the store lock. */
+		const std::lock_guard<std::mutex> lockListeners(this->ListenerMutex);
+
+		for (auto& [identifier, texture] : created)
+		{
+			for (auto& [handle, callback] : this->Listeners)
+			{
+				callback(identifier, texture);
 			}
 		}
 	}
 
 	Texture_t* TextureLoader::Get(const char* aIdentifier)
 	{
-		if (!aIdentifier) { return nullptr; }
-
-		Texture_t* result = nullptr;
-
-		const std::lock_guard<std::mutex> lock(this->Mutex);
-
-		auto it = this->Registry.find(aIdentifier);
-
-		if (it != this->Registry.end())
-		{
-			result = it->second;
-		}
-
-		return result;
+		return this->Store.Get(aIdentifier, Time::GetTimestampMs());
 	}
 
-	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, const char* aFilename)
+	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, const char* aFilename, void* aOwner)
 	{
 		Texture_t* result = Get(aIdentifier);
 
 		if (!result)
 		{
-			this->Load(aIdentifier, aFilename, nullptr);
+			this->Load(aIdentifier, aFilename, nullptr, false, aOwner);
 		}
 
 		return result;
 	}
 
-	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, unsigned aResourceID, HMODULE aModule)
+	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, void* aOwner)
 	{
 		Texture_t* result = this->Get(aIdentifier);
 
 		if (!result)
 		{
-			this->Load(aIdentifier, aResourceID, aModule, nullptr);
+			this->Load(aIdentifier, aResourceID, aModule, nullptr, false, aOwner);
 		}
 
 		return result;
 	}
 
-	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, const char* aRemote, const char* aEndpoint)
+	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, const char* aRemote, const char* aEndpoint, void* aOwner)
 	{
 		Texture_t* result = this->Get(aIdentifier);
 
 		if (!result)
 		{
-			this->Load(aIdentifier, aRemote, aEndpoint, nullptr);
+			this->Load(aIdentifier, aRemote, aEndpoint, nullptr, false, aOwner);
 		}
 
 		return result;
 	}
 
-	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, void* aData, size_t aSize)
+	Texture_t* TextureLoader::GetOrCreate(const char* aIdentifier, void* aData, size_t aSize, void* aOwner)
 	{
 		Texture_t* result = this->Get(aIdentifier);
 
 		if (!result)
 		{
-			this->Load(aIdentifier, aData, aSize, nullptr);
+			this->Load(aIdentifier, aData, aSize, nullptr, false, aOwner);
 		}
 
 		return result;
 	}
 
-	void TextureLoader::Load(const char* aIdentifier, const char* aFilename, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing)
+	void TextureLoader::Load(const char* aIdentifier, const char* aFilename, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, void* aOwner)
 	{
 		/* Preprocess the request to determine, if we should load. */
-		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing))
+		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing, TextureSource_t{ ETextureSource::File, aFilename }))
 		{
 			return;
 		}
 
 		/* Queue the callback. */
-		this->Enqueue(aIdentifier, aCallback);
+		this->Store.Enqueue(aIdentifier, aCallback, aOwner, Time::GetTimestampMs());
 
 		if (!std::filesystem::exists(aFilename))
 		{
 			this->Logger.Warning(LOG_CHANNEL, "File provided does not exist: %s (%s)", aFilename, aIdentifier);
 
 			/* nullptr response on fail */
-			this->DispatchTexture(aIdentifier, nullptr, aCallback);
-			this->Dequeue(aIdentifier);
+			this->Store.DispatchTexture(aIdentifier, nullptr, aCallback);
+			this->Store.Dequeue(aIdentifier);
 
 			return;
 		}
 
-		// Load from disk into a raw RGBA buffer
-		int width = 0;
-		int height = 0;
-		unsigned char* data = stbi_load(aFilename, &width, &height, NULL, 4);
+		/* Load from disk into a raw RGBA buffer. */
+		if (!this->Store.DecodeFile(aIdentifier, aFilename, Time::GetTimestampMs()))
+		{
+			this->Logger.Warning(LOG_CHANNEL, "File could not be read: %s (%s)", aFilename, aIdentifier);
 
-		this->Enqueue(aIdentifier, data, width, height);
+			/* nullptr response on fail */
+			this->Store.DispatchTexture(aIdentifier, nullptr, aCallback);
+			this->Store.Dequeue(aIdentifier);
+		}
 	}
 
-	void TextureLoader::Load(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing)
+	void TextureLoader::Load(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, void* aOwner)
 	{
 		/* Preprocess the request to determine, if we should load. */
-		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing))
+		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing, TextureSource_t{ ETextureSource::Resource, {}, aResourceID, aModule }))
 		{
 			return;
 		}
 
 		/* Queue the callback. */
-		this->Enqueue(aIdentifier, aCallback);
+		this->Store.Enqueue(aIdentifier, aCallback, aOwner, Time::GetTimestampMs());
 
-		HRSRC imageResHandle = FindResourceA(aModule, MAKEINTRESOURCEA(aResourceID), "PNG");
-		if (!imageResHandle)
+		/* Load the texture and queue the data. */
+		if (!this->DecodeResource(aIdentifier, aResourceID, aModule))
 		{
-			this->Logger.Debug(LOG_CHANNEL, "Resource not found ResID: %u (%s)", aResourceID, aIdentifier);
-
 			/* nullptr response on fail */
-			this->DispatchTexture(aIdentifier, nullptr, aCallback);
-			this->Dequeue(aIdentifier);
-
-			return;
+			this->Store.DispatchTexture(aIdentifier, nullptr, aCallback);
+			this->Store.Dequeue(aIdentifier);
 		}
+	}
 
-		HGLOBAL imageResDataHandle = LoadResource(aModule, imageResHandle);
-		if (!imageResDataHandle)
-		{
-			this->Logger.Debug(LOG_CHANNEL, "Failed loading resource: %u (%s)", aResourceID, aIdentifier);
-
-			/* nullptr response on fail */
-			this->DispatchTexture(aIdentifier, nullptr, aCallback);
-			this->Dequeue(aIdentifier);
-
-			return;
-		}
+	void TextureLoader::Load(const char* aIdentifier, const char* aRemote, const char* aEndpoint, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, void* aOwner)
+	{
+		std::string url = std::string(aRemote) + std::string(aEndpoint);
 
-		LPVOID imageFile = LockResource(imageResDataHandle);
-		if (!imageFile)
+		/* Preprocess the request to determine, if we should load. */
+		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing, TextureSource_t{ ETextureSource::Remote, {}, 0, nullptr, url }))
 		{
-			this->Logger.Debug(LOG_CHANNEL, "Failed locking resource: %u (%s)", aResourceID, aIdentifier);
-
-			/* nullptr response on fail */
-			this->DispatchTexture(aIdentifier, nullptr, aCallback);
-			this->Dequeue(aIdentifier);
-
 			return;
 		}
 
-		DWORD imageFileSize = SizeofResource(aModule, imageResHandle);
-		if (!imageFileSize)
+		/* Queue the callback and URL. */
+		if (this->Store.Enqueue(aIdentifier, url, aCallback, aOwner, Time::GetTimestampMs()))
 		{
-			this->Logger.Debug(LOG_CHANNEL, "Failed getting size of resource: %u (%s)", aResourceID, aIdentifier);
-
-			/* nullptr response on fail */
-			this->DispatchTexture(aIdentifier, nullptr, aCallback);
-			this->Dequeue(aIdentifier);
-
-			return;
+			this->TextureWorker();
 		}
-
-		/* Load the texture. */
-		int width = 0;
-		int height = 0;
-		int copmonents = 0;
-		unsigned char* data = stbi_load_from_memory((const stbi_uc*)imageFile, imageFileSize, &width, &height, &copmonents, 4);
-
-		/* Queue the data. */
-		this->Enqueue(aIdentifier, data, width, height);
 	}
 
-	void TextureLoader::Load(const char* aIdentifier, const char* aRemote, const char* aEndpoint, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing)
+	void TextureLoader::Load(const char* aIdentifier, void* aData, size_t aSize, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, void* aOwner)
 	{
 		/* Preprocess the request to determine, if we should load. */
-		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing))
+		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing, TextureSource_t{ ETextureSource::Memory }))
 		{
 			return;
 		}
 
-		/* Queue the callback and URL. */
-		this->Enqueue(aIdentifier, std::string(aRemote) + std::string(aEndpoint), aCallback);
+		/* Queue the callback. */
+		this->Store.Enqueue(aIdentifier, aCallback, aOwner, Time::GetTimestampMs());
+
+		/* Load the texture and queue the data. The caller keeps the memory, it cannot be decoded again. */
+		this->Store.Decode(aIdentifier, aData, aSize, TextureSource_t{ ETextureSource::Memory }, Time::GetTimestampMs());
 	}
 
-	void TextureLoader::Load(const char* aIdentifier, void* aData, size_t aSize, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing)
+	uint32_t TextureLoader::Subscribe(TEXTURES_CREATED aCallback)
 	{
-		/* Preprocess the request to determine, if we should load. */
-		if (this->ProcessRequest(aIdentifier, aCallback, aIsShadowing))
-		{
-			return;
-		}
+		if (!aCallback) { return 0; }
 
-		/* Queue the callback. */
-		this->Enqueue(aIdentifier, aCallback);
+		const std::lock_guard<std::mutex> lock(this->ListenerMutex);
 
-		/* Load the texture. */
-		int width = 0;
-		int height = 0;
-		int components = 0;
-		unsigned char* data = stbi_load_from_memory((const stbi_uc*)aData, static_cast<int>(aSize), &width, &height, &components, 4);
+		uint32_t handle = this->NextListener++;
+		this->Listeners.emplace(handle, aCallback);
 
-		/* Queue the data. */
-		this->Enqueue(aIdentifier, data, width, height);
+		return handle;
 	}
 
-	std::map<std::string, Texture_t*> TextureLoader::GetRegistry() const
+	void TextureLoader::Unsubscribe(uint32_t aHandle)
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		const std::lock_guard<std::mutex> lock(this->ListenerMutex);
+		this->Listeners.erase(aHandle);
+	}
 
-		return this->Registry;
+	std::map<std::string, Texture_t*> TextureLoader::GetRegistry() const
+	{
+		return this->Store.GetRegistry();
 	}
 
 	std::map<std::string, QueuedTexture_t> TextureLoader::GetQueuedTextures() const
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		return this->Store.GetQueuedTextures();
+	}
 
-		return this->QueuedTextures;
+	void TextureLoader::GetAtlasStats(uint32_t& aOutPages, uint32_t& aOutTextures) const
+	{
+		this->Store.GetAtlasStats(aOutPages, aOutTextures);
 	}
 
-	uint32_t TextureLoader::CleanupRefs(void* aStartAddress, void* aEndAddress)
+	std::map<std::string, TextureRecord_t> TextureLoader::GetRecords() const
+	{
+		return this->Store.GetRecords();
+	}
+
+	uint64_t TextureLoader::GetBudget() const
 	{
-		uint32_t refCounter = 0;
+		return this->Store.GetBudget();
+	}
 
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+	uint64_t TextureLoader::GetResidentSize() const
+	{
+		return this->Store.GetResidentSize();
+	}
 
-		for (auto& [identifier, qTex] : this->QueuedTextures)
-		{
-			if (qTex.Callback >= aStartAddress && qTex.Callback <= aEndAddress)
-			{
-				/* Same as Dequeue() */
-				qTex.Stage = ETextureStage::INVALID;
-				qTex.Callback = nullptr;
+	uint64_t TextureLoader::GetGeneration() const
+	{
+		return this->Store.GetGeneration();
+	}
 
-				refCounter++;
-			}
-		}
+	void TextureLoader::Touch(const std::vector<void*>& aResources)
+	{
+		this->Store.Touch(aResources, Time::GetTimestampMs());
+	}
 
-		return refCounter;
+	uint32_t TextureLoader::CleanupRefs(void* aStartAddress, void* aEndAddress)
+	{
+		return this->Store.CleanupRefs(aStartAddress, aEndAddress);
 	}
 
-	bool TextureLoader::ProcessRequest(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing)
+	bool TextureLoader::ProcessRequest(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, const TextureSource_t& aSource)
 	{
 		/* If this is already queued, stop processing. */
-		if (this->IsQueued(aIdentifier))
+		if (this->Store.IsQueued(aIdentifier))
 		{
 			return true;
 		}
@@ -369,18 +328,18 @@ namespace Raidcore::Nexus::Graphics
 			result = nullptr;
 
 			/* Rename existing texture. */
-			this->ShadowTexture(aIdentifier);
+			this->Store.ShadowTexture(aIdentifier);
 		}
 
 		/* We already have a result. Dispatch it and stop processing. */
 		if (result)
 		{
-			this->DispatchTexture(aIdentifier, result, aCallback);
+			this->Store.DispatchTexture(aIdentifier, result, aCallback);
 			return true;
 		}
 
 		/* Stop processing, if overriding. */
-		if (this->OverrideTexture(aIdentifier, aCallback))
+		if (this->OverrideTexture(aIdentifier, aCallback, aSource))
 		{
 			return true;
 		}
@@ -388,254 +347,188 @@ namespace Raidcore::Nexus::Graphics
 		return false;
 	}
 
-	void TextureLoader::ShadowTexture(const char* aIdentifier)
+	bool TextureLoader::OverrideTexture(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, const TextureSource_t& aSource)
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		std::filesystem::path overridepath;
 
-		std::string id = aIdentifier;
-		int i = 0;
-
-		auto targetIt = this->Registry.find(id);
+		/* Signal to continue processing. */
+		if (!this->Overrides.Find(aIdentifier, overridepath)) { return false; }
 
-		/* Target identifier does not even exist. */
-		if (targetIt == this->Registry.end())
-		{
-			return;
-		}
+		TextureSource_t source = aSource;
+		source.Override = overridepath;
 
-		/* Iterate until free identifier is found. */
-		while (auto freeIt = this->Registry.find(id) != this->Registry.end())
+		/* Unreadable overrides are queued empty and fail like any undecodable texture. */
+		if (!this->Store.DecodeFile(aIdentifier, overridepath, source, Time::GetTimestampMs()))
 		{
-			i++;
-			id = aIdentifier;
-			id.append("_");
-			id.append(std::to_string(i));
+			this->Store.Enqueue(aIdentifier, nullptr, 0, 0, Time::GetTimestampMs());
 		}
 
-		/* Move target iterate to free identifier. */
-		this->Registry.emplace(id, targetIt->second);
-		this->Registry.erase(targetIt);
+		/* Signal to stop processing. */
+		return true;
 	}
 
-	bool TextureLoader::OverrideTexture(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback)
+	void TextureLoader::HotSwap(const std::string& aIdentifier, const std::filesystem::path& aPath)
 	{
-		if (this->OverridesDirectory.empty()) { return false; }
-
-		std::filesystem::path overridepath = this->OverridesDirectory / (aIdentifier + std::string{ ".png" });
-
-		if (std::filesystem::exists(overridepath))
+		for (const std::string& identifier : this->Store.BeginHotSwap(aIdentifier))
 		{
-			int width = 0;
-			int height = 0;
-			unsigned char* data = stbi_load(overridepath.string().c_str(), &width, &height, NULL, 4);
+			TextureSource_t source = this->Store.GetSource(identifier);
+			source.Override = aPath;
 
-			this->Enqueue(aIdentifier, data, width, height);
+			if (!this->Store.DecodeFile(identifier.c_str(), aPath, source, Time::GetTimestampMs()))
+			{
+				this->Logger.Warning(LOG_CHANNEL, "Override \"%s\" could not be read.", aPath.string().c_str());
 
-			/* Signal to stop processing. */
-			return true;
-		}
+				this->Store.CancelHotSwap(identifier);
+				continue;
+			}
 
-		/* Signal to continue processing. */
-		return false;
+			this->Logger.Info(LOG_CHANNEL, "Reloaded texture \"%s\" from override.", identifier.c_str());
+		}
 	}
 
-	bool TextureLoader::IsQueued(const char* aIdentifier)
+	void TextureLoader::RevertOverride(const std::string& aIdentifier)
 	{
-		if (!aIdentifier) { return false; }
-
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		for (const std::string& identifier : this->Store.BeginHotSwap(aIdentifier))
+		{
+			TextureSource_t source = this->Store.GetSource(identifier);
 
-		auto it = this->QueuedTextures.find(aIdentifier);
+			/* Loaded before the override was added, nothing to revert. */
+			if (source.Override.empty())
+			{
+				this->Store.CancelHotSwap(identifier);
+				continue;
+			}
 
-		if (it != this->QueuedTextures.end())
-		{
-			return true;
-		}
+			source.Override.clear();
 
-		return false;
-	}
+			bool isDecoded = false;
 
-	void TextureLoader::Enqueue(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback)
-	{
-		if (!aIdentifier) { return; }
+			switch (source.Kind)
+			{
+				case ETextureSource::File:
+				{
+					isDecoded = this->Store.DecodeFile(identifier.c_str(), source.Path, source, Time::GetTimestampMs());
+					break;
+				}
+				case ETextureSource::Resource:
+				{
+					isDecoded = this->DecodeResource(identifier.c_str(), source.ResourceID, static_cast<HMODULE>(source.Module));
+					break;
+				}
+				case ETextureSource::Remote:
+				{
+					/* The download replaces the resource in place, as the texture is marked. */
+					if (this->Store.Enqueue(identifier.c_str(), source.URL, nullptr, nullptr, Time::GetTimestampMs()))
+					{
+						this->TextureWorker();
+					}
 
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+					isDecoded = true;
+					break;
+				}
+				default:
+				{
+					/* The caller's memory is long gone, the override stays in place. */
+					break;
+				}
+			}
 
-		auto it = this->QueuedTextures.find(aIdentifier);
+			if (!isDecoded)
+			{
+				this->Logger.Warning(LOG_CHANNEL, "Texture \"%s\" could not be reloaded from its source, the removed override stays in use.", identifier.c_str());
 
-		if (it == this->QueuedTextures.end())
-		{
-			QueuedTexture_t entry{};
-			entry.Stage    = ETextureStage::Prepare;
-			entry.Data     = nullptr;
-			entry.Width    = 0;
-			entry.Height   = 0;
-			entry.Callback = aCallback;
-			entry.Time = Time::GetTimestampMs();
+				this->Store.CancelHotSwap(identifier);
+				continue;
+			}
 
-			this->QueuedTextures.emplace(aIdentifier, entry);
+			this->Logger.Info(LOG_CHANNEL, "Reloaded texture \"%s\" from its source.", identifier.c_str());
 		}
 	}
 
-	void TextureLoader::Enqueue(const char* aIdentifier, std::string aDownloadURL, TEXTURES_RECEIVECALLBACK aCallback)
+	void TextureLoader::Reload(const std::string& aIdentifier)
 	{
-		if (!aIdentifier) { return; }
-
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		TextureSource_t source = this->Store.GetSource(aIdentifier);
 
-		auto it = this->QueuedTextures.find(aIdentifier);
+		bool isDecoded = false;
 
-		if (it != this->QueuedTextures.end())
-		{
-			it->second.Stage = ETextureStage::Prepare;
-			it->second.DownloadURL = aDownloadURL;
-			it->second.Callback = aCallback;
-		}
-		else
+		/* Overridden, unless the override was removed in the meantime. */
+		if (!source.Override.empty())
 		{
-			QueuedTexture_t entry{};
-			entry.Stage = ETextureStage::Prepare;
-			entry.DownloadURL = aDownloadURL;
-			entry.Callback = aCallback;
-			entry.Time = Time::GetTimestampMs();
+			if (this->Store.DecodeFile(aIdentifier.c_str(), source.Override, source, Time::GetTimestampMs())) { return; }
 
-			this->QueuedTextures.emplace(aIdentifier, entry);
-			this->TextureWorker();
+			source.Override.clear();
 		}
-	}
-
-	void TextureLoader::Enqueue(const char* aIdentifier, unsigned char* aData, int aWidth, int aHeight)
-	{
-		if (!aIdentifier) { return; }
-
-		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = this->QueuedTextures.find(aIdentifier);
-
-		if (it != this->QueuedTextures.end())
+		switch (source.Kind)
 		{
-			it->second.Stage = ETextureStage::Ready;
-			it->second.Data   = aData;
-			it->second.Width  = aWidth;
-			it->second.Height = aHeight;
+			case ETextureSource::File:
+			{
+				isDecoded = this->Store.DecodeFile(aIdentifier.c_str(), source.Path, source, Time::GetTimestampMs());
+				break;
+			}
+			case ETextureSource::Resource:
+			{
+				isDecoded = this->DecodeResource(aIdentifier.c_str(), source.ResourceID, static_cast<HMODULE>(source.Module));
+				break;
+			}
+			case ETextureSource::Remote:
+			{
+				/* Queued without its URL, if it was overridden when evicted. */
+				this->Store.Enqueue(aIdentifier.c_str(), source.URL, nullptr, nullptr, Time::GetTimestampMs());
+				this->TextureWorker();
+				isDecoded = true;
+				break;
+			}
+			default:
+			{
+				break;
+			}
 		}
-		else
-		{
-			QueuedTexture_t entry{};
-			entry.Stage = ETextureStage::Ready;
-			entry.Data = aData;
-			entry.Width = aWidth;
-			entry.Height = aHeight;
-			entry.Time = Time::GetTimestampMs();
 
-			this->QueuedTextures.emplace(aIdentifier, entry);
+		if (!isDecoded)
+		{
+			this->Store.Dequeue(aIdentifier.c_str());
 		}
 	}
 
-	void TextureLoader::Dequeue(const char* aIdentifier)
+	bool TextureLoader::DecodeResource(const char* aIdentifier, unsigned aResourceID, HMODULE aModule)
 	{
-		if (!aIdentifier) { return; }
-
-		const std::lock_guard<std::mutex> lock(this->Mutex);
-
-		auto it = this->QueuedTextures.find(aIdentifier);
-
-		if (it != this->QueuedTextures.end())
+		HRSRC imageResHandle = FindResourceA(aModule, MAKEINTRESOURCEA(aResourceID), "PNG");
+		if (!imageResHandle)
 		{
-			it->second.Stage = ETextureStage::INVALID;
+			this->Logger.Debug(LOG_CHANNEL, "Resource not found ResID: %u (%s)", aResourceID, aIdentifier);
+			return false;
 		}
-	}
 
-	void TextureLoader::CreateTexture(const std::string& aIdentifier, QueuedTexture_t& aQueuedTexture)
-	{
-		if (this->GrWindow.Device == nullptr || this->GrWindow.DeviceContext == nullptr)
+		HGLOBAL imageResDataHandle = LoadResource(aModule, imageResHandle);
+		if (!imageResDataHandle)
 		{
-			this->Logger.Debug(LOG_CHANNEL, "RenderContext not ready. Device: %p DeviceContext: %p", this->GrWindow.Device, this->GrWindow.DeviceContext);
-			return;
+			this->Logger.Debug(LOG_CHANNEL, "Failed loading resource: %u (%s)", aResourceID, aIdentifier);
+			return false;
 		}
 
-		/* Create texture description. */
-		D3D11_TEXTURE2D_DESC desc{};
-		desc.Width            = aQueuedTexture.Width;
-		desc.Height           = aQueuedTexture.Height;
-		desc.MipLevels        = 1;
-		desc.ArraySize        = 1;
-		desc.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
-		desc.SampleDesc.Count = 1;
-		desc.Usage            = D3D11_USAGE_DEFAULT;
-		desc.BindFlags        = D3D11_BIND_SHADER_RESOURCE;
-		desc.CPUAccessFlags   = 0;
-
-		/* Create Texture. */
-		D3D11_SUBRESOURCE_DATA subResource{};
-		subResource.pSysMem          = aQueuedTexture.Data;
-		subResource.SysMemPitch      = desc.Width * 4;
-		subResource.SysMemSlicePitch = 0;
-
-		ID3D11Texture2D* pTexture = nullptr;
-		this->GrWindow.Device->CreateTexture2D(&desc, &subResource, &pTexture);
-
-		if (!pTexture)
+		LPVOID imageFile = LockResource(imageResDataHandle);
+		if (!imageFile)
 		{
-			this->Logger.Debug(LOG_CHANNEL, "pTexture was null");
-			stbi_image_free(aQueuedTexture.Data);
-			aQueuedTexture.Data = nullptr;
-
-			/* Manual dequeue, because of Mutex lock. */
-			aQueuedTexture.Stage = ETextureStage::INVALID;
-
-			return;
+			this->Logger.Debug(LOG_CHANNEL, "Failed locking resource: %u (%s)", aResourceID, aIdentifier);
+			return false;
 		}
 
-		/* Create SRV. */
-		D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc{};
-		srvDesc.Format                    = DXGI_FORMAT_R8G8B8A8_UNORM;
-		srvDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Texture2D.MipLevels       = desc.MipLevels;
-		srvDesc.Texture2D.MostDetailedMip = 0;
-
-		ID3D11ShaderResourceView* srv = nullptr;
-		this->GrWindow.Device->CreateShaderResourceView(pTexture, &srvDesc, &srv);
-
-		pTexture->Release();
-
-		Texture_t* result = new Texture_t{
-			aQueuedTexture.Width,
-			aQueuedTexture.Height,
-			srv
-		};
-
-		this->Registry.emplace(aIdentifier, result);
-
-		this->DispatchTexture(aIdentifier, result, aQueuedTexture.Callback);
-
-		if (aQueuedTexture.Data)
+		DWORD imageFileSize = SizeofResource(aModule, imageResHandle);
+		if (!imageFileSize)
 		{
-			stbi_image_free(aQueuedTexture.Data);
-			aQueuedTexture.Data = nullptr;
+			this->Logger.Debug(LOG_CHANNEL, "Failed getting size of resource: %u (%s)", aResourceID, aIdentifier);
+			return false;
 		}
 
-		aQueuedTexture.Stage = ETextureStage::Done;
-	}
-
-	void TextureLoader::DispatchTexture(const std::string& aIdentifier, Texture_t* aTexture, TEXTURES_RECEIVECALLBACK aCallback)
-	{
-		if (aIdentifier.empty()) { return; }
-		if (!aCallback)          { return; }
+		this->Store.Decode(aIdentifier, imageFile, imageFileSize, TextureSource_t{ ETextureSource::Resource, {}, aResourceID, aModule }, Time::GetTimestampMs());
 
-		try
-		{
-			aCallback(aIdentifier.c_str(), aTexture);
-		}
-		catch (...)
-		{
-			this->Logger.Debug(LOG_CHANNEL, "DispatchTexture() failed with: %s %p %p", aIdentifier.c_str(), aTexture, aCallback);
-		}
+		return true;
 	}
 
 	void TextureLoader::ProcessDownloads(Clockwork::CancellationToken aToken)
 	{
-		std::map<std::string, QueuedTexture_t> queueCpy = GetQueuedTextures();
+		std::map<std::string, QueuedTexture_t> queueCpy = this->Store.GetQueuedTextures();
 
 		for (auto& [id, qtex] : queueCpy)
 		{
@@ -646,28 +539,10 @@ namespace Raidcore::Nexus::Graphics
 
 			std::string downloadUrl = "";
 
-			/* Scope and lock, to verify we're processing this texture on this thread. */
+			/* Verify we're processing this texture on this thread. */
+			if (!this->Store.TakeDownload(id, downloadUrl))
 			{
-				const std::lock_guard<std::mutex> lock(this->Mutex);
-				auto it = this->QueuedTextures.find(id);
-
-				if (it == this->QueuedTextures.end())
-				{
-					/* Already gone again :( */
-					continue;
-				}
-				else if (it->second.DownloadURL.empty())
-				{
-					continue;
-				}
-				else if (it->second.Stage == ETextureStage::Prepare && !it->second.DownloadURL.empty())
-				{
-					std::swap(downloadUrl, it->second.DownloadURL);
-				}
-				else
-				{
-					continue;
-				}
+				continue;
 			}
 
 			/* If we swapped a download URL, download it. */
@@ -683,12 +558,18 @@ namespace Raidcore::Nexus::Graphics
 
 				auto result = client.Get(endpoint);
 
+				Memory::ResourceLedger::Get()->Add(
+					qtex.Owner ? Memory::GetOwnerModule(qtex.Owner) : nullptr,
+					Memory::EResource::HttpRequests,
+					1
+				);
+
 				if (!result)
 				{
 					this->Logger.Debug(LOG_CHANNEL, "Error fetching %s%s (%s)\nError: %s", remote.c_str(), endpoint.c_str(), id.c_str(), httplib::to_string(result.error()).c_str());
 
 					/* nullptr response on fail */
-					this->Dequeue(id.c_str());
+					this->Store.Dequeue(id.c_str());
 
 					return;
 				}
@@ -699,25 +580,13 @@ namespace Raidcore::Nexus::Graphics
 					this->Logger.Debug(LOG_CHANNEL, "Status %d when fetching %s%s (%s) | %s", result->status, remote.c_str(), endpoint.c_str(), id.c_str(), httplib::to_string(result.error()).c_str());
 
 					/* nullptr response on fail */
-					this->Dequeue(id.c_str());
+					this->Store.Dequeue(id.c_str());
 
 					return;
 				}
 
-				size_t size = result->body.size();
-				unsigned char* remote_data = new unsigned char[size];
-				std::memcpy(remote_data, result->body.c_str(), size);
-
-				int width = 0;
-				int height = 0;
-				int components;
-
-				stbi_uc* data = stbi_load_from_memory(remote_data, static_cast<int>(size), &width, &height, &components, 4);
-
-				delete[] remote_data;
-
-				/* Enqueue the data. */
-				this->Enqueue(id.c_str(), data, width, height);
+				/* Decode and enqueue the data. */
+				this->Store.Decode(id.c_str(), result->body.data(), result->body.size(), TextureSource_t{ ETextureSource::Remote, {}, 0, nullptr, qtex.DownloadURL }, Time::GetTimestampMs());
 				return;
 			}
 		}
@@ -8,11 +8,13 @@
 
 #pragma once
 
-#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 #include <windows.h>
 
 #include "thirdparty/Clockwork/Dispatcher.h"
@@ -20,8 +22,14 @@ namespace Clockwork = Raidcore::Clockwork;
 
 #include "Memory/IRefCleaner.h"
 #include "Core/Logging/LogApi.h"
+#include "Core/Settings/SettingsMgr.h"
+#include "TxAtlas.h"
+#include "TxBudget.h"
+#include "TxOverrides.h"
 #include "TxQueueEntry.h"
+#include "TxStore.h"
 #include "TxTexture.h"
+#include "TxUploader.h"
 #include "Graphics/GrWindow.h"
 
 using namespace Raidcore::Nexus;
@@ -31,8 +39,12 @@ using namespace Raidcore::Nexus;
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::Graphics
 {
+	/* Invoked on the render thread after the loader lock is released. */
+	typedef std::function<void(const std::string& aIdentifier, Texture_t* aTexture)> TEXTURES_CREATED;
+
 	///----------------------------------------------------------------------------------------------------
 	/// TextureLoader Class
+	/// 	Reads, downloads and overrides textures, the store queues, creates and budgets them.
 	///----------------------------------------------------------------------------------------------------
 	class TextureLoader : public virtual Memory::IRefCleaner
 	{
@@ -43,7 +55,10 @@ namespace Raidcore::Nexus::Graphics
 		TextureLoader(
 			Core::LogApi&         aLogger,
 			Graphics::Window_t&   aGrWindow,
-			std::filesystem::path aOverridesDirectory
+			ITextureUploader&     aUploader,
+			Core::SettingsMgr&    aSettings,
+			std::filesystem::path aOverridesDirectory,
+			std::filesystem::path aCacheDirectory
 		);
 
 		///----------------------------------------------------------------------------------------------------
@@ -69,6 +84,7 @@ namespace Raidcore::Nexus::Graphics
 		///----------------------------------------------------------------------------------------------------
 		/// Get:
 		/// 	Returns a Texture_t* with the given identifier or nullptr.
+		/// 	Evicted textures hold a placeholder resource until they are restored with the next frame.
 		///----------------------------------------------------------------------------------------------------
 		Texture_t* Get(const char* aIdentifier);
 
@@ -76,49 +92,62 @@ namespace Raidcore::Nexus::Graphics
 		/// GetOrCreate:
 		/// 	Returns a Texture_t* with the given identifier or creates it from file path.
 		///----------------------------------------------------------------------------------------------------
-		Texture_t* GetOrCreate(const char* aIdentifier, const char* aFilename);
+		Texture_t* GetOrCreate(const char* aIdentifier, const char* aFilename, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// GetOrCreate:
 		/// 	Returns a Texture_t* with the given identifier or creates it from embedded resource.
 		///----------------------------------------------------------------------------------------------------
-		Texture_t* GetOrCreate(const char* aIdentifier, unsigned aResourceID, HMODULE aModule);
+		Texture_t* GetOrCreate(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// GetOrCreate:
 		/// 	Returns a Texture_t* with the given identifier or creates it from remote URL.
 		///----------------------------------------------------------------------------------------------------
-		Texture_t* GetOrCreate(const char* aIdentifier, const char* aRemote, const char* aEndpoint);
+		Texture_t* GetOrCreate(const char* aIdentifier, const char* aRemote, const char* aEndpoint, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// GetOrCreate:
 		/// 	Returns a Texture_t* with the given identifier or creates it from memory.
 		///----------------------------------------------------------------------------------------------------
-		Texture_t* GetOrCreate(const char* aIdentifier, void* aData, size_t aSize);
+		Texture_t* GetOrCreate(const char* aIdentifier, void* aData, size_t aSize, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Load:
 		/// 	Requests to load a texture from file and returns to the given callback.
 		///----------------------------------------------------------------------------------------------------
-		void Load(const char* aIdentifier, const char* aFilename, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false);
+		void Load(const char* aIdentifier, const char* aFilename, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Load:
 		/// 	Requests to load a texture from an embedded resource and returns to the given callback.
 		///----------------------------------------------------------------------------------------------------
-		void Load(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false);
+		void Load(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Load:
 		/// 	Requests to load a texture from remote URL and returns to the given callback.
 		///----------------------------------------------------------------------------------------------------
-		void Load(const char* aIdentifier, const char* aRemote, const char* aEndpoint, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false);
+		void Load(const char* aIdentifier, const char* aRemote, const char* aEndpoint, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false, void* aOwner = nullptr);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Load:
 		/// 	Requests to load a texture from memory and returns to the given callback.
 		///----------------------------------------------------------------------------------------------------
-		void Load(const char* aIdentifier, void* aData, size_t aSize, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false);
+		void Load(const char* aIdentifier, void* aData, size_t aSize, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing = false, void* aOwner = nullptr);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Subscribe:
+		/// 	Registers a callback for every created texture, including restored and swapped ones.
+		/// 	Returns a handle to unsubscribe. The callback must not (un)subscribe itself.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Subscribe(TEXTURES_CREATED aCallback);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Unsubscribe:
+		/// 	Removes a callback registered with Subscribe.
+		///----------------------------------------------------------------------------------------------------
+		void Unsubscribe(uint32_t aHandle);
 
 		///----------------------------------------------------------------------------------------------------
 		/// GetRegistry:
@@ -132,6 +161,43 @@ namespace Raidcore::Nexus::Graphics
 		///----------------------------------------------------------------------------------------------------
 		std::map<std::string, QueuedTexture_t> GetQueuedTextures() const;
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetAtlasStats:
+		/// 	Returns the number of atlas pages and packed textures.
+		///----------------------------------------------------------------------------------------------------
+		void GetAtlasStats(uint32_t& aOutPages, uint32_t& aOutTextures) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRecords:
+		/// 	Returns a copy of the memory accounting of all textures.
+		///----------------------------------------------------------------------------------------------------
+		std::map<std::string, TextureRecord_t> GetRecords() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetBudget:
+		/// 	Returns the video memory budget in bytes, 0 if unlimited.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetBudget() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetResidentSize:
+		/// 	Returns the video memory of all resident textures in bytes.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetResidentSize() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time a resource is released or an atlas page or
+		/// 	coordinates change. Draw data recorded before a change may reference released resources.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Touch:
+		/// 	Marks the textures of the given shader resources as used, e.g. all drawn in a frame.
+		///----------------------------------------------------------------------------------------------------
+		void Touch(const std::vector<void*>& aResources);
+
 		///----------------------------------------------------------------------------------------------------
 		/// CleanupRefs:
 		/// 	Removes all TextureReceiver Callbacks that are within the provided address space.
@@ -140,78 +206,63 @@ namespace Raidcore::Nexus::Graphics
 
 		private:
 		Core::LogApi&                          Logger;
-		Graphics::Window_t&                    GrWindow;
+		Core::SettingsMgr&                     Settings;
 
-		std::filesystem::path                  OverridesDirectory{};
+		TextureAtlas                           Atlas;
+		TextureStore                           Store;
 
-		mutable std::mutex                     Mutex{};
-		std::map<std::string, Texture_t*>      Registry{};
-		std::map<std::string, QueuedTexture_t> QueuedTextures{};
+		std::mutex                             ListenerMutex{};
+		std::map<uint32_t, TEXTURES_CREATED>   Listeners{};
+		uint32_t                               NextListener{ 1 };
 
 		Clockwork::Dispatcher<void>            TextureWorker{};
 
+		/* Declared last, so the watcher is stopped before anything it calls into is destroyed. */
+		TextureOverrides                       Overrides;
+
 		///----------------------------------------------------------------------------------------------------
 		/// ProcessRequest:
 		/// 	Processes the load request.
 		/// 	Returns true if request is already ongoing or fulfilled.
 		/// 	Returns false if the load should be cancelled.
 		///----------------------------------------------------------------------------------------------------
-		bool ProcessRequest(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing);
-
-		///----------------------------------------------------------------------------------------------------
-		/// ShadowTexture:
-		/// 	Renames the given identifier, to an alternative name.
-		///----------------------------------------------------------------------------------------------------
-		void ShadowTexture(const char* aIdentifier);
+		bool ProcessRequest(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, bool aIsShadowing, const TextureSource_t& aSource);
 
 		///----------------------------------------------------------------------------------------------------
 		/// OverrideTexture:
 		/// 	Internal function to override texture load with custom user texture on disk.
+		/// 	The requested source is kept, to load it once the override is removed.
 		/// 	Returns true if an override exists and queues it.
 		///----------------------------------------------------------------------------------------------------
-		bool OverrideTexture(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback);
-
-		///----------------------------------------------------------------------------------------------------
-		/// IsQueued:
-		/// 	Returns a true if the given identifier is already queued.
-		///----------------------------------------------------------------------------------------------------
-		bool IsQueued(const char* aIdentifier);
-
-		///----------------------------------------------------------------------------------------------------
-		/// Enqueue:
-		/// 	Adds an entry to the queue awaiting processing.
-		///----------------------------------------------------------------------------------------------------
-		void Enqueue(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback);
-
-		///----------------------------------------------------------------------------------------------------
-		/// Enqueue:
-		/// 	Adds an entry to be downloaded to the queue awaiting processing.
-		///----------------------------------------------------------------------------------------------------
-		void Enqueue(const char* aIdentifier, std::string aDownloadURL, TEXTURES_RECEIVECALLBACK aCallback);
+		bool OverrideTexture(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, const TextureSource_t& aSource);
 
 		///----------------------------------------------------------------------------------------------------
-		/// Enqueue:
-		/// 	Adds data to a queue entry.
+		/// HotSwap:
+		/// 	Reloads all registered textures matching a changed override, keeping their Texture_t.
+		/// 	Called from the override watcher.
 		///----------------------------------------------------------------------------------------------------
-		void Enqueue(const char* aIdentifier, unsigned char* aData, int aWidth, int aHeight);
+		void HotSwap(const std::string& aIdentifier, const std::filesystem::path& aPath);
 
 		///----------------------------------------------------------------------------------------------------
-		/// Dequeue:
-		/// 	Drops a queue entry.
+		/// RevertOverride:
+		/// 	Reloads all registered textures matching a removed override from their original source,
+		/// 	keeping their Texture_t. Called from the override watcher.
 		///----------------------------------------------------------------------------------------------------
-		void Dequeue(const char* aIdentifier);
+		void RevertOverride(const std::string& aIdentifier);
 
 		///----------------------------------------------------------------------------------------------------
-		/// CreateTexture:
-		/// 	Creates a texture and adds it to the registry.
+		/// DecodeResource:
+		/// 	Reads an embedded PNG resource and decodes it.
+		/// 	Returns false, if the resource could not be read.
 		///----------------------------------------------------------------------------------------------------
-		void CreateTexture(const std::string& aIdentifier, QueuedTexture_t& aQueuedTexture);
+		bool DecodeResource(const char* aIdentifier, unsigned aResourceID, HMODULE aModule);
 
 		///----------------------------------------------------------------------------------------------------
-		/// DispatchTexture:
-		/// 	Dispatches a texture.
+		/// Reload:
+		/// 	Decodes an evicted texture from its override, file or embedded resource or downloads it again.
+		/// 	Must be called without the store lock held.
 		///----------------------------------------------------------------------------------------------------
-		void DispatchTexture(const std::string& aIdentifier, Texture_t* aTexture, TEXTURES_RECEIVECALLBACK aCallback);
+		void Reload(const std::string& aIdentifier);
 
 		///----------------------------------------------------------------------------------------------------
 		/// ProcessDownloads:
@@ -0,0 +1,112 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrideIndex.cpp
+/// Description  :  Case-insensitive index of the texture override files.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxOverrideIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace Raidcore::Nexus::Graphics
+{
+	/* Identifiers are matched case-insensitive, same as the file system. */
+	static std::string ToLower(std::string aString)
+	{
+		std::transform(aString.begin(), aString.end(), aString.begin(), [](unsigned char aChar)
+		{
+			return static_cast<char>(std::tolower(aChar));
+		});
+
+		return aString;
+	}
+
+	OverrideChanges_t TextureOverrideIndex::Scan(const std::filesystem::path& aDirectory)
+	{
+		OverrideChanges_t changes{};
+		std::unordered_map<std::string, Override_t> index;
+
+		std::error_code ec;
+		std::filesystem::recursive_directory_iterator it(aDirectory, std::filesystem::directory_options::skip_permission_denied, ec);
+
+		for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+		{
+			if (!it->is_regular_file(ec)) { continue; }
+
+			std::string ext = ToLower(it->path().extension().string());
+
+			uint32_t extRank = 0;
+			for (; extRank < std::size(TEXOVERRIDE_EXTENSIONS); extRank++)
+			{
+				if (ext == TEXOVERRIDE_EXTENSIONS[extRank]) { break; }
+			}
+
+			if (extRank == std::size(TEXOVERRIDE_EXTENSIONS)) { continue; }
+
+			Override_t entry{};
+			entry.Path      = it->path();
+			entry.WriteTime = it->last_write_time(ec);
+			entry.Rank      = static_cast<uint32_t>(it.depth() * std::size(TEXOVERRIDE_EXTENSIONS)) + extRank;
+
+			std::string identifier = ToLower(it->path().stem().string());
+
+			auto existing = index.find(identifier);
+
+			if (existing != index.end())
+			{
+				if (existing->second.Rank <= entry.Rank) { continue; }
+			}
+
+			index[identifier] = entry;
+		}
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (const auto& [identifier, entry] : index)
+		{
+			auto prev = this->Index.find(identifier);
+
+			if (prev == this->Index.end() || prev->second.Path != entry.Path || prev->second.WriteTime != entry.WriteTime)
+			{
+				changes.Changed.emplace_back(identifier, entry.Path);
+			}
+		}
+
+		for (const auto& [identifier, entry] : this->Index)
+		{
+			if (index.find(identifier) == index.end())
+			{
+				changes.Removed.push_back(identifier);
+			}
+		}
+
+		this->Index = std::move(index);
+
+		return changes;
+	}
+
+	bool TextureOverrideIndex::Find(const std::string& aIdentifier, std::filesystem::path& aOutPath) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (this->Index.empty()) { return false; }
+
+		auto it = this->Index.find(ToLower(aIdentifier));
+
+		if (it == this->Index.end()) { return false; }
+
+		aOutPath = it->second.Path;
+		return true;
+	}
+
+	size_t TextureOverrideIndex::GetCount() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Index.size();
+	}
+}
@@ -0,0 +1,77 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrideIndex.h
+/// Description  :  Case-insensitive index of the texture override files.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* Supported by the decoder, in order of precedence. */
+constexpr const char* TEXOVERRIDE_EXTENSIONS[] = { ".png", ".jpg", ".jpeg", ".bmp", ".tga", ".gif" };
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// OverrideChanges_t Struct
+	/// 	Differences of a scan to the previous one, by lowercase identifier.
+	///----------------------------------------------------------------------------------------------------
+	struct OverrideChanges_t
+	{
+		std::vector<std::pair<std::string, std::filesystem::path>> Changed; /* New or modified. */
+		std::vector<std::string>                                   Removed;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// TextureOverrideIndex Class
+	/// 	Maps identifiers to the file named after them, anywhere below the directory.
+	/// 	Shallower files win over deeper ones, then the extensions in order of precedence.
+	///----------------------------------------------------------------------------------------------------
+	class TextureOverrideIndex
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Scan:
+		/// 	Rebuilds the index from the directory and returns the differences to the previous scan.
+		///----------------------------------------------------------------------------------------------------
+		OverrideChanges_t Scan(const std::filesystem::path& aDirectory);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns true and the file path, if an override exists for the given identifier.
+		///----------------------------------------------------------------------------------------------------
+		bool Find(const std::string& aIdentifier, std::filesystem::path& aOutPath) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCount:
+		/// 	Returns the number of indexed overrides.
+		///----------------------------------------------------------------------------------------------------
+		size_t GetCount() const;
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Override_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Override_t
+		{
+			std::filesystem::path           Path;
+			std::filesystem::file_time_type WriteTime;
+			uint32_t                        Rank; /* Lower wins, shallower paths then extension order. */
+		};
+
+		mutable std::mutex                          Mutex;
+		std::unordered_map<std::string, Override_t> Index;
+	};
+}
@@ -0,0 +1,125 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrides.cpp
+/// Description  :  Index of user texture overrides on disk.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxOverrides.h"
+
+namespace Raidcore::Nexus::Graphics
+{
+	constexpr const char* LOG_CHANNEL = "TextureOverrides";
+
+	/* Writers often touch a file several times in a row. */
+	constexpr const DWORD SETTLE_MS = 100;
+
+	TextureOverrides::TextureOverrides(Core::LogApi& aLogger, std::filesystem::path aDirectory)
+		: Logger(aLogger)
+		, Directory(aDirectory)
+	{
+		if (this->Directory.empty()) { return; }
+
+		this->Index.Scan(this->Directory);
+
+		if (this->Index.GetCount() > 0)
+		{
+			this->Logger.Info(LOG_CHANNEL, "Indexed %u texture overrides.", static_cast<uint32_t>(this->Index.GetCount()));
+		}
+	}
+
+	TextureOverrides::~TextureOverrides()
+	{
+		if (this->StopEvent)
+		{
+			SetEvent(this->StopEvent);
+		}
+
+		if (this->WatchThread.joinable())
+		{
+			this->WatchThread.join();
+		}
+
+		if (this->StopEvent)
+		{
+			CloseHandle(this->StopEvent);
+		}
+	}
+
+	void TextureOverrides::Watch(TEXOVERRIDE_CHANGED aChangedCallback, TEXOVERRIDE_REMOVED aRemovedCallback)
+	{
+		if (this->Directory.empty())      { return; }
+		if (this->WatchThread.joinable()) { return; }
+
+		this->ChangedCallback = aChangedCallback;
+		this->RemovedCallback = aRemovedCallback;
+		this->StopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+
+		if (!this->StopEvent)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Could not create stop event. Overrides will not be updated.");
+			return;
+		}
+
+		this->WatchThread = std::thread(&TextureOverrides::ProcessChanges, this);
+	}
+
+	bool TextureOverrides::Find(const std::string& aIdentifier, std::filesystem::path& aOutPath) const
+	{
+		return this->Index.Find(aIdentifier, aOutPath);
+	}
+
+	size_t TextureOverrides::GetCount() const
+	{
+		return this->Index.GetCount();
+	}
+
+	void TextureOverrides::ProcessChanges()
+	{
+		HANDLE change = FindFirstChangeNotificationW(
+			this->Directory.wstring().c_str(),
+			TRUE,
+			FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE
+		);
+
+		if (change == INVALID_HANDLE_VALUE)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Could not watch \"%s\". Error: %u", this->Directory.string().c_str(), GetLastError());
+			return;
+		}
+
+		HANDLE handles[] = { this->StopEvent, change };
+
+		while (WaitForMultipleObjects(_countof(handles), handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1)
+		{
+			if (WaitForSingleObject(this->StopEvent, SETTLE_MS) == WAIT_OBJECT_0) { break; }
+
+			OverrideChanges_t changes = this->Index.Scan(this->Directory);
+
+			for (const auto& [identifier, path] : changes.Changed)
+			{
+				this->Logger.Debug(LOG_CHANNEL, "Override changed: %s", path.string().c_str());
+
+				if (this->ChangedCallback)
+				{
+					this->ChangedCallback(identifier, path);
+				}
+			}
+
+			for (const std::string& identifier : changes.Removed)
+			{
+				this->Logger.Debug(LOG_CHANNEL, "Override removed: %s", identifier.c_str());
+
+				if (this->RemovedCallback)
+				{
+					this->RemovedCallback(identifier);
+				}
+			}
+
+			if (!FindNextChangeNotification(change)) { break; }
+		}
+
+		FindCloseChangeNotification(change);
+	}
+}
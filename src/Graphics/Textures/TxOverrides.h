@@ -0,0 +1,82 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrides.h
+/// Description  :  Index of user texture overrides on disk.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <windows.h>
+
+#include "Core/Logging/LogApi.h"
+#include "TxOverrideIndex.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	typedef std::function<void(const std::string& aIdentifier, const std::filesystem::path& aPath)> TEXOVERRIDE_CHANGED;
+	typedef std::function<void(const std::string& aIdentifier)> TEXOVERRIDE_REMOVED;
+
+	///----------------------------------------------------------------------------------------------------
+	/// TextureOverrides Class
+	/// 	Files are named after the texture identifier and may be sorted into subfolders, e.g. per addon.
+	/// 	The directory is scanned once and rescanned when it changes, lookups do not touch the disk.
+	///----------------------------------------------------------------------------------------------------
+	class TextureOverrides
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		TextureOverrides(Core::LogApi& aLogger, std::filesystem::path aDirectory);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~TextureOverrides();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Watch:
+		/// 	Starts watching the directory. The callbacks are invoked on the watcher thread,
+		/// 	for every override that was added or modified and every one that was removed.
+		///----------------------------------------------------------------------------------------------------
+		void Watch(TEXOVERRIDE_CHANGED aChangedCallback, TEXOVERRIDE_REMOVED aRemovedCallback);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns true and the file path, if an override exists for the given identifier.
+		///----------------------------------------------------------------------------------------------------
+		bool Find(const std::string& aIdentifier, std::filesystem::path& aOutPath) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCount:
+		/// 	Returns the number of indexed overrides.
+		///----------------------------------------------------------------------------------------------------
+		size_t GetCount() const;
+
+		private:
+		Core::LogApi&         Logger;
+		std::filesystem::path Directory;
+
+		TextureOverrideIndex  Index;
+
+		HANDLE                StopEvent = nullptr;
+		std::thread           WatchThread;
+		TEXOVERRIDE_CHANGED   ChangedCallback;
+		TEXOVERRIDE_REMOVED   RemovedCallback;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ProcessChanges:
+		/// 	Thread function waiting for directory changes.
+		///----------------------------------------------------------------------------------------------------
+		void ProcessChanges();
+	};
+}
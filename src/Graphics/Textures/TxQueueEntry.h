@@ -12,6 +12,7 @@
 #include <string>
 
 #include "TxEnum.h"
+#include "TxSource.h"
 #include "TxTexture.h"
 
 ///----------------------------------------------------------------------------------------------------
@@ -32,7 +33,11 @@ namespace Raidcore::Nexus::Graphics
 		uint32_t                 Width;
 		uint32_t                 Height;
 		uint8_t*                 Data;
+		void*                    MappedView;  /* Set if Data points into a disk cache file. */
+		uint64_t                 CacheKey;    /* Disk cache key of the decoded pixels. */
 		std::string              DownloadURL;
 		TEXTURES_RECEIVECALLBACK Callback;
+		void*                    Owner;       /* Address within the module that requested the texture. */
+		TextureSource_t          Source;
 	};
 }
@@ -0,0 +1,34 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxSource.h
+/// Description  :  Contains the TextureSource struct definition.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+#include "TxEnum.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// TextureSource_t Struct
+	/// 	Where the encoded image of a texture came from, to decode it again.
+	///----------------------------------------------------------------------------------------------------
+	struct TextureSource_t
+	{
+		ETextureSource        Kind;
+		std::filesystem::path Path;       /* File */
+		unsigned              ResourceID; /* Resource */
+		void*                 Module;     /* Resource, the module containing it. */
+		std::string           URL;        /* Remote */
+		std::filesystem::path Override;   /* Decoded from this override file instead, if set. */
+	};
+}
@@ -0,0 +1,801 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxStore.cpp
+/// Description  :  Registry, upload queue and video memory budget of the texture loader.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "TxStore.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+#pragma warning(push, 0)
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb/stb_image.h"
+#pragma warning(pop)
+
+namespace Raidcore::Nexus::Graphics
+{
+	constexpr const char* LOG_CHANNEL = "TextureLoader";
+
+	TextureStore::TextureStore(
+		Core::LogApi&         aLogger,
+		ITextureUploader&     aUploader,
+		ITextureAtlas&        aAtlas,
+		std::filesystem::path aCacheDirectory
+	)
+		: Logger(aLogger)
+		, Uploader(aUploader)
+		, Atlas(aAtlas)
+		, DiskCache(aLogger, aCacheDirectory)
+	{
+	}
+
+	void TextureStore::Shutdown()
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Atlas.Clear();
+		this->AtlasRemovals.clear();
+		this->Budget.Clear();
+		this->Resources.clear();
+		this->HotSwaps.clear();
+		this->Created.clear();
+
+		for (auto it = this->Registry.begin(); it != this->Registry.end();)
+		{
+			/* Release texture. */
+			this->Uploader.Release(it->second->Resource);
+
+			/* Deallocate wrapper. */
+			delete it->second;
+
+			/* Erase entry. */
+			it = this->Registry.erase(it);
+		}
+
+		this->Generation++;
+	}
+
+	void TextureStore::Advance(long long aTime, std::vector<std::pair<std::string, Texture_t*>>& aOutCreated, std::vector<std::string>& aOutReloads)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (Texture_t* texture : this->AtlasRemovals)
+		{
+			this->Atlas.Remove(texture);
+		}
+		this->AtlasRemovals.clear();
+
+		/* Disabled at runtime, the UI falls back to the standalone resources. */
+		if (!this->IsAtlasEnabled && this->Atlas.GetPageCount() > 0)
+		{
+			this->Atlas.Clear();
+		}
+
+		/* Bring back evicted textures that were looked up or drawn again. */
+		for (const std::string& identifier : this->Budget.SelectRestores())
+		{
+			this->Restore(identifier, aTime);
+		}
+
+		/* Only textures, which pixels are on disk, can be restored. */
+		std::vector<std::string> evictions = this->Budget.SelectEvictions(
+			this->BudgetBytes,
+			aTime,
+			TEXBUDGET_MINIDLE_MS,
+			[this](const std::string& aIdentifier, const TextureRecord_t& aRecord)
+			{
+				return aRecord.CacheKey != 0
+					&& this->QueuedTextures.find(aIdentifier) == this->QueuedTextures.end()
+					&& this->DiskCache.Contains(aRecord.CacheKey);
+			}
+		);
+
+		for (const std::string& identifier : evictions)
+		{
+			this->Evict(identifier, aTime);
+		}
+
+		for (auto it = this->QueuedTextures.begin(); it != this->QueuedTextures.end();)
+		{
+			switch (it->second.Stage)
+			{
+				default:
+				case ETextureStage::None:
+				case ETextureStage::Prepare:
+				{
+					if (aTime - static_cast<long long>(it->second.Time) > TEXSTORE_QUEUE_TIMEOUT_MS)
+					{
+						this->Logger.Debug(LOG_CHANNEL, "Dropped texture with ID \"%s\" from queue after %dms at stage %d.", it->first.c_str(), aTime - it->second.Time, it->second.Stage);
+						it->second.Stage = ETextureStage::INVALID;
+						++it;
+					}
+					else
+					{
+						++it;
+					}
+					break;
+				}
+				case ETextureStage::Ready:
+				{
+					this->CreateTexture(it->first, it->second, aTime);
+					++it;
+					break;
+				}
+				case ETextureStage::Done:
+				case ETextureStage::INVALID:
+				{
+					this->FreeData(it->second);
+
+					/* Only dispatch invalid textures. Created (Done) already were dispatched. */
+					if (it->second.Stage == ETextureStage::INVALID && it->second.Callback)
+					{
+						this->DispatchTexture(it->first, nullptr, it->second.Callback);
+					}
+
+					if (it->second.Callback)
+					{
+						this->CallbackOwners.Remove((void*)it->second.Callback, it->first);
+					}
+
+					if (it->second.Stage == ETextureStage::INVALID)
+					{
+						this->Abandon(it->first);
+					}
+
+					it = this->QueuedTextures.erase(it);
+					break;
+				}
+			}
+		}
+
+		/* Removals, clearing and repacking all happen above, on the render thread. */
+		if (this->Atlas.GetGeneration() != this->AtlasGeneration)
+		{
+			this->AtlasGeneration = this->Atlas.GetGeneration();
+			this->Generation++;
+		}
+
+		std::swap(aOutCreated, this->Created);
+		this->Created.clear();
+
+		std::swap(aOutReloads, this->Reloads);
+		this->Reloads.clear();
+	}
+
+	Texture_t* TextureStore::Get(const char* aIdentifier, long long aTime)
+	{
+		if (!aIdentifier) { return nullptr; }
+
+		Texture_t* result = nullptr;
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Registry.find(aIdentifier);
+
+		if (it != this->Registry.end())
+		{
+			result = it->second;
+			result->LastUsed = aTime;
+		}
+
+		return result;
+	}
+
+	void TextureStore::Touch(const std::vector<void*>& aResources, long long aTime)
+	{
+		if (this->BudgetBytes == 0) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (void* resource : aResources)
+		{
+			auto it = this->Resources.find(static_cast<ID3D11ShaderResourceView*>(resource));
+
+			if (it != this->Resources.end())
+			{
+				it->second->LastUsed = aTime;
+			}
+		}
+	}
+
+	bool TextureStore::IsQueued(const char* aIdentifier)
+	{
+		if (!aIdentifier) { return false; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		if (it != this->QueuedTextures.end())
+		{
+			return true;
+		}
+
+		return false;
+	}
+
+	void TextureStore::ShadowTexture(const char* aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		std::string id = aIdentifier;
+		int i = 0;
+
+		auto targetIt = this->Registry.find(id);
+
+		/* Target identifier does not even exist. */
+		if (targetIt == this->Registry.end())
+		{
+			return;
+		}
+
+		/* Iterate until free identifier is found. */
+		while (this->Registry.find(id) != this->Registry.end())
+		{
+			i++;
+			id = aIdentifier;
+			id.append("_");
+			id.append(std::to_string(i));
+		}
+
+		/* The shadowed texture stays valid, but is not looked up by the UI anymore. */
+		if (targetIt->second->AtlasResource)
+		{
+			this->AtlasRemovals.push_back(targetIt->second);
+		}
+
+		this->Budget.Rename(targetIt->first, id);
+
+		/* Move target iterate to free identifier. */
+		this->Registry.emplace(id, targetIt->second);
+		this->Registry.erase(targetIt);
+	}
+
+	std::vector<std::string> TextureStore::BeginHotSwap(const std::string& aIdentifier)
+	{
+		std::vector<std::string> identifiers;
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		/* The index of the overrides is case-insensitive, the registry is not. */
+		for (const auto& [identifier, texture] : this->Registry)
+		{
+			if (this->QueuedTextures.find(identifier) != this->QueuedTextures.end()) { continue; }
+			if (identifier.size() != aIdentifier.size())                            { continue; }
+
+			bool isMatch = std::equal(identifier.begin(), identifier.end(), aIdentifier.begin(), [](char aLeft, char aRight)
+			{
+				return std::tolower(static_cast<unsigned char>(aLeft)) == static_cast<unsigned char>(aRight);
+			});
+
+			if (isMatch)
+			{
+				identifiers.push_back(identifier);
+				this->HotSwaps.insert(identifier);
+			}
+		}
+
+		return identifiers;
+	}
+
+	void TextureStore::CancelHotSwap(const std::string& aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		this->HotSwaps.erase(aIdentifier);
+	}
+
+	void TextureStore::Enqueue(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, void* aOwner, long long aTime)
+	{
+		if (!aIdentifier) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		if (it == this->QueuedTextures.end())
+		{
+			QueuedTexture_t entry{};
+			entry.Stage    = ETextureStage::Prepare;
+			entry.Data     = nullptr;
+			entry.Width    = 0;
+			entry.Height   = 0;
+			entry.Callback = aCallback;
+			entry.Owner    = aOwner;
+			entry.Time = aTime;
+
+			this->QueuedTextures.emplace(aIdentifier, entry);
+
+			if (aCallback)
+			{
+				this->CallbackOwners.Add((void*)aCallback, aIdentifier);
+			}
+		}
+	}
+
+	bool TextureStore::Enqueue(const char* aIdentifier, std::string aDownloadURL, TEXTURES_RECEIVECALLBACK aCallback, void* aOwner, long long aTime)
+	{
+		if (!aIdentifier) { return false; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		if (it != this->QueuedTextures.end())
+		{
+			it->second.Stage = ETextureStage::Prepare;
+			it->second.DownloadURL = aDownloadURL;
+			it->second.Callback = aCallback;
+			it->second.Owner = aOwner;
+
+			if (aCallback)
+			{
+				this->CallbackOwners.Add((void*)aCallback, aIdentifier);
+			}
+
+			return false;
+		}
+
+		QueuedTexture_t entry{};
+		entry.Stage = ETextureStage::Prepare;
+		entry.DownloadURL = aDownloadURL;
+		entry.Callback = aCallback;
+		entry.Owner = aOwner;
+		entry.Time = aTime;
+
+		this->QueuedTextures.emplace(aIdentifier, entry);
+
+		if (aCallback)
+		{
+			this->CallbackOwners.Add((void*)aCallback, aIdentifier);
+		}
+
+		return true;
+	}
+
+	void TextureStore::Enqueue(const char* aIdentifier, unsigned char* aData, int aWidth, int aHeight, long long aTime, void* aMappedView, uint64_t aCacheKey, const TextureSource_t& aSource)
+	{
+		if (!aIdentifier) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		if (it != this->QueuedTextures.end())
+		{
+			it->second.Stage      = ETextureStage::Ready;
+			it->second.Data       = aData;
+			it->second.MappedView = aMappedView;
+			it->second.CacheKey   = aCacheKey;
+			it->second.Width      = aWidth;
+			it->second.Height     = aHeight;
+			it->second.Source     = aSource;
+		}
+		else
+		{
+			QueuedTexture_t entry{};
+			entry.Stage = ETextureStage::Ready;
+			entry.Data = aData;
+			entry.MappedView = aMappedView;
+			entry.CacheKey = aCacheKey;
+			entry.Width = aWidth;
+			entry.Height = aHeight;
+			entry.Source = aSource;
+			entry.Time = aTime;
+
+			this->QueuedTextures.emplace(aIdentifier, entry);
+		}
+	}
+
+	void TextureStore::Dequeue(const char* aIdentifier)
+	{
+		if (!aIdentifier) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		if (it != this->QueuedTextures.end())
+		{
+			it->second.Stage = ETextureStage::INVALID;
+		}
+	}
+
+	bool TextureStore::TakeDownload(const std::string& aIdentifier, std::string& aOutURL)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->QueuedTextures.find(aIdentifier);
+
+		/* Already gone again or not a download. */
+		if (it == this->QueuedTextures.end())              { return false; }
+		if (it->second.DownloadURL.empty())                { return false; }
+		if (it->second.Stage != ETextureStage::Prepare)    { return false; }
+
+		aOutURL.clear();
+		std::swap(aOutURL, it->second.DownloadURL);
+
+		return true;
+	}
+
+	void TextureStore::Decode(const char* aIdentifier, const void* aData, size_t aSize, const TextureSource_t& aSource, long long aTime)
+	{
+		uint64_t key = TextureDiskCache::GetKey(aData, aSize);
+
+		CachedTexture_t cached{};
+
+		if (this->DiskCache.Load(key, cached))
+		{
+			/* Only read by CreateTexture, the mapping stays read-only. */
+			this->Enqueue(aIdentifier, const_cast<uint8_t*>(cached.Data), cached.Width, cached.Height, aTime, cached.View, key, aSource);
+			return;
+		}
+
+		int width = 0;
+		int height = 0;
+		int components = 0;
+		unsigned char* data = stbi_load_from_memory((const stbi_uc*)aData, static_cast<int>(aSize), &width, &height, &components, 4);
+
+		if (data)
+		{
+			this->DiskCache.Store(key, width, height, data);
+		}
+
+		this->Enqueue(aIdentifier, data, width, height, aTime, nullptr, key, aSource);
+	}
+
+	bool TextureStore::DecodeFile(const char* aIdentifier, const std::filesystem::path& aPath, long long aTime)
+	{
+		return this->DecodeFile(aIdentifier, aPath, TextureSource_t{ ETextureSource::File, aPath }, aTime);
+	}
+
+	bool TextureStore::DecodeFile(const char* aIdentifier, const std::filesystem::path& aPath, const TextureSource_t& aSource, long long aTime)
+	{
+		std::ifstream file(aPath, std::ios::binary | std::ios::ate);
+
+		if (!file) { return false; }
+
+		std::vector<char> buffer(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+
+		if (!file.read(buffer.data(), buffer.size())) { return false; }
+
+		this->Decode(aIdentifier, buffer.data(), buffer.size(), aSource, aTime);
+
+		return true;
+	}
+
+	void TextureStore::DispatchTexture(const std::string& aIdentifier, Texture_t* aTexture, TEXTURES_RECEIVECALLBACK aCallback)
+	{
+		if (aIdentifier.empty()) { return; }
+		if (!aCallback)          { return; }
+
+		try
+		{
+			aCallback(aIdentifier.c_str(), aTexture);
+		}
+		catch (...)
+		{
+			this->Logger.Debug(LOG_CHANNEL, "DispatchTexture() failed with: %s %p %p", aIdentifier.c_str(), aTexture, aCallback);
+		}
+	}
+
+	TextureSource_t TextureStore::GetSource(const std::string& aIdentifier) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		const TextureRecord_t* record = this->Budget.Find(aIdentifier);
+
+		return record ? record->Source : TextureSource_t{};
+	}
+
+	void TextureStore::SetAtlasEnabled(bool aIsEnabled)
+	{
+		this->IsAtlasEnabled = aIsEnabled;
+	}
+
+	void TextureStore::SetBudget(uint64_t aBytes)
+	{
+		this->BudgetBytes = aBytes;
+	}
+
+	std::map<std::string, Texture_t*> TextureStore::GetRegistry() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Registry;
+	}
+
+	std::map<std::string, QueuedTexture_t> TextureStore::GetQueuedTextures() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->QueuedTextures;
+	}
+
+	void TextureStore::GetAtlasStats(uint32_t& aOutPages, uint32_t& aOutTextures) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		aOutPages = this->Atlas.GetPageCount();
+		aOutTextures = this->Atlas.GetSlotCount();
+	}
+
+	std::map<std::string, TextureRecord_t> TextureStore::GetRecords() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Budget.GetRecords();
+	}
+
+	uint64_t TextureStore::GetBudget() const
+	{
+		return this->BudgetBytes;
+	}
+
+	uint64_t TextureStore::GetResidentSize() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Budget.GetResidentSize();
+	}
+
+	uint64_t TextureStore::GetGeneration() const
+	{
+		return this->Generation;
+	}
+
+	const TextureDiskCache& TextureStore::GetDiskCache() const
+	{
+		return this->DiskCache;
+	}
+
+	uint32_t TextureStore::CleanupRefs(void* aStartAddress, void* aEndAddress)
+	{
+		uint32_t refCounter = 0;
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		/* Embedded resources are gone with their module. */
+		this->Budget.ClearSources(aStartAddress, aEndAddress);
+
+		for (const std::string& identifier : this->CallbackOwners.Take(aStartAddress, aEndAddress))
+		{
+			auto it = this->QueuedTextures.find(identifier);
+
+			if (it == this->QueuedTextures.end()) { continue; }
+
+			QueuedTexture_t& qTex = it->second;
+
+			if ((void*)qTex.Callback >= aStartAddress && (void*)qTex.Callback <= aEndAddress)
+			{
+				/* Same as Dequeue() */
+				qTex.Stage = ETextureStage::INVALID;
+				qTex.Callback = nullptr;
+
+				refCounter++;
+			}
+		}
+
+		return refCounter;
+	}
+
+	void TextureStore::FreeData(QueuedTexture_t& aQueuedTexture)
+	{
+		if (aQueuedTexture.MappedView)
+		{
+			TextureDiskCache::Release(aQueuedTexture.MappedView);
+		}
+		else if (aQueuedTexture.Data)
+		{
+			stbi_image_free(aQueuedTexture.Data);
+		}
+
+		aQueuedTexture.Data = nullptr;
+		aQueuedTexture.MappedView = nullptr;
+	}
+
+	void TextureStore::Evict(const std::string& aIdentifier, long long aTime)
+	{
+		auto it = this->Registry.find(aIdentifier);
+
+		if (it == this->Registry.end()) { return; }
+
+		Texture_t* texture = it->second;
+
+		/* Own placeholder per texture, so drawing it still tells which texture is in use. */
+		ID3D11ShaderResourceView* placeholder = this->CreatePlaceholder();
+
+		if (!placeholder) { return; }
+
+		this->Atlas.Remove(texture);
+
+		this->Resources.erase(texture->Resource);
+		this->Uploader.Release(texture->Resource);
+		texture->Resource = placeholder;
+		this->Resources[placeholder] = texture;
+		this->Generation++;
+
+		this->Budget.SetEvicted(aIdentifier, aTime);
+
+		/* The cached pixels are the only copy now. */
+		this->DiskCache.Pin(this->Budget.Find(aIdentifier)->CacheKey);
+	}
+
+	ID3D11ShaderResourceView* TextureStore::CreatePlaceholder()
+	{
+		uint32_t transparent = 0;
+
+		return this->Uploader.Create(1, 1, reinterpret_cast<const uint8_t*>(&transparent));
+	}
+
+	void TextureStore::Restore(const std::string& aIdentifier, long long aTime)
+	{
+		if (this->QueuedTextures.find(aIdentifier) != this->QueuedTextures.end()) { return; }
+
+		const TextureRecord_t* record = this->Budget.Find(aIdentifier);
+
+		if (!record) { return; }
+
+		QueuedTexture_t entry{};
+		entry.Owner  = record->Owner;
+		entry.Source = record->Source;
+		entry.Time   = aTime;
+
+		CachedTexture_t cached{};
+
+		if (this->DiskCache.Load(record->CacheKey, cached))
+		{
+			entry.Stage      = ETextureStage::Ready;
+			entry.Data       = const_cast<uint8_t*>(cached.Data);
+			entry.MappedView = cached.View;
+			entry.CacheKey   = record->CacheKey;
+			entry.Width      = cached.Width;
+			entry.Height     = cached.Height;
+
+			this->QueuedTextures.emplace(aIdentifier, entry);
+			return;
+		}
+
+		/* Pinned, but gone anyway, e.g. the cache directory was deleted. Decode it anew. */
+		if (!record->Source.Override.empty())
+		{
+			entry.Stage = ETextureStage::Prepare;
+
+			this->QueuedTextures.emplace(aIdentifier, entry);
+			this->Reloads.push_back(aIdentifier);
+			return;
+		}
+
+		switch (record->Source.Kind)
+		{
+			case ETextureSource::File:
+			case ETextureSource::Resource:
+			{
+				entry.Stage = ETextureStage::Prepare;
+
+				this->QueuedTextures.emplace(aIdentifier, entry);
+				this->Reloads.push_back(aIdentifier);
+				break;
+			}
+			case ETextureSource::Remote:
+			{
+				entry.Stage       = ETextureStage::Prepare;
+				entry.DownloadURL = record->Source.URL;
+
+				this->QueuedTextures.emplace(aIdentifier, entry);
+				this->Reloads.push_back(aIdentifier);
+				break;
+			}
+			default:
+			{
+				this->Abandon(aIdentifier);
+				break;
+			}
+		}
+	}
+
+	void TextureStore::Abandon(const std::string& aIdentifier)
+	{
+		const TextureRecord_t* record = this->Budget.Find(aIdentifier);
+
+		if (!record || !record->IsEvicted) { return; }
+
+		this->Logger.Warning(LOG_CHANNEL, "Evicted texture \"%s\" could not be restored.", aIdentifier.c_str());
+
+		/* Holders keep the placeholder, it is released with the registry. */
+		this->DiskCache.Unpin(record->CacheKey);
+		this->Budget.Remove(aIdentifier);
+	}
+
+	void TextureStore::CreateTexture(const std::string& aIdentifier, QueuedTexture_t& aQueuedTexture, long long aTime)
+	{
+		if (!this->Uploader.IsReady())
+		{
+			this->Logger.Debug(LOG_CHANNEL, "RenderContext not ready.");
+			return;
+		}
+
+		bool isHotSwap = this->HotSwaps.erase(aIdentifier) > 0;
+
+		ID3D11ShaderResourceView* srv = this->Uploader.Create(aQueuedTexture.Width, aQueuedTexture.Height, aQueuedTexture.Data);
+
+		if (!srv)
+		{
+			this->Logger.Debug(LOG_CHANNEL, "Resource could not be created for: %s", aIdentifier.c_str());
+			this->FreeData(aQueuedTexture);
+
+			/* Manual dequeue, because of Mutex lock. */
+			aQueuedTexture.Stage = ETextureStage::INVALID;
+
+			return;
+		}
+
+		Texture_t* result = nullptr;
+
+		auto existing = this->Registry.find(aIdentifier);
+		const TextureRecord_t* record = this->Budget.Find(aIdentifier);
+
+		/* Restoring an evicted texture or swapping in a changed override, holders keep their pointer. */
+		if (existing != this->Registry.end() && (isHotSwap || (record && record->IsEvicted)))
+		{
+			result = existing->second;
+
+			if (record && record->IsEvicted)
+			{
+				this->DiskCache.Unpin(record->CacheKey);
+			}
+
+			this->Atlas.Remove(result);
+
+			this->Resources.erase(result->Resource);
+			this->Uploader.Release(result->Resource);
+			this->Generation++;
+
+			result->Width    = aQueuedTexture.Width;
+			result->Height   = aQueuedTexture.Height;
+			result->Resource = srv;
+		}
+		else
+		{
+			result = new Texture_t{
+				aQueuedTexture.Width,
+				aQueuedTexture.Height,
+				srv
+			};
+			result->LastUsed = aTime;
+		}
+
+		/* Small icons are also packed for batched drawing, while the pixels are still around. */
+		if (this->IsAtlasEnabled)
+		{
+			this->Atlas.Add(result, aQueuedTexture.Data);
+		}
+
+		if (existing == this->Registry.end() || existing->second == result)
+		{
+			this->Registry.emplace(aIdentifier, result);
+			this->Resources[srv] = result;
+
+			this->Budget.Track(
+				aIdentifier,
+				result,
+				TextureBudget::GetSize(aQueuedTexture.Width, aQueuedTexture.Height),
+				aQueuedTexture.Owner ? Memory::GetOwnerModule(aQueuedTexture.Owner) : nullptr,
+				aQueuedTexture.CacheKey,
+				aQueuedTexture.Source
+			);
+		}
+
+		this->DispatchTexture(aIdentifier, result, aQueuedTexture.Callback);
+		this->Created.emplace_back(aIdentifier, result);
+
+		this->FreeData(aQueuedTexture);
+
+		aQueuedTexture.Stage = ETextureStage::Done;
+	}
+}
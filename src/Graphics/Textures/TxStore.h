@@ -0,0 +1,309 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxStore.h
+/// Description  :  Registry, upload queue and video memory budget of the texture loader.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Core/Logging/LogApi.h"
+#include "Memory/OwnerIndex.h"
+#include "TxAtlasBase.h"
+#include "TxBudget.h"
+#include "TxDiskCache.h"
+#include "TxQueueEntry.h"
+#include "TxSource.h"
+#include "TxTexture.h"
+#include "TxUploader.h"
+
+constexpr const long long TEXSTORE_QUEUE_TIMEOUT_MS = 60000; /* Entries that are not ready by then are dropped. */
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// TextureStore Class
+	/// 	Decoded pixels are queued from any thread and created through the uploader on the render thread.
+	/// 	Independent of the platform, the loader feeds it from files, embedded resources and downloads.
+	/// 	All timestamps are in ms and passed in by the caller.
+	///----------------------------------------------------------------------------------------------------
+	class TextureStore
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		TextureStore(
+			Core::LogApi&         aLogger,
+			ITextureUploader&     aUploader,
+			ITextureAtlas&        aAtlas,
+			std::filesystem::path aCacheDirectory
+		);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~TextureStore() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Shutdown:
+		/// 	Releases all existing textures.
+		///----------------------------------------------------------------------------------------------------
+		void Shutdown();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Advance:
+		/// 	Processes all currently queued textures, evicts and restores. Must be called on the render thread.
+		/// 	Returns the created textures and the evicted ones that have to be decoded from their source
+		/// 	again, both to be handled after the lock is released.
+		///----------------------------------------------------------------------------------------------------
+		void Advance(long long aTime, std::vector<std::pair<std::string, Texture_t*>>& aOutCreated, std::vector<std::string>& aOutReloads);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Get:
+		/// 	Returns a Texture_t* with the given identifier or nullptr and marks it as used.
+		///----------------------------------------------------------------------------------------------------
+		Texture_t* Get(const char* aIdentifier, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Touch:
+		/// 	Marks the textures of the given shader resources as used.
+		///----------------------------------------------------------------------------------------------------
+		void Touch(const std::vector<void*>& aResources, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsQueued:
+		/// 	Returns a true if the given identifier is already queued.
+		///----------------------------------------------------------------------------------------------------
+		bool IsQueued(const char* aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ShadowTexture:
+		/// 	Renames the given identifier, to an alternative name.
+		///----------------------------------------------------------------------------------------------------
+		void ShadowTexture(const char* aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// BeginHotSwap:
+		/// 	Returns the registered textures matching the lowercase identifier of a changed override and
+		/// 	marks them, so their next upload replaces the resource in place.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<std::string> BeginHotSwap(const std::string& aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CancelHotSwap:
+		/// 	Unmarks a texture, e.g. because the changed override could not be read.
+		///----------------------------------------------------------------------------------------------------
+		void CancelHotSwap(const std::string& aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Enqueue:
+		/// 	Adds an entry to the queue awaiting processing.
+		///----------------------------------------------------------------------------------------------------
+		void Enqueue(const char* aIdentifier, TEXTURES_RECEIVECALLBACK aCallback, void* aOwner, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Enqueue:
+		/// 	Adds an entry to be downloaded to the queue awaiting processing.
+		/// 	Returns true, if the entry is new and a download has to be started.
+		///----------------------------------------------------------------------------------------------------
+		bool Enqueue(const char* aIdentifier, std::string aDownloadURL, TEXTURES_RECEIVECALLBACK aCallback, void* aOwner, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Enqueue:
+		/// 	Adds data to a queue entry.
+		///----------------------------------------------------------------------------------------------------
+		void Enqueue(const char* aIdentifier, unsigned char* aData, int aWidth, int aHeight, long long aTime, void* aMappedView = nullptr, uint64_t aCacheKey = 0, const TextureSource_t& aSource = {});
+
+		///----------------------------------------------------------------------------------------------------
+		/// Dequeue:
+		/// 	Drops a queue entry.
+		///----------------------------------------------------------------------------------------------------
+		void Dequeue(const char* aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// TakeDownload:
+		/// 	Takes the download URL of a queued texture, so only one worker fetches it.
+		/// 	Returns false, if the texture is not waiting for a download.
+		///----------------------------------------------------------------------------------------------------
+		bool TakeDownload(const std::string& aIdentifier, std::string& aOutURL);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Decode:
+		/// 	Decodes encoded image data or maps it from the disk cache and adds it to a queue entry.
+		///----------------------------------------------------------------------------------------------------
+		void Decode(const char* aIdentifier, const void* aData, size_t aSize, const TextureSource_t& aSource, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// DecodeFile:
+		/// 	Reads an image file and decodes it.
+		/// 	Returns false, if the file could not be read.
+		///----------------------------------------------------------------------------------------------------
+		bool DecodeFile(const char* aIdentifier, const std::filesystem::path& aPath, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// DecodeFile:
+		/// 	Reads an image file and decodes it, e.g. an override, recording the given source.
+		/// 	Returns false, if the file could not be read.
+		///----------------------------------------------------------------------------------------------------
+		bool DecodeFile(const char* aIdentifier, const std::filesystem::path& aPath, const TextureSource_t& aSource, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// DispatchTexture:
+		/// 	Dispatches a texture.
+		///----------------------------------------------------------------------------------------------------
+		void DispatchTexture(const std::string& aIdentifier, Texture_t* aTexture, TEXTURES_RECEIVECALLBACK aCallback);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetSource:
+		/// 	Returns the source of a tracked texture.
+		///----------------------------------------------------------------------------------------------------
+		TextureSource_t GetSource(const std::string& aIdentifier) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetAtlasEnabled:
+		/// 	Packs small textures into the atlas, clears it with the next frame, if disabled.
+		///----------------------------------------------------------------------------------------------------
+		void SetAtlasEnabled(bool aIsEnabled);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetBudget:
+		/// 	Sets the video memory budget in bytes, 0 if unlimited.
+		///----------------------------------------------------------------------------------------------------
+		void SetBudget(uint64_t aBytes);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRegistry:
+		/// 	Returns a copy of the registry.
+		///----------------------------------------------------------------------------------------------------
+		std::map<std::string, Texture_t*> GetRegistry() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetQueuedTextures:
+		/// 	Returns a copy of all currently queued textures.
+		///----------------------------------------------------------------------------------------------------
+		std::map<std::string, QueuedTexture_t> GetQueuedTextures() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetAtlasStats:
+		/// 	Returns the number of atlas pages and packed textures.
+		///----------------------------------------------------------------------------------------------------
+		void GetAtlasStats(uint32_t& aOutPages, uint32_t& aOutTextures) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRecords:
+		/// 	Returns a copy of the memory accounting of all textures.
+		///----------------------------------------------------------------------------------------------------
+		std::map<std::string, TextureRecord_t> GetRecords() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetBudget:
+		/// 	Returns the video memory budget in bytes, 0 if unlimited.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetBudget() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetResidentSize:
+		/// 	Returns the video memory of all resident textures in bytes.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetResidentSize() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time a resource is released or an atlas page or
+		/// 	coordinates change.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetDiskCache:
+		/// 	Returns the disk cache of the decoded pixels.
+		///----------------------------------------------------------------------------------------------------
+		const TextureDiskCache& GetDiskCache() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// CleanupRefs:
+		/// 	Removes all callbacks and embedded sources that are within the provided address space.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t CleanupRefs(void* aStartAddress, void* aEndAddress);
+
+		private:
+		Core::LogApi&                          Logger;
+		ITextureUploader&                      Uploader;
+		ITextureAtlas&                         Atlas;
+
+		TextureDiskCache                       DiskCache;
+
+		std::atomic<bool>                      IsAtlasEnabled{ false };
+		std::vector<Texture_t*>                AtlasRemovals{}; /* Deferred to the render thread. */
+		uint64_t                               AtlasGeneration{ 0 }; /* Last atlas generation folded into Generation. */
+
+		std::atomic<uint64_t>                  Generation{ 0 };
+
+		TextureBudget                          Budget{};
+		std::atomic<uint64_t>                  BudgetBytes{ 0 };
+		std::unordered_map<ID3D11ShaderResourceView*, Texture_t*> Resources{}; /* Lookup of drawn resources. */
+
+		mutable std::mutex                     Mutex{};
+		std::map<std::string, Texture_t*>      Registry{};
+		std::map<std::string, QueuedTexture_t> QueuedTextures{};
+		Memory::OwnerIndex<std::string>        CallbackOwners{}; /* Queued identifiers by module of their callback. */
+
+		std::set<std::string>                  HotSwaps{}; /* Identifiers whose next upload replaces the resource in place. */
+		std::vector<std::pair<std::string, Texture_t*>> Created{}; /* Returned by Advance. */
+		std::vector<std::string>               Reloads{}; /* Evicted textures decoded anew after Advance releases the lock. */
+
+		///----------------------------------------------------------------------------------------------------
+		/// FreeData:
+		/// 	Frees or unmaps the pixels of a queue entry.
+		///----------------------------------------------------------------------------------------------------
+		void FreeData(QueuedTexture_t& aQueuedTexture);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Evict:
+		/// 	Swaps the resource of a texture for a placeholder, keeping the Texture_t for its holders.
+		/// 	Must be called on the render thread with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Evict(const std::string& aIdentifier, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CreatePlaceholder:
+		/// 	Creates a transparent 1x1 resource.
+		///----------------------------------------------------------------------------------------------------
+		ID3D11ShaderResourceView* CreatePlaceholder();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Restore:
+		/// 	Queues the cached pixels of an evicted texture or, if they are gone, queues it to be decoded
+		/// 	from its source. Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Restore(const std::string& aIdentifier, long long aTime);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Abandon:
+		/// 	Gives up on restoring an evicted texture, its holders keep the placeholder.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		void Abandon(const std::string& aIdentifier);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CreateTexture:
+		/// 	Creates a texture and adds it to the registry.
+		///----------------------------------------------------------------------------------------------------
+		void CreateTexture(const std::string& aIdentifier, QueuedTexture_t& aQueuedTexture, long long aTime);
+	};
+}
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <d3d11.h>
+struct ID3D11ShaderResourceView;
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Graphics Namespace
@@ -23,5 +23,11 @@ namespace Raidcore::Nexus::Graphics
 		unsigned                  Width;
 		unsigned                  Height;
 		ID3D11ShaderResourceView* Resource;
+
+		/* Nexus internal, appended to keep the layout addons know. */
+		ID3D11ShaderResourceView* AtlasResource; /* Atlas page also containing this texture or nullptr. */
+		float                     AtlasUV0[2];
+		float                     AtlasUV1[2];
+		long long                 LastUsed;      /* Timestamp in ms of the last lookup or draw by Nexus. */
 	};
 }
@@ -0,0 +1,51 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxUploader.h
+/// Description  :  TextureUploader interface definition.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "TxTexture.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Graphics Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Graphics
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ITextureUploader Interface Class
+	/// 	Creates and releases the GPU resources of the texture loader.
+	///----------------------------------------------------------------------------------------------------
+	class ITextureUploader
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		virtual ~ITextureUploader() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsReady:
+		/// 	Returns true if resources can be created.
+		///----------------------------------------------------------------------------------------------------
+		virtual bool IsReady() const = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Create:
+		/// 	Creates a shader resource from RGBA8 pixels.
+		/// 	Returns nullptr on failure.
+		///----------------------------------------------------------------------------------------------------
+		virtual ID3D11ShaderResourceView* Create(uint32_t aWidth, uint32_t aHeight, const uint8_t* aData) = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Release:
+		/// 	Releases a shader resource created by this uploader.
+		///----------------------------------------------------------------------------------------------------
+		virtual void Release(ID3D11ShaderResourceView* aResource) = 0;
+	};
+}
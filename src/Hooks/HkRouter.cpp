@@ -0,0 +1,70 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  HkRouter.cpp
+/// Description  :  Routes window messages to the WndProc stages interested in them.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "HkRouter.h"
+
+namespace Raidcore::Nexus::Hooks
+{
+	WndProcRouter::WndProcRouter()
+	{
+		LARGE_INTEGER freq;
+		QueryPerformanceFrequency(&freq);
+		this->Frequency = freq.QuadPart;
+	}
+
+	void WndProcRouter::Route(EWndProcStage aStage, Platform::EMsgClass aClasses)
+	{
+		for (uint32_t i = 0; i < MSGCLASS_COUNT; i++)
+		{
+			if ((static_cast<uint32_t>(aClasses) & (1 << i)) != 0)
+			{
+				this->StageMasks[i] |= 1 << static_cast<uint32_t>(aStage);
+			}
+		}
+	}
+
+	uint32_t WndProcRouter::Begin(UINT uMsg)
+	{
+		uint32_t idx = Platform::GetMsgClassIndex(uMsg);
+
+		this->Messages[idx].store(this->Messages[idx].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+		return this->StageMasks[idx];
+	}
+
+	uint32_t WndProcRouter::GetStages(UINT uMsg) const
+	{
+		return this->StageMasks[Platform::GetMsgClassIndex(uMsg)];
+	}
+
+	std::array<WndProcStageStats_t, static_cast<uint32_t>(EWndProcStage::COUNT)> WndProcRouter::GetStageStats() const
+	{
+		std::array<WndProcStageStats_t, static_cast<uint32_t>(EWndProcStage::COUNT)> stats{};
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(EWndProcStage::COUNT); i++)
+		{
+			stats[i].Calls    = this->Counters[i].Calls.load(std::memory_order_relaxed);
+			stats[i].Consumed = this->Counters[i].Consumed.load(std::memory_order_relaxed);
+			stats[i].TotalUs  = this->Counters[i].Ticks.load(std::memory_order_relaxed) * 1000000 / this->Frequency;
+		}
+
+		return stats;
+	}
+
+	std::array<uint64_t, MSGCLASS_COUNT> WndProcRouter::GetMessageCounts() const
+	{
+		std::array<uint64_t, MSGCLASS_COUNT> counts{};
+
+		for (uint32_t i = 0; i < MSGCLASS_COUNT; i++)
+		{
+			counts[i] = this->Messages[i].load(std::memory_order_relaxed);
+		}
+
+		return counts;
+	}
+}
@@ -0,0 +1,147 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  HkRouter.h
+/// Description  :  Routes window messages to the WndProc stages interested in them.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <windows.h>
+
+#include "Platform/RawInput/RiMsgClass.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Hooks Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Hooks
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EWndProcStage Enumeration
+	/// 	In the order they are dispatched.
+	///----------------------------------------------------------------------------------------------------
+	enum class EWndProcStage : uint32_t
+	{
+		Loader,
+		RawInput,
+		UI,
+		InputBinds,
+		GameBinds,
+		MouseResetFix,
+		COUNT
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// WndProcStageStats_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct WndProcStageStats_t
+	{
+		uint64_t Calls;    /* Messages passed to the stage.       */
+		uint64_t Consumed; /* Of which the stage did not pass on. */
+		uint64_t TotalUs;  /* Time spent in the stage.            */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// WndProcRouter Class
+	/// 	Stages declare the message classes they handle. Per class a stage mask is kept, so a message
+	/// 	costs one table lookup and skips every stage not interested in it.
+	/// 	Dispatching is only done from the window thread, the counters may be read from any thread.
+	///----------------------------------------------------------------------------------------------------
+	class WndProcRouter
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		WndProcRouter();
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~WndProcRouter() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Route:
+		/// 	Routes the given message classes to a stage.
+		///----------------------------------------------------------------------------------------------------
+		void Route(EWndProcStage aStage, Platform::EMsgClass aClasses);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Begin:
+		/// 	Counts a received message and returns its stage mask.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Begin(UINT uMsg);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetStages:
+		/// 	Returns the stage mask for a message without counting it.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t GetStages(UINT uMsg) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Dispatch:
+		/// 	Invokes the handler if the stage is in the mask and times it.
+		/// 	Returns true if the handler consumed the message, i.e. returned 0.
+		///----------------------------------------------------------------------------------------------------
+		template <typename F>
+		bool Dispatch(uint32_t aStages, EWndProcStage aStage, F&& aHandler)
+		{
+			uint32_t idx = static_cast<uint32_t>(aStage);
+
+			if ((aStages & (1 << idx)) == 0) { return false; }
+
+			LARGE_INTEGER start, end;
+			QueryPerformanceCounter(&start);
+
+			bool consumed = aHandler() == 0;
+
+			QueryPerformanceCounter(&end);
+
+			Counters_t& counters = this->Counters[idx];
+			counters.Calls.store(counters.Calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			counters.Ticks.store(counters.Ticks.load(std::memory_order_relaxed) + (end.QuadPart - start.QuadPart), std::memory_order_relaxed);
+
+			if (consumed)
+			{
+				counters.Consumed.store(counters.Consumed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			return consumed;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetStageStats:
+		/// 	Returns the counters of all stages.
+		///----------------------------------------------------------------------------------------------------
+		std::array<WndProcStageStats_t, static_cast<uint32_t>(EWndProcStage::COUNT)> GetStageStats() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetMessageCounts:
+		/// 	Returns the amount of messages received per message class.
+		///----------------------------------------------------------------------------------------------------
+		std::array<uint64_t, MSGCLASS_COUNT> GetMessageCounts() const;
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Counters_t Struct
+		/// 	Single writer, stored with relaxed load/store instead of read-modify-write.
+		///----------------------------------------------------------------------------------------------------
+		struct Counters_t
+		{
+			std::atomic<uint64_t> Calls{ 0 };
+			std::atomic<uint64_t> Consumed{ 0 };
+			std::atomic<uint64_t> Ticks{ 0 };
+		};
+
+		int64_t               Frequency;
+
+		uint32_t              StageMasks[MSGCLASS_COUNT]{};
+
+		Counters_t            Counters[static_cast<uint32_t>(EWndProcStage::COUNT)];
+		std::atomic<uint64_t> Messages[MSGCLASS_COUNT]{};
+	};
+}
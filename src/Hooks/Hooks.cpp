@@ -22,13 +22,17 @@
 #include "Core/DataLink/DlApi.h"
 #include "Core/Logging/LogApi.h"
 #include "Core/NexusLink.h"
+#include "Graphics/GrFrameMetrics.h"
 #include "Graphics/Textures/TxLoader.h"
 #include "GW2/Inputs/GameBinds/GbApi.h"
 #include "GW2/Inputs/MouseResetFix.h"
+#include "GW2/Mumble/MblReader.h"
 #include "HkConst.h"
+#include "HkRouter.h"
 #include "HkFuncDefs.h"
 #include "Host/Events/EvtApi.h"
 #include "Host/Loader/Loader.h"
+#include "Host/Resources/ResMonitor.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "Runtime/Runtime.h"
 #include "UI/UiContext.h"
@@ -188,18 +192,36 @@ namespace Raidcore::Nexus::Hooks
 			static GUI::Context&          s_UIContext    = s_Context.UI();
 			static Host::Loader&          s_Loader       = s_Context.Loader();
 			static GW2::GameBindsApi&     s_GameBindsApi = s_Context.GameBinds();
+			static Hooks::WndProcRouter&  s_Router       = [&]() -> Hooks::WndProcRouter&
+			{
+				using Platform::EMsgClass;
+
+				Hooks::WndProcRouter& router = s_Context.WndProcRouter();
+
+				/* Addon callbacks declare their classes themselves, RawInputApi filters per class. */
+				router.Route(EWndProcStage::Loader,        EMsgClass::User);
+				router.Route(EWndProcStage::RawInput,      EMsgClass::All);
+				router.Route(EWndProcStage::UI,            EMsgClass::Keyboard | EMsgClass::Mouse);
+				router.Route(EWndProcStage::InputBinds,    EMsgClass::Keyboard | EMsgClass::Mouse | EMsgClass::Focus);
+				router.Route(EWndProcStage::GameBinds,     EMsgClass::User);
+				router.Route(EWndProcStage::MouseResetFix, EMsgClass::Mouse | EMsgClass::Focus);
+
+				return router;
+			}();
+
+			uint32_t stages = s_Router.Begin(uMsg);
 
 			// don't pass to game if loader
-			if (s_Loader.WndProc(hWnd, uMsg, wParam, lParam) == 0) { return 0; }
+			if (s_Router.Dispatch(stages, EWndProcStage::Loader, [&]() { return s_Loader.WndProc(hWnd, uMsg, wParam, lParam); })) { return 0; }
 
 			// don't pass to game if custom wndproc
-			if (s_RawInputApi.WndProc(hWnd, uMsg, wParam, lParam) == 0) { return 0; }
+			if (s_Router.Dispatch(stages, EWndProcStage::RawInput, [&]() { return s_RawInputApi.WndProc(hWnd, uMsg, wParam, lParam); })) { return 0; }
 
 			// don't pass to game if gui
-			if (s_UIContext.WndProc(hWnd, uMsg, wParam, lParam) == 0) { return 0; }
+			if (s_Router.Dispatch(stages, EWndProcStage::UI, [&]() { return s_UIContext.WndProc(hWnd, uMsg, wParam, lParam); })) { return 0; }
 
 			// don't pass to game if InputBind
-			if (s_InputBindApi.WndProc(hWnd, uMsg, wParam, lParam) == 0) { return 0; }
+			if (s_Router.Dispatch(stages, EWndProcStage::InputBinds, [&]() { return s_InputBindApi.WndProc(hWnd, uMsg, wParam, lParam); })) { return 0; }
 
 			if (uMsg == WM_DESTROY)
 			{
@@ -207,9 +229,12 @@ namespace Raidcore::Nexus::Hooks
 			}
 
 			// shift game only messages back to normal messages.
-			s_GameBindsApi.RedirectGameOnly(hWnd, uMsg, wParam, lParam);
+			s_Router.Dispatch(stages, EWndProcStage::GameBinds, [&]() { return s_GameBindsApi.RedirectGameOnly(hWnd, uMsg, wParam, lParam); });
 
-			GW2::MouseResetFix(hWnd, uMsg, wParam, lParam);
+			// a game only message now has its actual class.
+			stages = s_Router.GetStages(uMsg);
+
+			s_Router.Dispatch(stages, EWndProcStage::MouseResetFix, [&]() { return GW2::MouseResetFix(hWnd, uMsg, wParam, lParam); });
 
 			return CallWindowProcA(Target::WndProc, hWnd, uMsg, wParam, lParam);
 		}
@@ -217,14 +242,16 @@ namespace Raidcore::Nexus::Hooks
 		void Present_Internal(IDXGISwapChain* aSwapChain)
 		{
 			static Runtime& s_Context = Runtime::Get();
-			static Graphics::Metrics_t s_GrMetrics = s_Context.GrMetrics();
+			static Graphics::FrameMetrics& s_GrMetrics = s_Context.GrMetrics();
 			static Graphics::Window_t& s_GrWindow = s_Context.GrWindow();
 			static Graphics::TextureLoader& s_TextureLoader = s_Context.TextureLoader();
 			static GUI::Context& s_UIContext = s_Context.UI();
 			static Host::Loader& s_Loader = s_Context.Loader();
+			static Host::ResourceMonitor& s_Resources = s_Context.Resources();
+			static GW2::MumbleReader& s_Mumble = s_Context.Mumble();
 
 			/* Increment count at the beginning of the frame. */
-			s_GrMetrics.FrameCount++;
+			s_GrMetrics.BeginFrame();
 
 			/* The swap chain we used to hook is different than the one the game created.
 			 * To be precise, we should have no swapchain at all right now. */
@@ -242,9 +269,20 @@ namespace Raidcore::Nexus::Hooks
 				s_Loader.InitDirectoryUpdates(swapChainDesc.OutputWindow);
 			}
 
+			s_GrMetrics.BeginSection(Graphics::EFrameSection::TextureLoader);
 			s_TextureLoader.Advance();
+			s_GrMetrics.EndSection(Graphics::EFrameSection::TextureLoader);
 
+			s_GrMetrics.BeginSection(Graphics::EFrameSection::UIRender);
 			s_UIContext.Render();
+			s_GrMetrics.EndSection(Graphics::EFrameSection::UIRender);
+
+			/* After the UI wrote its fields for this frame. */
+			s_Mumble.PublishNexusLink();
+
+			s_Resources.Advance();
+
+			s_GrMetrics.EndFrame();
 		}
 
 		HRESULT __stdcall DXGIPresent(IDXGISwapChain* pChain, UINT SyncInterval, UINT Flags)
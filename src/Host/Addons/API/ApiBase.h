@@ -12,10 +12,12 @@
 #include <imgui.h>
 #include <windows.h>
 
+#include "Core/DataLink/DlVersioned.h"
 #include "Core/Logging/LogEnum.h"
 #include "Graphics/Textures/TxQueueEntry.h"
 #include "Graphics/Textures/TxTexture.h"
 #include "GW2/Inputs/GameBinds/GbEnum.h"
+#include "GW2/Inputs/GameBinds/GbSequence.h"
 #include "Host/Events/EvtSubscriber.h"
 #include "Inputs/InputBinds/IbBind.h"
 #include "Inputs/InputBinds/IbMapping.h"
@@ -31,6 +33,20 @@ typedef void (*UPDATER_REQUESTUPDATE)(signed int aSignature, const char* aUpdate
 
 typedef void* (*DATALINK_GETRESOURCE)  (const char* aIdentifier);
 typedef void* (*DATALINK_SHARERESOURCE)(const char* aIdentifier, size_t aResourceSize);
+typedef uint32_t (*DATALINK_GETHANDLE)  (const char* aIdentifier);
+typedef void*    (*DATALINK_GETBYHANDLE)(uint32_t aHandle);
+typedef Core::VersionedHeader_t* (*DATALINK_SHAREVERSIONED)(const char* aIdentifier, size_t aPayloadSize, uint32_t aBufferCount);
+typedef void*                    (*DATALINK_BEGINWRITE)    (Core::VersionedHeader_t* aResource);
+typedef void                     (*DATALINK_ENDWRITE)      (Core::VersionedHeader_t* aResource);
+typedef bool                     (*DATALINK_READVERSIONED) (const Core::VersionedHeader_t* aResource, void* aOut, size_t aSize);
+
+typedef bool     (*FUNCTIONS_REGISTER)     (const char* aIdentifier, void* aFunction);
+typedef void     (*FUNCTIONS_DEREGISTER)   (const char* aIdentifier, void* aFunction);
+typedef void*    (*FUNCTIONS_QUERY)        (const char* aIdentifier);
+typedef void     (*FUNCTIONS_RELEASE)      (const char* aIdentifier);
+typedef uint32_t (*FUNCTIONS_GETHANDLE)    (const char* aIdentifier);
+typedef void*    (*FUNCTIONS_QUERYHANDLE)  (uint32_t aHandle);
+typedef void     (*FUNCTIONS_RELEASEHANDLE)(uint32_t aHandle);
 
 typedef void (*LOGGER_LOG) (Core::ELogLevel aLogLevel, const char* aStr);
 typedef void (*LOGGER_LOG2)(Core::ELogLevel aLogLevel, const char* aChannel, const char* aStr);
@@ -53,6 +69,8 @@ typedef void (*GAMEBINDS_INVOKEASYNC) (GW2::EGameBinds aGameBind, int aDuration)
 typedef void (*GAMEBINDS_PRESS)       (GW2::EGameBinds aGameBind);
 typedef void (*GAMEBINDS_RELEASE)     (GW2::EGameBinds aGameBind);
 typedef bool (*GAMEBINDS_ISBOUND)     (GW2::EGameBinds aGameBind);
+typedef uint64_t (*GAMEBINDS_SUBMITSEQUENCE)(const GW2::GameBindStep_t* aSteps, size_t aCount);
+typedef bool     (*GAMEBINDS_CANCELSEQUENCE)(uint64_t aSequenceID);
 
 typedef void (*EVENTS_RAISE)                     (const char* aIdentifier, void* aEventData);
 typedef void (*EVENTS_RAISENOTIFICATION)         (const char* aIdentifier);
@@ -81,6 +99,7 @@ typedef bool (*INPUTBINDS_INVOKE2)            (const char* aIdentifier, bool aIs
 typedef void (*INPUTBINDS_DEREGISTER)         (const char* aIdentifier);
 
 typedef void    (*WNDPROC_ADDREM)    (Platform::WNDPROC_CALLBACK aWndProcCallback);
+typedef void    (*WNDPROC_ADDFILTERED)(Platform::WNDPROC_CALLBACK aWndProcCallback, Platform::EMsgClass aClasses);
 typedef LRESULT(*WNDPROC_SENDTOGAME)(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
 typedef void (*FONTS_GETRELEASE)(const char* aIdentifier, GUI::FONTS_RECEIVECALLBACK aCallback);
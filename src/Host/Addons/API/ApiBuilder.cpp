@@ -12,6 +12,7 @@
 #include <cassert>
 #include <cstdint>
 #include <filesystem>
+#include <intrin.h>
 #include <mutex>
 #include <string>
 #include <string.h>
@@ -31,6 +32,7 @@ using namespace Raidcore::Nexus;
 #include "ApiV4.h"
 #include "ApiV5.h"
 #include "ApiV6.h"
+#include "ApiV7.h"
 #include "ApiBase.h"
 #include "Core/Logging/LogEnum.h"
 #include "Index/Index.h"
@@ -38,6 +40,7 @@ using namespace Raidcore::Nexus;
 #include "Graphics/Textures/TxTexture.h"
 #include "GW2/Inputs/GameBinds/GbEnum.h"
 #include "Core/DataLink/DlApi.h"
+#include "Core/Functions/FnRegistry.h"
 #include "Core/Logging/LogApi.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "Inputs/InputBinds/IbEnum.h"
@@ -61,6 +64,7 @@ using namespace Raidcore::Nexus;
 #include "Host/Events/EvtSubscriber.h"
 #include "Index/IdxEnum.h"
 #include "Inputs/InputBinds/IbMapping.h"
+#include "Memory/ResourceLedger.h"
 
 namespace Raidcore::Nexus::Host::API
 {
@@ -68,6 +72,7 @@ namespace Raidcore::Nexus::Host::API
 
 	static Core::DataLinkApi* s_DataLinkApi = nullptr;
 	static Host::EventApi* s_EventApi = nullptr;
+	static Core::FuncRegistry* s_FuncRegistry = nullptr;
 	static GW2::GameBindsApi* s_GameBindsApi = nullptr;
 	static Input::CInputBindApi* s_InputBindApi = nullptr;
 	static Platform::RawInputApi* s_RawInputApi = nullptr;
@@ -96,7 +101,88 @@ namespace Raidcore::Nexus::Host::API
 		void* Share(const char* aIdentifier, size_t aResourceSize)
 		{
 			assert(s_DataLinkApi);
-			return s_DataLinkApi->Share(aIdentifier, aResourceSize, "", false);
+			return s_DataLinkApi->Share(aIdentifier, aResourceSize, "", false, _ReturnAddress());
+		}
+
+		uint32_t GetHandle(const char* aIdentifier)
+		{
+			assert(s_DataLinkApi);
+			return s_DataLinkApi->GetHandle(aIdentifier);
+		}
+
+		void* GetByHandle(uint32_t aHandle)
+		{
+			assert(s_DataLinkApi);
+			return s_DataLinkApi->GetByHandle(aHandle);
+		}
+
+		Core::VersionedHeader_t* ShareVersioned(const char* aIdentifier, size_t aPayloadSize, uint32_t aBufferCount)
+		{
+			assert(s_DataLinkApi);
+			return s_DataLinkApi->ShareVersioned(aIdentifier, aPayloadSize, aBufferCount, "", false, _ReturnAddress());
+		}
+
+		void* BeginWrite(Core::VersionedHeader_t* aResource)
+		{
+			if (!aResource) { return nullptr; }
+			return Core::BeginWrite(aResource);
+		}
+
+		void EndWrite(Core::VersionedHeader_t* aResource)
+		{
+			if (!aResource) { return; }
+			Core::EndWrite(aResource);
+		}
+
+		bool Read(const Core::VersionedHeader_t* aResource, void* aOut, size_t aSize)
+		{
+			if (!aResource || !aOut) { return false; }
+			return Core::ReadVersioned(aResource, aOut, aSize);
+		}
+	}
+
+	namespace Functions
+	{
+		bool Register(const char* aIdentifier, void* aFunction)
+		{
+			assert(s_FuncRegistry);
+			return s_FuncRegistry->Register(aIdentifier, aFunction);
+		}
+
+		void Deregister(const char* aIdentifier, void* aFunction)
+		{
+			assert(s_FuncRegistry);
+			s_FuncRegistry->Deregister(aIdentifier, aFunction);
+		}
+
+		void* Query(const char* aIdentifier)
+		{
+			assert(s_FuncRegistry);
+			return s_FuncRegistry->Query(aIdentifier);
+		}
+
+		void Release(const char* aIdentifier)
+		{
+			assert(s_FuncRegistry);
+			s_FuncRegistry->Release(aIdentifier);
+		}
+
+		uint32_t GetHandle(const char* aIdentifier)
+		{
+			assert(s_FuncRegistry);
+			return s_FuncRegistry->GetHandle(aIdentifier);
+		}
+
+		void* QueryHandle(uint32_t aHandle)
+		{
+			assert(s_FuncRegistry);
+			return s_FuncRegistry->QueryHandle(aHandle);
+		}
+
+		void ReleaseHandle(uint32_t aHandle)
+		{
+			assert(s_FuncRegistry);
+			s_FuncRegistry->ReleaseHandle(aHandle);
 		}
 	}
 
@@ -106,18 +192,11 @@ namespace Raidcore::Nexus::Host::API
 		{
 			assert(s_EventApi);
 			s_EventApi->Subscribe(aIdentifier, aConsumeEventCallback);
+		}
 
-			// FIXME: Dirty hack to detect ArcDPS below. Do this cleaner later.
-			if (s_ArcApi->IsInitialized())
-			{
-				return;
-			}
-
-			if (!(strcmp("EV_ARCDPS_COMBATEVENT_LOCAL_RAW", aIdentifier) == 0 || strcmp("EV_ARCDPS_COMBATEVENT_SQUAD_RAW", aIdentifier) == 0))
-			{
-				return;
-			}
-
+		void OnArcdpsSubscribed(const char* aIdentifier)
+		{
+			assert(s_ArcApi);
 			s_ArcApi->TryDetect();
 		}
 
@@ -195,6 +274,18 @@ namespace Raidcore::Nexus::Host::API
 			assert(s_GameBindsApi);
 			return s_GameBindsApi->IsBound(aGameBind);
 		}
+
+		uint64_t SubmitSequence(const GW2::GameBindStep_t* aSteps, size_t aCount)
+		{
+			assert(s_GameBindsApi);
+			return s_GameBindsApi->SubmitSequence(aSteps, aCount);
+		}
+
+		bool CancelSequence(uint64_t aSequenceID)
+		{
+			assert(s_GameBindsApi);
+			return s_GameBindsApi->CancelSequence(aSequenceID);
+		}
 	}
 
 	namespace Paths
@@ -288,6 +379,12 @@ namespace Raidcore::Nexus::Host::API
 			s_RawInputApi->Register(aWndProcCallback);
 		}
 
+		void RegisterFiltered(Platform::WNDPROC_CALLBACK aWndProcCallback, Platform::EMsgClass aClasses)
+		{
+			assert(s_RawInputApi);
+			s_RawInputApi->Register(aWndProcCallback, aClasses);
+		}
+
 		void Deregister(Platform::WNDPROC_CALLBACK aWndProcCallback)
 		{
 			assert(s_RawInputApi);
@@ -316,21 +413,38 @@ namespace Raidcore::Nexus::Host::API
 		}
 	}
 
+	/* The return address attributes logged messages to the calling addon. */
 	namespace Logger
 	{
+		///----------------------------------------------------------------------------------------------------
+		/// Account:
+		/// 	Adds a message to the usage of the module containing the address.
+		///----------------------------------------------------------------------------------------------------
+		static void Account(void* aAddress, const char* aStr)
+		{
+			void* owner = Memory::GetOwnerModule(aAddress);
+
+			Memory::ResourceLedger* ledger = Memory::ResourceLedger::Get();
+			ledger->Add(owner, Memory::EResource::LogMessages, 1);
+			ledger->Add(owner, Memory::EResource::LogBytes, aStr ? static_cast<int64_t>(strlen(aStr)) : 0);
+		}
+
 		void LogMessage(Core::ELogLevel aLogLevel, const char* aStr)
 		{
 			assert(s_Logger);
+			Account(_ReturnAddress(), aStr);
 			s_Logger->LogUnformatted(aLogLevel, "Addon", aStr);
 		}
 
 		void LogMessage2(Core::ELogLevel aLogLevel, const char* aChannel, const char* aStr)
 		{
 			assert(s_Logger);
+			Account(_ReturnAddress(), aStr);
 			s_Logger->LogUnformatted(aLogLevel, aChannel, aStr);
 		}
 	}
 
+	/* The return address attributes requested textures to the calling addon. */
 	namespace TextureLoader
 	{
 		Graphics::Texture_t* Get(const char* aIdentifier)
@@ -342,49 +456,49 @@ namespace Raidcore::Nexus::Host::API
 		Graphics::Texture_t* GetOrCreateFromFile(const char* aIdentifier, const char* aFilename)
 		{
 			assert(s_TextureApi);
-			return s_TextureApi->GetOrCreate(aIdentifier, aFilename);
+			return s_TextureApi->GetOrCreate(aIdentifier, aFilename, _ReturnAddress());
 		}
 
 		Graphics::Texture_t* GetOrCreateFromResource(const char* aIdentifier, unsigned aResourceID, HMODULE aModule)
 		{
 			assert(s_TextureApi);
-			return s_TextureApi->GetOrCreate(aIdentifier, aResourceID, aModule);;
+			return s_TextureApi->GetOrCreate(aIdentifier, aResourceID, aModule, _ReturnAddress());
 		}
 
 		Graphics::Texture_t* GetOrCreateFromURL(const char* aIdentifier, const char* aRemote, const char* aEndpoint)
 		{
 			assert(s_TextureApi);
-			return s_TextureApi->GetOrCreate(aIdentifier, aRemote, aEndpoint);
+			return s_TextureApi->GetOrCreate(aIdentifier, aRemote, aEndpoint, _ReturnAddress());
 		}
 
 		Graphics::Texture_t* GetOrCreateFromMemory(const char* aIdentifier, void* aData, size_t aSize)
 		{
 			assert(s_TextureApi);
-			return s_TextureApi->GetOrCreate(aIdentifier, aData, aSize);
+			return s_TextureApi->GetOrCreate(aIdentifier, aData, aSize, _ReturnAddress());
 		}
 
 		void LoadFromFile(const char* aIdentifier, const char* aFilename, Graphics::TEXTURES_RECEIVECALLBACK aCallback)
 		{
 			assert(s_TextureApi);
-			s_TextureApi->Load(aIdentifier, aFilename, aCallback, true);
+			s_TextureApi->Load(aIdentifier, aFilename, aCallback, true, _ReturnAddress());
 		}
 
 		void LoadFromResource(const char* aIdentifier, unsigned aResourceID, HMODULE aModule, Graphics::TEXTURES_RECEIVECALLBACK aCallback)
 		{
 			assert(s_TextureApi);
-			s_TextureApi->Load(aIdentifier, aResourceID, aModule, aCallback, true);
+			s_TextureApi->Load(aIdentifier, aResourceID, aModule, aCallback, true, _ReturnAddress());
 		}
 
 		void LoadFromURL(const char* aIdentifier, const char* aRemote, const char* aEndpoint, Graphics::TEXTURES_RECEIVECALLBACK aCallback)
 		{
 			assert(s_TextureApi);
-			s_TextureApi->Load(aIdentifier, aRemote, aEndpoint, aCallback, true);
+			s_TextureApi->Load(aIdentifier, aRemote, aEndpoint, aCallback, true, _ReturnAddress());
 		}
 
 		void LoadFromMemory(const char* aIdentifier, void* aData, size_t aSize, Graphics::TEXTURES_RECEIVECALLBACK aCallback)
 		{
 			assert(s_TextureApi);
-			s_TextureApi->Load(aIdentifier, aData, aSize, aCallback, true);
+			s_TextureApi->Load(aIdentifier, aData, aSize, aCallback, true, _ReturnAddress());
 		}
 	}
 
@@ -581,14 +695,527 @@ namespace Raidcore::Nexus::Host::API
 		}
 	}
 
+	/* Built once on first use, all addons of a version share a table. Index 1 has the ImGui context set. */
+	static AddonAPI1_t s_APIV1[2]{};
+	static AddonAPI2_t s_APIV2[2]{};
+	static AddonAPI3_t s_APIV3[2]{};
+	static AddonAPI4_t s_APIV4[2]{};
+	static AddonAPI5_t s_APIV5[2]{};
+	static AddonAPI6_t s_APIV6[2]{};
+	static AddonAPI7_t s_APIV7[2]{};
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 1.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI1_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+		aApi.RegisterRender = GUI::Render::Register;
+		aApi.DeregisterRender = GUI::Render::Deregister;
+
+		aApi.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.CreateHook = MH_CreateHook;
+		aApi.RemoveHook = MH_RemoveHook;
+		aApi.EnableHook = MH_EnableHook;
+		aApi.DisableHook = MH_DisableHook;
+
+		aApi.Log = Logger::LogMessage;
+
+		aApi.RaiseEvent = Events::RaiseEvent;
+		aApi.SubscribeEvent = Events::Subscribe;
+		aApi.UnsubscribeEvent = Events::Unsubscribe;
+
+		aApi.RegisterWndProc = RawInput::Register;
+		aApi.DeregisterWndProc = RawInput::Deregister;
+
+		aApi.RegisterInputBindWithString = InputBinds::RegisterWithString;
+		aApi.RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
+		aApi.DeregisterInputBind = InputBinds::Deregister;
+
+		aApi.Get = DataLink::Get;
+		aApi.Share = DataLink::Share;
+
+		aApi.GetTexture = TextureLoader::Get;
+		aApi.LoadTextureFromFile = TextureLoader::LoadFromFile;
+		aApi.LoadTextureFromResource = TextureLoader::LoadFromResource;
+		aApi.LoadTextureFromURL = TextureLoader::LoadFromURL;
+
+		aApi.AddShortcut = GUI::QuickAccess::AddShortcut;
+		aApi.RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
+		aApi.AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
+		aApi.RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 2.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI2_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+		aApi.RegisterRender = GUI::Render::Register;
+		aApi.DeregisterRender = GUI::Render::Deregister;
+
+		aApi.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.CreateHook = MH_CreateHook;
+		aApi.RemoveHook = MH_RemoveHook;
+		aApi.EnableHook = MH_EnableHook;
+		aApi.DisableHook = MH_DisableHook;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.RaiseEvent = Events::RaiseEvent;
+		aApi.RaiseEventNotification = Events::RaiseNotification;
+		aApi.SubscribeEvent = Events::Subscribe;
+		aApi.UnsubscribeEvent = Events::Unsubscribe;
+
+		aApi.RegisterWndProc = RawInput::Register;
+		aApi.DeregisterWndProc = RawInput::Deregister;
+		aApi.SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
+
+		aApi.RegisterInputBindWithString = InputBinds::RegisterWithString;
+		aApi.RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
+		aApi.DeregisterInputBind = InputBinds::Deregister;
+
+		aApi.Get = DataLink::Get;
+		aApi.Share = DataLink::Share;
+
+		aApi.GetTexture = TextureLoader::Get;
+		aApi.GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.LoadTextureFromFile = TextureLoader::LoadFromFile;
+		aApi.LoadTextureFromResource = TextureLoader::LoadFromResource;
+		aApi.LoadTextureFromURL = TextureLoader::LoadFromURL;
+		aApi.LoadTextureFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.AddShortcut = GUI::QuickAccess::AddShortcut;
+		aApi.RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
+		aApi.PushNotification = GUI::QuickAccess::PushNotification;
+		aApi.AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
+		aApi.RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Translate = Localization::Translate;
+		aApi.TranslateTo = Localization::TranslateTo;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 3.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI3_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+		aApi.RegisterRender = GUI::Render::Register;
+		aApi.DeregisterRender = GUI::Render::Deregister;
+
+		aApi.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.CreateHook = MH_CreateHook;
+		aApi.RemoveHook = MH_RemoveHook;
+		aApi.EnableHook = MH_EnableHook;
+		aApi.DisableHook = MH_DisableHook;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.SendAlert = GUI::Alerts::Notify;
+
+		aApi.RaiseEvent = Events::RaiseEvent;
+		aApi.RaiseEventNotification = Events::RaiseNotification;
+		aApi.RaiseEventTargeted = Events::RaiseEventTargeted;
+		aApi.RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
+		aApi.SubscribeEvent = Events::Subscribe;
+		aApi.UnsubscribeEvent = Events::Unsubscribe;
+
+		aApi.RegisterWndProc = RawInput::Register;
+		aApi.DeregisterWndProc = RawInput::Deregister;
+		aApi.SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
+
+		aApi.RegisterInputBindWithString = InputBinds::RegisterWithString;
+		aApi.RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
+		aApi.DeregisterInputBind = InputBinds::Deregister;
+
+		aApi.Get = DataLink::Get;
+		aApi.Share = DataLink::Share;
+
+		aApi.GetTexture = TextureLoader::Get;
+		aApi.GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.LoadTextureFromFile = TextureLoader::LoadFromFile;
+		aApi.LoadTextureFromResource = TextureLoader::LoadFromResource;
+		aApi.LoadTextureFromURL = TextureLoader::LoadFromURL;
+		aApi.LoadTextureFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.AddShortcut = GUI::QuickAccess::AddShortcut;
+		aApi.RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
+		aApi.PushNotification = GUI::QuickAccess::PushNotification;
+		aApi.AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
+		aApi.RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Translate = Localization::Translate;
+		aApi.TranslateTo = Localization::TranslateTo;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 4.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI4_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+		aApi.RegisterRender = GUI::Render::Register;
+		aApi.DeregisterRender = GUI::Render::Deregister;
+
+		aApi.RequestUpdate = Updater::RequestUpdate;
+
+		aApi.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.CreateHook = MH_CreateHook;
+		aApi.RemoveHook = MH_RemoveHook;
+		aApi.EnableHook = MH_EnableHook;
+		aApi.DisableHook = MH_DisableHook;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.SendAlert = GUI::Alerts::Notify;
+
+		aApi.RaiseEvent = Events::RaiseEvent;
+		aApi.RaiseEventNotification = Events::RaiseNotification;
+		aApi.RaiseEventTargeted = Events::RaiseEventTargeted;
+		aApi.RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
+		aApi.SubscribeEvent = Events::Subscribe;
+		aApi.UnsubscribeEvent = Events::Unsubscribe;
+
+		aApi.RegisterWndProc = RawInput::Register;
+		aApi.DeregisterWndProc = RawInput::Deregister;
+		aApi.SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
+
+		aApi.RegisterInputBindWithString = InputBinds::RegisterWithString2;
+		aApi.RegisterInputBindWithStruct = InputBinds::RegisterWithStruct2;
+		aApi.DeregisterInputBind = InputBinds::Deregister;
+
+		aApi.Get = DataLink::Get;
+		aApi.Share = DataLink::Share;
+
+		aApi.GetTexture = TextureLoader::Get;
+		aApi.GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.LoadTextureFromFile = TextureLoader::LoadFromFile;
+		aApi.LoadTextureFromResource = TextureLoader::LoadFromResource;
+		aApi.LoadTextureFromURL = TextureLoader::LoadFromURL;
+		aApi.LoadTextureFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.AddShortcut = GUI::QuickAccess::AddShortcut;
+		aApi.RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
+		aApi.PushNotification = GUI::QuickAccess::PushNotification;
+		aApi.AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
+		aApi.RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Translate = Localization::Translate;
+		aApi.TranslateTo = Localization::TranslateTo;
+
+		aApi.GetFont = GUI::Fonts::Get;
+		aApi.ReleaseFont = GUI::Fonts::Release;
+		aApi.AddFontFromFile = GUI::Fonts::AddFontFromFile;
+		aApi.AddFontFromResource = GUI::Fonts::AddFontFromResource;
+		aApi.AddFontFromMemory = GUI::Fonts::AddFontFromMemory;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 5.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI5_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+		aApi.RegisterRender = GUI::Render::Register;
+		aApi.DeregisterRender = GUI::Render::Deregister;
+
+		aApi.RequestUpdate = Updater::RequestUpdate;
+
+		aApi.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.CreateHook = MH_CreateHook;
+		aApi.RemoveHook = MH_RemoveHook;
+		aApi.EnableHook = MH_EnableHook;
+		aApi.DisableHook = MH_DisableHook;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.SendAlert = GUI::Alerts::Notify;
+
+		aApi.RaiseEvent = Events::RaiseEvent;
+		aApi.RaiseEventNotification = Events::RaiseNotification;
+		aApi.RaiseEventTargeted = Events::RaiseEventTargeted;
+		aApi.RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
+		aApi.SubscribeEvent = Events::Subscribe;
+		aApi.UnsubscribeEvent = Events::Unsubscribe;
+
+		aApi.RegisterWndProc = RawInput::Register;
+		aApi.DeregisterWndProc = RawInput::Deregister;
+		aApi.SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
+
+		aApi.InvokeInputBind = InputBinds::InvokeInputBind;
+		aApi.RegisterInputBindWithString = InputBinds::RegisterWithString2;
+		aApi.RegisterInputBindWithStruct = InputBinds::RegisterWithStruct2;
+		aApi.DeregisterInputBind = InputBinds::Deregister;
+
+		aApi.Get = DataLink::Get;
+		aApi.Share = DataLink::Share;
+
+		aApi.GetTexture = TextureLoader::Get;
+		aApi.GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.LoadTextureFromFile = TextureLoader::LoadFromFile;
+		aApi.LoadTextureFromResource = TextureLoader::LoadFromResource;
+		aApi.LoadTextureFromURL = TextureLoader::LoadFromURL;
+		aApi.LoadTextureFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.AddShortcut = GUI::QuickAccess::AddShortcut;
+		aApi.RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
+		aApi.PushNotification = GUI::QuickAccess::PushNotification;
+		aApi.AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
+		aApi.RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Translate = Localization::Translate;
+		aApi.TranslateTo = Localization::TranslateTo;
+		aApi.SetTranslatedString = Localization::Set;
+
+		aApi.GetFont = GUI::Fonts::Get;
+		aApi.ReleaseFont = GUI::Fonts::Release;
+		aApi.AddFontFromFile = GUI::Fonts::AddFontFromFile;
+		aApi.AddFontFromResource = GUI::Fonts::AddFontFromResource;
+		aApi.AddFontFromMemory = GUI::Fonts::AddFontFromMemory;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 6.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI6_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+
+		aApi.Renderer.Register = GUI::Render::Register;
+		aApi.Renderer.Deregister = GUI::Render::Deregister;
+
+		aApi.RequestUpdate = Updater::RequestUpdate;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.UI.SendAlert = GUI::Alerts::Notify;
+		aApi.UI.RegisterCloseOnEscape = GUI::EscapeClosing::Register;
+		aApi.UI.DeregisterCloseOnEscape = GUI::EscapeClosing::Deregister;
+
+		aApi.Paths.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.Paths.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.Paths.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.MinHook.Create = MH_CreateHook;
+		aApi.MinHook.Remove = MH_RemoveHook;
+		aApi.MinHook.Enable = MH_EnableHook;
+		aApi.MinHook.Disable = MH_DisableHook;
+
+		aApi.Events.Raise = Events::RaiseEvent;
+		aApi.Events.RaiseNotification = Events::RaiseNotification;
+		aApi.Events.RaiseTargeted = Events::RaiseEventTargeted;
+		aApi.Events.RaiseNotificationTargeted = Events::RaiseNotificationTargeted;
+		aApi.Events.Subscribe = Events::Subscribe;
+		aApi.Events.Unsubscribe = Events::Unsubscribe;
+
+		aApi.WndProc.Register = RawInput::Register;
+		aApi.WndProc.Deregister = RawInput::Deregister;
+		aApi.WndProc.SendToGameOnly = GameBinds::SendWndProcToGame;
+
+		aApi.InputBinds.Invoke = InputBinds::InvokeInputBind;
+		aApi.InputBinds.RegisterWithString = InputBinds::RegisterWithString2;
+		aApi.InputBinds.RegisterWithStruct = InputBinds::RegisterWithStruct2;
+		aApi.InputBinds.Deregister = InputBinds::Deregister;
+
+		aApi.GameBinds.PressAsync = GameBinds::PressAsync;
+		aApi.GameBinds.ReleaseAsync = GameBinds::ReleaseAsync;
+		aApi.GameBinds.InvokeAsync = GameBinds::InvokeAsync;
+		aApi.GameBinds.Press = GameBinds::Press;
+		aApi.GameBinds.Release = GameBinds::Release;
+		aApi.GameBinds.IsBound = GameBinds::IsBound;
+
+		aApi.DataLink.Get = DataLink::Get;
+		aApi.DataLink.Share = DataLink::Share;
+
+		aApi.TextureLoader.Get = TextureLoader::Get;
+		aApi.TextureLoader.GetOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.TextureLoader.GetOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.TextureLoader.GetOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.TextureLoader.GetOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.TextureLoader.LoadFromFile = TextureLoader::LoadFromFile;
+		aApi.TextureLoader.LoadFromResource = TextureLoader::LoadFromResource;
+		aApi.TextureLoader.LoadFromURL = TextureLoader::LoadFromURL;
+		aApi.TextureLoader.LoadFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.QuickAccess.Add = GUI::QuickAccess::AddShortcut;
+		aApi.QuickAccess.Remove = GUI::QuickAccess::RemoveShortcut;
+		aApi.QuickAccess.Notify = GUI::QuickAccess::PushNotification;
+		aApi.QuickAccess.AddContextMenu = GUI::QuickAccess::AddContextItem2;
+		aApi.QuickAccess.RemoveContextMenu = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Localization.Translate = Localization::Translate;
+		aApi.Localization.TranslateTo = Localization::TranslateTo;
+		aApi.Localization.SetTranslatedString = Localization::Set;
+
+		aApi.Fonts.Get = GUI::Fonts::Get;
+		aApi.Fonts.Release = GUI::Fonts::Release;
+		aApi.Fonts.AddFromFile = GUI::Fonts::AddFontFromFile;
+		aApi.Fonts.AddFromResource = GUI::Fonts::AddFontFromResource;
+		aApi.Fonts.AddFromMemory = GUI::Fonts::AddFontFromMemory;
+		aApi.Fonts.Resize = GUI::Fonts::ResizeFont;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Build:
+	/// 	Fills the table of revision 7.
+	///----------------------------------------------------------------------------------------------------
+	static void Build(AddonAPI7_t& aApi, bool aSetImGuiContext)
+	{
+		aApi.ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
+		aApi.ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
+		aApi.ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
+
+		aApi.Renderer.Register = GUI::Render::Register;
+		aApi.Renderer.Deregister = GUI::Render::Deregister;
+
+		aApi.RequestUpdate = Updater::RequestUpdate;
+
+		aApi.Log = Logger::LogMessage2;
+
+		aApi.UI.SendAlert = GUI::Alerts::Notify;
+		aApi.UI.RegisterCloseOnEscape = GUI::EscapeClosing::Register;
+		aApi.UI.DeregisterCloseOnEscape = GUI::EscapeClosing::Deregister;
+
+		aApi.Paths.GetGameDirectory = Paths::GetGameDirectory;
+		aApi.Paths.GetAddonDirectory = Paths::GetAddonDirectory;
+		aApi.Paths.GetCommonDirectory = Paths::GetCommonDirectory;
+
+		aApi.MinHook.Create = MH_CreateHook;
+		aApi.MinHook.Remove = MH_RemoveHook;
+		aApi.MinHook.Enable = MH_EnableHook;
+		aApi.MinHook.Disable = MH_DisableHook;
+
+		aApi.Events.Raise = Events::RaiseEvent;
+		aApi.Events.RaiseNotification = Events::RaiseNotification;
+		aApi.Events.RaiseTargeted = Events::RaiseEventTargeted;
+		aApi.Events.RaiseNotificationTargeted = Events::RaiseNotificationTargeted;
+		aApi.Events.Subscribe = Events::Subscribe;
+		aApi.Events.Unsubscribe = Events::Unsubscribe;
+
+		aApi.WndProc.Register = RawInput::Register;
+		aApi.WndProc.Deregister = RawInput::Deregister;
+		aApi.WndProc.SendToGameOnly = GameBinds::SendWndProcToGame;
+		aApi.WndProc.RegisterFiltered = RawInput::RegisterFiltered;
+
+		aApi.InputBinds.Invoke = InputBinds::InvokeInputBind;
+		aApi.InputBinds.RegisterWithString = InputBinds::RegisterWithString2;
+		aApi.InputBinds.RegisterWithStruct = InputBinds::RegisterWithStruct2;
+		aApi.InputBinds.Deregister = InputBinds::Deregister;
+
+		aApi.GameBinds.PressAsync = GameBinds::PressAsync;
+		aApi.GameBinds.ReleaseAsync = GameBinds::ReleaseAsync;
+		aApi.GameBinds.InvokeAsync = GameBinds::InvokeAsync;
+		aApi.GameBinds.Press = GameBinds::Press;
+		aApi.GameBinds.Release = GameBinds::Release;
+		aApi.GameBinds.IsBound = GameBinds::IsBound;
+		aApi.GameBinds.SubmitSequence = GameBinds::SubmitSequence;
+		aApi.GameBinds.CancelSequence = GameBinds::CancelSequence;
+
+		aApi.DataLink.Get = DataLink::Get;
+		aApi.DataLink.Share = DataLink::Share;
+		aApi.DataLink.GetHandle = DataLink::GetHandle;
+		aApi.DataLink.GetByHandle = DataLink::GetByHandle;
+		aApi.DataLink.ShareVersioned = DataLink::ShareVersioned;
+		aApi.DataLink.BeginWrite = DataLink::BeginWrite;
+		aApi.DataLink.EndWrite = DataLink::EndWrite;
+		aApi.DataLink.Read = DataLink::Read;
+
+		aApi.TextureLoader.Get = TextureLoader::Get;
+		aApi.TextureLoader.GetOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
+		aApi.TextureLoader.GetOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
+		aApi.TextureLoader.GetOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
+		aApi.TextureLoader.GetOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
+		aApi.TextureLoader.LoadFromFile = TextureLoader::LoadFromFile;
+		aApi.TextureLoader.LoadFromResource = TextureLoader::LoadFromResource;
+		aApi.TextureLoader.LoadFromURL = TextureLoader::LoadFromURL;
+		aApi.TextureLoader.LoadFromMemory = TextureLoader::LoadFromMemory;
+
+		aApi.QuickAccess.Add = GUI::QuickAccess::AddShortcut;
+		aApi.QuickAccess.Remove = GUI::QuickAccess::RemoveShortcut;
+		aApi.QuickAccess.Notify = GUI::QuickAccess::PushNotification;
+		aApi.QuickAccess.AddContextMenu = GUI::QuickAccess::AddContextItem2;
+		aApi.QuickAccess.RemoveContextMenu = GUI::QuickAccess::RemoveContextItem;
+
+		aApi.Localization.Translate = Localization::Translate;
+		aApi.Localization.TranslateTo = Localization::TranslateTo;
+		aApi.Localization.SetTranslatedString = Localization::Set;
+
+		aApi.Fonts.Get = GUI::Fonts::Get;
+		aApi.Fonts.Release = GUI::Fonts::Release;
+		aApi.Fonts.AddFromFile = GUI::Fonts::AddFontFromFile;
+		aApi.Fonts.AddFromResource = GUI::Fonts::AddFontFromResource;
+		aApi.Fonts.AddFromMemory = GUI::Fonts::AddFontFromMemory;
+		aApi.Fonts.Resize = GUI::Fonts::ResizeFont;
+
+		aApi.Functions.Register = Functions::Register;
+		aApi.Functions.Deregister = Functions::Deregister;
+		aApi.Functions.Query = Functions::Query;
+		aApi.Functions.Release = Functions::Release;
+		aApi.Functions.GetHandle = Functions::GetHandle;
+		aApi.Functions.QueryHandle = Functions::QueryHandle;
+		aApi.Functions.ReleaseHandle = Functions::ReleaseHandle;
+	}
+
 	AddonAPI_t* Get(uint32_t aVersion, bool aSetImGuiContext)
 	{
+		static std::mutex s_Mutex;
+
+		const std::lock_guard<std::mutex> lock(s_Mutex);
+
 		if (!s_IsInitialized)
 		{
 			Runtime& ctx = Runtime::Get();
 
 			s_DataLinkApi = &ctx.DataLink();
 			s_EventApi = &ctx.Events();
+			s_FuncRegistry = &ctx.FunctionRegistry();
 			s_GameBindsApi = &ctx.GameBinds();
 			s_InputBindApi = &ctx.InputBinds();
 			s_RawInputApi = &ctx.RawInput();
@@ -605,409 +1232,63 @@ namespace Raidcore::Nexus::Host::API
 			s_EscapeClosing = s_UiContext->GetEscapeClosingService();
 			s_Localization = s_UiContext->GetLocalization();
 
+			/* The legacy bridge is brought up by subscriptions, not checked on every call. */
+			s_EventApi->Watch("EV_ARCDPS_COMBATEVENT_LOCAL_RAW", Events::OnArcdpsSubscribed);
+			s_EventApi->Watch("EV_ARCDPS_COMBATEVENT_SQUAD_RAW", Events::OnArcdpsSubscribed);
+
+			for (size_t i = 0; i < 2; i++)
+			{
+				Build(s_APIV1[i], i == 1);
+				Build(s_APIV2[i], i == 1);
+				Build(s_APIV3[i], i == 1);
+				Build(s_APIV4[i], i == 1);
+				Build(s_APIV5[i], i == 1);
+				Build(s_APIV6[i], i == 1);
+				Build(s_APIV7[i], i == 1);
+			}
+
 			s_IsInitialized = true;
 		}
 
-		/* Create the requested version/configuration and return it. */
+		size_t idx = aSetImGuiContext ? 1 : 0;
+
+		/* The swap chain is replaced, if the game recreates it. */
 		switch (aVersion)
 		{
 			case 1:
 			{
-				AddonAPI1_t* api = new AddonAPI1_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-				api->RegisterRender = GUI::Render::Register;
-				api->DeregisterRender = GUI::Render::Deregister;
-
-				api->GetGameDirectory = Paths::GetGameDirectory;
-				api->GetAddonDirectory = Paths::GetAddonDirectory;
-				api->GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->CreateHook = MH_CreateHook;
-				api->RemoveHook = MH_RemoveHook;
-				api->EnableHook = MH_EnableHook;
-				api->DisableHook = MH_DisableHook;
-
-				api->Log = Logger::LogMessage;
-
-				api->RaiseEvent = Events::RaiseEvent;
-				api->SubscribeEvent = Events::Subscribe;
-				api->UnsubscribeEvent = Events::Unsubscribe;
-
-				api->RegisterWndProc = RawInput::Register;
-				api->DeregisterWndProc = RawInput::Deregister;
-
-				api->RegisterInputBindWithString = InputBinds::RegisterWithString;
-				api->RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
-				api->DeregisterInputBind = InputBinds::Deregister;
-
-				api->Get = DataLink::Get;
-				api->Share = DataLink::Share;
-
-				api->GetTexture = TextureLoader::Get;
-				api->LoadTextureFromFile = TextureLoader::LoadFromFile;
-				api->LoadTextureFromResource = TextureLoader::LoadFromResource;
-				api->LoadTextureFromURL = TextureLoader::LoadFromURL;
-
-				api->AddShortcut = GUI::QuickAccess::AddShortcut;
-				api->RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
-				api->AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
-				api->RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
-
-				return api;
+				s_APIV1[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV1[idx];
 			}
 			case 2:
 			{
-				AddonAPI2_t* api = new AddonAPI2_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-				api->RegisterRender = GUI::Render::Register;
-				api->DeregisterRender = GUI::Render::Deregister;
-
-				api->GetGameDirectory = Paths::GetGameDirectory;
-				api->GetAddonDirectory = Paths::GetAddonDirectory;
-				api->GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->CreateHook = MH_CreateHook;
-				api->RemoveHook = MH_RemoveHook;
-				api->EnableHook = MH_EnableHook;
-				api->DisableHook = MH_DisableHook;
-
-				api->Log = Logger::LogMessage2;
-
-				api->RaiseEvent = Events::RaiseEvent;
-				api->RaiseEventNotification = Events::RaiseNotification;
-				api->SubscribeEvent = Events::Subscribe;
-				api->UnsubscribeEvent = Events::Unsubscribe;
-
-				api->RegisterWndProc = RawInput::Register;
-				api->DeregisterWndProc = RawInput::Deregister;
-				api->SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
-
-				api->RegisterInputBindWithString = InputBinds::RegisterWithString;
-				api->RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
-				api->DeregisterInputBind = InputBinds::Deregister;
-
-				api->Get = DataLink::Get;
-				api->Share = DataLink::Share;
-
-				api->GetTexture = TextureLoader::Get;
-				api->GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
-				api->GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
-				api->GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
-				api->GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
-				api->LoadTextureFromFile = TextureLoader::LoadFromFile;
-				api->LoadTextureFromResource = TextureLoader::LoadFromResource;
-				api->LoadTextureFromURL = TextureLoader::LoadFromURL;
-				api->LoadTextureFromMemory = TextureLoader::LoadFromMemory;
-
-				api->AddShortcut = GUI::QuickAccess::AddShortcut;
-				api->RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
-				api->PushNotification = GUI::QuickAccess::PushNotification;
-				api->AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
-				api->RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
-
-				api->Translate = Localization::Translate;
-				api->TranslateTo = Localization::TranslateTo;
-
-				return api;
+				s_APIV2[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV2[idx];
 			}
 			case 3:
 			{
-				AddonAPI3_t* api = new AddonAPI3_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-				api->RegisterRender = GUI::Render::Register;
-				api->DeregisterRender = GUI::Render::Deregister;
-
-				api->GetGameDirectory = Paths::GetGameDirectory;
-				api->GetAddonDirectory = Paths::GetAddonDirectory;
-				api->GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->CreateHook = MH_CreateHook;
-				api->RemoveHook = MH_RemoveHook;
-				api->EnableHook = MH_EnableHook;
-				api->DisableHook = MH_DisableHook;
-
-				api->Log = Logger::LogMessage2;
-
-				api->SendAlert = GUI::Alerts::Notify;
-
-				api->RaiseEvent = Events::RaiseEvent;
-				api->RaiseEventNotification = Events::RaiseNotification;
-				api->RaiseEventTargeted = Events::RaiseEventTargeted;
-				api->RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
-				api->SubscribeEvent = Events::Subscribe;
-				api->UnsubscribeEvent = Events::Unsubscribe;
-
-				api->RegisterWndProc = RawInput::Register;
-				api->DeregisterWndProc = RawInput::Deregister;
-				api->SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
-
-				api->RegisterInputBindWithString = InputBinds::RegisterWithString;
-				api->RegisterInputBindWithStruct = InputBinds::RegisterWithStruct;
-				api->DeregisterInputBind = InputBinds::Deregister;
-
-				api->Get = DataLink::Get;
-				api->Share = DataLink::Share;
-
-				api->GetTexture = TextureLoader::Get;
-				api->GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
-				api->GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
-				api->GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
-				api->GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
-				api->LoadTextureFromFile = TextureLoader::LoadFromFile;
-				api->LoadTextureFromResource = TextureLoader::LoadFromResource;
-				api->LoadTextureFromURL = TextureLoader::LoadFromURL;
-				api->LoadTextureFromMemory = TextureLoader::LoadFromMemory;
-
-				api->AddShortcut = GUI::QuickAccess::AddShortcut;
-				api->RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
-				api->PushNotification = GUI::QuickAccess::PushNotification;
-				api->AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
-				api->RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
-
-				api->Translate = Localization::Translate;
-				api->TranslateTo = Localization::TranslateTo;
-
-				return api;
+				s_APIV3[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV3[idx];
 			}
 			case 4:
 			{
-				AddonAPI4_t* api = new AddonAPI4_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-				api->RegisterRender = GUI::Render::Register;
-				api->DeregisterRender = GUI::Render::Deregister;
-
-				api->RequestUpdate = Updater::RequestUpdate;
-
-				api->GetGameDirectory = Paths::GetGameDirectory;
-				api->GetAddonDirectory = Paths::GetAddonDirectory;
-				api->GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->CreateHook = MH_CreateHook;
-				api->RemoveHook = MH_RemoveHook;
-				api->EnableHook = MH_EnableHook;
-				api->DisableHook = MH_DisableHook;
-
-				api->Log = Logger::LogMessage2;
-
-				api->SendAlert = GUI::Alerts::Notify;
-
-				api->RaiseEvent = Events::RaiseEvent;
-				api->RaiseEventNotification = Events::RaiseNotification;
-				api->RaiseEventTargeted = Events::RaiseEventTargeted;
-				api->RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
-				api->SubscribeEvent = Events::Subscribe;
-				api->UnsubscribeEvent = Events::Unsubscribe;
-
-				api->RegisterWndProc = RawInput::Register;
-				api->DeregisterWndProc = RawInput::Deregister;
-				api->SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
-
-				api->RegisterInputBindWithString = InputBinds::RegisterWithString2;
-				api->RegisterInputBindWithStruct = InputBinds::RegisterWithStruct2;
-				api->DeregisterInputBind = InputBinds::Deregister;
-
-				api->Get = DataLink::Get;
-				api->Share = DataLink::Share;
-
-				api->GetTexture = TextureLoader::Get;
-				api->GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
-				api->GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
-				api->GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
-				api->GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
-				api->LoadTextureFromFile = TextureLoader::LoadFromFile;
-				api->LoadTextureFromResource = TextureLoader::LoadFromResource;
-				api->LoadTextureFromURL = TextureLoader::LoadFromURL;
-				api->LoadTextureFromMemory = TextureLoader::LoadFromMemory;
-
-				api->AddShortcut = GUI::QuickAccess::AddShortcut;
-				api->RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
-				api->PushNotification = GUI::QuickAccess::PushNotification;
-				api->AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
-				api->RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
-
-				api->Translate = Localization::Translate;
-				api->TranslateTo = Localization::TranslateTo;
-
-				api->GetFont = GUI::Fonts::Get;
-				api->ReleaseFont = GUI::Fonts::Release;
-				api->AddFontFromFile = GUI::Fonts::AddFontFromFile;
-				api->AddFontFromResource = GUI::Fonts::AddFontFromResource;
-				api->AddFontFromMemory = GUI::Fonts::AddFontFromMemory;
-
-				return api;
+				s_APIV4[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV4[idx];
 			}
 			case 5:
 			{
-				AddonAPI5_t* api = new AddonAPI5_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-				api->RegisterRender = GUI::Render::Register;
-				api->DeregisterRender = GUI::Render::Deregister;
-
-				api->RequestUpdate = Updater::RequestUpdate;
-
-				api->GetGameDirectory = Paths::GetGameDirectory;
-				api->GetAddonDirectory = Paths::GetAddonDirectory;
-				api->GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->CreateHook = MH_CreateHook;
-				api->RemoveHook = MH_RemoveHook;
-				api->EnableHook = MH_EnableHook;
-				api->DisableHook = MH_DisableHook;
-
-				api->Log = Logger::LogMessage2;
-
-				api->SendAlert = GUI::Alerts::Notify;
-
-				api->RaiseEvent = Events::RaiseEvent;
-				api->RaiseEventNotification = Events::RaiseNotification;
-				api->RaiseEventTargeted = Events::RaiseEventTargeted;
-				api->RaiseEventNotificationTargeted = Events::RaiseNotificationTargeted;
-				api->SubscribeEvent = Events::Subscribe;
-				api->UnsubscribeEvent = Events::Unsubscribe;
-
-				api->RegisterWndProc = RawInput::Register;
-				api->DeregisterWndProc = RawInput::Deregister;
-				api->SendWndProcToGameOnly = GameBinds::SendWndProcToGame;
-
-				api->InvokeInputBind = InputBinds::InvokeInputBind;
-				api->RegisterInputBindWithString = InputBinds::RegisterWithString2;
-				api->RegisterInputBindWithStruct = InputBinds::RegisterWithStruct2;
-				api->DeregisterInputBind = InputBinds::Deregister;
-
-				api->Get = DataLink::Get;
-				api->Share = DataLink::Share;
-
-				api->GetTexture = TextureLoader::Get;
-				api->GetTextureOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
-				api->GetTextureOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
-				api->GetTextureOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
-				api->GetTextureOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
-				api->LoadTextureFromFile = TextureLoader::LoadFromFile;
-				api->LoadTextureFromResource = TextureLoader::LoadFromResource;
-				api->LoadTextureFromURL = TextureLoader::LoadFromURL;
-				api->LoadTextureFromMemory = TextureLoader::LoadFromMemory;
-
-				api->AddShortcut = GUI::QuickAccess::AddShortcut;
-				api->RemoveShortcut = GUI::QuickAccess::RemoveShortcut;
-				api->PushNotification = GUI::QuickAccess::PushNotification;
-				api->AddSimpleShortcut = GUI::QuickAccess::AddContextItem;
-				api->RemoveSimpleShortcut = GUI::QuickAccess::RemoveContextItem;
-
-				api->Translate = Localization::Translate;
-				api->TranslateTo = Localization::TranslateTo;
-				api->SetTranslatedString = Localization::Set;
-
-				api->GetFont = GUI::Fonts::Get;
-				api->ReleaseFont = GUI::Fonts::Release;
-				api->AddFontFromFile = GUI::Fonts::AddFontFromFile;
-				api->AddFontFromResource = GUI::Fonts::AddFontFromResource;
-				api->AddFontFromMemory = GUI::Fonts::AddFontFromMemory;
-
-				return api;
+				s_APIV5[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV5[idx];
 			}
 			case 6:
 			{
-				AddonAPI6_t* api = new AddonAPI6_t();
-
-				api->SwapChain = s_GrWindow->SwapChain;
-				api->ImguiContext = aSetImGuiContext ? ImGui::GetCurrentContext() : nullptr;
-				api->ImguiMalloc = aSetImGuiContext ? ImGui::MemAlloc : nullptr;
-				api->ImguiFree = aSetImGuiContext ? ImGui::MemFree : nullptr;
-
-				api->Renderer.Register = GUI::Render::Register;
-				api->Renderer.Deregister = GUI::Render::Deregister;
-
-				api->RequestUpdate = Updater::RequestUpdate;
-
-				api->Log = Logger::LogMessage2;
-
-				api->UI.SendAlert = GUI::Alerts::Notify;
-				api->UI.RegisterCloseOnEscape = GUI::EscapeClosing::Register;
-				api->UI.DeregisterCloseOnEscape = GUI::EscapeClosing::Deregister;
-
-				api->Paths.GetGameDirectory = Paths::GetGameDirectory;
-				api->Paths.GetAddonDirectory = Paths::GetAddonDirectory;
-				api->Paths.GetCommonDirectory = Paths::GetCommonDirectory;
-
-				api->MinHook.Create = MH_CreateHook;
-				api->MinHook.Remove = MH_RemoveHook;
-				api->MinHook.Enable = MH_EnableHook;
-				api->MinHook.Disable = MH_DisableHook;
-
-				api->Events.Raise = Events::RaiseEvent;
-				api->Events.RaiseNotification = Events::RaiseNotification;
-				api->Events.RaiseTargeted = Events::RaiseEventTargeted;
-				api->Events.RaiseNotificationTargeted = Events::RaiseNotificationTargeted;
-				api->Events.Subscribe = Events::Subscribe;
-				api->Events.Unsubscribe = Events::Unsubscribe;
-
-				api->WndProc.Register = RawInput::Register;
-				api->WndProc.Deregister = RawInput::Deregister;
-				api->WndProc.SendToGameOnly = GameBinds::SendWndProcToGame;
-
-				api->InputBinds.Invoke = InputBinds::InvokeInputBind;
-				api->InputBinds.RegisterWithString = InputBinds::RegisterWithString2;
-				api->InputBinds.RegisterWithStruct = InputBinds::RegisterWithStruct2;
-				api->InputBinds.Deregister = InputBinds::Deregister;
-
-				api->GameBinds.PressAsync = GameBinds::PressAsync;
-				api->GameBinds.ReleaseAsync = GameBinds::ReleaseAsync;
-				api->GameBinds.InvokeAsync = GameBinds::InvokeAsync;
-				api->GameBinds.Press = GameBinds::Press;
-				api->GameBinds.Release = GameBinds::Release;
-				api->GameBinds.IsBound = GameBinds::IsBound;
-
-				api->DataLink.Get = DataLink::Get;
-				api->DataLink.Share = DataLink::Share;
-
-				api->TextureLoader.Get = TextureLoader::Get;
-				api->TextureLoader.GetOrCreateFromFile = TextureLoader::GetOrCreateFromFile;
-				api->TextureLoader.GetOrCreateFromResource = TextureLoader::GetOrCreateFromResource;
-				api->TextureLoader.GetOrCreateFromURL = TextureLoader::GetOrCreateFromURL;
-				api->TextureLoader.GetOrCreateFromMemory = TextureLoader::GetOrCreateFromMemory;
-				api->TextureLoader.LoadFromFile = TextureLoader::LoadFromFile;
-				api->TextureLoader.LoadFromResource = TextureLoader::LoadFromResource;
-				api->TextureLoader.LoadFromURL = TextureLoader::LoadFromURL;
-				api->TextureLoader.LoadFromMemory = TextureLoader::LoadFromMemory;
-
-				api->QuickAccess.Add = GUI::QuickAccess::AddShortcut;
-				api->QuickAccess.Remove = GUI::QuickAccess::RemoveShortcut;
-				api->QuickAccess.Notify = GUI::QuickAccess::PushNotification;
-				api->QuickAccess.AddContextMenu = GUI::QuickAccess::AddContextItem2;
-				api->QuickAccess.RemoveContextMenu = GUI::QuickAccess::RemoveContextItem;
-
-				api->Localization.Translate = Localization::Translate;
-				api->Localization.TranslateTo = Localization::TranslateTo;
-				api->Localization.SetTranslatedString = Localization::Set;
-
-				api->Fonts.Get = GUI::Fonts::Get;
-				api->Fonts.Release = GUI::Fonts::Release;
-				api->Fonts.AddFromFile = GUI::Fonts::AddFontFromFile;
-				api->Fonts.AddFromResource = GUI::Fonts::AddFontFromResource;
-				api->Fonts.AddFromMemory = GUI::Fonts::AddFontFromMemory;
-				api->Fonts.Resize = GUI::Fonts::ResizeFont;
-
-				return api;
+				s_APIV6[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV6[idx];
+			}
+			case 7:
+			{
+				s_APIV7[idx].SwapChain = s_GrWindow->SwapChain;
+				return &s_APIV7[idx];
 			}
 		}
 
@@ -1030,6 +1311,8 @@ namespace Raidcore::Nexus::Host::API
 			return sizeof(AddonAPI5_t);
 			case 6:
 			return sizeof(AddonAPI6_t);
+			case 7:
+			return sizeof(AddonAPI7_t);
 		}
 
 		return 0;
@@ -56,6 +56,12 @@ namespace Raidcore::Nexus::Host::API
 		///----------------------------------------------------------------------------------------------------
 		void Subscribe(const char* aIdentifier, Host::EVENT_CONSUME aConsumeEventCallback);
 
+		///----------------------------------------------------------------------------------------------------
+		/// OnArcdpsSubscribed:
+		/// 	Detects ArcDPS, once an addon subscribes to its raw combat events.
+		///----------------------------------------------------------------------------------------------------
+		void OnArcdpsSubscribed(const char* aIdentifier);
+
 		///----------------------------------------------------------------------------------------------------
 		/// Unsubscribe:
 		/// 	Addon API wrapper function for unsubscribing from events.
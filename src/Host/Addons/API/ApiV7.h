@@ -0,0 +1,191 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  AdoApiV7.h
+/// Description  :  Addon API Revision 7.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "ApiBase.h"
+
+#include <dxgi.h>
+
+#include "thirdparty/imgui/imgui.h"
+#include "thirdparty/minhook/mh_hook.h"
+
+using namespace Raidcore::Nexus;
+
+///----------------------------------------------------------------------------------------------------
+/// AddonAPI7_t Struct
+///----------------------------------------------------------------------------------------------------
+struct AddonAPI7_t : AddonAPI_t
+{
+	/* Renderer */
+	IDXGISwapChain* SwapChain;
+	ImGuiContext* ImguiContext;
+	void* ImguiMalloc;
+	void* ImguiFree;
+
+	struct RendererVT
+	{
+		GUI_ADDRENDER                     Register;
+		GUI_REMRENDER                     Deregister;
+	};
+	RendererVT                            Renderer;
+
+	/* Updater */
+	UPDATER_REQUESTUPDATE                 RequestUpdate;
+
+	/* Logging */
+	LOGGER_LOG2                           Log;
+
+	/* User Interface */
+	struct UIVT
+	{
+		ALERTS_NOTIFY                     SendAlert;
+		GUI_REGISTERCLOSEONESCAPE         RegisterCloseOnEscape;
+		GUI_DEREGISTERCLOSEONESCAPE       DeregisterCloseOnEscape;
+	};
+	UIVT                                  UI;
+
+	/* Paths */
+	struct PathsVT
+	{
+		IDX_GETGAMEDIR                    GetGameDirectory;
+		IDX_GETADDONDIR                   GetAddonDirectory;
+		IDX_GETCOMMONDIR                  GetCommonDirectory;
+	};
+	PathsVT                               Paths;
+
+	/* Minhook */
+	struct MinHookVT
+	{
+		MINHOOK_CREATE                    Create;
+		MINHOOK_REMOVE                    Remove;
+		MINHOOK_ENABLE                    Enable;
+		MINHOOK_DISABLE                   Disable;
+	};
+	MinHookVT                             MinHook;
+
+	/* Events */
+	struct EventsVT
+	{
+		EVENTS_RAISE                      Raise;
+		EVENTS_RAISENOTIFICATION          RaiseNotification;
+		EVENTS_RAISE_TARGETED             RaiseTargeted;
+		EVENTS_RAISENOTIFICATION_TARGETED RaiseNotificationTargeted;
+		EVENTS_SUBSCRIBE                  Subscribe;
+		EVENTS_SUBSCRIBE                  Unsubscribe;
+	};
+	EventsVT                              Events;
+
+	/* WndProc */
+	struct WndProcVT
+	{
+		WNDPROC_ADDREM          Register;
+		WNDPROC_ADDREM          Deregister;
+		WNDPROC_SENDTOGAME      SendToGameOnly;
+		WNDPROC_ADDFILTERED     RegisterFiltered;
+	};
+	WndProcVT                             WndProc;
+
+	/* InputBinds */
+	struct InputBindsVT
+	{
+		INPUTBINDS_INVOKE                 Invoke;
+		INPUTBINDS_REGISTERWITHSTRING2    RegisterWithString;
+		INPUTBINDS_REGISTERWITHSTRUCT2    RegisterWithStruct;
+		INPUTBINDS_DEREGISTER             Deregister;
+	};
+	InputBindsVT                          InputBinds;
+
+	/* GameBinds */
+	struct GameBindsVT
+	{
+		GAMEBINDS_PRESSASYNC              PressAsync;
+		GAMEBINDS_RELEASEASYNC            ReleaseAsync;
+		GAMEBINDS_INVOKEASYNC             InvokeAsync;
+		GAMEBINDS_PRESS                   Press;
+		GAMEBINDS_RELEASE                 Release;
+		GAMEBINDS_ISBOUND                 IsBound;
+		GAMEBINDS_SUBMITSEQUENCE          SubmitSequence;
+		GAMEBINDS_CANCELSEQUENCE          CancelSequence;
+	};
+	GameBindsVT                           GameBinds;
+
+	/* DataLink */
+	struct DataLinkVT
+	{
+		DATALINK_GETRESOURCE              Get;
+		DATALINK_SHARERESOURCE            Share;
+		DATALINK_GETHANDLE                GetHandle;
+		DATALINK_GETBYHANDLE              GetByHandle;
+		DATALINK_SHAREVERSIONED           ShareVersioned;
+		DATALINK_BEGINWRITE               BeginWrite;
+		DATALINK_ENDWRITE                 EndWrite;
+		DATALINK_READVERSIONED            Read;
+	};
+	DataLinkVT                            DataLink;
+
+	/* Textures */
+	struct TexturesVT
+	{
+		TEXTURES_GET                      Get;
+		TEXTURES_GETORCREATEFROMFILE      GetOrCreateFromFile;
+		TEXTURES_GETORCREATEFROMRESOURCE  GetOrCreateFromResource;
+		TEXTURES_GETORCREATEFROMURL       GetOrCreateFromURL;
+		TEXTURES_GETORCREATEFROMMEMORY    GetOrCreateFromMemory;
+		TEXTURES_LOADFROMFILE             LoadFromFile;
+		TEXTURES_LOADFROMRESOURCE         LoadFromResource;
+		TEXTURES_LOADFROMURL              LoadFromURL;
+		TEXTURES_LOADFROMMEMORY           LoadFromMemory;
+	};
+	TexturesVT                            TextureLoader;
+
+	/* Shortcuts */
+	struct QuickAccessVT
+	{
+		QUICKACCESS_ADDSHORTCUT           Add;
+		QUICKACCESS_GENERIC               Remove;
+		QUICKACCESS_GENERIC               Notify;
+		QUICKACCESS_ADDSIMPLE2            AddContextMenu;
+		QUICKACCESS_GENERIC               RemoveContextMenu;
+	};
+	QuickAccessVT                         QuickAccess;
+
+	/* Localization */
+	struct LocalizationVT
+	{
+		LOCALIZATION_TRANSLATE            Translate;
+		LOCALIZATION_TRANSLATETO          TranslateTo;
+		LOCALIZATION_SET                  SetTranslatedString;
+	};
+	LocalizationVT                        Localization;
+
+	/* Fonts */
+	struct FontsVT
+	{
+		FONTS_GETRELEASE                  Get;
+		FONTS_GETRELEASE                  Release;
+		FONTS_ADDFROMFILE                 AddFromFile;
+		FONTS_ADDFROMRESOURCE             AddFromResource;
+		FONTS_ADDFROMMEMORY               AddFromMemory;
+		FONTS_RESIZE                      Resize;
+	};
+	FontsVT                               Fonts;
+
+	/* Functions */
+	struct FunctionsVT
+	{
+		FUNCTIONS_REGISTER                Register;
+		FUNCTIONS_DEREGISTER              Deregister;
+		FUNCTIONS_QUERY                   Query;
+		FUNCTIONS_RELEASE                 Release;
+		FUNCTIONS_GETHANDLE               GetHandle;
+		FUNCTIONS_QUERYHANDLE             QueryHandle;
+		FUNCTIONS_RELEASEHANDLE           ReleaseHandle;
+	};
+	FunctionsVT                           Functions;
+};
@@ -20,6 +20,7 @@ using namespace Raidcore::Nexus;
 #include "Host/Addons/API/ApiBuilder.h"
 #include "Index/Index.h"
 #include "Memory/RefCleanerContext.h"
+#include "Memory/ResourceLedger.h"
 #include "Util/DLL.h"
 #include "Util/MD5.h"
 #include "Util/Paths.h"
@@ -67,6 +68,8 @@ CAddon::~CAddon()
 		this->ProcessorThread.join();
 	}
 
+	this->Loader->Undeclare(this);
+
 	if (this->NexusAddonDefV1)
 	{
 		delete this->NexusAddonDefV1;
@@ -164,6 +167,7 @@ void CAddon::ProcessActions()
 		}
 
 		this->Flags |= EAddonFlags::RunningAction;
+		this->Publish();
 
 		switch (action)
 		{
@@ -180,6 +184,7 @@ void CAddon::ProcessActions()
 				this->Flags |= EAddonFlags::Destroying;
 				this->Logger->Trace(LOG_CHANNEL, "CAddon::Destroy(): %s", this->Location.string().c_str());
 				this->UnloadInternal();
+				this->Publish();
 				this->IsRunning = false; /* Just to be sure. */
 				this->EventApi->Raise(0, EV_ADDON_DESTROYED);
 				return; /* Return the thread entirely. */
@@ -222,9 +227,33 @@ void CAddon::ProcessActions()
 		}
 
 		this->Flags &= ~EAddonFlags::RunningAction;
+		this->Publish();
 	}
 }
 
+void CAddon::Publish()
+{
+	Host::AddonInfo_t info{};
+	info.Addon               = this;
+	info.Signature           = this->GetSignature();
+	info.Name                = this->GetName();
+	info.Version             = this->GetVersion();
+	info.Author              = this->GetAuthor();
+	info.Description         = this->GetDescription();
+	info.Location            = this->Location;
+	info.MD5                 = this->GetMD5().string();
+	info.ProjectPageURL      = this->GetProjectPageURL();
+	info.SupportsPreReleases = this->SupportsPreReleases();
+	info.State               = this->State;
+	info.Interfaces          = static_cast<uint32_t>(this->ModuleInterfaces);
+	info.Flags               = static_cast<uint32_t>(this->Flags);
+	info.Module              = this->Module;
+	info.ModuleSize          = this->ModuleSize;
+	info.IsDestroying        = this->IsDestroying();
+
+	this->Loader->Publish(info);
+}
+
 void CAddon::LoadInternal()
 {
 	this->Logger->Trace(LOG_CHANNEL, "CAddon::LoadInternal(%s)", this->Location.string().c_str());
@@ -258,7 +287,10 @@ void CAddon::LoadInternal()
 		return;
 	}
 
-	HMODULE module = LoadLibraryA(this->Location.string().c_str());
+	/* Either the file itself or a shadow copy, which leaves the file free to be overwritten. */
+	std::filesystem::path loadPath = this->Loader->AcquireLoadPath(this->Location, this->MD5);
+
+	HMODULE module = LoadLibraryA(loadPath.string().c_str());
 
 	if (!module)
 	{
@@ -267,10 +299,11 @@ void CAddon::LoadInternal()
 		this->Logger->Warning(
 			LOG_CHANNEL,
 			"Cannot load. LoadLibrary(%s) failed: %s (%d)",
-			this->Location.string().c_str(),
+			loadPath.string().c_str(),
 			ecnd.message().c_str(),
 			lasterror
 		);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		return;
 	}
@@ -282,6 +315,7 @@ void CAddon::LoadInternal()
 		this->Logger->Debug(LOG_CHANNEL, "Cannot load. Interface was set, but is not actually present. (%s)", this->Location.string().c_str());
 		this->ModuleInterfaces &= ~EAddonInterfaces::Nexus;
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		return;
 	}
@@ -292,6 +326,7 @@ void CAddon::LoadInternal()
 	{
 		this->Logger->Warning(LOG_CHANNEL, "Cannot load. Addon definition was nullptr. (%s)", this->Location.string().c_str());
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		this->Flags |= EAddonFlags::MissingReqs;
 		return;
@@ -309,6 +344,7 @@ void CAddon::LoadInternal()
 	{
 		this->Logger->Warning(LOG_CHANNEL, "Cannot load. Addon definition does not fulfill minimum requirements. (%s)", this->Location.string().c_str());
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		this->Flags |= EAddonFlags::MissingReqs;
 		return;
@@ -328,6 +364,7 @@ void CAddon::LoadInternal()
 	{
 		this->Logger->Warning(LOG_CHANNEL, "Canceled load. Addon is a duplicate. (%s)", this->Location.string().c_str());
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		return;
 	}
@@ -336,6 +373,7 @@ void CAddon::LoadInternal()
 	{
 		/* Should load prints debug reasons, no need to also print here. */
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		return;
 	}
@@ -351,6 +389,31 @@ void CAddon::LoadInternal()
 			this->Location.string().c_str()
 		);
 		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
+		this->State = Host::EAddonState::NotLoaded;
+		return;
+	}
+
+	std::vector<Host::Dependency_t> deps;
+
+	for (uint32_t i = 0; i < this->NexusAddonDefV1->DependencyCount; i++)
+	{
+		const AddonDependency_t& dep = this->NexusAddonDefV1->Dependencies[i];
+
+		deps.push_back({
+			dep.Signature,
+			dep.MinVersion,
+			dep.MaxVersion,
+			(dep.Flags & EAddonDepFlags::Optional) == EAddonDepFlags::Optional
+		});
+	}
+
+	/* Blocks this addon's thread only, independent addons keep loading concurrently. */
+	if (!this->Loader->AwaitDependencies(this, this->NexusAddonDefV1->Version, deps))
+	{
+		/* Await prints the reasons, no need to also print here. */
+		FreeLibrary(module);
+		this->Loader->ReleaseLoadPath(loadPath);
 		this->State = Host::EAddonState::NotLoaded;
 		return;
 	}
@@ -358,15 +421,30 @@ void CAddon::LoadInternal()
 	if ((this->NexusAddonDefV1->Flags & EAddonDefFlags::DisableHotloading) == EAddonDefFlags::DisableHotloading)
 	{
 		this->Flags |= EAddonFlags::StateLocked;
-		this->Flags |= EAddonFlags::FileLocked;
+
+		if (loadPath == this->Location)
+		{
+			this->Flags |= EAddonFlags::FileLocked;
+		}
 	}
 
 	this->Module = module;
+	this->LoadLocation = loadPath;
 
 	MODULEINFO moduleInfo{};
 	GetModuleInformation(GetCurrentProcess(), this->Module, &moduleInfo, sizeof(moduleInfo));
 	this->ModuleSize = moduleInfo.SizeOfImage;
 
+	/* Before Load, faults within it are covered too. Ignore wins, if both are set. */
+	if ((this->NexusAddonDefV1->Flags & EAddonDefFlags::CrashIgnore) == EAddonDefFlags::CrashIgnore)
+	{
+		Runtime::Get().CrashHandler().SetPolicy(this->Module, Platform::ECrashPolicy::Ignore);
+	}
+	else if ((this->NexusAddonDefV1->Flags & EAddonDefFlags::CrashFirstChance) == EAddonDefFlags::CrashFirstChance)
+	{
+		Runtime::Get().CrashHandler().SetPolicy(this->Module, Platform::ECrashPolicy::FirstChance);
+	}
+
 	auto start_time = std::chrono::high_resolution_clock::now();
 	this->NexusAddonDefV1->Load(api);
 	auto end_time = std::chrono::high_resolution_clock::now();
@@ -377,8 +455,11 @@ void CAddon::LoadInternal()
 	this->Config->LastGameBuild = Runtime::Get().BuildInfo().Build();
 	this->Config->LastName = this->NexusAddonDefV1->GetName();
 	this->State = Host::EAddonState::Loaded;
+	this->Loader->SetLoaded(this, true);
 	this->ConfigMgr->SaveConfigs();
 
+	Memory::ResourceLedger::Get()->Set(this->Module, Memory::EResource::LoadTimeUs, time / std::chrono::microseconds(1));
+
 	this->Logger->Info(
 		LOG_CHANNEL,
 		"Loaded addon: %s\n"
@@ -415,6 +496,12 @@ void CAddon::UnloadInternal()
 		return;
 	}
 
+	/* On shutdown the loader already destroys dependents first. */
+	if ((this->Flags & EAddonFlags::Destroying) != EAddonFlags::Destroying)
+	{
+		this->Loader->UnloadDependents(this);
+	}
+
 	std::string strUnloadInfo;
 
 	if (this->NexusAddonDefV1->Unload)
@@ -431,23 +518,34 @@ void CAddon::UnloadInternal()
 		strUnloadInfo = "No unload routine defined.";
 	}
 
-	std::string refcleanup = Memory::RefCleanerContext::Get()->CleanupRefs(this->Module, (PBYTE)this->Module + this->ModuleSize);
+	Memory::RefCleanupReport_t cleanupReport = Memory::RefCleanerContext::Get()->CleanupRefs(this->Module, (PBYTE)this->Module + this->ModuleSize);
+	std::string refcleanup = Memory::RefCleanerContext::ToString(cleanupReport);
 
 	if (!refcleanup.empty())
 	{
 		this->Logger->Warning(LOG_CHANNEL, "(%s) %s", this->Location.string().c_str(), refcleanup.c_str());
 	}
 
+	/* After the registries released their references, so only the usage outliving the module remains. */
+	Memory::ResourceLedger::Get()->Retire(this->Module, (PBYTE)this->Module + this->ModuleSize);
+
 	if ((this->Flags & EAddonFlags::Destroying) != EAddonFlags::Destroying)
 	{
 		this->EventApi->Raise(EV_ADDON_UNLOADED, &this->NexusAddonDefV1->Signature);
 	}
 
+	/* Another module may be mapped at the same base later. */
+	Runtime::Get().CrashHandler().SetPolicy(this->Module, Platform::ECrashPolicy::Unhandled);
+
 	FreeLibrary(this->Module);
 	this->Module = nullptr;
 	this->ModuleSize = 0;
 
+	this->Loader->ReleaseLoadPath(this->LoadLocation);
+	this->LoadLocation.clear();
+
 	this->State = Host::EAddonState::NotLoaded;
+	this->Loader->SetLoaded(this, false);
 
 	this->Logger->Info(
 		LOG_CHANNEL,
@@ -222,6 +222,7 @@ class CAddon : public virtual Host::IAddon
 
 	long long                LastCheckedTimestamp = 0;
 	std::filesystem::path    UpdateLocal;
+	std::filesystem::path    LoadLocation;         /* Where the module was loaded from, a shadow copy or Location. */
 	std::string              UpdateRemote;
 
 	///----------------------------------------------------------------------------------------------------
@@ -230,6 +231,13 @@ class CAddon : public virtual Host::IAddon
 	///----------------------------------------------------------------------------------------------------
 	void ProcessActions();
 
+	///----------------------------------------------------------------------------------------------------
+	/// Publish:
+	/// 	Publishes the current state to the loader's snapshot. Only called from the processor thread,
+	/// 	which is the only one changing the state.
+	///----------------------------------------------------------------------------------------------------
+	void Publish();
+
 	///----------------------------------------------------------------------------------------------------
 	/// LoadInternal:
 	/// 	Loads the addon.
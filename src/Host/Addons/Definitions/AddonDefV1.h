@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "Host/Addons/AddEnum.h"
 #include "Host/Addons/API/ApiBase.h"
@@ -21,6 +22,17 @@ typedef AddonDefV1_t* (*GETADDONDEF_V1) ();
 typedef void          (*ADDON_LOAD)     (AddonAPI_t* aAPI);
 typedef void          (*ADDON_UNLOAD)   ();
 
+///----------------------------------------------------------------------------------------------------
+/// AddonDependency_t Struct
+///----------------------------------------------------------------------------------------------------
+struct AddonDependency_t
+{
+	uint32_t        Signature;   /* Signature of the addon that has to be loaded first.                     */
+	Version_t       MinVersion;  /* Lowest compatible version, inclusive. Zero for any.                     */
+	Version_t       MaxVersion;  /* First incompatible version, exclusive. Zero for any.                    */
+	EAddonDepFlags  Flags;       /* Additional flags, to modify behavior.                                   */
+};
+
 ///----------------------------------------------------------------------------------------------------
 /// AddonDefV1_t Struct
 /// 	Used for API Revisions 1-6.
@@ -42,6 +54,10 @@ struct AddonDefV1_t
 	EUpdateProvider Provider;    /* How to check for updates.                                               */
 	const char*     UpdateLink;  /* Link to the update resource.                                            */
 
+	/* Optional, only read if Flags::HasDependencies is set. */
+	const AddonDependency_t* Dependencies;    /* Addons that have to be loaded first.                       */
+	uint32_t                 DependencyCount; /* Number of entries in Dependencies.                         */
+
 	inline std::string GetName()
 	{
 		return this->Name ? this->Name : "";
@@ -78,6 +94,8 @@ struct AddonDefV1_t
 		this->Flags       = aOther.Flags;
 		this->Provider    = aOther.Provider;
 		this->UpdateLink  = nullptr;
+		this->Dependencies    = nullptr;
+		this->DependencyCount = 0;
 
 		/* Upgrade legacy -1 Revision omission to just 0. */
 		if (static_cast<int16_t>(this->Version.Revision) < static_cast<int16_t>(-1))
@@ -104,6 +122,22 @@ struct AddonDefV1_t
 		{
 			this->UpdateLink = _strdup(aOther.UpdateLink);
 		}
+
+		/* Definitions without the flag are shorter, the fields must not be read. */
+		if ((aOther.Flags & EAddonDefFlags::HasDependencies) == EAddonDefFlags::HasDependencies
+			&& aOther.Dependencies
+			&& aOther.DependencyCount > 0)
+		{
+			AddonDependency_t* deps = new AddonDependency_t[aOther.DependencyCount];
+			memcpy(deps, aOther.Dependencies, sizeof(AddonDependency_t) * aOther.DependencyCount);
+
+			this->Dependencies    = deps;
+			this->DependencyCount = aOther.DependencyCount;
+		}
+		else
+		{
+			this->Flags &= ~EAddonDefFlags::HasDependencies;
+		}
 	}
 
 	///----------------------------------------------------------------------------------------------------
@@ -130,6 +164,11 @@ struct AddonDefV1_t
 		{
 			free((void*)this->UpdateLink);
 		}
+
+		if (this->Dependencies)
+		{
+			delete[] this->Dependencies;
+		}
 	}
 
 	///----------------------------------------------------------------------------------------------------
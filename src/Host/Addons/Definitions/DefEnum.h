@@ -21,6 +21,19 @@ enum class EAddonDefFlags : uint32_t
 	DisableHotloading     = 1 << 1, /* Prevents the addon from being unloaded at runtime. Unload will still be called on shutdown, if defined.            */
 	LaunchOnly            = 1 << 2, /* Prevents the addon from getting loaded at runtime after the initial game launch.                                   */
 	CanCreateImGuiContext = 1 << 3, /* Addon is capable of receiving nullptr instead of imgui context and allocators and can manage its own. (User pref.) */
-	ForceUpdate           = 1 << 4  /* Addon should always be kept up-to-date. E.g. to avoid exploiting old versions.                                     */
+	ForceUpdate           = 1 << 4, /* Addon should always be kept up-to-date. E.g. to avoid exploiting old versions.                                     */
+	HasDependencies       = 1 << 5, /* Dependencies and DependencyCount are set. Older definitions do not have these fields.                               */
+	CrashFirstChance      = 1 << 6, /* Faults raised within the addon are captured, even if it handles them itself. E.g. while debugging.                  */
+	CrashIgnore           = 1 << 7  /* Faults raised within the addon are never captured. E.g. it reports crashes on its own.                              */
 };
 DEFINE_ENUM_FLAG_OPERATORS(EAddonDefFlags);
+
+///----------------------------------------------------------------------------------------------------
+/// EAddonDepFlags Enumeration
+///----------------------------------------------------------------------------------------------------
+enum class EAddonDepFlags : uint32_t
+{
+	None                  = 0,
+	Optional              = 1 << 0  /* Only orders the load, if the dependency is present and compatible. */
+};
+DEFINE_ENUM_FLAG_OPERATORS(EAddonDepFlags);
@@ -155,6 +155,17 @@ namespace Raidcore::Nexus::Host
 		return config;
 	}
 
+	Config_t* ConfigMgr::GetConfig(uint32_t aSignature)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->Configs.find(aSignature);
+
+		if (it == this->Configs.end()) { return nullptr; }
+
+		return it->second;
+	}
+
 	void ConfigMgr::DeleteConfig(uint32_t aSignature)
 	{
 		/* Scoping for mutex. */
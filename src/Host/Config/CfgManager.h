@@ -49,6 +49,12 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		Config_t* RegisterConfig(uint32_t aSignature);
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetConfig:
+		/// 	Returns the config of the given addon signature or nullptr, if none is registered.
+		///----------------------------------------------------------------------------------------------------
+		Config_t* GetConfig(uint32_t aSignature);
+
 		///----------------------------------------------------------------------------------------------------
 		/// DeleteConfig:
 		/// 	Deletes the config of the given addon signature, also deletes it from disk.
@@ -9,6 +9,7 @@
 #include "EvtApi.h"
 
 #include "EvtSubscriber.h"
+#include "Memory/ResourceLedger.h"
 
 namespace Raidcore::Nexus::Host
 {
@@ -67,31 +68,43 @@ namespace Raidcore::Nexus::Host
 		if (aIdentifier == nullptr) { return; }
 		if (aConsumeEventCallback == nullptr) { return; }
 
-		const std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+		EVENT_SUBSCRIBED onSubscribe = nullptr;
 
-		EventSubscriber_t sub{};
-		sub.Callback = aConsumeEventCallback;
+		{
+			const std::lock_guard<std::recursive_mutex> lock(this->Mutex);
 
-		IAddon* owner = this->Loader.GetOwner(aConsumeEventCallback);
+			EventSubscriber_t sub{};
+			sub.Callback = aConsumeEventCallback;
 
-		sub.Signature = owner != nullptr ? owner->GetSignature() : 0;
+			IAddon* owner = this->Loader.GetOwner(aConsumeEventCallback);
 
-		auto it = this->Registry.find(aIdentifier);
+			sub.Signature = owner != nullptr ? owner->GetSignature() : 0;
 
-		/* Emplace new event or add subscriber to existing. */
-		if (it == this->Registry.end())
-		{
-			EventData_t ev{};
+			/* Emplace new event or add subscriber to existing. */
+			EventData_t& ev = this->Registry[aIdentifier];
 			ev.Subscribers.push_back(sub);
+			onSubscribe = ev.OnSubscribe;
+
+			this->Owners.Add(aConsumeEventCallback, { aIdentifier, aConsumeEventCallback });
 
-			this->Registry.emplace(aIdentifier, ev);
+			Memory::ResourceLedger::Get()->AddByAddress(aConsumeEventCallback, Memory::EResource::Events, 1);
 		}
-		else
+
+		if (onSubscribe)
 		{
-			it->second.Subscribers.push_back(sub);
+			onSubscribe(aIdentifier);
 		}
 	}
 
+	void EventApi::Watch(const char* aIdentifier, EVENT_SUBSCRIBED aCallback)
+	{
+		if (aIdentifier == nullptr) { return; }
+
+		const std::lock_guard<std::recursive_mutex> lock(this->Mutex);
+
+		this->Registry[aIdentifier].OnSubscribe = aCallback;
+	}
+
 	void EventApi::Unsubscribe(const char* aIdentifier, EVENT_CONSUME aConsumeEventCallback)
 	{
 		if (aIdentifier == nullptr) { return; }
@@ -105,6 +118,8 @@ namespace Raidcore::Nexus::Host
 			return;
 		}
 
+		size_t before = it->second.Subscribers.size();
+
 		it->second.Subscribers.erase(
 			std::remove_if(
 			it->second.Subscribers.begin(),
@@ -116,6 +131,14 @@ namespace Raidcore::Nexus::Host
 		),
 			it->second.Subscribers.end()
 		);
+
+		this->Owners.Remove(aConsumeEventCallback, { aIdentifier, aConsumeEventCallback });
+
+		Memory::ResourceLedger::Get()->AddByAddress(
+			aConsumeEventCallback,
+			Memory::EResource::Events,
+			-static_cast<int64_t>(before - it->second.Subscribers.size())
+		);
 	}
 
 	uint32_t EventApi::CleanupRefs(void* aStartAddress, void* aEndAddress)
@@ -124,23 +147,34 @@ namespace Raidcore::Nexus::Host
 
 		const std::lock_guard<std::recursive_mutex> lock(this->Mutex);
 
-		for (auto& [identifier, ev] : this->Registry)
+		/* Only the events the module subscribed to. */
+		for (const auto& [identifier, callback] : this->Owners.Take(aStartAddress, aEndAddress))
 		{
-			ev.Subscribers.erase(
+			auto it = this->Registry.find(identifier);
+
+			if (it == this->Registry.end()) { continue; }
+
+			std::vector<EventSubscriber_t>& subscribers = it->second.Subscribers;
+			size_t before = subscribers.size();
+
+			subscribers.erase(
 				std::remove_if(
-				ev.Subscribers.begin(),
-				ev.Subscribers.end(),
-				[&refCounter, aStartAddress, aEndAddress](EventSubscriber_t& sub)
+				subscribers.begin(),
+				subscribers.end(),
+				[callback](EventSubscriber_t& sub)
 			{
-				if (sub.Callback >= aStartAddress && sub.Callback <= aEndAddress)
-				{
-					refCounter++;
-					return true;
-				}
-				return false;
+				return sub.Callback == callback;
 			}
 			),
-				ev.Subscribers.end()
+				subscribers.end()
+			);
+
+			refCounter += static_cast<uint32_t>(before - subscribers.size());
+
+			Memory::ResourceLedger::Get()->AddByAddress(
+				callback,
+				Memory::EResource::Events,
+				-static_cast<int64_t>(before - subscribers.size())
 			);
 		}
 
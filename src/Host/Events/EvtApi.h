@@ -11,11 +11,13 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "EvtData.h"
 #include "EvtSubscriber.h"
 #include "Host/Loader/Loader.h"
 #include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Host Namespace
@@ -56,6 +58,12 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		void Subscribe(const char* aIdentifier, EVENT_CONSUME aConsumeEventCallback);
 
+		///----------------------------------------------------------------------------------------------------
+		/// Watch:
+		/// 	Invokes the callback after every subscription to the provided event name, outside the lock.
+		///----------------------------------------------------------------------------------------------------
+		void Watch(const char* aIdentifier, EVENT_SUBSCRIBED aCallback);
+
 		///----------------------------------------------------------------------------------------------------
 		/// Unsubscribe:
 		/// 	Unsubscribes the provided ConsumeEventCallback function from the provided event name.
@@ -79,5 +87,7 @@ namespace Raidcore::Nexus::Host
 
 		mutable std::recursive_mutex                 Mutex;
 		std::unordered_map<std::string, EventData_t> Registry;
+
+		Memory::OwnerIndex<std::pair<std::string, EVENT_CONSUME>> Owners;
 	};
 }
@@ -17,6 +17,8 @@
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::Host
 {
+	typedef void (*EVENT_SUBSCRIBED) (const char* aIdentifier);
+
 	///----------------------------------------------------------------------------------------------------
 	/// EventData_t Struct
 	///----------------------------------------------------------------------------------------------------
@@ -24,5 +26,6 @@ namespace Raidcore::Nexus::Host
 	{
 		std::vector<EventSubscriber_t> Subscribers;
 		unsigned long long             AmountRaises = 0;
+		EVENT_SUBSCRIBED               OnSubscribe  = nullptr; /* Invoked after every subscription. */
 	};
 }
@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #pragma warning(push, 0)
 #include "nlohmann/json.hpp"
@@ -36,5 +37,18 @@ namespace Raidcore::Nexus::Host
 
 		LibraryAddon_t() = default;
 		LibraryAddon_t(json& aJson);
+
+		bool operator==(const LibraryAddon_t& aOther) const = default;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// LibraryDiff_t Struct
+	/// 	Signatures that changed between two library generations.
+	///----------------------------------------------------------------------------------------------------
+	struct LibraryDiff_t
+	{
+		std::vector<uint32_t> Added;
+		std::vector<uint32_t> Changed;
+		std::vector<uint32_t> Removed;
 	};
 }
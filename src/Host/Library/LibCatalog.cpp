@@ -0,0 +1,144 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LibCatalog.cpp
+/// Description  :  Merged and indexed addon definitions of all library sources.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "LibCatalog.h"
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+namespace Raidcore::Nexus::Host
+{
+	static std::string ToLower(std::string aString)
+	{
+		std::transform(aString.begin(), aString.end(), aString.begin(), [](unsigned char aChar)
+		{
+			return static_cast<char>(std::tolower(aChar));
+		});
+
+		return aString;
+	}
+
+	bool LibraryCatalog::AddSource(const std::string& aURL)
+	{
+		if (std::find(this->Sources.begin(), this->Sources.end(), aURL) != this->Sources.end()) { return false; }
+
+		this->Sources.push_back(aURL);
+		return true;
+	}
+
+	void LibraryCatalog::SetDefinitions(const std::string& aURL, std::vector<LibraryAddon_t> aAddons)
+	{
+		this->SourceAddons[aURL] = std::move(aAddons);
+	}
+
+	size_t LibraryCatalog::GetDefinitionCount(const std::string& aURL) const
+	{
+		auto it = this->SourceAddons.find(aURL);
+
+		if (it == this->SourceAddons.end()) { return 0; }
+
+		return it->second.size();
+	}
+
+	bool LibraryCatalog::Merge()
+	{
+		std::vector<LibraryAddon_t> addons;
+		std::unordered_map<uint32_t, size_t> bySignature;
+		std::unordered_map<std::string, size_t> byName;
+
+		for (const std::string& url : this->Sources)
+		{
+			auto it = this->SourceAddons.find(url);
+
+			if (it == this->SourceAddons.end()) { continue; }
+
+			for (const LibraryAddon_t& addon : it->second)
+			{
+				/* Listed by multiple sources, the first one wins. */
+				if (!bySignature.emplace(addon.Signature, addons.size()).second) { continue; }
+
+				byName.emplace(ToLower(addon.Name), addons.size());
+				addons.push_back(addon);
+			}
+		}
+
+		LibraryDiff_t diff{};
+
+		for (const LibraryAddon_t& addon : addons)
+		{
+			auto prev = this->BySignature.find(addon.Signature);
+
+			if (prev == this->BySignature.end())
+			{
+				diff.Added.push_back(addon.Signature);
+			}
+			else if (!(this->Addons[prev->second] == addon))
+			{
+				diff.Changed.push_back(addon.Signature);
+			}
+		}
+
+		for (const auto& [signature, index] : this->BySignature)
+		{
+			if (bySignature.find(signature) == bySignature.end())
+			{
+				diff.Removed.push_back(signature);
+			}
+		}
+
+		this->Addons = std::move(addons);
+		this->BySignature = std::move(bySignature);
+		this->ByName = std::move(byName);
+
+		if (diff.Added.empty() && diff.Changed.empty() && diff.Removed.empty()) { return false; }
+
+		this->LastDiff = std::move(diff);
+		this->Generation++;
+
+		return true;
+	}
+
+	const std::vector<LibraryAddon_t>& LibraryCatalog::GetLibrary() const
+	{
+		return this->Addons;
+	}
+
+	const LibraryAddon_t* LibraryCatalog::Find(uint32_t aSignature) const
+	{
+		auto it = this->BySignature.find(aSignature);
+
+		if (it == this->BySignature.end()) { return nullptr; }
+
+		return &this->Addons[it->second];
+	}
+
+	const LibraryAddon_t* LibraryCatalog::FindByName(const std::string& aName) const
+	{
+		auto it = this->ByName.find(ToLower(aName));
+
+		if (it == this->ByName.end()) { return nullptr; }
+
+		return &this->Addons[it->second];
+	}
+
+	uint64_t LibraryCatalog::GetGeneration() const
+	{
+		return this->Generation;
+	}
+
+	bool LibraryCatalog::GetChanges(uint64_t aGeneration, LibraryDiff_t& aOutDiff, uint64_t& aOutGeneration) const
+	{
+		aOutGeneration = this->Generation;
+
+		if (aGeneration + 1 != this->Generation) { return false; }
+
+		aOutDiff = this->LastDiff;
+		return true;
+	}
+}
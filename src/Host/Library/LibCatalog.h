@@ -0,0 +1,98 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LibCatalog.h
+/// Description  :  Merged and indexed addon definitions of all library sources.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LibAddon.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// LibraryCatalog Class
+	/// 	Holds the last definitions of each source and the library merged from them.
+	/// 	Not synchronized, the owner locks around every call.
+	///----------------------------------------------------------------------------------------------------
+	class LibraryCatalog
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// AddSource:
+		/// 	Appends a source, earlier ones take precedence. Returns false, if it already exists.
+		///----------------------------------------------------------------------------------------------------
+		bool AddSource(const std::string& aURL);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetDefinitions:
+		/// 	Replaces the definitions of a source. Takes effect with the next merge.
+		///----------------------------------------------------------------------------------------------------
+		void SetDefinitions(const std::string& aURL, std::vector<LibraryAddon_t> aAddons);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetDefinitionCount:
+		/// 	Returns the number of definitions currently held for a source.
+		///----------------------------------------------------------------------------------------------------
+		size_t GetDefinitionCount(const std::string& aURL) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Merge:
+		/// 	Rebuilds the library and its indices from all sources in order and records the changes.
+		/// 	Returns true and advances the generation, if the contents changed.
+		///----------------------------------------------------------------------------------------------------
+		bool Merge();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetLibrary:
+		/// 	Returns the merged library.
+		///----------------------------------------------------------------------------------------------------
+		const std::vector<LibraryAddon_t>& GetLibrary() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the library addon with the given signature or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const LibraryAddon_t* Find(uint32_t aSignature) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// FindByName:
+		/// 	Returns the library addon with the given name or nullptr. Matched case-insensitive.
+		///----------------------------------------------------------------------------------------------------
+		const LibraryAddon_t* FindByName(const std::string& aName) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time the library contents change.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetChanges:
+		/// 	Returns true and the changes since the given generation, if it directly precedes the current.
+		/// 	Returns false if the library has to be fetched in full.
+		///----------------------------------------------------------------------------------------------------
+		bool GetChanges(uint64_t aGeneration, LibraryDiff_t& aOutDiff, uint64_t& aOutGeneration) const;
+
+		private:
+		std::vector<std::string>                                      Sources;      /* In the order they were added. */
+		std::unordered_map<std::string, std::vector<LibraryAddon_t>> SourceAddons; /* Last successful result per source. */
+
+		std::vector<LibraryAddon_t>                                   Addons;
+		std::unordered_map<uint32_t, size_t>                          BySignature;
+		std::unordered_map<std::string, size_t>                       ByName;       /* Lowercase */
+
+		uint64_t                                                      Generation = 0;
+		LibraryDiff_t                                                 LastDiff{};
+	};
+}
@@ -8,6 +8,8 @@
 
 #include "LibManager.h"
 
+#include <future>
+
 #include "Runtime/Runtime.h"
 using namespace Raidcore::Nexus;
 
@@ -28,69 +30,122 @@ namespace Raidcore::Nexus::Host
 
 	void LibraryMgr::Update()
 	{
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		std::vector<std::pair<std::string, std::shared_ptr<Network::CHttpClient>>> sources;
+
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			sources = this->Sources;
+		}
 
-		this->Addons.clear();
+		/* The slowest source bounds the update, not the sum of all. */
+		std::vector<std::vector<LibraryAddon_t>> results(sources.size());
+		std::vector<std::future<bool>> fetches;
 
-		for (auto& [url, client] : this->Sources)
+		for (size_t i = 0; i < sources.size(); i++)
 		{
-			std::string endpoint = URL::GetEndpoint(url);
+			fetches.push_back(std::async(std::launch::async, [this, &sources, &results, i]()
+			{
+				return this->Fetch(sources[i].first, *sources[i].second, results[i]);
+			}));
+		}
 
-			Network::HttpResponse_t result = client->Get(endpoint);
+		/* Wait for all sources before locking, readers are only blocked by the merge. */
+		std::vector<bool> succeeded(sources.size());
 
-			if (!result.Success())
+		for (size_t i = 0; i < sources.size(); i++)
+		{
+			succeeded[i] = fetches[i].get();
+		}
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (size_t i = 0; i < sources.size(); i++)
+		{
+			const std::string& url = sources[i].first;
+
+			if (succeeded[i])
 			{
-				this->Logger.Warning(
-					LOG_CHANNEL,
-					"Failed to fetch addon library from \"%s\".\n\tStatus: %s\n\tError: %s",
-					url.c_str(),
-					result.Status().c_str(),
-					result.Error.c_str()
-				);
+				this->Catalog.SetDefinitions(url, std::move(results[i]));
 				continue;
 			}
 
-			try
+			size_t previous = this->Catalog.GetDefinitionCount(url);
+
+			if (previous > 0)
 			{
-				json libJSON = result.ContentJSON();
+				this->Logger.Info(LOG_CHANNEL, "Keeping %u previous definitions of \"%s\".", static_cast<uint32_t>(previous), url.c_str());
+			}
+		}
 
-				if (libJSON.is_null())
-				{
-					this->Logger.Warning(LOG_CHANNEL, "\"%s\" had an empty response.", url.c_str());
-					continue;
-				}
+		this->Catalog.Merge();
+	}
 
-				if (!libJSON.is_array())
-				{
-					this->Logger.Warning(LOG_CHANNEL, "\"%s\" does not conform to library specification.", url.c_str());
-					continue;
-				}
+	bool LibraryMgr::Fetch(const std::string& aURL, Network::CHttpClient& aClient, std::vector<LibraryAddon_t>& aOutAddons)
+	{
+		std::string endpoint = URL::GetEndpoint(aURL);
 
-				for (json& addonJSON : libJSON)
-				{
-					this->Addons.push_back(addonJSON);
-				}
+		Network::HttpResponse_t result = aClient.Get(endpoint);
+
+		if (!result.Success())
+		{
+			this->Logger.Warning(
+				LOG_CHANNEL,
+				"Failed to fetch addon library from \"%s\".\n\tStatus: %s\n\tError: %s",
+				aURL.c_str(),
+				result.Status().c_str(),
+				result.Error.c_str()
+			);
+			return false;
+		}
+
+		try
+		{
+			json libJSON = result.ContentJSON();
+
+			if (libJSON.is_null())
+			{
+				this->Logger.Warning(LOG_CHANNEL, "\"%s\" had an empty response.", aURL.c_str());
+				return false;
 			}
-			catch (...)
+
+			if (!libJSON.is_array())
 			{
-				this->Logger.Warning(LOG_CHANNEL, "Unknown error processing \"%s\".", url.c_str());
+				this->Logger.Warning(LOG_CHANNEL, "\"%s\" does not conform to library specification.", aURL.c_str());
+				return false;
 			}
+
+			aOutAddons.reserve(libJSON.size());
+
+			for (json& addonJSON : libJSON)
+			{
+				aOutAddons.push_back(addonJSON);
+			}
+		}
+		catch (...)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Unknown error processing \"%s\".", aURL.c_str());
+			return false;
 		}
+
+		return true;
 	}
 
 	void LibraryMgr::AddSource(std::string aURL)
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = this->Sources.find(aURL);
-
-		if (it != this->Sources.end())
+		if (!this->Catalog.AddSource(aURL))
 		{
 			this->Logger.Info(LOG_CHANNEL, "Source already exists: %s", aURL.c_str());
 			return;
 		}
 
-		this->Sources.emplace(aURL, &Runtime::Get().HttpClientStorage().GetHttpClient(aURL));
+		/* Not the shared client of the host, the updater must not inherit these timeouts. */
+		std::shared_ptr<Network::CHttpClient> client = std::make_shared<Network::CHttpClient>(&this->Logger, aURL);
+		client->SetTimeout(LIBRARY_SOURCE_TIMEOUT);
+		client->SetDeadline(LIBRARY_SOURCE_DEADLINE);
+
+		this->Sources.emplace_back(aURL, std::move(client));
 	}
 
 	void LibraryMgr::Install(uint32_t aSignature)
@@ -98,17 +153,10 @@ namespace Raidcore::Nexus::Host
 		/* Already installed. */
 		if (this->Loader.IsTrackedSafe(aSignature)) { return; }
 
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		LibraryAddon_t addon;
 
-		auto it = std::find_if(this->Addons.begin(), this->Addons.end(), [aSignature](const LibraryAddon_t& aAddon)
-		{
-			return aAddon.Signature == aSignature;
-		});
-
-		/* Does not exist in library. */
-		if (it == this->Addons.end()) { return; }
-
-		LibraryAddon_t& addon = *it;
+		/* Does not exist in library. Copied, so the download does not block readers. */
+		if (!this->Find(aSignature, addon)) { return; }
 
 		std::string filename;
 
@@ -251,6 +299,44 @@ namespace Raidcore::Nexus::Host
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		return this->Addons;
+		return this->Catalog.GetLibrary();
+	}
+
+	bool LibraryMgr::Find(uint32_t aSignature, LibraryAddon_t& aOutAddon) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		const LibraryAddon_t* addon = this->Catalog.Find(aSignature);
+
+		if (!addon) { return false; }
+
+		aOutAddon = *addon;
+		return true;
+	}
+
+	bool LibraryMgr::FindByName(const std::string& aName, LibraryAddon_t& aOutAddon) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		const LibraryAddon_t* addon = this->Catalog.FindByName(aName);
+
+		if (!addon) { return false; }
+
+		aOutAddon = *addon;
+		return true;
+	}
+
+	uint64_t LibraryMgr::GetGeneration() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Catalog.GetGeneration();
+	}
+
+	bool LibraryMgr::GetChanges(uint64_t aGeneration, LibraryDiff_t& aOutDiff, uint64_t& aOutGeneration) const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Catalog.GetChanges(aGeneration, aOutDiff, aOutGeneration);
 	}
 }
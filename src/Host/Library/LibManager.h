@@ -8,14 +8,20 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Host/Loader/Loader.h"
 #include "Core/Logging/LogApi.h"
 #include "Network/WebRequests/WreClient.h"
 #include "LibAddon.h"
+#include "LibCatalog.h"
+
+constexpr const uint32_t LIBRARY_SOURCE_TIMEOUT  = 10; /* Seconds, connecting and between reads. */
+constexpr const uint32_t LIBRARY_SOURCE_DEADLINE = 30; /* Seconds, for the whole response of a source. */
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Host Namespace
@@ -41,12 +47,14 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		/// Update:
 		/// 	Updates the library addon definitions from the available sources.
+		/// 	Sources are fetched concurrently, a source that fails keeps its previous definitions.
 		///----------------------------------------------------------------------------------------------------
 		void Update();
 
 		///----------------------------------------------------------------------------------------------------
 		/// AddSource:
 		/// 	Adds a source for library addons definitions.
+		/// 	Each source gets its own client, so its timeouts do not affect other users of the host.
 		///----------------------------------------------------------------------------------------------------
 		void AddSource(std::string aURL);
 
@@ -62,12 +70,45 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		std::vector<LibraryAddon_t> GetLibrary() const;
 
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns true and a copy of the library addon with the given signature, if it exists.
+		///----------------------------------------------------------------------------------------------------
+		bool Find(uint32_t aSignature, LibraryAddon_t& aOutAddon) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// FindByName:
+		/// 	Returns true and a copy of the library addon with the given name, if it exists.
+		/// 	The name is matched case-insensitive.
+		///----------------------------------------------------------------------------------------------------
+		bool FindByName(const std::string& aName, LibraryAddon_t& aOutAddon) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns a counter, that increments every time the library contents change.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetChanges:
+		/// 	Returns true and the changes since the given generation, if it directly precedes the current.
+		/// 	Returns false if the library has to be fetched in full.
+		///----------------------------------------------------------------------------------------------------
+		bool GetChanges(uint64_t aGeneration, LibraryDiff_t& aOutDiff, uint64_t& aOutGeneration) const;
+
 		private:
-		Core::LogApi&                                          Logger;
-		Loader&                                                Loader;
+		Core::LogApi&                                                              Logger;
+		Loader&                                                                    Loader;
+
+		mutable std::mutex                                                         Mutex;
+		std::vector<std::pair<std::string, std::shared_ptr<Network::CHttpClient>>> Sources; /* Shared with running updates. */
+		LibraryCatalog                                                             Catalog;
 
-		mutable std::mutex                                     Mutex;
-		std::unordered_map<std::string, Network::CHttpClient*> Sources;
-		std::vector<LibraryAddon_t>                            Addons;
+		///----------------------------------------------------------------------------------------------------
+		/// Fetch:
+		/// 	Fetches and parses the definitions of a source.
+		/// 	Returns false, if the source could not be fetched or parsed.
+		///----------------------------------------------------------------------------------------------------
+		bool Fetch(const std::string& aURL, Network::CHttpClient& aClient, std::vector<LibraryAddon_t>& aOutAddons);
 	};
 }
@@ -0,0 +1,380 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrDependencies.cpp
+/// Description  :  Dependency graph of addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "LdrDependencies.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <queue>
+#include <unordered_set>
+
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// IsZero:
+	/// 	Returns true, if the version is not set.
+	///----------------------------------------------------------------------------------------------------
+	static bool IsZero(const Version_t& aVersion)
+	{
+		return aVersion.Major == 0 && aVersion.Minor == 0 && aVersion.Build == 0 && aVersion.Revision == 0;
+	}
+
+	void DependencyGraph::Declare(uint32_t aSignature, Version_t aVersion, std::vector<Dependency_t> aDependencies)
+	{
+		Node_t& node = this->Nodes[aSignature];
+		node.Version = aVersion;
+		node.Dependencies = std::move(aDependencies);
+	}
+
+	void DependencyGraph::Remove(uint32_t aSignature)
+	{
+		this->Nodes.erase(aSignature);
+	}
+
+	void DependencyGraph::SetLoaded(uint32_t aSignature, bool aIsLoaded)
+	{
+		auto it = this->Nodes.find(aSignature);
+
+		if (it != this->Nodes.end())
+		{
+			it->second.IsLoaded = aIsLoaded;
+		}
+	}
+
+	bool DependencyGraph::IsLoaded(uint32_t aSignature) const
+	{
+		auto it = this->Nodes.find(aSignature);
+
+		return it != this->Nodes.end() && it->second.IsLoaded;
+	}
+
+	EDependencyState DependencyGraph::Check(uint32_t aSignature, uint32_t* aOutBlocker) const
+	{
+		auto it = this->Nodes.find(aSignature);
+
+		if (it == this->Nodes.end()) { return EDependencyState::Satisfied; }
+
+		/* Everything not contained in a wave is in or behind a cycle. */
+		std::unordered_set<uint32_t> ordered;
+
+		for (const std::vector<uint32_t>& wave : this->GetWaves())
+		{
+			ordered.insert(wave.begin(), wave.end());
+		}
+
+		EDependencyState result = EDependencyState::Satisfied;
+		uint32_t blocker = 0;
+
+		if (ordered.find(aSignature) == ordered.end())
+		{
+			result = EDependencyState::Cycle;
+			blocker = aSignature;
+		}
+
+		for (const Dependency_t& dep : it->second.Dependencies)
+		{
+			if (result == EDependencyState::Cycle) { break; }
+
+			auto depIt = this->Nodes.find(dep.Signature);
+
+			if (depIt == this->Nodes.end())
+			{
+				if (!dep.IsOptional && result == EDependencyState::Satisfied)
+				{
+					result = EDependencyState::Missing;
+					blocker = dep.Signature;
+				}
+
+				continue;
+			}
+
+			if (!IsCompatible(dep, depIt->second.Version))
+			{
+				if (!dep.IsOptional)
+				{
+					result = EDependencyState::VersionMismatch;
+					blocker = dep.Signature;
+					break;
+				}
+
+				continue;
+			}
+
+			if (ordered.find(dep.Signature) == ordered.end())
+			{
+				result = EDependencyState::Cycle;
+				blocker = dep.Signature;
+				break;
+			}
+
+			if (!depIt->second.IsLoaded && result != EDependencyState::Missing)
+			{
+				result = EDependencyState::Pending;
+				blocker = dep.Signature;
+			}
+		}
+
+		if (aOutBlocker)
+		{
+			*aOutBlocker = blocker;
+		}
+
+		return result;
+	}
+
+	std::vector<std::vector<uint32_t>> DependencyGraph::GetWaves() const
+	{
+		std::unordered_map<uint32_t, uint32_t>              remaining;
+		std::unordered_map<uint32_t, std::vector<uint32_t>> dependents;
+
+		for (const auto& [sig, node] : this->Nodes)
+		{
+			std::vector<uint32_t> edges = this->GetEdges(node);
+			remaining[sig] = static_cast<uint32_t>(edges.size());
+
+			for (uint32_t dep : edges)
+			{
+				dependents[dep].push_back(sig);
+			}
+		}
+
+		std::vector<std::vector<uint32_t>> waves;
+		std::vector<uint32_t> wave;
+
+		for (const auto& [sig, count] : remaining)
+		{
+			if (count == 0)
+			{
+				wave.push_back(sig);
+			}
+		}
+
+		while (!wave.empty())
+		{
+			std::sort(wave.begin(), wave.end());
+
+			std::vector<uint32_t> next;
+
+			for (uint32_t sig : wave)
+			{
+				auto it = dependents.find(sig);
+
+				if (it == dependents.end()) { continue; }
+
+				for (uint32_t dependent : it->second)
+				{
+					if (--remaining[dependent] == 0)
+					{
+						next.push_back(dependent);
+					}
+				}
+			}
+
+			waves.push_back(std::move(wave));
+			wave = std::move(next);
+		}
+
+		return waves;
+	}
+
+	std::vector<uint32_t> DependencyGraph::GetUnloadOrder() const
+	{
+		std::vector<uint32_t> order;
+		order.reserve(this->Nodes.size());
+
+		std::vector<std::vector<uint32_t>> waves = this->GetWaves();
+
+		for (auto it = waves.rbegin(); it != waves.rend(); it++)
+		{
+			order.insert(order.end(), it->begin(), it->end());
+		}
+
+		/* Cycles never load, their order does not matter. */
+		std::vector<uint32_t> rest;
+
+		for (const auto& [sig, node] : this->Nodes)
+		{
+			if (std::find(order.begin(), order.end(), sig) == order.end())
+			{
+				rest.push_back(sig);
+			}
+		}
+
+		std::sort(rest.begin(), rest.end());
+		order.insert(order.end(), rest.begin(), rest.end());
+
+		return order;
+	}
+
+	std::vector<std::vector<uint32_t>> DependencyGraph::GetCycles() const
+	{
+		std::vector<uint32_t> signatures;
+
+		for (const auto& [sig, node] : this->Nodes)
+		{
+			signatures.push_back(sig);
+		}
+
+		std::sort(signatures.begin(), signatures.end());
+
+		std::vector<std::vector<uint32_t>> cycles;
+		std::unordered_set<uint32_t> visited;
+
+		for (uint32_t sig : signatures)
+		{
+			if (visited.find(sig) != visited.end()) { continue; }
+
+			std::vector<uint32_t> cycle = this->GetCycle(sig);
+
+			if (cycle.empty()) { continue; }
+
+			visited.insert(cycle.begin(), cycle.end());
+			cycles.push_back(std::move(cycle));
+		}
+
+		return cycles;
+	}
+
+	std::vector<uint32_t> DependencyGraph::GetCycle(uint32_t aSignature) const
+	{
+		auto it = this->Nodes.find(aSignature);
+
+		if (it == this->Nodes.end()) { return {}; }
+
+		/* Breadth first, so the shortest cycle through the addon is reported. */
+		std::unordered_map<uint32_t, uint32_t> parents;
+		std::queue<uint32_t> queue;
+
+		for (uint32_t dep : this->GetEdges(it->second))
+		{
+			if (parents.emplace(dep, aSignature).second)
+			{
+				queue.push(dep);
+			}
+		}
+
+		while (!queue.empty())
+		{
+			uint32_t sig = queue.front();
+			queue.pop();
+
+			if (sig == aSignature)
+			{
+				std::vector<uint32_t> cycle;
+				uint32_t current = parents[aSignature];
+
+				cycle.push_back(aSignature);
+
+				while (current != aSignature)
+				{
+					cycle.push_back(current);
+					current = parents[current];
+				}
+
+				/* Walked backwards from the dependency, reverse to read as "depends on". */
+				std::reverse(cycle.begin() + 1, cycle.end());
+				cycle.push_back(aSignature);
+
+				return cycle;
+			}
+
+			for (uint32_t dep : this->GetEdges(this->Nodes.at(sig)))
+			{
+				if (parents.emplace(dep, sig).second)
+				{
+					queue.push(dep);
+				}
+			}
+		}
+
+		return {};
+	}
+
+	std::vector<uint32_t> DependencyGraph::GetDependents(uint32_t aSignature) const
+	{
+		std::vector<uint32_t> dependents;
+
+		for (const auto& [sig, node] : this->Nodes)
+		{
+			std::vector<uint32_t> edges = this->GetEdges(node);
+
+			if (std::find(edges.begin(), edges.end(), aSignature) != edges.end())
+			{
+				dependents.push_back(sig);
+			}
+		}
+
+		std::sort(dependents.begin(), dependents.end());
+
+		return dependents;
+	}
+
+	/*static*/ const char* DependencyGraph::ToString(EDependencyState aState)
+	{
+		switch (aState)
+		{
+			case EDependencyState::Satisfied:       return "Satisfied";
+			case EDependencyState::Pending:         return "Not loaded";
+			case EDependencyState::Missing:         return "Missing";
+			case EDependencyState::VersionMismatch: return "Incompatible version";
+			case EDependencyState::Cycle:           return "Dependency cycle";
+		}
+
+		return "Unknown";
+	}
+
+	/*static*/ std::string DependencyGraph::ToString(const std::vector<uint32_t>& aSignatures)
+	{
+		std::string str;
+
+		for (uint32_t sig : aSignatures)
+		{
+			char buff[16]{};
+			snprintf(buff, sizeof(buff), "0x%08X", sig);
+
+			if (!str.empty())
+			{
+				str.append(" -> ");
+			}
+
+			str.append(buff);
+		}
+
+		return str;
+	}
+
+	/*static*/ bool DependencyGraph::IsCompatible(const Dependency_t& aDependency, Version_t aVersion)
+	{
+		if (!IsZero(aDependency.MinVersion) && aVersion < aDependency.MinVersion)  { return false; }
+		if (!IsZero(aDependency.MaxVersion) && aVersion >= aDependency.MaxVersion) { return false; }
+
+		return true;
+	}
+
+	std::vector<uint32_t> DependencyGraph::GetEdges(const Node_t& aNode) const
+	{
+		std::vector<uint32_t> edges;
+
+		for (const Dependency_t& dep : aNode.Dependencies)
+		{
+			auto it = this->Nodes.find(dep.Signature);
+
+			if (it == this->Nodes.end()) { continue; }
+
+			/* Incompatible optional dependencies are ignored entirely. */
+			if (dep.IsOptional && !IsCompatible(dep, it->second.Version)) { continue; }
+
+			if (std::find(edges.begin(), edges.end(), dep.Signature) == edges.end())
+			{
+				edges.push_back(dep.Signature);
+			}
+		}
+
+		return edges;
+	}
+}
@@ -0,0 +1,163 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrDependencies.h
+/// Description  :  Dependency graph of addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/Versioning/Version.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EDependencyState Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EDependencyState : uint32_t
+	{
+		Satisfied,       /* All dependencies are loaded and compatible. */
+		Pending,         /* A dependency is known, but not loaded yet. */
+		Missing,         /* A required dependency is unknown. It may still be declared later. */
+		VersionMismatch, /* A required dependency has an incompatible version. */
+		Cycle            /* The addon or one of its dependencies is part of a cycle. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// Dependency_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct Dependency_t
+	{
+		uint32_t  Signature;
+		Version_t MinVersion; /* Inclusive. Zero for any. */
+		Version_t MaxVersion; /* Exclusive. Zero for any. */
+		bool      IsOptional; /* Only orders the load, if the dependency is present. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// DependencyGraph Class
+	/// 	Addons are declared with their dependencies by signature. Dependencies that are not declared
+	/// 	are not part of the graph, so it can be queried at any time while addons are still declared.
+	///----------------------------------------------------------------------------------------------------
+	class DependencyGraph
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		DependencyGraph() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~DependencyGraph() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Declare:
+		/// 	Adds or replaces an addon. Keeps the loaded state, if it was already declared.
+		///----------------------------------------------------------------------------------------------------
+		void Declare(uint32_t aSignature, Version_t aVersion, std::vector<Dependency_t> aDependencies);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Removes an addon.
+		///----------------------------------------------------------------------------------------------------
+		void Remove(uint32_t aSignature);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetLoaded:
+		/// 	Sets whether a declared addon is loaded.
+		///----------------------------------------------------------------------------------------------------
+		void SetLoaded(uint32_t aSignature, bool aIsLoaded);
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsLoaded:
+		/// 	Returns true, if the addon is declared and loaded.
+		///----------------------------------------------------------------------------------------------------
+		bool IsLoaded(uint32_t aSignature) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Check:
+		/// 	Returns whether the addon can be loaded. Undeclared addons are always satisfied.
+		/// 	[optional] aOutBlocker: Signature of the dependency that is not satisfied.
+		///----------------------------------------------------------------------------------------------------
+		EDependencyState Check(uint32_t aSignature, uint32_t* aOutBlocker = nullptr) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetWaves:
+		/// 	Returns the addons in load order. The addons of one wave do not depend on each other.
+		/// 	Addons in or depending on a cycle are not contained.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<std::vector<uint32_t>> GetWaves() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetUnloadOrder:
+		/// 	Returns all addons, dependents before their dependencies.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<uint32_t> GetUnloadOrder() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCycles:
+		/// 	Returns all cycles, each in dependency order.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<std::vector<uint32_t>> GetCycles() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCycle:
+		/// 	Returns the cycle the addon is part of, or an empty list.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<uint32_t> GetCycle(uint32_t aSignature) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetDependents:
+		/// 	Returns the declared addons directly depending on the addon.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<uint32_t> GetDependents(uint32_t aSignature) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// ToString:
+		/// 	Returns a description of the state.
+		///----------------------------------------------------------------------------------------------------
+		static const char* ToString(EDependencyState aState);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ToString:
+		/// 	Returns the signatures as "0x... -> 0x...".
+		///----------------------------------------------------------------------------------------------------
+		static std::string ToString(const std::vector<uint32_t>& aSignatures);
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Node_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Node_t
+		{
+			Version_t                 Version;
+			std::vector<Dependency_t> Dependencies;
+			bool                      IsLoaded = false;
+		};
+
+		std::unordered_map<uint32_t, Node_t> Nodes;
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsCompatible:
+		/// 	Returns true, if the version is within the range of the dependency.
+		///----------------------------------------------------------------------------------------------------
+		static bool IsCompatible(const Dependency_t& aDependency, Version_t aVersion);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetEdges:
+		/// 	Returns the declared dependencies of the node, which are taken into account for ordering.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<uint32_t> GetEdges(const Node_t& aNode) const;
+	};
+}
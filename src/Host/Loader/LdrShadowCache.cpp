@@ -0,0 +1,149 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrShadowCache.cpp
+/// Description  :  Content addressed copies of addons to load from.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "LdrShadowCache.h"
+
+#include <system_error>
+#include <vector>
+
+namespace Raidcore::Nexus::Host
+{
+	/* Suffix of copies in progress. */
+	constexpr const char* SHADOW_PARTIAL_EXT = ".partial";
+
+	ShadowCache::ShadowCache(std::filesystem::path aDirectory)
+	{
+		this->Directory = aDirectory;
+	}
+
+	std::filesystem::path ShadowCache::Acquire(const std::filesystem::path& aSource, const MD5_t& aMD5)
+	{
+		std::filesystem::path target = this->GetPath(aSource, aMD5);
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		std::error_code ec;
+
+		uintmax_t size = std::filesystem::file_size(aSource, ec);
+		if (ec) { return {}; }
+
+		/* The name is the content, an existing copy of the same size is the same file. */
+		if (std::filesystem::file_size(target, ec) != size || ec)
+		{
+			std::filesystem::create_directories(this->Directory, ec);
+
+			std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(aSource, ec);
+			if (ec) { return {}; }
+
+			std::filesystem::path partial = target;
+			partial += SHADOW_PARTIAL_EXT;
+
+			if (!std::filesystem::copy_file(aSource, partial, std::filesystem::copy_options::overwrite_existing, ec) || ec)
+			{
+				std::filesystem::remove(partial, ec);
+				return {};
+			}
+
+			/* Written to while copying, the content does not match the hash anymore. */
+			bool isChanged = std::filesystem::last_write_time(aSource, ec) != writeTime || ec
+				|| std::filesystem::file_size(aSource, ec) != size || ec
+				|| std::filesystem::file_size(partial, ec) != size || ec;
+
+			if (isChanged)
+			{
+				std::filesystem::remove(partial, ec);
+				return {};
+			}
+
+			std::filesystem::rename(partial, target, ec);
+
+			if (ec)
+			{
+				std::filesystem::remove(partial, ec);
+				return {};
+			}
+		}
+
+		this->References[target.filename().string()]++;
+
+		return target;
+	}
+
+	void ShadowCache::Release(const std::filesystem::path& aCopy)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		auto it = this->References.find(aCopy.filename().string());
+
+		if (it == this->References.end()) { return; }
+
+		if (--it->second == 0)
+		{
+			this->References.erase(it);
+		}
+
+		this->IsDirty = true;
+	}
+
+	uint32_t ShadowCache::Collect()
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (!this->IsDirty) { return 0; }
+
+		std::error_code ec;
+
+		if (!std::filesystem::exists(this->Directory, ec))
+		{
+			this->IsDirty = false;
+			return 0;
+		}
+
+		std::vector<std::filesystem::path> unused;
+
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(this->Directory, ec))
+		{
+			if (!entry.is_regular_file(ec)) { continue; }
+
+			if (this->References.find(entry.path().filename().string()) != this->References.end()) { continue; }
+
+			unused.push_back(entry.path());
+		}
+
+		uint32_t deleted = 0;
+		bool hasRemaining = false;
+
+		for (const std::filesystem::path& path : unused)
+		{
+			/* Fails while the module is still mapped, e.g. if freeing it was deferred. */
+			if (std::filesystem::remove(path, ec) && !ec)
+			{
+				deleted++;
+			}
+			else
+			{
+				hasRemaining = true;
+			}
+		}
+
+		this->IsDirty = hasRemaining;
+
+		return deleted;
+	}
+
+	std::filesystem::path ShadowCache::GetPath(const std::filesystem::path& aSource, const MD5_t& aMD5) const
+	{
+		/* <stem>.<md5><ext>, the original name stays recognizable in module lists and crash logs. */
+		std::string filename = aSource.stem().string();
+		filename.append(".");
+		filename.append(aMD5.string());
+		filename.append(aSource.extension().string());
+
+		return this->Directory / filename;
+	}
+}
@@ -0,0 +1,76 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrShadowCache.h
+/// Description  :  Content addressed copies of addons to load from.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "LdrChecksum.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ShadowCache Class
+	/// 	Loading a copy leaves the original file free to be overwritten. Copies are named by the hash
+	/// 	of their content, so unchanged files are copied only once and changed files never collide
+	/// 	with a copy that is still loaded.
+	///----------------------------------------------------------------------------------------------------
+	class ShadowCache
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		ShadowCache(std::filesystem::path aDirectory);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~ShadowCache() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Acquire:
+		/// 	Returns the copy of the file with the given hash and references it.
+		/// 	Returns an empty path, if the copy failed or the file changed while copying.
+		///----------------------------------------------------------------------------------------------------
+		std::filesystem::path Acquire(const std::filesystem::path& aSource, const MD5_t& aMD5);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Release:
+		/// 	Releases a reference to a copy. It is deleted on the next collection.
+		///----------------------------------------------------------------------------------------------------
+		void Release(const std::filesystem::path& aCopy);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Collect:
+		/// 	Deletes all unreferenced copies and leftovers of interrupted copies.
+		/// 	Files that cannot be deleted yet are retried on the next collection.
+		/// 	Returns the number of deleted files.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Collect();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPath:
+		/// 	Returns where the copy of the file with the given hash is stored.
+		///----------------------------------------------------------------------------------------------------
+		std::filesystem::path GetPath(const std::filesystem::path& aSource, const MD5_t& aMD5) const;
+
+		private:
+		std::mutex                                Mutex;
+		std::filesystem::path                     Directory;
+		std::unordered_map<std::string, uint32_t> References;  /* Filename -> Count */
+		bool                                      IsDirty = true;
+	};
+}
@@ -0,0 +1,141 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrSnapshot.cpp
+/// Description  :  Immutable snapshots of the state of all tracked addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "LdrSnapshot.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::Host
+{
+	const AddonInfo_t* AddonSnapshot_t::Find(uint32_t aSignature) const
+	{
+		if (aSignature == 0) { return nullptr; }
+
+		for (const std::shared_ptr<const AddonInfo_t>& info : this->Addons)
+		{
+			if (info->Signature == aSignature)
+			{
+				return info.get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	const AddonInfo_t* AddonSnapshot_t::FindOwner(void* aAddress) const
+	{
+		if (aAddress == nullptr) { return nullptr; }
+
+		for (const std::shared_ptr<const AddonInfo_t>& info : this->Addons)
+		{
+			if (info->Module == nullptr) { continue; }
+
+			if (aAddress >= info->Module && aAddress < static_cast<char*>(info->Module) + info->ModuleSize)
+			{
+				return info.get();
+			}
+		}
+
+		return nullptr;
+	}
+
+	std::shared_ptr<const AddonSnapshot_t> AddonSnapshots::Get() const
+	{
+		return this->Current.load(std::memory_order_acquire);
+	}
+
+	uint64_t AddonSnapshots::GetGeneration() const
+	{
+		return this->Generation.load(std::memory_order_acquire);
+	}
+
+	void AddonSnapshots::Track(IAddon* aAddon)
+	{
+		if (aAddon == nullptr) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Tracked.insert(aAddon);
+	}
+
+	bool AddonSnapshots::Publish(const AddonInfo_t& aInfo)
+	{
+		if (aInfo.Addon == nullptr || aInfo.IsDestroying) { return false; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		/* Removed already, its last publishes race with the deletion. */
+		if (this->Tracked.find(aInfo.Addon) == this->Tracked.end()) { return false; }
+
+		std::vector<std::shared_ptr<const AddonInfo_t>> addons = this->Current.load(std::memory_order_relaxed)->Addons;
+
+		auto it = std::find_if(addons.begin(), addons.end(), [&aInfo](const std::shared_ptr<const AddonInfo_t>& info)
+		{
+			return info->Addon == aInfo.Addon;
+		});
+
+		if (it != addons.end())
+		{
+			if (**it == aInfo) { return false; }
+
+			*it = std::make_shared<const AddonInfo_t>(aInfo);
+		}
+		else
+		{
+			addons.push_back(std::make_shared<const AddonInfo_t>(aInfo));
+		}
+
+		this->Swap(std::move(addons));
+
+		return true;
+	}
+
+	bool AddonSnapshots::Remove(IAddon* aAddon)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Tracked.erase(aAddon);
+
+		std::vector<std::shared_ptr<const AddonInfo_t>> addons = this->Current.load(std::memory_order_relaxed)->Addons;
+
+		auto it = std::find_if(addons.begin(), addons.end(), [aAddon](const std::shared_ptr<const AddonInfo_t>& info)
+		{
+			return info->Addon == aAddon;
+		});
+
+		if (it == addons.end()) { return false; }
+
+		addons.erase(it);
+
+		this->Swap(std::move(addons));
+
+		return true;
+	}
+
+	void AddonSnapshots::Clear()
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Tracked.clear();
+
+		if (this->Current.load(std::memory_order_relaxed)->Addons.empty()) { return; }
+
+		this->Swap({});
+	}
+
+	void AddonSnapshots::Swap(std::vector<std::shared_ptr<const AddonInfo_t>> aAddons)
+	{
+		std::shared_ptr<AddonSnapshot_t> snapshot = std::make_shared<AddonSnapshot_t>();
+		snapshot->Generation = this->Generation.load(std::memory_order_relaxed) + 1;
+		snapshot->Addons = std::move(aAddons);
+
+		/* Snapshot first, a reader seeing the new generation always loads at least that snapshot. */
+		this->Current.store(snapshot, std::memory_order_release);
+		this->Generation.store(snapshot->Generation, std::memory_order_release);
+	}
+}
@@ -0,0 +1,145 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrSnapshot.h
+/// Description  :  Immutable snapshots of the state of all tracked addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "LdrEnum.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	class IAddon;
+
+	///----------------------------------------------------------------------------------------------------
+	/// AddonInfo_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AddonInfo_t
+	{
+		IAddon*               Addon               = nullptr; /* Identity only, never dereferenced. May be deleted while the snapshot is held. */
+		uint32_t              Signature           = 0;
+		std::string           Name;
+		std::string           Version;
+		std::string           Author;
+		std::string           Description;
+		std::filesystem::path Location;
+		std::string           MD5;                           /* Hex, as stored to disable a version.           */
+		std::string           ProjectPageURL;
+		bool                  SupportsPreReleases = false;
+		EAddonState           State               = EAddonState::None;
+		uint32_t              Interfaces          = 0;       /* Implementation defined, e.g. EAddonInterfaces. */
+		uint32_t              Flags               = 0;       /* Implementation defined, e.g. EAddonFlags.      */
+		void*                 Module              = nullptr;
+		size_t                ModuleSize          = 0;
+		bool                  IsDestroying        = false;   /* Being deleted, no longer published.            */
+
+		bool operator==(const AddonInfo_t& aOther) const = default;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AddonSnapshot_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct AddonSnapshot_t
+	{
+		uint64_t                                        Generation = 0;
+		std::vector<std::shared_ptr<const AddonInfo_t>> Addons;     /* In the order they were tracked. */
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the addon with the given signature, or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const AddonInfo_t* Find(uint32_t aSignature) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// FindOwner:
+		/// 	Returns the loaded addon whose module contains the address, or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const AddonInfo_t* FindOwner(void* aAddress) const;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AddonSnapshots Class
+	/// 	Each change publishes a new snapshot, readers load the current one without locking and keep
+	/// 	it alive for as long as they need it. Unchanged addons share their info across snapshots.
+	/// 	Writers are serialized, an unchanged publish does not produce a new generation.
+	/// 	Only tracked addons are published, so an addon that is being deleted cannot add itself again.
+	///----------------------------------------------------------------------------------------------------
+	class AddonSnapshots
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		AddonSnapshots() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~AddonSnapshots() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Get:
+		/// 	Returns the current snapshot.
+		///----------------------------------------------------------------------------------------------------
+		std::shared_ptr<const AddonSnapshot_t> Get() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns the generation of the current snapshot. Increments with every change.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Track:
+		/// 	Accepts publishes of the addon from now on.
+		///----------------------------------------------------------------------------------------------------
+		void Track(IAddon* aAddon);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Adds or replaces the info of a tracked addon. Ignored, if untracked or destroying.
+		/// 	Returns true, if it changed and a new snapshot was published.
+		///----------------------------------------------------------------------------------------------------
+		bool Publish(const AddonInfo_t& aInfo);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Removes and untracks an addon. Must be called before the addon is deleted.
+		/// 	Returns true, if it was contained.
+		///----------------------------------------------------------------------------------------------------
+		bool Remove(IAddon* aAddon);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Removes and untracks all addons.
+		///----------------------------------------------------------------------------------------------------
+		void Clear();
+
+		private:
+		std::mutex                                          Mutex;      /* Writers only. */
+		std::atomic<std::shared_ptr<const AddonSnapshot_t>> Current{ std::make_shared<const AddonSnapshot_t>() };
+		std::atomic<uint64_t>                               Generation = 0;
+		std::unordered_set<IAddon*>                         Tracked;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Swap:
+		/// 	Publishes the addons as the next generation. Must hold the lock.
+		///----------------------------------------------------------------------------------------------------
+		void Swap(std::vector<std::shared_ptr<const AddonInfo_t>> aAddons);
+	};
+}
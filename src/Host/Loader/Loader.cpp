@@ -8,8 +8,10 @@
 
 #include "Loader.h"
 
+#include <algorithm>
 #include <shlobj.h>
 
+#include "Core/Settings/SettingsConst.h"
 #include "Util/Strings.h"
 #include "Util/MD5.h"
 
@@ -17,8 +19,16 @@ namespace Raidcore::Nexus::Host
 {
 	constexpr const char* LOG_CHANNEL = "Loader";
 
-	Loader::Loader(Core::LogApi& aLogger, IADDON_FACTORY aFactoryFunction, std::filesystem::path aDirectory)
+	Loader::Loader(
+		Core::LogApi&         aLogger,
+		Core::SettingsMgr&    aSettings,
+		IADDON_FACTORY        aFactoryFunction,
+		std::filesystem::path aDirectory,
+		std::filesystem::path aCacheDirectory
+	)
 		: Logger(aLogger)
+		, Settings(aSettings)
+		, Shadows(aCacheDirectory)
 	{
 		this->CreateAddon = aFactoryFunction;
 		this->Directory = aDirectory;
@@ -27,6 +37,15 @@ namespace Raidcore::Nexus::Host
 		{
 			std::filesystem::create_directories(aDirectory);
 		}
+
+		this->IsShadowCopyEnabled = this->Settings.Get<bool>(OPT_LOADER_SHADOWCOPY, false);
+
+		this->Settings.Subscribe<bool>(OPT_LOADER_SHADOWCOPY, [&](bool aEnabled)
+		{
+			/* Applies to the next load, addons that are already loaded keep their file. */
+			this->IsShadowCopyEnabled = aEnabled;
+			this->NotifyChanges();
+		});
 	}
 
 	Loader::~Loader()
@@ -153,6 +172,7 @@ namespace Raidcore::Nexus::Host
 		IAddon* addon = this->CreateAddon(aPath);
 
 		this->Addons.push_back(addon);
+		this->Snapshots.Track(addon);
 
 		addon->Load();
 	}
@@ -212,6 +232,222 @@ namespace Raidcore::Nexus::Host
 		return this->Addons;
 	}
 
+	std::shared_ptr<const AddonSnapshot_t> Loader::GetSnapshot() const
+	{
+		return this->Snapshots.Get();
+	}
+
+	uint64_t Loader::GetGeneration() const
+	{
+		return this->Snapshots.GetGeneration();
+	}
+
+	void Loader::Publish(const AddonInfo_t& aInfo)
+	{
+		this->Snapshots.Publish(aInfo);
+	}
+
+	bool Loader::AwaitDependencies(IAddon* aAddon, Version_t aVersion, std::vector<Dependency_t> aDependencies)
+	{
+		assert(aAddon);
+
+		uint32_t signature = aAddon->GetSignature();
+		std::string path = aAddon->GetLocation().string();
+
+		std::unique_lock<std::mutex> lock(this->DepMutex);
+
+		this->Dependencies.Declare(signature, aVersion, std::move(aDependencies));
+		this->Declared[signature] = aAddon;
+
+		/* Dependents may be waiting for this addon to be declared, or complete a cycle with it. */
+		this->DepConVar.notify_all();
+
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LDR_DEPENDENCY_TIMEOUT_MS);
+
+		uint32_t blocker = 0;
+		EDependencyState state = this->Dependencies.Check(signature, &blocker);
+
+		/* Missing is not final, dependencies are only declared once they start loading. */
+		while (state == EDependencyState::Pending || state == EDependencyState::Missing)
+		{
+			std::cv_status status = this->DepConVar.wait_until(lock, deadline);
+
+			state = this->Dependencies.Check(signature, &blocker);
+
+			if (status == std::cv_status::timeout) { break; }
+		}
+
+		switch (state)
+		{
+			case EDependencyState::Satisfied:
+			{
+				return true;
+			}
+			case EDependencyState::Cycle:
+			{
+				std::vector<uint32_t> cycle = this->Dependencies.GetCycle(blocker);
+
+				if (cycle.empty())
+				{
+					this->Logger.Warning(LOG_CHANNEL, "Cannot load. Depends on a dependency cycle. (%s)", path.c_str());
+				}
+				else
+				{
+					this->Logger.Warning(LOG_CHANNEL, "Cannot load. Dependency cycle: %s (%s)", DependencyGraph::ToString(cycle).c_str(), path.c_str());
+				}
+
+				break;
+			}
+			default:
+			{
+				this->Logger.Warning(
+					LOG_CHANNEL,
+					"Cannot load. Dependency 0x%08X: %s. (%s)",
+					blocker,
+					DependencyGraph::ToString(state),
+					path.c_str()
+				);
+				break;
+			}
+		}
+
+		return false;
+	}
+
+	void Loader::SetLoaded(IAddon* aAddon, bool aIsLoaded)
+	{
+		assert(aAddon);
+
+		{
+			const std::lock_guard<std::mutex> lock(this->DepMutex);
+
+			uint32_t signature = aAddon->GetSignature();
+			auto it = this->Declared.find(signature);
+
+			if (it == this->Declared.end() || it->second != aAddon)
+			{
+				return;
+			}
+
+			this->Dependencies.SetLoaded(signature, aIsLoaded);
+
+			auto reload = aIsLoaded ? this->Reloads.find(signature) : this->Reloads.end();
+
+			if (reload != this->Reloads.end())
+			{
+				for (uint32_t dependent : reload->second)
+				{
+					auto dep = this->Declared.find(dependent);
+
+					/* Loaded in the meantime, e.g. manually. */
+					if (dep == this->Declared.end() || this->Dependencies.IsLoaded(dependent)) { continue; }
+
+					this->Logger.Debug(LOG_CHANNEL, "Loading dependent again: %s", dep->second->GetLocation().string().c_str());
+
+					/* Only queues, it still awaits all of its dependencies on its own thread. */
+					dep->second->Load();
+				}
+
+				this->Reloads.erase(reload);
+			}
+		}
+
+		this->DepConVar.notify_all();
+	}
+
+	void Loader::UnloadDependents(IAddon* aAddon)
+	{
+		assert(aAddon);
+
+		std::unique_lock<std::mutex> lock(this->DepMutex);
+
+		uint32_t signature = aAddon->GetSignature();
+		bool isReloading = this->Reloading.erase(signature) > 0;
+
+		std::vector<uint32_t> dependents;
+
+		for (uint32_t dependent : this->Dependencies.GetDependents(signature))
+		{
+			auto it = this->Declared.find(dependent);
+
+			if (it == this->Declared.end() || !this->Dependencies.IsLoaded(dependent))
+			{
+				continue;
+			}
+
+			this->Logger.Debug(LOG_CHANNEL, "Unloading dependent first: %s", it->second->GetLocation().string().c_str());
+
+			/* Loaded again once this addon is, their own dependents in turn once they are. */
+			if (isReloading)
+			{
+				this->Reloading.insert(dependent);
+				this->Reloads[signature].push_back(dependent);
+			}
+
+			/* Only queues, the dependent unloads on its own thread and unloads its dependents in turn. */
+			it->second->Unload();
+			dependents.push_back(dependent);
+		}
+
+		if (dependents.empty()) { return; }
+
+		bool isUnloaded = this->DepConVar.wait_for(lock, std::chrono::milliseconds(LDR_DEPENDENCY_TIMEOUT_MS), [this, &dependents] {
+			return std::none_of(dependents.begin(), dependents.end(), [this](uint32_t aSignature) {
+				return this->Dependencies.IsLoaded(aSignature);
+			});
+		});
+
+		if (!isUnloaded)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Dependents did not unload in time. Unloading anyway. (%s)", aAddon->GetLocation().string().c_str());
+		}
+	}
+
+	void Loader::Undeclare(IAddon* aAddon)
+	{
+		{
+			const std::lock_guard<std::mutex> lock(this->DepMutex);
+
+			for (auto it = this->Declared.begin(); it != this->Declared.end(); it++)
+			{
+				if (it->second == aAddon)
+				{
+					this->Dependencies.Remove(it->first);
+					this->Reloading.erase(it->first);
+					this->Reloads.erase(it->first);
+					this->Declared.erase(it);
+					break;
+				}
+			}
+		}
+
+		this->DepConVar.notify_all();
+	}
+
+	std::filesystem::path Loader::AcquireLoadPath(const std::filesystem::path& aPath, const MD5_t& aMD5)
+	{
+		if (!this->IsShadowCopyEnabled) { return aPath; }
+
+		std::filesystem::path copy = this->Shadows.Acquire(aPath, aMD5);
+
+		if (copy.empty())
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Shadow copy failed. Loading in place: %s", aPath.string().c_str());
+			return aPath;
+		}
+
+		this->Logger.Debug(LOG_CHANNEL, "Loading from shadow copy: %s -> %s", aPath.string().c_str(), copy.string().c_str());
+
+		return copy;
+	}
+
+	void Loader::ReleaseLoadPath(const std::filesystem::path& aLoadPath)
+	{
+		if (aLoadPath.empty()) { return; }
+
+		this->Shadows.Release(aLoadPath);
+	}
+
 	void Loader::DeinitDirectoryUpdates()
 	{
 		const std::lock_guard<std::mutex> lock(this->FSMutex);
@@ -251,6 +487,42 @@ namespace Raidcore::Nexus::Host
 		return true;
 	}
 
+	bool Loader::HasChanged(IAddon* aAddon)
+	{
+		std::error_code ec;
+
+		FileStamp_t stamp{};
+		stamp.Size = std::filesystem::file_size(aAddon->GetLocation(), ec);
+		stamp.WriteTime = std::filesystem::last_write_time(aAddon->GetLocation(), ec);
+
+		/* Unreadable, let the hash decide. */
+		if (ec) { return true; }
+
+		auto it = this->Stamps.find(aAddon);
+
+		if (it == this->Stamps.end())
+		{
+			stamp.IsSettled = true;
+			this->Stamps[aAddon] = stamp;
+			return true;
+		}
+
+		/* Possibly still being written, e.g. by a build. Check again on the next pass. */
+		if (it->second.Size != stamp.Size || it->second.WriteTime != stamp.WriteTime)
+		{
+			it->second = stamp;
+			return false;
+		}
+
+		if (!it->second.IsSettled)
+		{
+			it->second.IsSettled = true;
+			return true;
+		}
+
+		return false;
+	}
+
 	void Loader::ProcessChanges()
 	{
 		this->Logger.Trace(LOG_CHANNEL, "Init. Discovering addons.");
@@ -259,7 +531,7 @@ namespace Raidcore::Nexus::Host
 		while (this->IsRunning)
 		{
 			std::unique_lock<std::mutex> lock(this->Mutex);
-			this->ConVar.wait_for(lock, std::chrono::milliseconds(5000));
+			this->ConVar.wait_for(lock, std::chrono::milliseconds(this->IsShadowCopyEnabled ? LDR_POLL_INTERVAL_SHADOW_MS : LDR_POLL_INTERVAL_MS));
 
 			this->Logger.Trace(LOG_CHANNEL, "Processing changes.");
 
@@ -281,6 +553,12 @@ namespace Raidcore::Nexus::Host
 					continue;
 				}
 
+				/* Only hash the file, if it was touched. */
+				if (!this->HasChanged(addon))
+				{
+					continue;
+				}
+
 				/* Get the MD5 of the current file on disk. */
 				MD5_t md5 = MD5Util::FromFile(addon->GetLocation());
 
@@ -290,6 +568,11 @@ namespace Raidcore::Nexus::Host
 					this->Logger.Debug(LOG_CHANNEL, "File changed. Reloading: %s", addon->GetLocation().empty() ? "(null)" : addon->GetLocation().string().c_str());
 					if (addon->IsLoaded())
 					{
+						{
+							const std::lock_guard<std::mutex> lockDeps(this->DepMutex);
+							this->Reloading.insert(addon->GetSignature());
+						}
+
 						addon->Unload();
 						addon->Load();
 					}
@@ -348,6 +631,7 @@ namespace Raidcore::Nexus::Host
 					IAddon* addon = this->CreateAddon(path);
 
 					this->Addons.push_back(addon);
+					this->Snapshots.Track(addon);
 
 					this->Logger.Debug(LOG_CHANNEL, "New addon tracked. Loading: %s", addon->GetLocation().empty() ? "(null)" : addon->GetLocation().string().c_str());
 					addon->Load();
@@ -373,19 +657,46 @@ namespace Raidcore::Nexus::Host
 						this->Addons.erase(it);
 					}
 
+					this->Stamps.erase(addon);
+
+					/* Before deleting, so no snapshot published afterwards refers to it. */
+					this->Snapshots.Remove(addon);
 					delete addon;
 				}
 			}
+
+			/* Delete shadow copies of unloaded addons. */
+			this->Shadows.Collect();
 		}
 
 		this->Logger.Trace(LOG_CHANNEL, "Shutdown. Clearing addons.");
 
+		/* Dependents first, so no addon is unloaded while another one still uses it. */
+		std::vector<uint32_t> order;
+
+		{
+			const std::lock_guard<std::mutex> lock(this->DepMutex);
+			order = this->Dependencies.GetUnloadOrder();
+		}
+
+		auto rank = [&order](IAddon* aAddon) {
+			return std::find(order.begin(), order.end(), aAddon->GetSignature()) - order.begin();
+		};
+
+		std::stable_sort(this->Addons.begin(), this->Addons.end(), [&rank](IAddon* aLeft, IAddon* aRight) {
+			return rank(aLeft) < rank(aRight);
+		});
+
 		for (IAddon* addon : this->Addons)
 		{
+			this->Snapshots.Remove(addon);
 			delete addon;
 		}
 
 		this->Addons.clear();
+		this->Snapshots.Clear();
+		this->Stamps.clear();
+		this->Shadows.Collect();
 	}
 
 	void Loader::Discover()
@@ -406,6 +717,7 @@ namespace Raidcore::Nexus::Host
 			IAddon* addon = this->CreateAddon(path);
 
 			this->Addons.push_back(addon);
+			this->Snapshots.Track(addon);
 
 			addon->Load();
 		}
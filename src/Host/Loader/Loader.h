@@ -8,18 +8,32 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <filesystem>
 #include <mutex>
 #include <shtypes.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <windows.h>
 
 #include "Core/Logging/LogApi.h"
+#include "Core/Settings/SettingsMgr.h"
 #include "LdrAddonBase.h"
+#include "LdrDependencies.h"
+#include "LdrShadowCache.h"
+#include "LdrSnapshot.h"
 
 constexpr const uint32_t WM_ADDONDIRUPDATE = WM_USER + 101;
 
+/* How long an addon waits for its dependencies to load, or its dependents to unload. */
+constexpr const uint32_t LDR_DEPENDENCY_TIMEOUT_MS = 10000;
+
+/* How often the addon directory is checked for changes. Shorter with shadow copies, for quick iteration. */
+constexpr const uint32_t LDR_POLL_INTERVAL_MS        = 5000;
+constexpr const uint32_t LDR_POLL_INTERVAL_SHADOW_MS = 500;
+
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Host Namespace
 ///----------------------------------------------------------------------------------------------------
@@ -36,8 +50,10 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		Loader(
 			Core::LogApi&         aLogger,
+			Core::SettingsMgr&    aSettings,
 			IADDON_FACTORY        aFactoryFunction,
-			std::filesystem::path aDirectory
+			std::filesystem::path aDirectory,
+			std::filesystem::path aCacheDirectory
 		);
 		// TODO: Register factory functions per file extension/type.
 
@@ -115,8 +131,79 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		std::vector<IAddon*> GetAddons() const;
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetSnapshot:
+		/// 	Returns the state of all tracked addons. Lock-free, the snapshot does not change.
+		///----------------------------------------------------------------------------------------------------
+		std::shared_ptr<const AddonSnapshot_t> GetSnapshot() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetGeneration:
+		/// 	Returns the generation of the current snapshot. Lock-free.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetGeneration() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Publishes the state of a tracked addon. Called by the addon after each state transition.
+		/// 	Ignored once the addon is untracked or destroying, its thread may still publish while deleted.
+		///----------------------------------------------------------------------------------------------------
+		void Publish(const AddonInfo_t& aInfo);
+
+		///----------------------------------------------------------------------------------------------------
+		/// AwaitDependencies:
+		/// 	Declares the addon and blocks until its dependencies are loaded.
+		/// 	Returns false and logs the reason, if they are missing, incompatible or form a cycle.
+		/// 	Must be called from the addon's own thread, never while holding the loader lock.
+		///----------------------------------------------------------------------------------------------------
+		bool AwaitDependencies(IAddon* aAddon, Version_t aVersion, std::vector<Dependency_t> aDependencies);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetLoaded:
+		/// 	Notifies waiting addons that a declared addon was loaded or unloaded.
+		/// 	Loads the dependents again, that were unloaded while the addon reloaded.
+		///----------------------------------------------------------------------------------------------------
+		void SetLoaded(IAddon* aAddon, bool aIsLoaded);
+
+		///----------------------------------------------------------------------------------------------------
+		/// UnloadDependents:
+		/// 	Unloads the addons depending on the addon and blocks until they are unloaded.
+		/// 	If the addon is reloading, the dependents are recorded to be loaded again along with it.
+		///----------------------------------------------------------------------------------------------------
+		void UnloadDependents(IAddon* aAddon);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Undeclare:
+		/// 	Removes the addon from the dependency graph.
+		///----------------------------------------------------------------------------------------------------
+		void Undeclare(IAddon* aAddon);
+
+		///----------------------------------------------------------------------------------------------------
+		/// AcquireLoadPath:
+		/// 	Returns the path to load the addon from. A shadow copy if enabled, otherwise the file itself.
+		/// 	The path has to be released once the addon is unloaded.
+		///----------------------------------------------------------------------------------------------------
+		std::filesystem::path AcquireLoadPath(const std::filesystem::path& aPath, const MD5_t& aMD5);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ReleaseLoadPath:
+		/// 	Releases a path returned by AcquireLoadPath.
+		///----------------------------------------------------------------------------------------------------
+		void ReleaseLoadPath(const std::filesystem::path& aLoadPath);
+
 		private:
+		///----------------------------------------------------------------------------------------------------
+		/// FileStamp_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct FileStamp_t
+		{
+			uintmax_t                       Size;
+			std::filesystem::file_time_type WriteTime;
+			bool                            IsSettled; /* Unchanged for a full pass since the last change. */
+		};
+
 		Core::LogApi&           Logger;
+		Core::SettingsMgr&      Settings;
 
 		std::filesystem::path   Directory;
 
@@ -132,6 +219,21 @@ namespace Raidcore::Nexus::Host
 
 		IADDON_FACTORY          CreateAddon;
 		std::vector<IAddon*>    Addons;
+		AddonSnapshots          Snapshots;
+
+		/* Separate from the loader lock, which is held while addons are queued and deleted. */
+		std::mutex              DepMutex;
+		std::condition_variable DepConVar;
+		DependencyGraph         Dependencies;
+		std::unordered_map<uint32_t, IAddon*> Declared;
+		std::unordered_set<uint32_t> Reloading; /* Unloaded to be loaded again, e.g. after the file changed. */
+		std::unordered_map<uint32_t, std::vector<uint32_t>> Reloads; /* Dependents to load again, by the reloaded dependency. */
+
+		ShadowCache             Shadows;
+		std::atomic<bool>       IsShadowCopyEnabled = false;
+
+		/* Only hash files, if size or write time changed. Owned by the processor thread. */
+		std::unordered_map<IAddon*, FileStamp_t> Stamps;
 
 		///----------------------------------------------------------------------------------------------------
 		/// DeinitDirectoryUpdates:
@@ -145,6 +247,13 @@ namespace Raidcore::Nexus::Host
 		///----------------------------------------------------------------------------------------------------
 		bool IsValid(const std::filesystem::path& aPath);
 
+		///----------------------------------------------------------------------------------------------------
+		/// HasChanged:
+		/// 	Returns true once the size and write time of the addon's file stopped changing after a change.
+		/// 	Always true for addons not seen before.
+		///----------------------------------------------------------------------------------------------------
+		bool HasChanged(IAddon* aAddon);
+
 		///----------------------------------------------------------------------------------------------------
 		/// ProcessChanges:
 		/// 	Detects and processes any changes to addons.
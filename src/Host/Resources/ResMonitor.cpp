@@ -0,0 +1,166 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResMonitor.cpp
+/// Description  :  Resolves the resource usage of modules to addons and publishes it via DataLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "ResMonitor.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace Raidcore::Nexus::Host
+{
+	/* Any address within the host module. */
+	static const int s_HostAnchor = 0;
+
+	ResourceMonitor::ResourceMonitor(Core::DataLinkApi& aDataLink, Host::Loader& aLoader)
+		: Loader(aLoader)
+	{
+		this->HostModule = Memory::GetOwnerModule((void*)&s_HostAnchor);
+		this->Published = aDataLink.ShareVersioned(DL_RESOURCE_USAGE, sizeof(UsageReport_t), 2, "", true);
+	}
+
+	void ResourceMonitor::Advance()
+	{
+		Clock::time_point now = Clock::now();
+
+		if (now - this->LastRefresh < std::chrono::milliseconds(RESMONITOR_INTERVAL_MS)) { return; }
+
+		this->LastRefresh = now;
+
+		this->Refresh();
+	}
+
+	std::vector<ResourceOwner_t> ResourceMonitor::GetReport() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Report;
+	}
+
+	void ResourceMonitor::Refresh()
+	{
+		std::vector<Memory::ResourceUsage_t> usage = Memory::ResourceLedger::Get()->GetSnapshot();
+
+		/* Unattributed usage is requested by Nexus itself, e.g. its own textures and shared resources. */
+		auto unattributed = std::find_if(usage.begin(), usage.end(), [](const Memory::ResourceUsage_t& entry)
+		{
+			return entry.Owner == nullptr;
+		});
+
+		if (unattributed != usage.end())
+		{
+			Memory::ResourceUsage_t host = *unattributed;
+			usage.erase(unattributed);
+
+			auto it = std::find_if(usage.begin(), usage.end(), [this](const Memory::ResourceUsage_t& entry)
+			{
+				return entry.Owner == this->HostModule;
+			});
+
+			if (it != usage.end())
+			{
+				host = Memory::ResourceLedger::Sum({ host, *it });
+				usage.erase(it);
+			}
+
+			host.Owner = this->HostModule;
+			usage.push_back(host);
+		}
+
+		/* Largest first, so the published report keeps the owners that matter, if it is truncated. */
+		Memory::ResourceLedger::Sort(usage, Memory::EResource::TextureBytes, true);
+
+		std::shared_ptr<const AddonSnapshot_t> addons = this->Loader.GetSnapshot();
+
+		std::vector<ResourceOwner_t> report;
+		report.reserve(usage.size());
+
+		for (const Memory::ResourceUsage_t& entry : usage)
+		{
+			ResourceOwner_t owner{};
+			owner.Usage = entry;
+
+			if (entry.Owner == this->HostModule)
+			{
+				owner.Name = "Nexus";
+				owner.IsLoaded = true;
+				report.push_back(std::move(owner));
+				continue;
+			}
+
+			const AddonInfo_t* addon = addons->FindOwner(entry.Owner);
+
+			if (addon)
+			{
+				this->Names[entry.Owner] = Name_t{ addon->Signature, addon->Name };
+			}
+
+			auto it = this->Names.find(entry.Owner);
+
+			if (it != this->Names.end())
+			{
+				owner.Signature = it->second.Signature;
+				owner.Name = it->second.Name;
+			}
+			else
+			{
+				char buff[32]{};
+				snprintf(buff, sizeof(buff), "%p", entry.Owner);
+				owner.Name = buff;
+			}
+
+			owner.IsLoaded = addon != nullptr;
+
+			report.push_back(std::move(owner));
+		}
+
+		this->Publish(report);
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		this->Report = std::move(report);
+	}
+
+	void ResourceMonitor::Publish(const std::vector<ResourceOwner_t>& aReport)
+	{
+		if (!this->Published) { return; }
+
+		UsageReport_t* target = (UsageReport_t*)Core::BeginWrite(this->Published);
+
+		std::memset(target, 0, sizeof(UsageReport_t));
+
+		target->Version = RESOURCEUSAGE_VERSION;
+		target->Count = static_cast<uint32_t>((std::min)(aReport.size(), static_cast<size_t>(RESOURCEUSAGE_MAX_ENTRIES)));
+		target->Timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()
+		).count());
+
+		for (uint32_t i = 0; i < target->Count; i++)
+		{
+			const ResourceOwner_t& owner = aReport[i];
+			UsageEntry_t& entry = target->Entries[i];
+
+			entry.Module = reinterpret_cast<uint64_t>(owner.Usage.Owner);
+			entry.Signature = owner.Signature;
+			entry.IsLoaded = owner.IsLoaded ? 1 : 0;
+			strncpy_s(entry.Name, owner.Name.c_str(), _TRUNCATE);
+
+			entry.Events          = owner.Usage.Get(Memory::EResource::Events);
+			entry.InputBinds      = owner.Usage.Get(Memory::EResource::InputBinds);
+			entry.RenderCallbacks = owner.Usage.Get(Memory::EResource::RenderCallbacks);
+			entry.Textures        = owner.Usage.Get(Memory::EResource::Textures);
+			entry.TextureBytes    = owner.Usage.Get(Memory::EResource::TextureBytes);
+			entry.DataLinkBytes   = owner.Usage.Get(Memory::EResource::DataLinkBytes);
+			entry.LogMessages     = owner.Usage.Get(Memory::EResource::LogMessages);
+			entry.LogBytes        = owner.Usage.Get(Memory::EResource::LogBytes);
+			entry.HttpRequests    = owner.Usage.Get(Memory::EResource::HttpRequests);
+			entry.LoadTimeUs      = owner.Usage.Get(Memory::EResource::LoadTimeUs);
+		}
+
+		Core::EndWrite(this->Published);
+	}
+}
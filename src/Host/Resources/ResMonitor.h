@@ -0,0 +1,104 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResMonitor.h
+/// Description  :  Resolves the resource usage of modules to addons and publishes it via DataLink.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/DataLink/DlApi.h"
+#include "Core/DataLink/DlVersioned.h"
+#include "Host/Loader/Loader.h"
+#include "Memory/ResourceLedger.h"
+#include "ResUsage.h"
+
+constexpr const uint32_t RESMONITOR_INTERVAL_MS = 1000;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ResourceOwner_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct ResourceOwner_t
+	{
+		Memory::ResourceUsage_t Usage;
+		uint32_t                Signature; /* 0 for Nexus and unknown modules. */
+		std::string             Name;
+		bool                    IsLoaded;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// ResourceMonitor Class
+	/// 	Refreshes on the render thread once per interval. The report may be read from any thread.
+	///----------------------------------------------------------------------------------------------------
+	class ResourceMonitor
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		ResourceMonitor(Core::DataLinkApi& aDataLink, Host::Loader& aLoader);
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~ResourceMonitor() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Advance:
+		/// 	Refreshes and publishes the report, if the interval elapsed. Called every frame.
+		///----------------------------------------------------------------------------------------------------
+		void Advance();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetReport:
+		/// 	Returns the last report.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<ResourceOwner_t> GetReport() const;
+
+		private:
+		using Clock = std::chrono::steady_clock;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Name_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Name_t
+		{
+			uint32_t    Signature;
+			std::string Name;
+		};
+
+		Host::Loader&                          Loader;
+		Core::VersionedHeader_t*               Published = nullptr;
+		void*                                  HostModule = nullptr;
+		Clock::time_point                      LastRefresh{};
+
+		mutable std::mutex                     Mutex;
+		std::vector<ResourceOwner_t>           Report;
+		std::unordered_map<void*, Name_t>      Names;     /* Module -> last known addon, kept after unloading. */
+
+		///----------------------------------------------------------------------------------------------------
+		/// Refresh:
+		/// 	Builds the report from a snapshot of the ledger.
+		///----------------------------------------------------------------------------------------------------
+		void Refresh();
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Writes the report to the shared resource.
+		///----------------------------------------------------------------------------------------------------
+		void Publish(const std::vector<ResourceOwner_t>& aReport);
+	};
+}
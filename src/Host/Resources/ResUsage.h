@@ -0,0 +1,57 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResUsage.h
+/// Description  :  Definition for the published resource usage.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+constexpr const char*    DL_RESOURCE_USAGE            = "DL_NEXUS_RESOURCE_USAGE"; /* Public, double-buffered, see VersionedHeader_t. */
+
+constexpr const uint32_t RESOURCEUSAGE_VERSION        = 1;
+constexpr const uint32_t RESOURCEUSAGE_MAX_ENTRIES    = 64;
+constexpr const uint32_t RESOURCEUSAGE_NAME_LENGTH    = 64;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Host Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Host
+{
+	///----------------------------------------------------------------------------------------------------
+	/// UsageEntry_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct UsageEntry_t
+	{
+		uint64_t Module;                          /* Base address of the owning module.            */
+		uint32_t Signature;                       /* Addon signature, 0 for Nexus and unknown.     */
+		uint32_t IsLoaded;                        /* 1 while the module is loaded.                 */
+		char     Name[RESOURCEUSAGE_NAME_LENGTH]; /* Null-terminated, truncated.                   */
+
+		int64_t  Events;
+		int64_t  InputBinds;
+		int64_t  RenderCallbacks;
+		int64_t  Textures;
+		int64_t  TextureBytes;
+		int64_t  DataLinkBytes;
+		int64_t  LogMessages;                     /* Since the game was started.                   */
+		int64_t  LogBytes;                        /* Since the game was started.                   */
+		int64_t  HttpRequests;                    /* Since the game was started.                   */
+		int64_t  LoadTimeUs;                      /* Of the last load.                             */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// UsageReport_t Struct
+	/// 	Published as DL_RESOURCE_USAGE, refreshed about once per second.
+	///----------------------------------------------------------------------------------------------------
+	struct UsageReport_t
+	{
+		uint32_t     Version;                            /* RESOURCEUSAGE_VERSION                    */
+		uint32_t     Count;                              /* Valid entries, by texture memory.        */
+		uint64_t     Timestamp;                          /* Milliseconds since epoch.                */
+		UsageEntry_t Entries[RESOURCEUSAGE_MAX_ENTRIES];
+	};
+}
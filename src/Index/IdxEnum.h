@@ -34,6 +34,8 @@ namespace Raidcore::Nexus
 		DIR_LOCALES,              /* <GW2>/addons/Nexus/Locales                      */
 		DIR_STYLES,               /* <GW2>/addons/Nexus/Styles                       */
 		DIR_TEXTURES,             /* <GW2>/addons/Nexus/Textures                     */
+		DIR_TEXTURECACHE,         /* <GW2>/addons/Nexus/Cache/Textures               */
+		DIR_ADDONCACHE,           /* <GW2>/addons/Nexus/Cache/Addons                 */
 
 		DIR_DOCUMENTS,            /* <DOCUMENTS>                                     */
 		DIR_DOCUMENTS_GW2,        /* <DOCUMENTS>/Guild Wars 2                        */
@@ -48,6 +50,8 @@ namespace Raidcore::Nexus
 		Log,                      /* <GW2>/addons/Nexus/Nexus.log                    */
 		CrashLog,                 /* <GW2>/addons/Nexus/Crash.log                    */
 		CrashStack,               /* <GW2>/addons/Nexus/CrashStack.log               */
+		CrashCapture,             /* <GW2>/addons/Nexus/Crash.capture                */
+		CrashDump,                /* <GW2>/addons/Nexus/Crash.dmp                    */
 		InputBinds,               /* <GW2>/addons/Nexus/InputBinds.json              */
 		GameBinds,                /* <GW2>/addons/Nexus/GameBinds.xml                */
 		Settings,                 /* <GW2>/addons/Nexus/Settings.json                */
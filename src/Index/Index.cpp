@@ -51,6 +51,8 @@ namespace Raidcore::Nexus
 			s_Paths[(int)EPath::DIR_LOCALES] = s_Paths[(int)EPath::DIR_NEXUS] / "Locales";
 			s_Paths[(int)EPath::DIR_STYLES] = s_Paths[(int)EPath::DIR_NEXUS] / "Styles";
 			s_Paths[(int)EPath::DIR_TEXTURES] = s_Paths[(int)EPath::DIR_NEXUS] / "Textures";
+			s_Paths[(int)EPath::DIR_TEXTURECACHE] = s_Paths[(int)EPath::DIR_NEXUS] / "Cache" / "Textures";
+			s_Paths[(int)EPath::DIR_ADDONCACHE] = s_Paths[(int)EPath::DIR_NEXUS] / "Cache" / "Addons";
 
 			/* Get document based directories. */
 			s_Paths[(int)EPath::DIR_DOCUMENTS_GW2] = s_Paths[(int)EPath::DIR_DOCUMENTS] / "Guild Wars 2";
@@ -65,11 +67,15 @@ namespace Raidcore::Nexus
 			std::filesystem::create_directories(s_Paths[(int)EPath::DIR_LOCALES]);
 			std::filesystem::create_directories(s_Paths[(int)EPath::DIR_STYLES]);
 			std::filesystem::create_directories(s_Paths[(int)EPath::DIR_TEXTURES]);
+			std::filesystem::create_directories(s_Paths[(int)EPath::DIR_TEXTURECACHE]);
+			std::filesystem::create_directories(s_Paths[(int)EPath::DIR_ADDONCACHE]);
 
 			/* Get files. */
 			s_Paths[(int)EPath::Log] = s_Paths[(int)EPath::DIR_NEXUS] / "Nexus.log";
 			s_Paths[(int)EPath::CrashLog] = s_Paths[(int)EPath::DIR_NEXUS] / "Crash.log";
 			s_Paths[(int)EPath::CrashStack] = s_Paths[(int)EPath::DIR_NEXUS] / "CrashStack.log";
+			s_Paths[(int)EPath::CrashCapture] = s_Paths[(int)EPath::DIR_NEXUS] / "Crash.capture";
+			s_Paths[(int)EPath::CrashDump] = s_Paths[(int)EPath::DIR_NEXUS] / "Crash.dmp";
 			s_Paths[(int)EPath::InputBinds] = s_Paths[(int)EPath::DIR_NEXUS] / "InputBinds.json";
 			s_Paths[(int)EPath::GameBinds] = s_Paths[(int)EPath::DIR_NEXUS] / "GameBinds.xml";
 			s_Paths[(int)EPath::Settings] = s_Paths[(int)EPath::DIR_NEXUS] / "Settings.json";
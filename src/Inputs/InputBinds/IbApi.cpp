@@ -21,6 +21,7 @@ using json = nlohmann::json;
 namespace Clockwork = Raidcore::Clockwork;
 
 #include "IbConst.h"
+#include "Memory/ResourceLedger.h"
 #include "Util/Inputs.h"
 
 namespace Raidcore::Nexus::Input
@@ -160,6 +161,11 @@ namespace Raidcore::Nexus::Input
 
 		auto it = this->Registry.find(aIdentifier);
 
+		/* The handlers share a union, any member is the previous handler. */
+		void* prevHandler = it != this->Registry.end() && it->second.HandlerType != EIbHandlerType::None
+			? (void*)it->second.Handler_DownRelease
+			: nullptr;
+
 		/* check if this InputBind_t is not already set */
 		if (it == Registry.end())
 		{
@@ -192,6 +198,7 @@ namespace Raidcore::Nexus::Input
 			}
 
 			this->Registry.emplace(aIdentifier, mapping);
+			this->BindIndex.Insert(aIdentifier, mapping.Bind);
 		}
 		else
 		{
@@ -222,6 +229,24 @@ namespace Raidcore::Nexus::Input
 			}
 		}
 
+		if (aInputBindHandler)
+		{
+			this->Owners.Add(aInputBindHandler, aIdentifier);
+		}
+
+		if (prevHandler != aInputBindHandler)
+		{
+			if (prevHandler)
+			{
+				Memory::ResourceLedger::Get()->AddByAddress(prevHandler, Memory::EResource::InputBinds, -1);
+			}
+
+			if (aInputBindHandler)
+			{
+				Memory::ResourceLedger::Get()->AddByAddress(aInputBindHandler, Memory::EResource::InputBinds, 1);
+			}
+		}
+
 		this->Save();
 
 		Clockwork::Run<void>(Raidcore::Clockwork::ETaskPriority::Low, [this](Clockwork::CancellationToken aToken)
@@ -239,6 +264,11 @@ namespace Raidcore::Nexus::Input
 		auto it = this->Registry.find(str);
 		if (it != this->Registry.end())
 		{
+			if (it->second.HandlerType != EIbHandlerType::None)
+			{
+				Memory::ResourceLedger::Get()->AddByAddress((void*)it->second.Handler_DownRelease, Memory::EResource::InputBinds, -1);
+			}
+
 			switch (it->second.HandlerType)
 			{
 				case EIbHandlerType::DownAsync:
@@ -262,6 +292,12 @@ namespace Raidcore::Nexus::Input
 		}
 
 		this->Save();
+
+		/* Shortcuts without a handler are hidden. */
+		Clockwork::Run<void>(Raidcore::Clockwork::ETaskPriority::Low, [this](Clockwork::CancellationToken aToken)
+		{
+			this->EventApi->Raise("EV_INPUTBIND_UPDATED");
+		});
 	}
 
 	std::string CInputBindApi::IsInUse(InputBind_t aInputBind)
@@ -270,15 +306,12 @@ namespace Raidcore::Nexus::Input
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		auto it = std::find_if(this->Registry.begin(), this->Registry.end(), [aInputBind](auto& entry)
-		{
-			return entry.second.Bind == aInputBind;
-		});
+		uint32_t index = this->BindIndex.Find(aInputBind);
 
-		if (it != this->Registry.end())
+		if (index != UINT32_MAX)
 		{
 			/* return the identifier that's already using this combination */
-			return it->first;
+			return this->BindIndex.GetIdentifier(index);
 		}
 
 		return "";
@@ -346,13 +379,21 @@ namespace Raidcore::Nexus::Input
 
 		if (it != this->Registry.end())
 		{
+			InputBind_t prev = it->second.Bind;
 			it->second.Bind = aInputBind;
+
+			if (prev != aInputBind)
+			{
+				this->BindIndex.Erase(aIdentifier, prev, this->Registry);
+				this->BindIndex.Insert(aIdentifier, aInputBind);
+			}
 		}
 		else
 		{
 			IbMapping_t mapping{};
 			mapping.Bind = aInputBind;
 			this->Registry.emplace(aIdentifier, mapping);
+			this->BindIndex.Insert(aIdentifier, aInputBind);
 		}
 
 		this->Save();
@@ -444,7 +485,14 @@ namespace Raidcore::Nexus::Input
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		this->Registry.erase(aIdentifier);
+		auto it = this->Registry.find(aIdentifier);
+
+		if (it != this->Registry.end())
+		{
+			InputBind_t prev = it->second.Bind;
+			this->Registry.erase(it);
+			this->BindIndex.Erase(aIdentifier, prev, this->Registry);
+		}
 
 		Clockwork::Run<void>(Raidcore::Clockwork::ETaskPriority::Low, [this](Clockwork::CancellationToken aToken)
 		{
@@ -458,8 +506,14 @@ namespace Raidcore::Nexus::Input
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		for (auto& [identifier, mapping] : this->Registry)
+		for (const std::string& identifier : this->Owners.Take(aStartAddress, aEndAddress))
 		{
+			auto it = this->Registry.find(identifier);
+
+			if (it == this->Registry.end()) { continue; }
+
+			IbMapping_t& mapping = it->second;
+
 			switch (mapping.HandlerType)
 			{
 				case EIbHandlerType::DownAsync:
@@ -495,6 +549,11 @@ namespace Raidcore::Nexus::Input
 			}
 		}
 
+		if (refCounter > 0)
+		{
+			Memory::ResourceLedger::Get()->AddByAddress(aStartAddress, Memory::EResource::InputBinds, -static_cast<int64_t>(refCounter));
+		}
+
 		return refCounter;
 	}
 
@@ -565,8 +624,15 @@ namespace Raidcore::Nexus::Input
 
 				if (it != this->Registry.end())
 				{
+					InputBind_t prev = it->second.Bind;
 					it->second.Bind = ib;
 					it->second.Passthrough = passthrough;
+
+					if (prev != ib)
+					{
+						this->BindIndex.Erase(identifier, prev, this->Registry);
+						this->BindIndex.Insert(identifier, ib);
+					}
 				}
 				else
 				{
@@ -574,6 +640,7 @@ namespace Raidcore::Nexus::Input
 					mapping.Bind = ib;
 					mapping.Passthrough = passthrough;
 					this->Registry.emplace(identifier, mapping);
+					this->BindIndex.Insert(identifier, ib);
 				}
 			}
 
@@ -630,32 +697,51 @@ namespace Raidcore::Nexus::Input
 		}
 	}
 
+	void CInputBindApi::InvokeRelease(const HeldInputBind_t& aHeldInputBind)
+	{
+		std::string identifier;
+
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			identifier = this->BindIndex.GetIdentifier(aHeldInputBind.Index);
+		}
+
+		this->Invoke(identifier, true);
+	}
+
 	bool CInputBindApi::Press(const InputBind_t& aInputBind)
 	{
+		uint32_t index = UINT32_MAX;
 		std::string identifier;
 		bool passthrough = false;
 
 		{
 			const std::lock_guard<std::mutex> lock(this->Mutex);
 
-			auto it = std::find_if(this->Registry.begin(), this->Registry.end(), [aInputBind](auto& entry)
-			{
-				return entry.second.Bind == aInputBind;
-			});
+			index = this->BindIndex.Find(aInputBind);
 
-			if (it == this->Registry.end())
+			if (index == UINT32_MAX)
 			{
 				return false;
 			}
 
-			identifier = it->first;
-			passthrough = it->second.Passthrough;
+			identifier = this->BindIndex.GetIdentifier(index);
+
+			auto it = this->Registry.find(identifier);
+
+			if (it != this->Registry.end())
+			{
+				passthrough = it->second.Passthrough;
+			}
 		}
 
-		assert(this->HeldInputBinds.find(identifier) == this->HeldInputBinds.end());
+		assert(std::find_if(this->HeldInputBinds.begin(), this->HeldInputBinds.end(), [index](const HeldInputBind_t& aHeld)
+		{
+			return aHeld.Index == index;
+		}) == this->HeldInputBinds.end());
 
 		/* track the actual bind/id combo */
-		this->HeldInputBinds.emplace(identifier, aInputBind);
+		this->HeldInputBinds.push_back(HeldInputBind_t{ index, aInputBind });
 
 		bool invoked = this->Invoke(identifier);
 
@@ -672,19 +758,11 @@ namespace Raidcore::Nexus::Input
 	{
 		for (auto it = this->HeldInputBinds.begin(); it != this->HeldInputBinds.end();)
 		{
-			if (aModifierVK == VK_SHIFT && it->second.Shift)
-			{
-				this->Invoke(it->first, true);
-				it = this->HeldInputBinds.erase(it);
-			}
-			else if (aModifierVK == VK_CONTROL && it->second.Ctrl)
-			{
-				this->Invoke(it->first, true);
-				it = this->HeldInputBinds.erase(it);
-			}
-			else if (aModifierVK == VK_MENU && it->second.Alt)
+			if ((aModifierVK == VK_SHIFT && it->Bind.Shift) ||
+				(aModifierVK == VK_CONTROL && it->Bind.Ctrl) ||
+				(aModifierVK == VK_MENU && it->Bind.Alt))
 			{
-				this->Invoke(it->first, true);
+				this->InvokeRelease(*it);
 				it = this->HeldInputBinds.erase(it);
 			}
 			else
@@ -698,9 +776,9 @@ namespace Raidcore::Nexus::Input
 	{
 		for (auto it = this->HeldInputBinds.begin(); it != this->HeldInputBinds.end();)
 		{
-			if (it->second.Device == aDevice && it->second.Code == aCode)
+			if (it->Bind.Device == aDevice && it->Bind.Code == aCode)
 			{
-				this->Invoke(it->first, true);
+				this->InvokeRelease(*it);
 				it = this->HeldInputBinds.erase(it);
 			}
 			else
@@ -712,9 +790,9 @@ namespace Raidcore::Nexus::Input
 
 	void CInputBindApi::ReleaseAll()
 	{
-		for (auto& bind : this->HeldInputBinds)
+		for (const HeldInputBind_t& held : this->HeldInputBinds)
 		{
-			this->Invoke(bind.first, true);
+			this->InvokeRelease(held);
 		}
 
 		this->HeldInputBinds.clear();
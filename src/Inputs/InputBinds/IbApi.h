@@ -12,13 +12,17 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 #include <windows.h>
 
 #include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
 #include "Host/Events/EvtApi.h"
 #include "Core/Logging/LogApi.h"
 #include "IbBindV2.h"
 #include "IbCapture.h"
+#include "IbIndex.h"
+#include "IbHeldBind.h"
 #include "IbMapping.h"
 
 ///----------------------------------------------------------------------------------------------------
@@ -130,9 +134,17 @@ namespace Raidcore::Nexus::Input
 
 		std::filesystem::path              ConfigPath;
 
-		mutable std::mutex                 Mutex;
-		std::map<std::string, IbMapping_t> Registry;
-		std::map<std::string, InputBind_t> HeldInputBinds;
+		mutable std::mutex                        Mutex;
+		std::map<std::string, IbMapping_t>        Registry;
+
+		/* Packed InputBind_t to dense identifier index. Updated whenever a bind changes. */
+		CInputBindIndex                           BindIndex;
+
+		/* Identifiers by the module of their handler. Verified on cleanup, handlers may have changed. */
+		Memory::OwnerIndex<std::string>           Owners;
+
+		/* Only accessed from the WndProc thread. */
+		std::vector<HeldInputBind_t>              HeldInputBinds;
 
 		///----------------------------------------------------------------------------------------------------
 		/// LoadSafe:
@@ -158,6 +170,12 @@ namespace Raidcore::Nexus::Input
 		///----------------------------------------------------------------------------------------------------
 		void Save();
 
+		///----------------------------------------------------------------------------------------------------
+		/// InvokeRelease:
+		/// 	Invokes the release of a held InputBind_t.
+		///----------------------------------------------------------------------------------------------------
+		void InvokeRelease(const HeldInputBind_t& aHeldInputBind);
+
 		///----------------------------------------------------------------------------------------------------
 		/// Press:
 		/// 	Invokes an InputBind_t that matches the pressed inputs.
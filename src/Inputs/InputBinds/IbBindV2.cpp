@@ -27,6 +27,16 @@ namespace Raidcore::Nexus::Input
 		return this->Device != EInputDevice::None && this->Code != 0;
 	}
 
+	uint64_t InputBind_t::Pack() const
+	{
+		/* [63..32 Device][31..16 Code][15..3 unused][2 Shift][1 Ctrl][0 Alt] */
+		return (static_cast<uint64_t>(this->Device) << 32)
+			| (static_cast<uint64_t>(this->Code) << 16)
+			| (static_cast<uint64_t>(this->Shift) << 2)
+			| (static_cast<uint64_t>(this->Ctrl) << 1)
+			| static_cast<uint64_t>(this->Alt);
+	}
+
 	bool operator==(const InputBind_t& lhs, const InputBind_t& rhs)
 	{
 		return lhs.Alt == rhs.Alt &&
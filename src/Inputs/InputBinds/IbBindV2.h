@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "IbEnum.h"
 #include "IbBind.h"
 
@@ -54,6 +56,13 @@ namespace Raidcore::Nexus::Input
 		/// 	Returns true if this input bind has any values set.
 		///----------------------------------------------------------------------------------------------------
 		bool IsBound() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Pack:
+		/// 	Returns device, code and modifiers packed into a single key.
+		/// 	Two binds are equal, if and only if their packed keys are equal.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t Pack() const;
 	};
 
 	bool operator==(const InputBind_t& lhs, const InputBind_t& rhs);
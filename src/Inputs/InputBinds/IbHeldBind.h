@@ -0,0 +1,29 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  IbHeldBind.h
+/// Description  :  Held InputBind_t struct definition.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "IbBindV2.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Input Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Input
+{
+	///----------------------------------------------------------------------------------------------------
+	/// HeldInputBind_t Struct
+	/// 	An InputBind_t that was pressed and awaits its release.
+	///----------------------------------------------------------------------------------------------------
+	struct HeldInputBind_t
+	{
+		uint32_t    Index; /* Dense identifier index of the pressed bind. */
+		InputBind_t Bind;  /* The actual combination that was pressed.    */
+	};
+}
@@ -0,0 +1,95 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  IbIndex.cpp
+/// Description  :  Lookup from InputBind_t to the identifier using it.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "IbIndex.h"
+
+namespace Raidcore::Nexus::Input
+{
+	uint32_t CInputBindIndex::Intern(const std::string& aIdentifier)
+	{
+		auto it = this->IdentifierIndices.find(aIdentifier);
+
+		if (it != this->IdentifierIndices.end())
+		{
+			return it->second;
+		}
+
+		uint32_t index = static_cast<uint32_t>(this->Identifiers.size());
+		this->Identifiers.push_back(aIdentifier);
+		this->IdentifierIndices.emplace(aIdentifier, index);
+
+		return index;
+	}
+
+	const std::string& CInputBindIndex::GetIdentifier(uint32_t aIndex) const
+	{
+		return this->Identifiers[aIndex];
+	}
+
+	void CInputBindIndex::Insert(const std::string& aIdentifier, const InputBind_t& aInputBind)
+	{
+		if (aInputBind == InputBind_t{}) { return; }
+
+		uint32_t index = this->Intern(aIdentifier);
+
+		auto [it, inserted] = this->Binds.try_emplace(aInputBind.Pack(), Entry_t{ index, 1 });
+
+		if (inserted) { return; }
+
+		it->second.Count++;
+
+		/* First one wins on duplicates, same as iterating the ordered registry. */
+		if (aIdentifier < this->Identifiers[it->second.Index])
+		{
+			it->second.Index = index;
+		}
+	}
+
+	void CInputBindIndex::Erase(const std::string& aIdentifier, const InputBind_t& aInputBind, const std::map<std::string, IbMapping_t>& aRegistry)
+	{
+		if (aInputBind == InputBind_t{}) { return; }
+
+		uint64_t key = aInputBind.Pack();
+
+		auto it = this->Binds.find(key);
+
+		if (it == this->Binds.end()) { return; }
+
+		if (--it->second.Count == 0)
+		{
+			this->Binds.erase(it);
+			return;
+		}
+
+		/* Another identifier uses it, the winner only changes if this one was it. */
+		if (this->Identifiers[it->second.Index] != aIdentifier) { return; }
+
+		for (auto& [identifier, mapping] : aRegistry)
+		{
+			if (identifier == aIdentifier) { continue; }
+
+			if (mapping.Bind != InputBind_t{} && mapping.Bind.Pack() == key)
+			{
+				it->second.Index = this->Intern(identifier);
+				return;
+			}
+		}
+	}
+
+	uint32_t CInputBindIndex::Find(const InputBind_t& aInputBind) const
+	{
+		auto it = this->Binds.find(aInputBind.Pack());
+
+		if (it == this->Binds.end())
+		{
+			return UINT32_MAX;
+		}
+
+		return it->second.Index;
+	}
+}
@@ -0,0 +1,75 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  IbIndex.h
+/// Description  :  Lookup from InputBind_t to the identifier using it.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IbBindV2.h"
+#include "IbMapping.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Input Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Input
+{
+	///----------------------------------------------------------------------------------------------------
+	/// CInputBindIndex Class
+	/// 	Maps packed InputBinds to dense identifier indices. Not threadsafe.
+	/// 	On duplicates the first identifier in registry order wins.
+	///----------------------------------------------------------------------------------------------------
+	class CInputBindIndex
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// GetIdentifier:
+		/// 	Returns the identifier of a dense index.
+		///----------------------------------------------------------------------------------------------------
+		const std::string& GetIdentifier(uint32_t aIndex) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Insert:
+		/// 	Adds the InputBind_t of an identifier, after it was added to the registry.
+		///----------------------------------------------------------------------------------------------------
+		void Insert(const std::string& aIdentifier, const InputBind_t& aInputBind);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Erase:
+		/// 	Removes the InputBind_t of an identifier, after it was changed or removed in the registry.
+		/// 	Only rescans the registry if another identifier uses the same InputBind_t.
+		///----------------------------------------------------------------------------------------------------
+		void Erase(const std::string& aIdentifier, const InputBind_t& aInputBind, const std::map<std::string, IbMapping_t>& aRegistry);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the dense index of the identifier using the InputBind_t or UINT32_MAX.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Find(const InputBind_t& aInputBind) const;
+
+		private:
+		struct Entry_t
+		{
+			uint32_t Index; /* Identifier that wins the InputBind_t. */
+			uint32_t Count; /* Identifiers using the InputBind_t.    */
+		};
+
+		std::unordered_map<uint64_t, Entry_t>     Binds;
+		std::unordered_map<std::string, uint32_t> IdentifierIndices;
+		std::vector<std::string>                  Identifiers;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Intern:
+		/// 	Returns the dense index of an identifier, assigning a new one if needed.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Intern(const std::string& aIdentifier);
+	};
+}
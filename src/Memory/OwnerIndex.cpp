@@ -0,0 +1,28 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  OwnerIndex.cpp
+/// Description  :  Reverse index from owning module to registry keys.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "OwnerIndex.h"
+
+#include <windows.h>
+
+namespace Raidcore::Nexus::Memory
+{
+	void* GetOwnerModule(void* aAddress)
+	{
+		if (aAddress == nullptr) { return nullptr; }
+
+		HMODULE module = nullptr;
+
+		if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCSTR)aAddress, &module))
+		{
+			return nullptr;
+		}
+
+		return module;
+	}
+}
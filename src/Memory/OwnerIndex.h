@@ -0,0 +1,147 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  OwnerIndex.h
+/// Description  :  Reverse index from owning module to registry keys.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Memory Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Memory
+{
+	///----------------------------------------------------------------------------------------------------
+	/// GetOwnerModule:
+	/// 	Returns the base address of the module containing the given address or nullptr.
+	///----------------------------------------------------------------------------------------------------
+	void* GetOwnerModule(void* aAddress);
+
+	///----------------------------------------------------------------------------------------------------
+	/// OwnerIndex Class
+	/// 	Maps module base addresses to the registry keys whose callbacks live in that module, so
+	/// 	cleaning up after a module only visits its own entries.
+	/// 	Entries may go stale when a key is re-registered, the registry has to verify every key
+	/// 	returned by Take. Not thread-safe, guarded by the lock of the owning registry.
+	///----------------------------------------------------------------------------------------------------
+	template <typename K>
+	class OwnerIndex
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Add:
+		/// 	Indexes a key by the module of the given address.
+		///----------------------------------------------------------------------------------------------------
+		void Add(void* aAddress, const K& aKey)
+		{
+			void* owner = GetOwnerModule(aAddress);
+
+			std::vector<Entry_t>& keys = this->Owners[owner];
+
+			auto it = std::find_if(keys.begin(), keys.end(), [&aKey](const Entry_t& aEntry)
+			{
+				return aEntry.Key == aKey;
+			});
+
+			if (it != keys.end())
+			{
+				it->Address = aAddress;
+				return;
+			}
+
+			keys.push_back(Entry_t{ aAddress, aKey });
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Remove:
+		/// 	Removes a key from the module of the given address.
+		///----------------------------------------------------------------------------------------------------
+		void Remove(void* aAddress, const K& aKey)
+		{
+			auto owner = this->Owners.find(GetOwnerModule(aAddress));
+
+			if (owner == this->Owners.end()) { return; }
+
+			std::vector<Entry_t>& keys = owner->second;
+
+			keys.erase(std::remove_if(keys.begin(), keys.end(), [&aKey](const Entry_t& aEntry)
+			{
+				return aEntry.Key == aKey;
+			}), keys.end());
+
+			if (keys.empty())
+			{
+				this->Owners.erase(owner);
+			}
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Take:
+		/// 	Removes and returns all keys of the module starting at aStartAddress.
+		/// 	Keys registered from outside any module are included, if their address is within range.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<K> Take(void* aStartAddress, void* aEndAddress)
+		{
+			std::vector<K> result;
+
+			auto owner = this->Owners.find(aStartAddress);
+
+			if (aStartAddress != nullptr && owner != this->Owners.end())
+			{
+				for (Entry_t& entry : owner->second)
+				{
+					result.push_back(std::move(entry.Key));
+				}
+
+				this->Owners.erase(owner);
+			}
+
+			auto unowned = this->Owners.find(nullptr);
+
+			if (unowned != this->Owners.end())
+			{
+				std::vector<Entry_t>& keys = unowned->second;
+
+				keys.erase(std::remove_if(keys.begin(), keys.end(), [&result, aStartAddress, aEndAddress](Entry_t& aEntry)
+				{
+					if (aEntry.Address >= aStartAddress && aEntry.Address <= aEndAddress)
+					{
+						result.push_back(std::move(aEntry.Key));
+						return true;
+					}
+					return false;
+				}), keys.end());
+			}
+
+			return result;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Clear:
+		/// 	Removes all keys.
+		///----------------------------------------------------------------------------------------------------
+		void Clear()
+		{
+			this->Owners.clear();
+		}
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Entry_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Entry_t
+		{
+			void* Address;
+			K     Key;
+		};
+
+		std::unordered_map<void*, std::vector<Entry_t>> Owners;
+	};
+}
@@ -8,7 +8,8 @@
 
 #include "RefCleanerContext.h"
 
-#include <map>
+#include <algorithm>
+#include <chrono>
 
 namespace Raidcore::Nexus::Memory
 {
@@ -51,34 +52,62 @@ namespace Raidcore::Nexus::Memory
 		}
 	}
 
-	std::string RefCleanerContext::CleanupRefs(void* aStartAddress, void* aEndAddress)
+	RefCleanupReport_t RefCleanerContext::CleanupRefs(void* aStartAddress, void* aEndAddress)
 	{
-		std::string result;
+		RefCleanupReport_t report{};
 
-		std::map<std::string, uint32_t> leftoverRefs;
+		auto start = std::chrono::high_resolution_clock::now();
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
 		for (const RefCleaner_t& entry : this->Registry)
 		{
-			leftoverRefs[entry.Name] += entry.Component->CleanupRefs(aStartAddress, aEndAddress);
+			auto componentStart = std::chrono::high_resolution_clock::now();
+			uint32_t count = entry.Component->CleanupRefs(aStartAddress, aEndAddress);
+			uint64_t elapsedUs = (std::chrono::high_resolution_clock::now() - componentStart) / std::chrono::microseconds(1);
+
+			auto it = std::find_if(report.Components.begin(), report.Components.end(), [&entry](const RefCleanupResult_t& aResult)
+			{
+				return aResult.Component == entry.Name;
+			});
+
+			if (it != report.Components.end())
+			{
+				it->Count += count;
+				it->ElapsedUs += elapsedUs;
+			}
+			else
+			{
+				report.Components.push_back(RefCleanupResult_t{ entry.Name, count, elapsedUs });
+			}
+
+			report.Total += count;
 		}
 
-		for (auto& [id, count] : leftoverRefs)
+		report.ElapsedUs = (std::chrono::high_resolution_clock::now() - start) / std::chrono::microseconds(1);
+
+		return report;
+	}
+
+	/*static*/ std::string RefCleanerContext::ToString(const RefCleanupReport_t& aReport)
+	{
+		std::string result;
+
+		for (const RefCleanupResult_t& component : aReport.Components)
 		{
 #ifndef _DEBUG
-			if (count == 0) { continue; }
+			if (component.Count == 0) { continue; }
 #endif
 			result.append("\t");
-			result.append(id);
+			result.append(component.Component);
 			result.append(": ");
-			result.append(std::to_string(count));
+			result.append(std::to_string(component.Count));
 			result.append("\n");
 		}
 
 		if (!result.empty())
 		{
-			result = "Cleaned leftover references for\n" + result;
+			result = "Cleaned leftover references (" + std::to_string(aReport.ElapsedUs) + "us) for\n" + result;
 		}
 
 		return result;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -19,6 +20,26 @@
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::Memory
 {
+	///----------------------------------------------------------------------------------------------------
+	/// RefCleanupResult_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct RefCleanupResult_t
+	{
+		std::string Component;
+		uint32_t    Count;     /* Removed references. */
+		uint64_t    ElapsedUs;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// RefCleanupReport_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct RefCleanupReport_t
+	{
+		std::vector<RefCleanupResult_t> Components; /* Per component name, in registration order. */
+		uint32_t                        Total;
+		uint64_t                        ElapsedUs;
+	};
+
 	///----------------------------------------------------------------------------------------------------
 	/// RefCleanerContext Class
 	///----------------------------------------------------------------------------------------------------
@@ -49,9 +70,16 @@ namespace Raidcore::Nexus::Memory
 		///----------------------------------------------------------------------------------------------------
 		/// CleanupRefs:
 		/// 	Removes any reference matching the provided address space.
-		/// 	Returns a message with the cleanup results.
+		/// 	aStartAddress is expected to be the base address of the module being unloaded.
+		/// 	Returns the cleanup results.
+		///----------------------------------------------------------------------------------------------------
+		RefCleanupReport_t CleanupRefs(void* aStartAddress, void* aEndAddress);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ToString:
+		/// 	Returns a message listing the components with removed references or an empty string.
 		///----------------------------------------------------------------------------------------------------
-		std::string CleanupRefs(void* aStartAddress, void* aEndAddress);
+		static std::string ToString(const RefCleanupReport_t& aReport);
 
 		private:
 		RefCleanerContext() = default;
@@ -0,0 +1,243 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResourceLedger.cpp
+/// Description  :  Per module accounting of resources held in the registries.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "ResourceLedger.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::Memory
+{
+	/* Owner of freed slots, never a module. */
+	static char s_Retired = 0;
+	static void* const RETIRED = &s_Retired;
+
+	/* Held by the host, not the module, and released later. */
+	static bool OutlivesModule(EResource aResource)
+	{
+		return aResource == EResource::Textures
+			|| aResource == EResource::TextureBytes
+			|| aResource == EResource::DataLinkBytes;
+	}
+
+	/*static*/ ResourceLedger* ResourceLedger::Get()
+	{
+		static ResourceLedger s_Ledger{};
+		return &s_Ledger;
+	}
+
+	void ResourceLedger::Add(void* aOwner, EResource aResource, int64_t aDelta)
+	{
+		if (aResource >= EResource::COUNT) { return; }
+
+		/* Nothing to release, if it was never accounted. */
+		Slot_t* slot = this->Find(aOwner, aDelta > 0);
+
+		if (!slot) { return; }
+
+		slot->Values[static_cast<uint32_t>(aResource)].fetch_add(aDelta, std::memory_order_relaxed);
+	}
+
+	void ResourceLedger::Set(void* aOwner, EResource aResource, int64_t aValue)
+	{
+		if (aResource >= EResource::COUNT) { return; }
+
+		Slot_t* slot = this->Find(aOwner, aValue != 0);
+
+		if (!slot) { return; }
+
+		slot->Values[static_cast<uint32_t>(aResource)].store(aValue, std::memory_order_relaxed);
+	}
+
+	uint32_t ResourceLedger::Retire(void* aStartAddress, void* aEndAddress)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		uint32_t retired = 0;
+		uint32_t count = this->SlotCount.load(std::memory_order_relaxed);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Slot_t& slot = this->Slots[i];
+
+			void* owner = slot.Owner.load(std::memory_order_relaxed);
+
+			if (owner == nullptr || owner == RETIRED) { continue; }
+			if (owner < aStartAddress || owner > aEndAddress) { continue; }
+
+			bool isEmpty = true;
+
+			for (uint32_t res = 0; res < static_cast<uint32_t>(EResource::COUNT); res++)
+			{
+				if (!OutlivesModule(static_cast<EResource>(res)))
+				{
+					slot.Values[res].store(0, std::memory_order_relaxed);
+				}
+				else if (slot.Values[res].load(std::memory_order_relaxed) != 0)
+				{
+					isEmpty = false;
+				}
+			}
+
+			/* Releases of an unknown owner are ignored, nothing can write to it anymore. */
+			if (isEmpty)
+			{
+				slot.Owner.store(RETIRED, std::memory_order_relaxed);
+			}
+
+			retired++;
+		}
+
+		return retired;
+	}
+
+	uint64_t ResourceLedger::GetDroppedCount() const
+	{
+		return this->Dropped.load(std::memory_order_relaxed);
+	}
+
+	std::vector<ResourceUsage_t> ResourceLedger::GetSnapshot() const
+	{
+		std::vector<ResourceUsage_t> usage;
+
+		uint32_t count = this->SlotCount.load(std::memory_order_acquire);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const Slot_t& slot = this->Slots[i];
+
+			ResourceUsage_t entry{};
+			entry.Owner = slot.Owner.load(std::memory_order_relaxed);
+
+			bool isEmpty = true;
+
+			for (uint32_t res = 0; res < static_cast<uint32_t>(EResource::COUNT); res++)
+			{
+				entry.Values[res] = slot.Values[res].load(std::memory_order_relaxed);
+
+				if (entry.Values[res] != 0)
+				{
+					isEmpty = false;
+				}
+			}
+
+			if (isEmpty) { continue; }
+
+			usage.push_back(entry);
+		}
+
+		return usage;
+	}
+
+	/*static*/ ResourceUsage_t ResourceLedger::Sum(const std::vector<ResourceUsage_t>& aUsage)
+	{
+		ResourceUsage_t total{};
+
+		for (const ResourceUsage_t& entry : aUsage)
+		{
+			for (uint32_t res = 0; res < static_cast<uint32_t>(EResource::COUNT); res++)
+			{
+				total.Values[res] += entry.Values[res];
+			}
+		}
+
+		return total;
+	}
+
+	/*static*/ void ResourceLedger::Sort(std::vector<ResourceUsage_t>& aUsage, EResource aResource, bool aIsDescending)
+	{
+		if (aResource >= EResource::COUNT) { return; }
+
+		std::sort(aUsage.begin(), aUsage.end(), [aResource, aIsDescending](const ResourceUsage_t& lhs, const ResourceUsage_t& rhs)
+		{
+			int64_t l = lhs.Get(aResource);
+			int64_t r = rhs.Get(aResource);
+
+			if (l != r)
+			{
+				return aIsDescending ? l > r : l < r;
+			}
+
+			return lhs.Owner < rhs.Owner;
+		});
+	}
+
+	/*static*/ const char* ResourceLedger::ToString(EResource aResource)
+	{
+		switch (aResource)
+		{
+			case EResource::Events:          return "Events";
+			case EResource::InputBinds:      return "Input Binds";
+			case EResource::RenderCallbacks: return "Render Callbacks";
+			case EResource::Textures:        return "Textures";
+			case EResource::TextureBytes:    return "Texture Memory";
+			case EResource::DataLinkBytes:   return "DataLink Memory";
+			case EResource::LogMessages:     return "Log Messages";
+			case EResource::LogBytes:        return "Log Size";
+			case EResource::HttpRequests:    return "HTTP Requests";
+			case EResource::LoadTimeUs:      return "Load Time";
+			case EResource::COUNT:           break;
+		}
+
+		return "Unknown";
+	}
+
+	ResourceLedger::Slot_t* ResourceLedger::Find(void* aOwner, bool aCreate)
+	{
+		uint32_t count = this->SlotCount.load(std::memory_order_acquire);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (this->Slots[i].Owner.load(std::memory_order_relaxed) == aOwner)
+			{
+				return &this->Slots[i];
+			}
+		}
+
+		if (!aCreate) { return nullptr; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		/* Claimed by another thread in the meantime, possibly a freed slot before the ones seen. */
+		uint32_t claimed = this->SlotCount.load(std::memory_order_relaxed);
+		Slot_t* retired = nullptr;
+
+		for (uint32_t i = 0; i < claimed; i++)
+		{
+			void* owner = this->Slots[i].Owner.load(std::memory_order_relaxed);
+
+			if (owner == aOwner)
+			{
+				return &this->Slots[i];
+			}
+
+			if (owner == RETIRED && !retired)
+			{
+				retired = &this->Slots[i];
+			}
+		}
+
+		/* Values were reset when it was freed. */
+		if (retired)
+		{
+			retired->Owner.store(aOwner, std::memory_order_relaxed);
+			return retired;
+		}
+
+		/* Out of slots, the usage is not accounted. */
+		if (claimed >= RESLEDGER_MAXOWNERS)
+		{
+			this->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		this->Slots[claimed].Owner.store(aOwner, std::memory_order_relaxed);
+		this->SlotCount.store(claimed + 1, std::memory_order_release);
+
+		return &this->Slots[claimed];
+	}
+}
@@ -0,0 +1,167 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResourceLedger.h
+/// Description  :  Per module accounting of resources held in the registries.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "OwnerIndex.h"
+
+constexpr const uint32_t RESLEDGER_MAXOWNERS = 256;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Memory Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Memory
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EResource Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EResource : uint32_t
+	{
+		Events,          /* Event subscriptions. */
+		InputBinds,      /* Registered input binds. */
+		RenderCallbacks, /* Registered render callbacks. */
+		Textures,        /* Resident textures. */
+		TextureBytes,    /* Estimated video memory of resident textures. */
+		DataLinkBytes,   /* Shared memory allocated through DataLink. */
+		LogMessages,     /* Logged messages, cumulative. */
+		LogBytes,        /* Logged characters, cumulative. */
+		HttpRequests,    /* Requests made on behalf of the module, cumulative. */
+		LoadTimeUs,      /* Duration of the last load. */
+		COUNT
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// ResourceUsage_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct ResourceUsage_t
+	{
+		void*   Owner;                                          /* Module base, nullptr if not attributable to a module. */
+		int64_t Values[static_cast<uint32_t>(EResource::COUNT)];
+
+		///----------------------------------------------------------------------------------------------------
+		/// Get:
+		/// 	Returns the value of the given resource.
+		///----------------------------------------------------------------------------------------------------
+		inline int64_t Get(EResource aResource) const
+		{
+			return this->Values[static_cast<uint32_t>(aResource)];
+		}
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// ResourceLedger Class
+	/// 	Registries report what they hold per owning module. Owners are assigned a fixed slot on first
+	/// 	use and keep it, so writers and snapshots never take a lock. Only claiming a slot does.
+	/// 	On unload only textures and shared memory are kept, they outlive the module that requested them.
+	/// 	Slots left empty are freed for other modules.
+	///----------------------------------------------------------------------------------------------------
+	class ResourceLedger
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// Get:
+		/// 	Returns the resource ledger.
+		///----------------------------------------------------------------------------------------------------
+		static ResourceLedger* Get();
+
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		ResourceLedger() = default;
+
+		ResourceLedger(ResourceLedger const&) = delete;
+		void operator=(ResourceLedger const&) = delete;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Add:
+		/// 	Adds to a resource of the owner. Negative to release.
+		///----------------------------------------------------------------------------------------------------
+		void Add(void* aOwner, EResource aResource, int64_t aDelta);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Set:
+		/// 	Sets a resource of the owner.
+		///----------------------------------------------------------------------------------------------------
+		void Set(void* aOwner, EResource aResource, int64_t aValue);
+
+		///----------------------------------------------------------------------------------------------------
+		/// AddByAddress:
+		/// 	Adds to a resource of the module containing the address.
+		///----------------------------------------------------------------------------------------------------
+		inline void AddByAddress(void* aAddress, EResource aResource, int64_t aDelta)
+		{
+			this->Add(GetOwnerModule(aAddress), aResource, aDelta);
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Retire:
+		/// 	Resets the usage of the modules within the range, except what outlives them.
+		/// 	Called with the range of RefCleanerContext::CleanupRefs, after the registries cleaned up.
+		/// 	Returns the number of reset owners.
+		///----------------------------------------------------------------------------------------------------
+		uint32_t Retire(void* aStartAddress, void* aEndAddress);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetDroppedCount:
+		/// 	Returns the number of updates that were not accounted, because all slots were taken.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetDroppedCount() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetSnapshot:
+		/// 	Returns the usage of all owners with any resource. Lock-free, counters of one owner may be
+		/// 	torn across a concurrent update, but each is consistent on its own.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<ResourceUsage_t> GetSnapshot() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Sum:
+		/// 	Returns the total of all owners. The owner of the result is nullptr.
+		///----------------------------------------------------------------------------------------------------
+		static ResourceUsage_t Sum(const std::vector<ResourceUsage_t>& aUsage);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Sort:
+		/// 	Sorts by the given resource. Ties are ordered by owner, so the order is stable across frames.
+		///----------------------------------------------------------------------------------------------------
+		static void Sort(std::vector<ResourceUsage_t>& aUsage, EResource aResource, bool aIsDescending);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ToString:
+		/// 	Returns the name of the resource.
+		///----------------------------------------------------------------------------------------------------
+		static const char* ToString(EResource aResource);
+
+		private:
+		///----------------------------------------------------------------------------------------------------
+		/// Slot_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct Slot_t
+		{
+			std::atomic<void*>   Owner;
+			std::atomic<int64_t> Values[static_cast<uint32_t>(EResource::COUNT)];
+		};
+
+		std::mutex            Mutex;
+		Slot_t                Slots[RESLEDGER_MAXOWNERS]{};
+		std::atomic<uint32_t> SlotCount = 0;
+		std::atomic<uint64_t> Dropped   = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Find:
+		/// 	Returns the slot of the owner. Claims one, if requested and the owner has none yet.
+		/// 	Freed slots are claimed before new ones. Returns nullptr, if there is none and no slot is left.
+		///----------------------------------------------------------------------------------------------------
+		Slot_t* Find(void* aOwner, bool aCreate);
+	};
+}
@@ -0,0 +1,146 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UpdDelta.cpp
+/// Description  :  Binary delta patches between two builds.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "UpdDelta.h"
+
+#include <cstring>
+
+namespace Raidcore::Nexus::Network
+{
+	///----------------------------------------------------------------------------------------------------
+	/// ReadU32:
+	/// 	Reads a little endian integer and advances the offset. Returns false if truncated.
+	///----------------------------------------------------------------------------------------------------
+	static bool ReadU32(const uint8_t* aData, size_t aSize, size_t& aOffset, uint32_t& aOutValue)
+	{
+		if (aSize - aOffset < sizeof(uint32_t)) { return false; }
+
+		aOutValue = static_cast<uint32_t>(aData[aOffset])
+			| static_cast<uint32_t>(aData[aOffset + 1]) << 8
+			| static_cast<uint32_t>(aData[aOffset + 2]) << 16
+			| static_cast<uint32_t>(aData[aOffset + 3]) << 24;
+
+		aOffset += sizeof(uint32_t);
+		return true;
+	}
+
+	bool DeltaPatch::ReadHeader(const uint8_t* aPatch, size_t aPatchSize, DeltaHeader_t& aOutHeader)
+	{
+		if (!aPatch || aPatchSize < sizeof(DeltaHeader_t)) { return false; }
+
+		memcpy(&aOutHeader, aPatch, sizeof(DeltaHeader_t));
+
+		return aOutHeader.Magic == DELTAPATCH_MAGIC && aOutHeader.Version == DELTAPATCH_VERSION;
+	}
+
+	EDeltaResult DeltaPatch::Apply(
+		const uint8_t*        aSource,
+		size_t                aSourceSize,
+		const uint8_t*        aPatch,
+		size_t                aPatchSize,
+		std::vector<uint8_t>& aOutTarget
+	)
+	{
+		aOutTarget.clear();
+
+		DeltaHeader_t header{};
+
+		if (!DeltaPatch::ReadHeader(aPatch, aPatchSize, header)) { return EDeltaResult::InvalidHeader; }
+		if (header.SourceSize != aSourceSize)                    { return EDeltaResult::SourceMismatch; }
+		if (header.TargetSize > DELTAPATCH_MAXSIZE)              { return EDeltaResult::TargetTooLarge; }
+
+		aOutTarget.reserve(static_cast<size_t>(header.TargetSize));
+
+		size_t offset = sizeof(DeltaHeader_t);
+
+		while (offset < aPatchSize)
+		{
+			EDeltaOp op = static_cast<EDeltaOp>(aPatch[offset++]);
+
+			uint32_t srcOffset = 0;
+			uint32_t length = 0;
+
+			switch (op)
+			{
+				case EDeltaOp::Copy:
+				case EDeltaOp::Add:
+				{
+					if (!ReadU32(aPatch, aPatchSize, offset, srcOffset)) { return EDeltaResult::Truncated; }
+					if (!ReadU32(aPatch, aPatchSize, offset, length))    { return EDeltaResult::Truncated; }
+
+					if (srcOffset > aSourceSize || length > aSourceSize - srcOffset)
+					{
+						return EDeltaResult::OutOfRange;
+					}
+
+					break;
+				}
+				case EDeltaOp::Insert:
+				{
+					if (!ReadU32(aPatch, aPatchSize, offset, length)) { return EDeltaResult::Truncated; }
+					break;
+				}
+				default:
+				{
+					return EDeltaResult::InvalidOp;
+				}
+			}
+
+			/* Checked before writing, so a broken patch cannot grow the output unbounded. */
+			if (length > header.TargetSize - aOutTarget.size()) { return EDeltaResult::OutOfRange; }
+
+			if (op != EDeltaOp::Copy && length > aPatchSize - offset) { return EDeltaResult::Truncated; }
+
+			switch (op)
+			{
+				case EDeltaOp::Copy:
+				{
+					aOutTarget.insert(aOutTarget.end(), aSource + srcOffset, aSource + srcOffset + length);
+					break;
+				}
+				case EDeltaOp::Insert:
+				{
+					aOutTarget.insert(aOutTarget.end(), aPatch + offset, aPatch + offset + length);
+					offset += length;
+					break;
+				}
+				case EDeltaOp::Add:
+				{
+					/* Shifted code mostly differs in relocated addresses, which leaves small deltas. */
+					for (uint32_t i = 0; i < length; i++)
+					{
+						aOutTarget.push_back(static_cast<uint8_t>(aSource[srcOffset + i] + aPatch[offset + i]));
+					}
+					offset += length;
+					break;
+				}
+			}
+		}
+
+		if (aOutTarget.size() != header.TargetSize) { return EDeltaResult::TargetMismatch; }
+
+		return EDeltaResult::Success;
+	}
+
+	const char* DeltaPatch::ToString(EDeltaResult aResult)
+	{
+		switch (aResult)
+		{
+			case EDeltaResult::Success:        return "Success";
+			case EDeltaResult::InvalidHeader:  return "Invalid header";
+			case EDeltaResult::SourceMismatch: return "Source size mismatch";
+			case EDeltaResult::InvalidOp:      return "Invalid instruction";
+			case EDeltaResult::Truncated:      return "Truncated";
+			case EDeltaResult::OutOfRange:     return "Out of range";
+			case EDeltaResult::TargetMismatch: return "Target size mismatch";
+			case EDeltaResult::TargetTooLarge: return "Target too large";
+		}
+
+		return "Unknown";
+	}
+}
@@ -0,0 +1,94 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UpdDelta.h
+/// Description  :  Binary delta patches between two builds.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr const uint32_t DELTAPATCH_MAGIC   = 0x5450584E; /* NXPT */
+constexpr const uint32_t DELTAPATCH_VERSION = 1;
+constexpr const uint64_t DELTAPATCH_MAXSIZE = 64ull * 1024 * 1024; /* Largest accepted target, far above any build. */
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Network Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Network
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EDeltaOp Enumeration
+	/// 	Opcode of an instruction following the header. All integers are little endian.
+	///----------------------------------------------------------------------------------------------------
+	enum class EDeltaOp : uint8_t
+	{
+		Copy   = 1, /* uint32 SourceOffset, uint32 Length: Copies a range of the source. */
+		Insert = 2, /* uint32 Length, uint8[Length]: Appends the literal bytes. */
+		Add    = 3  /* uint32 SourceOffset, uint32 Length, uint8[Length]: Appends source + delta bytewise. */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// EDeltaResult Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EDeltaResult : uint32_t
+	{
+		Success,
+		InvalidHeader,
+		SourceMismatch,
+		InvalidOp,
+		Truncated,
+		OutOfRange,
+		TargetMismatch,
+		TargetTooLarge
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// DeltaHeader_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct DeltaHeader_t
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint64_t SourceSize;
+		uint64_t TargetSize;
+		uint8_t  SourceMD5[16];
+		uint8_t  TargetMD5[16];
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// DeltaPatch Namespace
+	///----------------------------------------------------------------------------------------------------
+	namespace DeltaPatch
+	{
+		///----------------------------------------------------------------------------------------------------
+		/// ReadHeader:
+		/// 	Returns true if the patch starts with a header of a compatible version.
+		///----------------------------------------------------------------------------------------------------
+		bool ReadHeader(const uint8_t* aPatch, size_t aPatchSize, DeltaHeader_t& aOutHeader);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Apply:
+		/// 	Rebuilds the target from the source. Every instruction is bounds checked and the output
+		/// 	must match the target size of the header. Hashes are left to the caller.
+		/// 	Targets above DELTAPATCH_MAXSIZE are rejected before any allocation.
+		///----------------------------------------------------------------------------------------------------
+		EDeltaResult Apply(
+			const uint8_t*        aSource,
+			size_t                aSourceSize,
+			const uint8_t*        aPatch,
+			size_t                aPatchSize,
+			std::vector<uint8_t>& aOutTarget
+		);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ToString:
+		/// 	Returns a description of the result.
+		///----------------------------------------------------------------------------------------------------
+		const char* ToString(EDeltaResult aResult);
+	}
+}
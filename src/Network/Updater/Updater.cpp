@@ -8,11 +8,18 @@
 
 #include "Updater.h"
 
+#include <fstream>
+#include <vector>
+
 #include "Runtime/Runtime.h"
 using namespace Raidcore::Nexus;
 
+#include "Host/Loader/LdrChecksum.h"
 #include "Index/Index.h"
+#include "UpdDelta.h"
+#include "Util/MD5.h"
 #include "Util/Paths.h"
+#include "Util/Strings.h"
 
 namespace Raidcore::Nexus::Network
 {
@@ -92,6 +99,22 @@ namespace Raidcore::Nexus::Network
 			versionJSON["Changelog"].get_to(this->Changelog);
 		}
 
+		/* Optional, the update is only verified and patched if the hash is known. */
+		if (versionJSON["MD5"].is_string())
+		{
+			this->RemoteMD5 = String::ToLower(versionJSON["MD5"].get<std::string>());
+		}
+
+		if (versionJSON["Patches"].is_object())
+		{
+			for (const auto& [sourceMD5, endpoint] : versionJSON["Patches"].items())
+			{
+				if (!endpoint.is_string()) { continue; }
+
+				this->Patches[String::ToLower(sourceMD5)] = endpoint.get<std::string>();
+			}
+		}
+
 		return this->RemoteVersion;
 	}
 
@@ -215,6 +238,117 @@ namespace Raidcore::Nexus::Network
 		return false;
 	}
 
+	bool Updater::PatchUpdate()
+	{
+		if (this->RemoteMD5.empty() || this->Patches.empty()) { return false; }
+
+		std::ifstream file(Index(EPath::NexusDLL), std::ios::binary | std::ios::ate);
+
+		if (!file) { return false; }
+
+		std::vector<uint8_t> source(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+
+		if (!file.read(reinterpret_cast<char*>(source.data()), source.size())) { return false; }
+
+		file.close();
+
+		Host::MD5_t installedMD5 = MD5Util::FromFile(Index(EPath::NexusDLL));
+
+		auto it = this->Patches.find(installedMD5.string());
+
+		if (it == this->Patches.end())
+		{
+			this->Logger.Debug(LOG_CHANNEL, "No delta patch for the installed build.");
+			return false;
+		}
+
+		CHttpClient& raidcoreapi = Runtime::Get().HttpClientStorage().GetHttpClient("https://api.raidcore.gg");
+
+		/* Bypass cache, patches are only needed once. */
+		HttpResponse_t result = raidcoreapi.Get(it->second, "", 0);
+
+		if (!result.Success())
+		{
+			this->Logger.Warning(
+				LOG_CHANNEL,
+				"Failed to download Nexus delta patch.\n\tStatus: %s\n\tError: %s",
+				result.Status().empty() ? "(null)" : result.Status().c_str(),
+				result.Error.c_str()
+			);
+			return false;
+		}
+
+		const uint8_t* patch = reinterpret_cast<const uint8_t*>(result.Content.data());
+
+		DeltaHeader_t header{};
+
+		if (!DeltaPatch::ReadHeader(patch, result.Content.size(), header))
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Discarded Nexus delta patch: Invalid header.");
+			return false;
+		}
+
+		Host::MD5_t patchSourceMD5 = std::vector<uint8_t>(header.SourceMD5, header.SourceMD5 + MD5_LENGTH);
+		Host::MD5_t patchTargetMD5 = std::vector<uint8_t>(header.TargetMD5, header.TargetMD5 + MD5_LENGTH);
+
+		if (patchSourceMD5 != installedMD5 || patchTargetMD5.string() != this->RemoteMD5)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Discarded Nexus delta patch: Built for a different version.");
+			return false;
+		}
+
+		std::vector<uint8_t> target;
+		EDeltaResult applyResult = DeltaPatch::Apply(source.data(), source.size(), patch, result.Content.size(), target);
+
+		if (applyResult != EDeltaResult::Success)
+		{
+			this->Logger.Warning(LOG_CHANNEL, "Discarded Nexus delta patch: %s", DeltaPatch::ToString(applyResult));
+			return false;
+		}
+
+		std::error_code ec;
+
+		{
+			std::ofstream out(Index(EPath::NexusDLL_Update), std::ios::binary | std::ios::trunc);
+			out.write(reinterpret_cast<const char*>(target.data()), target.size());
+
+			if (!out)
+			{
+				out.close();
+				std::filesystem::remove(Index(EPath::NexusDLL_Update), ec);
+				this->Logger.Warning(LOG_CHANNEL, "Failed writing \"%s\".", Index(EPath::NexusDLL_Update).string().c_str());
+				return false;
+			}
+		}
+
+		if (!this->VerifyUpdate())
+		{
+			std::filesystem::remove(Index(EPath::NexusDLL_Update), ec);
+			this->Logger.Warning(LOG_CHANNEL, "Discarded Nexus delta patch: Result does not match the remote hash.");
+			return false;
+		}
+
+		this->Logger.Info(
+			LOG_CHANNEL,
+			"Applied Nexus delta patch. Downloaded %llu bytes instead of %llu. (Saved %.1f%%)",
+			static_cast<unsigned long long>(result.Content.size()),
+			static_cast<unsigned long long>(target.size()),
+			target.empty() ? 0.0 : 100.0 * (1.0 - static_cast<double>(result.Content.size()) / static_cast<double>(target.size()))
+		);
+
+		return true;
+	}
+
+	bool Updater::VerifyUpdate()
+	{
+		if (this->RemoteMD5.empty()) { return true; }
+
+		Host::MD5_t md5 = MD5Util::FromFile(Index(EPath::NexusDLL_Update));
+
+		return md5.string() == this->RemoteMD5;
+	}
+
 	void Updater::Run()
 	{
 		Runtime& ctx = Runtime::Get();
@@ -243,8 +377,24 @@ namespace Raidcore::Nexus::Network
 				this->RemoteVersion.string().c_str()
 			);
 
-			/* Downloads the update to d3d11.dll.update. */
-			this->DownloadUpdate();
+			/* Patches or downloads the update to d3d11.dll.update. */
+			if (!this->PatchUpdate())
+			{
+				if (!this->DownloadUpdate())
+				{
+					this->Logger.Warning(LOG_CHANNEL, "Nexus update failed: Download failed.");
+					return;
+				}
+
+				if (!this->VerifyUpdate())
+				{
+					std::error_code ec;
+					std::filesystem::remove(Index(EPath::NexusDLL_Update), ec);
+
+					this->Logger.Warning(LOG_CHANNEL, "Nexus update failed: Download does not match the remote hash.");
+					return;
+				}
+			}
 
 			/* Try renaming .dll to .dll.old. */
 			try
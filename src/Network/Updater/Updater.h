@@ -10,6 +10,7 @@
 
 #include <thread>
 #include <string>
+#include <unordered_map>
 #include <windows.h>
 
 #include "Core/Versioning/Version.h"
@@ -62,6 +63,10 @@ namespace Raidcore::Nexus::Network
 
 		Version_t     RemoteVersion{};
 		std::string   Changelog{};
+		std::string   RemoteMD5{};
+
+		/* Delta patch endpoints, keyed by the MD5 of the build they apply to. */
+		std::unordered_map<std::string, std::string> Patches{};
 
 		///----------------------------------------------------------------------------------------------------
 		/// CreatePatchMutex:
@@ -83,6 +88,19 @@ namespace Raidcore::Nexus::Network
 		///----------------------------------------------------------------------------------------------------
 		bool DownloadUpdate();
 
+		///----------------------------------------------------------------------------------------------------
+		/// PatchUpdate:
+		/// 	Returns true if a delta patch from the installed build was applied to d3d11.dll.update.
+		/// 	Any failure leaves no update file behind, so the full download can be used instead.
+		///----------------------------------------------------------------------------------------------------
+		bool PatchUpdate();
+
+		///----------------------------------------------------------------------------------------------------
+		/// VerifyUpdate:
+		/// 	Returns true if d3d11.dll.update matches the remote hash, or none was provided.
+		///----------------------------------------------------------------------------------------------------
+		bool VerifyUpdate();
+
 		///----------------------------------------------------------------------------------------------------
 		/// Runs:
 		/// 	Checks if an update is available and installs it.
@@ -8,6 +8,8 @@
 
 #include "WreClient.h"
 
+#include <chrono>
+
 #include "Core/Logging/LogApi.h"
 #include "Util/URL.h"
 #include "Util/Time.h"
@@ -77,7 +79,22 @@ namespace Raidcore::Nexus::Network
 		HttpResponse_t result{};
 		result.Time = Time::GetTimestamp();
 
-		httplib::Result getResult = this->Client->Get(query);
+		httplib::Result getResult;
+
+		if (this->Deadline > 0)
+		{
+			std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(this->Deadline);
+
+			/* Checked with every received chunk, returning false cancels the request. */
+			getResult = this->Client->Get(query, [deadline](uint64_t aCurrent, uint64_t aTotal)
+			{
+				return std::chrono::steady_clock::now() < deadline;
+			});
+		}
+		else
+		{
+			getResult = this->Client->Get(query);
+		}
 
 		if (getResult.error() != httplib::Error::Success)
 		{
@@ -190,6 +207,21 @@ namespace Raidcore::Nexus::Network
 		return result;
 	}
 
+	void CHttpClient::SetTimeout(uint32_t aSeconds)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Client->set_connection_timeout(aSeconds, 0);
+		this->Client->set_read_timeout(aSeconds, 0);
+	}
+
+	void CHttpClient::SetDeadline(uint32_t aSeconds)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		this->Deadline = aSeconds;
+	}
+
 	void CHttpClient::DownloadCleanup(const std::filesystem::path& aOutPath, const std::string& aQuery)
 	{
 		this->Logger->Warning(
@@ -64,12 +64,26 @@ namespace Raidcore::Nexus::Network
 		///----------------------------------------------------------------------------------------------------
 		HttpResponse_t Download(std::filesystem::path aOutPath, std::string aEndpoint, std::string aParameters = "");
 
+		///----------------------------------------------------------------------------------------------------
+		/// SetTimeout:
+		/// 	Sets the connection and read timeout in seconds.
+		///----------------------------------------------------------------------------------------------------
+		void SetTimeout(uint32_t aSeconds);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetDeadline:
+		/// 	Sets the time in seconds a Get may take in total, 0 means no limit.
+		/// 	Unlike the read timeout, this also cancels hosts that keep sending slowly.
+		///----------------------------------------------------------------------------------------------------
+		void SetDeadline(uint32_t aSeconds);
+
 		private:
 		Core::LogApi* Logger = nullptr;
 
 		std::string      BaseURL;
 		std::mutex       Mutex{};
 		httplib::Client* Client = nullptr;
+		uint32_t         Deadline = 0;
 
 		CHttpCache* Cache = nullptr;
 
@@ -0,0 +1,172 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CrashCapture.cpp
+/// Description  :  Raw crash record, written by the crash handler and symbolized later.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "CrashCapture.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace Raidcore::Nexus::Platform::CrashCapture
+{
+	/* Order in which the handler stores the registers. */
+	constexpr const char* REGISTERS_AMD64[] = {
+		"RIP", "RSP", "RBP", "RAX", "RBX", "RCX", "RDX", "RSI", "RDI",
+		"R8", "R9", "R10", "R11", "R12", "R13", "R14", "R15"
+	};
+	constexpr const char* REGISTERS_I386[] = {
+		"EIP", "ESP", "EBP", "EAX", "EBX", "ECX", "EDX", "ESI", "EDI"
+	};
+
+	bool IsValid(const CrashCapture_t& aCapture)
+	{
+		if (aCapture.Magic != CRASHCAPTURE_MAGIC)                { return false; }
+		if (aCapture.Version != CRASHCAPTURE_VERSION)            { return false; }
+		if (aCapture.RegisterCount > CRASHCAPTURE_MAXREGISTERS)  { return false; }
+		if (aCapture.FrameCount > CRASHCAPTURE_MAXFRAMES)        { return false; }
+		if (aCapture.ModuleCount > CRASHCAPTURE_MAXMODULES)      { return false; }
+
+		for (uint32_t i = 0; i < aCapture.ModuleCount; i++)
+		{
+			/* Paths must be terminated, they are read as strings. */
+			if (memchr(aCapture.Modules[i].Path, 0, sizeof(aCapture.Modules[i].Path)) == nullptr) { return false; }
+		}
+
+		return true;
+	}
+
+	const CrashModule_t* FindModule(const CrashCapture_t& aCapture, uint64_t aAddress)
+	{
+		for (uint32_t i = 0; i < aCapture.ModuleCount && i < CRASHCAPTURE_MAXMODULES; i++)
+		{
+			const CrashModule_t& mod = aCapture.Modules[i];
+
+			if (aAddress >= mod.Base && aAddress - mod.Base < mod.Size)
+			{
+				return &mod;
+			}
+		}
+
+		return nullptr;
+	}
+
+	const char* GetRegisterName(uint32_t aMachine, uint32_t aIndex)
+	{
+		switch (aMachine)
+		{
+			case CRASHCAPTURE_MACHINE_AMD64:
+			{
+				return aIndex < sizeof(REGISTERS_AMD64) / sizeof(REGISTERS_AMD64[0]) ? REGISTERS_AMD64[aIndex] : nullptr;
+			}
+			case CRASHCAPTURE_MACHINE_I386:
+			{
+				return aIndex < sizeof(REGISTERS_I386) / sizeof(REGISTERS_I386[0]) ? REGISTERS_I386[aIndex] : nullptr;
+			}
+		}
+
+		return nullptr;
+	}
+
+	const char* GetFileName(const CrashModule_t& aModule)
+	{
+		const char* name = aModule.Path;
+
+		for (const char* p = aModule.Path; *p; p++)
+		{
+			if (*p == '\\' || *p == '/')
+			{
+				name = p + 1;
+			}
+		}
+
+		return name;
+	}
+
+	bool Read(const std::filesystem::path& aPath, CrashCapture_t& aOutCapture)
+	{
+		std::ifstream file(aPath, std::ios::binary);
+
+		if (!file) { return false; }
+
+		file.read(reinterpret_cast<char*>(&aOutCapture), sizeof(aOutCapture));
+
+		return file.gcount() == sizeof(aOutCapture) && IsValid(aOutCapture);
+	}
+
+	void WriteLog(const CrashCapture_t& aCapture, const CRASHCAPTURE_RESOLVE& aResolve, std::ostream& aLog, std::ostream& aStack)
+	{
+		char buffer[0x1000]{};
+
+		aLog << "========================\n";
+		snprintf(buffer, sizeof(buffer), "Exception: 0x%X%s\n", aCapture.ExceptionCode, aCapture.IsFirstChance ? " (First chance)" : "");
+		aLog << buffer;
+		aLog << "========================\n";
+		aLog << "Stack Trace:\n";
+		aLog << "========================\n";
+
+		for (uint32_t i = 0; i < aCapture.FrameCount && i < CRASHCAPTURE_MAXFRAMES; i++)
+		{
+			uint64_t address = aCapture.Frames[i];
+			const CrashModule_t* mod = FindModule(aCapture, address);
+
+			CrashSymbol_t symbol{ {}, {}, UINT32_MAX };
+
+			if (aResolve)
+			{
+				aResolve(address, symbol);
+			}
+
+			if (symbol.Function.empty())
+			{
+				snprintf(buffer, sizeof(buffer), "0x%llX", static_cast<unsigned long long>(mod ? address - mod->Base : address));
+				symbol.Function = buffer;
+			}
+
+			if (symbol.File.empty())
+			{
+				symbol.File = mod ? mod->Path : "(unknown)";
+			}
+
+			aLog << symbol.File << "@" << symbol.Function;
+
+			if (symbol.Line != UINT32_MAX)
+			{
+				aLog << " on line " << symbol.Line;
+			}
+
+			aLog << "\n";
+
+			/* Read by the loader, to tell which addon to disable next. */
+			aStack << (mod ? mod->Path : "") << "\n";
+		}
+
+		aLog << "========================\n";
+		aLog << "Registers:\n";
+		aLog << "========================\n";
+
+		for (uint32_t i = 0; i < aCapture.RegisterCount && i < CRASHCAPTURE_MAXREGISTERS; i++)
+		{
+			const char* name = GetRegisterName(aCapture.Machine, i);
+			snprintf(buffer, sizeof(buffer), "%s: 0x%016llX\n", name ? name : "?", static_cast<unsigned long long>(aCapture.Registers[i]));
+			aLog << buffer;
+		}
+
+		aLog << "========================\n";
+		aLog << "Modules:\n";
+		aLog << "========================\n";
+
+		for (uint32_t i = 0; i < aCapture.ModuleCount && i < CRASHCAPTURE_MAXMODULES; i++)
+		{
+			const CrashModule_t& mod = aCapture.Modules[i];
+			snprintf(buffer, sizeof(buffer), "0x%016llX %08X %s\n", static_cast<unsigned long long>(mod.Base), mod.TimeDateStamp, mod.Path);
+			aLog << buffer;
+		}
+
+		aLog << "========================\n";
+	}
+}
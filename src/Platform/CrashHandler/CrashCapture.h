@@ -0,0 +1,124 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CrashCapture.h
+/// Description  :  Raw crash record, written by the crash handler and symbolized later.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <string>
+
+constexpr const uint32_t CRASHCAPTURE_MAGIC        = 0x52435850; /* PXCR */
+constexpr const uint32_t CRASHCAPTURE_VERSION      = 1;
+constexpr const uint32_t CRASHCAPTURE_MAXFRAMES    = 64;
+constexpr const uint32_t CRASHCAPTURE_MAXMODULES   = 32;
+constexpr const uint32_t CRASHCAPTURE_MAXREGISTERS = 17;
+constexpr const uint32_t CRASHCAPTURE_MAXPATH      = 260;
+
+constexpr const uint32_t CRASHCAPTURE_MACHINE_I386  = 0x014C;
+constexpr const uint32_t CRASHCAPTURE_MACHINE_AMD64 = 0x8664;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Platform Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Platform
+{
+	///----------------------------------------------------------------------------------------------------
+	/// CrashModule_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct CrashModule_t
+	{
+		uint64_t Base;
+		uint32_t Size;
+		uint32_t TimeDateStamp;
+		char     Path[CRASHCAPTURE_MAXPATH]; /* UTF-8 */
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// CrashCapture_t Struct
+	/// 	Plain data only, written to disk as is.
+	///----------------------------------------------------------------------------------------------------
+	struct CrashCapture_t
+	{
+		uint32_t      Magic;
+		uint32_t      Version;
+		uint32_t      Machine;
+		uint32_t      ExceptionCode;
+		uint64_t      ExceptionAddress;
+		uint32_t      ThreadId;
+		uint32_t      IsFirstChance;
+		uint64_t      Timestamp;     /* Seconds since epoch. */
+
+		uint32_t      RegisterCount;
+		uint64_t      Registers[CRASHCAPTURE_MAXREGISTERS];
+
+		uint32_t      FrameCount;
+		uint64_t      Frames[CRASHCAPTURE_MAXFRAMES];
+
+		uint32_t      ModuleCount;
+		CrashModule_t Modules[CRASHCAPTURE_MAXMODULES];
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// CrashSymbol_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct CrashSymbol_t
+	{
+		std::string Function; /* Empty if unknown. */
+		std::string File;     /* Source file, empty if unknown. */
+		uint32_t    Line;     /* UINT32_MAX if unknown. */
+	};
+
+	/* Fills in what is known about the given address. */
+	typedef std::function<void(uint64_t aAddress, CrashSymbol_t& aSymbol)> CRASHCAPTURE_RESOLVE;
+
+	///----------------------------------------------------------------------------------------------------
+	/// CrashCapture Namespace
+	///----------------------------------------------------------------------------------------------------
+	namespace CrashCapture
+	{
+		///----------------------------------------------------------------------------------------------------
+		/// IsValid:
+		/// 	Returns true if the capture was fully written by a compatible version.
+		///----------------------------------------------------------------------------------------------------
+		bool IsValid(const CrashCapture_t& aCapture);
+
+		///----------------------------------------------------------------------------------------------------
+		/// FindModule:
+		/// 	Returns the module containing the given address or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const CrashModule_t* FindModule(const CrashCapture_t& aCapture, uint64_t aAddress);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRegisterName:
+		/// 	Returns the name of a captured register or nullptr.
+		///----------------------------------------------------------------------------------------------------
+		const char* GetRegisterName(uint32_t aMachine, uint32_t aIndex);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetFileName:
+		/// 	Returns the file name part of a module path.
+		///----------------------------------------------------------------------------------------------------
+		const char* GetFileName(const CrashModule_t& aModule);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Read:
+		/// 	Reads a capture from disk.
+		/// 	Returns false, if it is missing, truncated or invalid.
+		///----------------------------------------------------------------------------------------------------
+		bool Read(const std::filesystem::path& aPath, CrashCapture_t& aOutCapture);
+
+		///----------------------------------------------------------------------------------------------------
+		/// WriteLog:
+		/// 	Writes the crash log and the crash stack, one module path per frame, of a capture.
+		/// 	Frames without a resolved symbol are written as module offsets.
+		///----------------------------------------------------------------------------------------------------
+		void WriteLog(const CrashCapture_t& aCapture, const CRASHCAPTURE_RESOLVE& aResolve, std::ostream& aLog, std::ostream& aStack);
+	}
+}
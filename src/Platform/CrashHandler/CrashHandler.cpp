@@ -2,7 +2,7 @@
 /// Copyright (c) Raidcore.GG - All rights reserved.
 ///
 /// Name         :  CrashHandler.cpp
-/// Description  :  Unhandled exception crash logger.
+/// Description  :  Unhandled exception crash capture.
 /// Authors      :  K. Bieniek
 ///----------------------------------------------------------------------------------------------------
 
@@ -10,63 +10,60 @@
 
 #include <dbghelp.h>
 #include <errhandlingapi.h>
+#include <winternl.h>
 
 namespace Raidcore::Nexus::Platform
 {
 	static CrashHandler* s_CrashHandler{};
 
 	///----------------------------------------------------------------------------------------------------
-	/// WriteToFile:
-	/// 	Helper function to log to the specified file.
+	/// IsFatal:
+	/// 	Returns true if the exception code is a fault, rather than a signal.
 	///----------------------------------------------------------------------------------------------------
-	void WriteToFile(HANDLE aFileHandle, const char* aFmt, ...)
+	static bool IsFatal(DWORD aExceptionCode)
 	{
-		char buffer[0x1000]{};
-		char* p = &buffer[0];
-
-		va_list args;
-		va_start(args, aFmt);
-		vsnprintf(p, sizeof(buffer), aFmt, args);
-		::WriteFile(aFileHandle, p, static_cast<DWORD>(strlen(p)), nullptr, nullptr);
-		va_end(args);
-	}
-
-	CrashHandler::CrashHandler(std::filesystem::path aCrashLogPath, std::filesystem::path aCrashStackPath)
-	{
-		::GetSystemInfo(&this->SystemInfo);
-
-		if (this->SystemInfo.wProcessorArchitecture == PROCESSOR_ARCHITECTURE_AMD64)
-		{
-			// x64
-			this->MachineType = IMAGE_FILE_MACHINE_AMD64;
-		}
-		else if (this->SystemInfo.wProcessorArchitecture == PROCESSOR_ARCHITECTURE_INTEL)
-		{
-			// x86
-			this->MachineType = IMAGE_FILE_MACHINE_I386;
-		}
-		else
+		switch (aExceptionCode)
 		{
-			throw "Unexpected CPU architecture.";
+			case EXCEPTION_ACCESS_VIOLATION:
+			case EXCEPTION_ILLEGAL_INSTRUCTION:
+			case EXCEPTION_INT_DIVIDE_BY_ZERO:
+			case EXCEPTION_STACK_OVERFLOW:
+			case EXCEPTION_ARRAY_BOUNDS_EXCEEDED:
+			case EXCEPTION_IN_PAGE_ERROR:
+			case EXCEPTION_GUARD_PAGE:
+			case EXCEPTION_PRIV_INSTRUCTION:
+			{
+				return true;
+			}
 		}
 
-		this->VEH = ::AddVectoredExceptionHandler(1, CrashHandler::OnVectoredException);
-
-		memset(this->LogPath, 0, MAX_PATH);
-		strcpy_s(this->LogPath, MAX_PATH, aCrashLogPath.string().c_str());
-
-		memset(this->StackPath, 0, MAX_PATH);
-		strcpy_s(this->StackPath, MAX_PATH, aCrashStackPath.string().c_str());
-
-		this->CallstackSize = 0;
-		memset(this->Callstack, 0, sizeof(this->Callstack));
+		return false;
+	}
 
+	CrashHandler::CrashHandler(std::filesystem::path aCapturePath, std::filesystem::path aDumpPath)
+	{
 		if (s_CrashHandler)
 		{
 			throw "CrashHandler already registered.";
 		}
 
+		memset(this->CapturePath, 0, sizeof(this->CapturePath));
+		wcscpy_s(this->CapturePath, MAX_PATH, aCapturePath.wstring().c_str());
+
+		memset(this->DumpPath, 0, sizeof(this->DumpPath));
+		wcscpy_s(this->DumpPath, MAX_PATH, aDumpPath.wstring().c_str());
+
+		this->PolicyCount = 0;
+		this->IsWriting = false;
+		this->HasFirstChance = false;
+		this->HasUnhandled = false;
+		memset(&this->Capture, 0, sizeof(this->Capture));
+		memset(&this->UnwindContext, 0, sizeof(this->UnwindContext));
+
 		s_CrashHandler = this;
+
+		this->VEH = ::AddVectoredExceptionHandler(1, CrashHandler::OnVectoredException);
+		this->PreviousFilter = ::SetUnhandledExceptionFilter(CrashHandler::OnUnhandledException);
 	}
 
 	CrashHandler::~CrashHandler()
@@ -75,185 +72,306 @@ namespace Raidcore::Nexus::Platform
 		{
 			::RemoveVectoredExceptionHandler(this->VEH);
 		}
+
+		LPTOP_LEVEL_EXCEPTION_FILTER current = ::SetUnhandledExceptionFilter(this->PreviousFilter);
+
+		/* Replaced by someone else since, keep theirs. */
+		if (current != CrashHandler::OnUnhandledException)
+		{
+			::SetUnhandledExceptionFilter(current);
+		}
+
+		s_CrashHandler = nullptr;
 	}
 
-	/*static*/ LONG WINAPI CrashHandler::OnVectoredException(EXCEPTION_POINTERS* aExcPointers)
+	void CrashHandler::SetPolicy(HMODULE aModule, ECrashPolicy aPolicy)
 	{
-		switch (aExcPointers->ExceptionRecord->ExceptionCode)
+		if (!aModule) { return; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		uint32_t count = this->PolicyCount;
+
+		for (uint32_t i = 0; i < count; i++)
 		{
-			case EXCEPTION_ACCESS_VIOLATION:
-			case EXCEPTION_ILLEGAL_INSTRUCTION:
-			case EXCEPTION_INT_DIVIDE_BY_ZERO:
-			case EXCEPTION_STACK_OVERFLOW:
-			case EXCEPTION_ARRAY_BOUNDS_EXCEEDED:
-			case EXCEPTION_IN_PAGE_ERROR:
-			case EXCEPTION_GUARD_PAGE:
-			case EXCEPTION_PRIV_INSTRUCTION:
-			//case 0xE06D7363: // C++ exception
+			if (this->Policies[i].Base == reinterpret_cast<uint64_t>(aModule))
 			{
-				break;
+				this->Policies[i].Policy = aPolicy;
+				return;
 			}
-			default:
+		}
+
+		/* Unknown modules are unhandled already. */
+		if (aPolicy == ECrashPolicy::Unhandled) { return; }
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			/* Reuse the slot of an unloaded module. It reads as unhandled until the policy is set. */
+			if (this->Policies[i].Policy == ECrashPolicy::Unhandled)
 			{
-				return EXCEPTION_CONTINUE_SEARCH;
+				this->Policies[i].Base = reinterpret_cast<uint64_t>(aModule);
+				this->Policies[i].Policy = aPolicy;
+				return;
 			}
 		}
 
-		HANDLE hProcess = ::GetCurrentProcess();
+		if (count >= CRASHHANDLER_MAXPOLICIES) { return; }
+
+		/* Published by the count, the handlers read without locking. */
+		this->Policies[count].Policy = aPolicy;
+		this->Policies[count].Base = reinterpret_cast<uint64_t>(aModule);
+		this->PolicyCount = count + 1;
+	}
+
+	/*static*/ LONG WINAPI CrashHandler::OnVectoredException(EXCEPTION_POINTERS* aExcPointers)
+	{
+		if (!s_CrashHandler)                                        { return EXCEPTION_CONTINUE_SEARCH; }
+		if (!IsFatal(aExcPointers->ExceptionRecord->ExceptionCode)) { return EXCEPTION_CONTINUE_SEARCH; }
 
-		/* If we cannot initalize, we cleanup and then initialize again. Hooks 'n stuff.. */
-		if (!::SymInitialize(hProcess, NULL, TRUE))
+		if (s_CrashHandler->GetPolicy(aExcPointers->ExceptionRecord->ExceptionAddress) == ECrashPolicy::FirstChance)
 		{
-			::SymCleanup(hProcess);
-			::SymInitialize(hProcess, NULL, TRUE);
+			s_CrashHandler->Write(aExcPointers, true);
 		}
 
-		/* Reset the callstack. */
-		s_CrashHandler->CallstackSize = 0;
-		memset(s_CrashHandler->Callstack, 0, sizeof(s_CrashHandler->Callstack));
+		/* Never handle it, a handler further down might. */
+		return EXCEPTION_CONTINUE_SEARCH;
+	}
 
-		/* Initialize the stackframe. */
-		STACKFRAME64 sf{};
+	/*static*/ LONG WINAPI CrashHandler::OnUnhandledException(EXCEPTION_POINTERS* aExcPointers)
+	{
+		if (!s_CrashHandler) { return EXCEPTION_CONTINUE_SEARCH; }
 
-#if defined(_WIN64)
-		sf.AddrPC.Offset = aExcPointers->ContextRecord->Rip;
-		sf.AddrStack.Offset = aExcPointers->ContextRecord->Rsp;
-		sf.AddrFrame.Offset = aExcPointers->ContextRecord->Rbp;
-#elif defined(WIN32)
-		sf.AddrPC.Offset = aExcPointers->ContextRecord->Eip;
-		sf.AddrStack.Offset = aExcPointers->ContextRecord->Esp;
-		sf.AddrFrame.Offset = aExcPointers->ContextRecord->Ebp;
-#endif
-		sf.AddrPC.Mode = AddrModeFlat;
-		sf.AddrStack.Mode = AddrModeFlat;
-		sf.AddrFrame.Mode = AddrModeFlat;
+		if (s_CrashHandler->GetPolicy(aExcPointers->ExceptionRecord->ExceptionAddress) != ECrashPolicy::Ignore)
+		{
+			s_CrashHandler->Write(aExcPointers, false);
+		}
 
-		/* Walk through the stack frames. */
-		HANDLE hThread = ::GetCurrentThread();
-		while (::StackWalk64(s_CrashHandler->MachineType, hProcess, hThread, &sf, aExcPointers->ContextRecord, 0, ::SymFunctionTableAccess64, ::SymGetModuleBase64, 0))
+		/* Let the game report it as well. */
+		if (s_CrashHandler->PreviousFilter)
 		{
-			if (sf.AddrFrame.Offset == 0)
-			{
-				break;
-			}
+			return s_CrashHandler->PreviousFilter(aExcPointers);
+		}
 
-			/* Resolve function name. */
-			SYMBOL_INFO_PACKAGE symPack{}; // This holds SYMBOL_INFO + an additional MAX_SYN_NAME + 1.
-			PSYMBOL_INFO pSymbol = reinterpret_cast<PSYMBOL_INFO>(&symPack);
+		return EXCEPTION_CONTINUE_SEARCH;
+	}
 
-			pSymbol->SizeOfStruct = sizeof(SYMBOL_INFO);
-			pSymbol->MaxNameLen = MAX_SYM_NAME;
+	ECrashPolicy CrashHandler::GetPolicy(void* aAddress) const
+	{
+		PVOID base = nullptr;
+		::RtlPcToFileHeader(aAddress, &base);
 
-			IMAGEHLP_MODULE64 moduleInfo{};
-			moduleInfo.SizeOfStruct = sizeof(moduleInfo);
+		if (!base) { return ECrashPolicy::Unhandled; }
 
-			StackEntry_t& entry = s_CrashHandler->Callstack[s_CrashHandler->CallstackSize];
+		uint32_t count = this->PolicyCount;
 
-			if (::SymGetModuleInfo64(hProcess, sf.AddrPC.Offset, &moduleInfo))
+		for (uint32_t i = 0; i < count && i < CRASHHANDLER_MAXPOLICIES; i++)
+		{
+			if (this->Policies[i].Base == reinterpret_cast<uint64_t>(base))
 			{
-				entry.ModuleOffset = sf.AddrPC.Offset - moduleInfo.BaseOfImage;
-				strcpy_s(entry.ModuleName, sizeof(entry.ModuleName), moduleInfo.LoadedImageName);
+				return this->Policies[i].Policy;
 			}
+		}
 
-			DWORD64 dwSymDisplacement = 0;
-			if (::SymFromAddr(hProcess, sf.AddrPC.Offset, &dwSymDisplacement, pSymbol))
-			{
-				strcpy_s(entry.FunctionName, sizeof(entry.FunctionName), pSymbol->Name);
-			}
-			else
-			{
-				snprintf(&entry.FunctionName[0], sizeof(entry.FunctionName), "0x%llX", entry.ModuleOffset);
-			}
+		return ECrashPolicy::Unhandled;
+	}
 
-			/* Get line and module name. */
-			IMAGEHLP_LINE64 lineInfo{};
-			DWORD dwLineDisplacement = 0;
+	void CrashHandler::Write(EXCEPTION_POINTERS* aExcPointers, bool aIsFirstChance)
+	{
+		/* Also guards against faults while writing. */
+		if (this->IsWriting.exchange(true)) { return; }
 
-			if (::SymGetLineFromAddr64(hProcess, sf.AddrPC.Offset, &dwLineDisplacement, &lineInfo))
-			{
-				strcpy_s(entry.FileName, sizeof(entry.FileName), lineInfo.FileName);
-				entry.LineNumber = lineInfo.LineNumber;
-			}
-			else
-			{
-				strcpy_s(entry.FileName, sizeof(entry.FileName), moduleInfo.ImageName);
-				entry.LineNumber = -1;
-			}
+		/* Once each, an unhandled crash still replaces an earlier first chance capture. */
+		bool& hasWritten = aIsFirstChance ? this->HasFirstChance : this->HasUnhandled;
 
-			/* Increment size/index. */
-			s_CrashHandler->CallstackSize++;
+		if (!hasWritten)
+		{
+			hasWritten = true;
+			this->WriteFiles(aExcPointers, aIsFirstChance);
 		}
 
-		/* Cleanup. */
-		::SymCleanup(hProcess);
+		this->IsWriting = false;
+	}
 
-		/* Write log file, for in depth analysis. */
-		HANDLE hLogFile = ::CreateFileA(
-			s_CrashHandler->LogPath,
-			GENERIC_WRITE,
-			FILE_SHARE_READ,
-			nullptr,
-			CREATE_ALWAYS,
-			FILE_ATTRIBUTE_NORMAL,
-			nullptr
-		);
+	void CrashHandler::WriteFiles(EXCEPTION_POINTERS* aExcPointers, bool aIsFirstChance)
+	{
+		CrashCapture_t& capture = this->Capture;
+		const CONTEXT* context = aExcPointers->ContextRecord;
 
-		if (hLogFile == INVALID_HANDLE_VALUE)
-		{
-			return EXCEPTION_EXECUTE_HANDLER;
-		}
+		capture.Magic            = CRASHCAPTURE_MAGIC;
+		capture.Version          = CRASHCAPTURE_VERSION;
+		capture.ExceptionCode    = aExcPointers->ExceptionRecord->ExceptionCode;
+		capture.ExceptionAddress = reinterpret_cast<uint64_t>(aExcPointers->ExceptionRecord->ExceptionAddress);
+		capture.ThreadId         = ::GetCurrentThreadId();
+		capture.IsFirstChance    = aIsFirstChance;
 
-		WriteToFile(hLogFile, "========================\n");
-		WriteToFile(hLogFile, "Exception: 0x%X\n", aExcPointers->ExceptionRecord->ExceptionCode);
-		WriteToFile(hLogFile, "========================\n");
-		WriteToFile(hLogFile, "Stack Trace:\n");
-		WriteToFile(hLogFile, "========================\n");
+		FILETIME ft{};
+		::GetSystemTimeAsFileTime(&ft);
+		uint64_t ticks = (static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+		capture.Timestamp = (ticks - 116444736000000000ULL) / 10000000ULL;
 
-		size_t frameIndex = 0;
-		for (size_t i = 0; i < s_CrashHandler->CallstackSize; i++)
+#if defined(_WIN64)
+		capture.Machine = CRASHCAPTURE_MACHINE_AMD64;
+		const DWORD64 registers[] = {
+			context->Rip, context->Rsp, context->Rbp, context->Rax, context->Rbx, context->Rcx, context->Rdx, context->Rsi, context->Rdi,
+			context->R8, context->R9, context->R10, context->R11, context->R12, context->R13, context->R14, context->R15
+		};
+#elif defined(WIN32)
+		capture.Machine = CRASHCAPTURE_MACHINE_I386;
+		const DWORD registers[] = {
+			context->Eip, context->Esp, context->Ebp, context->Eax, context->Ebx, context->Ecx, context->Edx, context->Esi, context->Edi
+		};
+#endif
+		capture.RegisterCount = _countof(registers);
+		for (uint32_t i = 0; i < capture.RegisterCount; i++)
 		{
-			StackEntry_t& entry = s_CrashHandler->Callstack[i];
+			capture.Registers[i] = registers[i];
+		}
 
-			WriteToFile(hLogFile, "%s@%s", entry.FileName, entry.FunctionName);
+		this->CaptureStack(context);
+		this->CaptureModules();
 
-			if (entry.LineNumber != -1)
-			{
-				WriteToFile(hLogFile, " on line %u", entry.LineNumber);
-			}
+		/* Write the capture first, the minidump is the part more likely to fail. */
+		HANDLE hCaptureFile = ::CreateFileW(this->CapturePath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
 
-			WriteToFile(hLogFile, "\n");
+		if (hCaptureFile != INVALID_HANDLE_VALUE)
+		{
+			DWORD written = 0;
+			::WriteFile(hCaptureFile, &capture, sizeof(capture), &written, nullptr);
+			::CloseHandle(hCaptureFile);
 		}
 
-		WriteToFile(hLogFile, "========================\n");
+		/* Writing the dump needs more stack than is left. */
+		if (capture.ExceptionCode == EXCEPTION_STACK_OVERFLOW) { return; }
+
+		HANDLE hDumpFile = ::CreateFileW(this->DumpPath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
 
-		::CloseHandle(hLogFile);
+		if (hDumpFile == INVALID_HANDLE_VALUE) { return; }
 
-		/* Write stack log, to let loader analyze what to disable next launch. */
-		HANDLE hStackFile = ::CreateFileA(
-			s_CrashHandler->StackPath,
-			GENERIC_WRITE,
-			FILE_SHARE_READ,
+		MINIDUMP_EXCEPTION_INFORMATION excInfo{};
+		excInfo.ThreadId          = capture.ThreadId;
+		excInfo.ExceptionPointers = aExcPointers;
+		excInfo.ClientPointers    = FALSE;
+
+		::MiniDumpWriteDump(
+			::GetCurrentProcess(),
+			::GetCurrentProcessId(),
+			hDumpFile,
+			static_cast<MINIDUMP_TYPE>(MiniDumpNormal | MiniDumpWithThreadInfo | MiniDumpWithUnloadedModules),
+			&excInfo,
 			nullptr,
-			CREATE_ALWAYS,
-			FILE_ATTRIBUTE_NORMAL,
 			nullptr
 		);
 
-		if (hStackFile == INVALID_HANDLE_VALUE)
+		::CloseHandle(hDumpFile);
+	}
+
+	void CrashHandler::CaptureStack(const CONTEXT* aContext)
+	{
+		CrashCapture_t& capture = this->Capture;
+		CONTEXT& ctx = this->UnwindContext;
+
+		memcpy(&ctx, aContext, sizeof(CONTEXT));
+		capture.FrameCount = 0;
+
+		__try
 		{
-			return EXCEPTION_EXECUTE_HANDLER;
-		}
+#if defined(_WIN64)
+			while (capture.FrameCount < CRASHCAPTURE_MAXFRAMES && ctx.Rip != 0)
+			{
+				capture.Frames[capture.FrameCount++] = ctx.Rip;
+
+				DWORD64 imageBase = 0;
+				PRUNTIME_FUNCTION function = ::RtlLookupFunctionEntry(ctx.Rip, &imageBase, nullptr);
+
+				if (function)
+				{
+					PVOID handlerData = nullptr;
+					DWORD64 establisherFrame = 0;
+					::RtlVirtualUnwind(UNW_FLAG_NHANDLER, imageBase, ctx.Rip, function, &ctx, &handlerData, &establisherFrame, nullptr);
+				}
+				else
+				{
+					/* Leaf function, the return address is on top of the stack. */
+					ctx.Rip = *reinterpret_cast<DWORD64*>(ctx.Rsp);
+					ctx.Rsp += sizeof(DWORD64);
+				}
+			}
+#elif defined(WIN32)
+			capture.Frames[capture.FrameCount++] = ctx.Eip;
+
+			DWORD* frame = reinterpret_cast<DWORD*>(ctx.Ebp);
+
+			while (frame && capture.FrameCount < CRASHCAPTURE_MAXFRAMES && frame[1] != 0)
+			{
+				capture.Frames[capture.FrameCount++] = frame[1];
+
+				DWORD* next = reinterpret_cast<DWORD*>(frame[0]);
 
-		for (size_t i = 0; i < s_CrashHandler->CallstackSize; i++)
+				if (next <= frame) { break; }
+
+				frame = next;
+			}
+#endif
+		}
+		__except (EXCEPTION_EXECUTE_HANDLER)
 		{
-			StackEntry_t& entry = s_CrashHandler->Callstack[i];
-			WriteToFile(hStackFile, "%s\n", entry.FileName);
+			/* Corrupted stack, keep what was walked so far. */
 		}
+	}
 
-		::CloseHandle(hStackFile);
-
-		//::ShellExecuteA(nullptr, "open", s_CrashHandler->LogPath, nullptr, nullptr, SW_SHOWNORMAL);
+	void CrashHandler::CaptureModules()
+	{
+		CrashCapture_t& capture = this->Capture;
+		capture.ModuleCount = 0;
 
-		return EXCEPTION_EXECUTE_HANDLER;
+		__try
+		{
+			for (uint32_t i = 0; i < capture.FrameCount && capture.ModuleCount < CRASHCAPTURE_MAXMODULES; i++)
+			{
+				PVOID base = nullptr;
+				::RtlPcToFileHeader(reinterpret_cast<PVOID>(capture.Frames[i]), &base);
+
+				if (!base) { continue; }
+
+				if (CrashCapture::FindModule(capture, reinterpret_cast<uint64_t>(base))) { continue; }
+
+				PIMAGE_DOS_HEADER dosHeader = static_cast<PIMAGE_DOS_HEADER>(base);
+				PIMAGE_NT_HEADERS ntHeaders = reinterpret_cast<PIMAGE_NT_HEADERS>(static_cast<uint8_t*>(base) + dosHeader->e_lfanew);
+
+				CrashModule_t& mod = capture.Modules[capture.ModuleCount++];
+				mod.Base          = reinterpret_cast<uint64_t>(base);
+				mod.Size          = ntHeaders->OptionalHeader.SizeOfImage;
+				mod.TimeDateStamp = ntHeaders->FileHeader.TimeDateStamp;
+				memset(mod.Path, 0, sizeof(mod.Path));
+
+				/* Read without the loader lock, its holder might be the one that crashed. */
+				PPEB peb = NtCurrentTeb()->ProcessEnvironmentBlock;
+				PLIST_ENTRY head = &peb->Ldr->InMemoryOrderModuleList;
+				uint32_t guard = 0;
+
+				for (PLIST_ENTRY it = head->Flink; it != head && guard < 4096; it = it->Flink, guard++)
+				{
+					PLDR_DATA_TABLE_ENTRY entry = CONTAINING_RECORD(it, LDR_DATA_TABLE_ENTRY, InMemoryOrderLinks);
+
+					if (entry->DllBase != base) { continue; }
+
+					::WideCharToMultiByte(
+						CP_UTF8,
+						0,
+						entry->FullDllName.Buffer,
+						entry->FullDllName.Length / sizeof(wchar_t),
+						mod.Path,
+						sizeof(mod.Path) - 1,
+						nullptr,
+						nullptr
+					);
+					break;
+				}
+			}
+		}
+		__except (EXCEPTION_EXECUTE_HANDLER)
+		{
+			/* Keep the modules recorded so far. */
+		}
 	}
 }
@@ -2,34 +2,41 @@
 /// Copyright (c) Raidcore.GG - All rights reserved.
 ///
 /// Name         :  CrashHandler.h
-/// Description  :  Unhandled exception crash logger.
+/// Description  :  Unhandled exception crash capture.
 /// Authors      :  K. Bieniek
 ///----------------------------------------------------------------------------------------------------
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <windows.h>
 
+#include "CrashCapture.h"
+
+constexpr const uint32_t CRASHHANDLER_MAXPOLICIES = 64;
+
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Platform Namespace
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::Platform
 {
 	///----------------------------------------------------------------------------------------------------
-	/// StackEntry_t Struct
+	/// ECrashPolicy Enumeration
+	/// 	How faults raised within a module are treated.
 	///----------------------------------------------------------------------------------------------------
-	struct StackEntry_t
+	enum class ECrashPolicy : uint32_t
 	{
-		char     FileName[MAX_PATH];
-		char     FunctionName[MAX_PATH];
-		uint32_t LineNumber;
-		char     ModuleName[MAX_PATH];
-		uint64_t ModuleOffset;
+		Unhandled   = 0, /* Captured, if no handler takes the exception. (Default) */
+		FirstChance = 1, /* Captured as soon as raised, even if handled later. */
+		Ignore      = 2  /* Never captured. */
 	};
 
 	///----------------------------------------------------------------------------------------------------
 	/// CrashHandler Class
+	/// 	The handlers only copy the stack and registers into preallocated memory and write it to disk
+	/// 	along with a minidump. Symbols are resolved on the next launch by the CrashSymbolizer.
 	///----------------------------------------------------------------------------------------------------
 	class CrashHandler
 	{
@@ -37,26 +44,84 @@ namespace Raidcore::Nexus::Platform
 		///----------------------------------------------------------------------------------------------------
 		/// ctor
 		///----------------------------------------------------------------------------------------------------
-		CrashHandler(std::filesystem::path aCrashLogPath, std::filesystem::path aCrashStackPath);
+		CrashHandler(std::filesystem::path aCapturePath, std::filesystem::path aDumpPath);
 
 		///----------------------------------------------------------------------------------------------------
 		/// dtor
 		///----------------------------------------------------------------------------------------------------
 		~CrashHandler();
 
+		///----------------------------------------------------------------------------------------------------
+		/// SetPolicy:
+		/// 	Sets how faults within the given module are treated.
+		///----------------------------------------------------------------------------------------------------
+		void SetPolicy(HMODULE aModule, ECrashPolicy aPolicy);
+
 		private:
-		char         LogPath[MAX_PATH];
-		char         StackPath[MAX_PATH];
-		PVOID        VEH;
-		SYSTEM_INFO  SystemInfo;
-		DWORD        MachineType;
-		StackEntry_t Callstack[64];
-		size_t       CallstackSize;
+		///----------------------------------------------------------------------------------------------------
+		/// ModulePolicy_t Struct
+		///----------------------------------------------------------------------------------------------------
+		struct ModulePolicy_t
+		{
+			std::atomic<uint64_t>     Base;
+			std::atomic<ECrashPolicy> Policy;
+		};
+
+		wchar_t                      CapturePath[MAX_PATH];
+		wchar_t                      DumpPath[MAX_PATH];
+		PVOID                        VEH;
+		LPTOP_LEVEL_EXCEPTION_FILTER PreviousFilter;
+
+		std::mutex                   Mutex;
+		ModulePolicy_t               Policies[CRASHHANDLER_MAXPOLICIES];
+		std::atomic<uint32_t>        PolicyCount;
+
+		std::atomic<bool>            IsWriting;
+		bool                         HasFirstChance;
+		bool                         HasUnhandled;
+		CrashCapture_t               Capture;
+		CONTEXT                      UnwindContext; /* Not on the stack, which may be exhausted. */
 
 		///----------------------------------------------------------------------------------------------------
 		/// OnVectoredException:
-		/// 	Logs the unhandled exception.
+		/// 	Captures first chance exceptions of modules with the FirstChance policy.
 		///----------------------------------------------------------------------------------------------------
 		static LONG WINAPI OnVectoredException(EXCEPTION_POINTERS* aExcPointers);
+
+		///----------------------------------------------------------------------------------------------------
+		/// OnUnhandledException:
+		/// 	Captures exceptions no handler took, then passes them on.
+		///----------------------------------------------------------------------------------------------------
+		static LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* aExcPointers);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetPolicy:
+		/// 	Returns the policy of the module containing the given address.
+		///----------------------------------------------------------------------------------------------------
+		ECrashPolicy GetPolicy(void* aAddress) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Write:
+		/// 	Writes the capture of a first chance and an unhandled exception once each.
+		///----------------------------------------------------------------------------------------------------
+		void Write(EXCEPTION_POINTERS* aExcPointers, bool aIsFirstChance);
+
+		///----------------------------------------------------------------------------------------------------
+		/// WriteFiles:
+		/// 	Fills the capture and writes it and the minidump to disk.
+		///----------------------------------------------------------------------------------------------------
+		void WriteFiles(EXCEPTION_POINTERS* aExcPointers, bool aIsFirstChance);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CaptureStack:
+		/// 	Unwinds the stack without symbol lookups.
+		///----------------------------------------------------------------------------------------------------
+		void CaptureStack(const CONTEXT* aContext);
+
+		///----------------------------------------------------------------------------------------------------
+		/// CaptureModules:
+		/// 	Records the modules of all captured frames, read from the loaded images without locking.
+		///----------------------------------------------------------------------------------------------------
+		void CaptureModules();
 	};
 }
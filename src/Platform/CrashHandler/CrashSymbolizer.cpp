@@ -0,0 +1,92 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CrashSymbolizer.cpp
+/// Description  :  Resolves the symbols of a crash capture outside of the crashing process.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "CrashSymbolizer.h"
+
+#include <fstream>
+#include <windows.h>
+#include <dbghelp.h>
+
+#include "CrashCapture.h"
+
+namespace Raidcore::Nexus::Platform::CrashSymbolizer
+{
+	/* The modules are loaded at their captured bases, separate from the symbol state of the live process. */
+	static int s_SymbolSession{};
+
+	bool Process(const std::filesystem::path& aCapturePath, const std::filesystem::path& aCrashLogPath, const std::filesystem::path& aCrashStackPath)
+	{
+		std::error_code ec;
+
+		if (!std::filesystem::exists(aCapturePath, ec)) { return false; }
+
+		CrashCapture_t capture{};
+
+		if (!CrashCapture::Read(aCapturePath, capture))
+		{
+			std::filesystem::remove(aCapturePath, ec);
+			return false;
+		}
+
+		HANDLE hSession = reinterpret_cast<HANDLE>(&s_SymbolSession);
+		bool hasSymbols = ::SymInitialize(hSession, nullptr, FALSE);
+
+		if (hasSymbols)
+		{
+			::SymSetOptions(::SymGetOptions() | SYMOPT_UNDNAME | SYMOPT_LOAD_LINES | SYMOPT_FAIL_CRITICAL_ERRORS);
+
+			for (uint32_t i = 0; i < capture.ModuleCount; i++)
+			{
+				const CrashModule_t& mod = capture.Modules[i];
+
+				if (mod.Path[0] == 0) { continue; }
+
+				/* Symbols are searched next to the module. */
+				::SymLoadModuleEx(hSession, nullptr, mod.Path, nullptr, mod.Base, mod.Size, nullptr, 0);
+			}
+		}
+
+		std::ofstream log(aCrashLogPath, std::ios::trunc);
+		std::ofstream stack(aCrashStackPath, std::ios::trunc);
+
+		CrashCapture::WriteLog(capture, [hSession, hasSymbols](uint64_t aAddress, CrashSymbol_t& aSymbol)
+		{
+			if (!hasSymbols) { return; }
+
+			SYMBOL_INFO_PACKAGE symPack{};
+			PSYMBOL_INFO pSymbol = reinterpret_cast<PSYMBOL_INFO>(&symPack);
+			pSymbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+			pSymbol->MaxNameLen = MAX_SYM_NAME;
+
+			DWORD64 dwSymDisplacement = 0;
+			if (::SymFromAddr(hSession, aAddress, &dwSymDisplacement, pSymbol))
+			{
+				aSymbol.Function = pSymbol->Name;
+			}
+
+			IMAGEHLP_LINE64 lineInfo{};
+			lineInfo.SizeOfStruct = sizeof(lineInfo);
+			DWORD dwLineDisplacement = 0;
+
+			if (::SymGetLineFromAddr64(hSession, aAddress, &dwLineDisplacement, &lineInfo))
+			{
+				aSymbol.File = lineInfo.FileName;
+				aSymbol.Line = lineInfo.LineNumber;
+			}
+		}, log, stack);
+
+		if (hasSymbols)
+		{
+			::SymCleanup(hSession);
+		}
+
+		std::filesystem::remove(aCapturePath, ec);
+
+		return true;
+	}
+}
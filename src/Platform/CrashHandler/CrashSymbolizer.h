@@ -0,0 +1,30 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CrashSymbolizer.h
+/// Description  :  Resolves the symbols of a crash capture outside of the crashing process.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <filesystem>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Platform Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Platform
+{
+	///----------------------------------------------------------------------------------------------------
+	/// CrashSymbolizer Namespace
+	///----------------------------------------------------------------------------------------------------
+	namespace CrashSymbolizer
+	{
+		///----------------------------------------------------------------------------------------------------
+		/// Process:
+		/// 	Symbolizes a pending crash capture into the crash log and the crash stack, then deletes it.
+		/// 	Returns true if a capture was processed.
+		///----------------------------------------------------------------------------------------------------
+		bool Process(const std::filesystem::path& aCapturePath, const std::filesystem::path& aCrashLogPath, const std::filesystem::path& aCrashStackPath);
+	}
+}
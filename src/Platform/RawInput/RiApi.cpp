@@ -8,56 +8,168 @@
 
 #include "RiApi.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 namespace Raidcore::Nexus::Platform
 {
+	/* Depth of WndProc dispatches on the calling thread. A callback deregistering itself must not wait on itself. */
+	static thread_local uint32_t s_DispatchDepth = 0;
+
 	UINT RawInputApi::WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 	{
 		// don't pass to game if addon wndproc
-		const std::lock_guard<std::mutex> lock(this->Mutex);
+		std::shared_ptr<const WndProcSnapshot_t> snapshot = this->Snapshot.load(std::memory_order_acquire);
+
+		const std::vector<WNDPROC_CALLBACK>& callbacks = snapshot->ByClass[GetMsgClassIndex(uMsg)];
+
+		if (callbacks.empty()) { return 1; }
 
-		for (WNDPROC_CALLBACK wndprocCb : this->Registry)
+		s_DispatchDepth++;
+
+		UINT result = 1;
+
+		for (WNDPROC_CALLBACK wndprocCb : callbacks)
 		{
 			if (wndprocCb(hWnd, uMsg, wParam, lParam) == 0)
 			{
-				return 0;
+				result = 0;
+				break;
 			}
 		}
 
-		return 1;
+		s_DispatchDepth--;
+
+		return result;
 	}
 
-	void RawInputApi::Register(WNDPROC_CALLBACK aWndProcCallback)
+	void RawInputApi::Register(WNDPROC_CALLBACK aWndProcCallback, EMsgClass aClasses)
 	{
+		if (!aWndProcCallback || aClasses == EMsgClass::None) { return; }
+
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		this->Registry.push_back(aWndProcCallback);
+		auto it = std::find_if(this->Registry.begin(), this->Registry.end(), [aWndProcCallback](const WndProcRegistration_t& aEntry)
+		{
+			return aEntry.Callback == aWndProcCallback;
+		});
+
+		if (it != this->Registry.end())
+		{
+			it->Classes |= aClasses;
+		}
+		else
+		{
+			this->Registry.push_back(WndProcRegistration_t{ aWndProcCallback, aClasses });
+			this->Owners.Add((void*)aWndProcCallback, aWndProcCallback);
+		}
+
+		/* Nothing was removed, dispatches in flight do not need to finish. */
+		this->Publish();
 	}
 
 	void RawInputApi::Deregister(WNDPROC_CALLBACK aWndProcCallback)
+	{
+		std::shared_ptr<const WndProcSnapshot_t> previous;
+
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			this->Registry.erase(std::remove_if(this->Registry.begin(), this->Registry.end(), [aWndProcCallback](const WndProcRegistration_t& aEntry)
+			{
+				return aEntry.Callback == aWndProcCallback;
+			}), this->Registry.end());
+
+			this->Owners.Remove((void*)aWndProcCallback, aWndProcCallback);
+
+			previous = this->Publish();
+		}
+
+		this->WaitForDispatch(previous);
+	}
+
+	EMsgClass RawInputApi::GetClasses() const
+	{
+		return this->Classes.load(std::memory_order_relaxed);
+	}
+
+	std::vector<WndProcRegistration_t> RawInputApi::GetRegistry() const
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		this->Registry.erase(std::remove(this->Registry.begin(), this->Registry.end(), aWndProcCallback), this->Registry.end());
+		return this->Registry;
 	}
 
 	uint32_t RawInputApi::CleanupRefs(void* aStartAddress, void* aEndAddress)
 	{
 		uint32_t refCounter = 0;
 
-		const std::lock_guard<std::mutex> lock(this->Mutex);
-		for (WNDPROC_CALLBACK wndprocCb : this->Registry)
+		std::shared_ptr<const WndProcSnapshot_t> previous;
+
 		{
-			if (wndprocCb >= aStartAddress && wndprocCb <= aEndAddress)
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			std::vector<WNDPROC_CALLBACK> owned = this->Owners.Take(aStartAddress, aEndAddress);
+
+			if (owned.empty()) { return 0; }
+
+			size_t before = this->Registry.size();
+
+			this->Registry.erase(std::remove_if(this->Registry.begin(), this->Registry.end(), [&owned](const WndProcRegistration_t& aEntry)
 			{
-				this->Registry.erase(std::remove(this->Registry.begin(), this->Registry.end(), wndprocCb), this->Registry.end());
-				refCounter++;
-			}
+				return std::find(owned.begin(), owned.end(), aEntry.Callback) != owned.end();
+			}), this->Registry.end());
+
+			refCounter = static_cast<uint32_t>(before - this->Registry.size());
+
+			if (refCounter == 0) { return 0; }
+
+			previous = this->Publish();
 		}
 
+		this->WaitForDispatch(previous);
+
 		return refCounter;
 	}
+
+	std::shared_ptr<const WndProcSnapshot_t> RawInputApi::Publish()
+	{
+		std::shared_ptr<WndProcSnapshot_t> snapshot = std::make_shared<WndProcSnapshot_t>();
+		EMsgClass classes = EMsgClass::None;
+
+		for (const WndProcRegistration_t& entry : this->Registry)
+		{
+			for (uint32_t i = 0; i < MSGCLASS_COUNT; i++)
+			{
+				if ((static_cast<uint32_t>(entry.Classes) & (1 << i)) != 0)
+				{
+					snapshot->ByClass[i].push_back(entry.Callback);
+				}
+			}
+
+			classes |= entry.Classes;
+		}
+
+		std::shared_ptr<const WndProcSnapshot_t> previous = this->Snapshot.exchange(snapshot, std::memory_order_acq_rel);
+		this->Classes.store(classes, std::memory_order_relaxed);
+
+		return previous;
+	}
+
+	void RawInputApi::WaitForDispatch(std::shared_ptr<const WndProcSnapshot_t>& aSnapshot)
+	{
+		/* Called from within a callback, the dispatch holding the snapshot is further up this stack. */
+		if (s_DispatchDepth > 0) { return; }
+
+		/* Removed callbacks may belong to a module about to be unloaded, let in-flight dispatches finish first. */
+		while (aSnapshot.use_count() > 1)
+		{
+			std::this_thread::yield();
+		}
+
+		aSnapshot.reset();
+	}
 }
@@ -8,12 +8,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <windows.h>
 
 #include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
+#include "RiMsgClass.h"
 
 ///----------------------------------------------------------------------------------------------------
 /// Raidcore::Nexus::Platform Namespace
@@ -22,6 +26,24 @@ namespace Raidcore::Nexus::Platform
 {
 	typedef UINT(*WNDPROC_CALLBACK)(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
+	///----------------------------------------------------------------------------------------------------
+	/// WndProcRegistration_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct WndProcRegistration_t
+	{
+		WNDPROC_CALLBACK Callback;
+		EMsgClass        Classes;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// WndProcSnapshot_t Struct
+	/// 	Immutable, the callbacks interested in each message class in registration order.
+	///----------------------------------------------------------------------------------------------------
+	struct WndProcSnapshot_t
+	{
+		std::vector<WNDPROC_CALLBACK> ByClass[MSGCLASS_COUNT];
+	};
+
 	///----------------------------------------------------------------------------------------------------
 	/// RawInputApi Class
 	///----------------------------------------------------------------------------------------------------
@@ -41,21 +63,36 @@ namespace Raidcore::Nexus::Platform
 		///----------------------------------------------------------------------------------------------------
 		/// WndProc:
 		/// 	Returns 0 if message was processed or non-zero, if it should be passed to the next callback.
+		/// 	Lock-free, only the callbacks registered for the class of the message are invoked.
 		///----------------------------------------------------------------------------------------------------
 		UINT WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Register:
-		/// 	Registers the provided WndProcCallback.
+		/// 	Registers the provided WndProcCallback for the given message classes.
+		/// 	Registering an already registered callback adds the classes.
 		///----------------------------------------------------------------------------------------------------
-		void Register(WNDPROC_CALLBACK aWndProcCallback);
+		void Register(WNDPROC_CALLBACK aWndProcCallback, EMsgClass aClasses = EMsgClass::All);
 
 		///----------------------------------------------------------------------------------------------------
 		/// Deregister:
 		/// 	Deregisters the provided WndProcCallback.
+		/// 	Returns once no message is dispatched to it anymore.
 		///----------------------------------------------------------------------------------------------------
 		void Deregister(WNDPROC_CALLBACK aWndProcCallback);
 
+		///----------------------------------------------------------------------------------------------------
+		/// GetClasses:
+		/// 	Returns the union of all message classes registered callbacks are interested in.
+		///----------------------------------------------------------------------------------------------------
+		EMsgClass GetClasses() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRegistry:
+		/// 	Returns a copy of the registry.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<WndProcRegistration_t> GetRegistry() const;
+
 		///----------------------------------------------------------------------------------------------------
 		/// CleanupRefs:
 		/// 	Removes all WndProc Callbacks that are within the provided address space.
@@ -63,7 +100,26 @@ namespace Raidcore::Nexus::Platform
 		uint32_t CleanupRefs(void* aStartAddress, void* aEndAddress) override;
 
 		private:
-		mutable std::mutex            Mutex;
-		std::vector<WNDPROC_CALLBACK> Registry;
+		/* Writers only, dispatching reads the snapshot. */
+		mutable std::mutex                                    Mutex;
+		std::vector<WndProcRegistration_t>                    Registry;
+		Memory::OwnerIndex<WNDPROC_CALLBACK>                  Owners;
+
+		std::atomic<std::shared_ptr<const WndProcSnapshot_t>> Snapshot{ std::make_shared<const WndProcSnapshot_t>() };
+		std::atomic<EMsgClass>                                Classes{ EMsgClass::None };
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Builds a snapshot of the registry, swaps it in and returns the previous one.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		std::shared_ptr<const WndProcSnapshot_t> Publish();
+
+		///----------------------------------------------------------------------------------------------------
+		/// WaitForDispatch:
+		/// 	Waits until the given snapshot is no longer dispatched on another thread.
+		/// 	Must be called without the lock held, callbacks may register while waited on.
+		///----------------------------------------------------------------------------------------------------
+		void WaitForDispatch(std::shared_ptr<const WndProcSnapshot_t>& aSnapshot);
 	};
 }
@@ -0,0 +1,80 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  RiMsgClass.cpp
+/// Description  :  Classification of window messages for routing.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "RiMsgClass.h"
+
+#include <array>
+
+namespace Raidcore::Nexus::Platform
+{
+	static uint8_t ToIndex(EMsgClass aClass)
+	{
+		uint32_t bits = static_cast<uint32_t>(aClass);
+		uint8_t idx = 0;
+
+		while (bits > 1)
+		{
+			bits >>= 1;
+			idx++;
+		}
+
+		return idx;
+	}
+
+	/* One byte per message below WM_USER, built once. */
+	static const std::array<uint8_t, WM_USER> s_ClassTable = []()
+	{
+		std::array<uint8_t, WM_USER> table{};
+		table.fill(ToIndex(EMsgClass::Window));
+
+		for (UINT msg = WM_KEYFIRST; msg <= WM_KEYLAST; msg++)
+		{
+			table[msg] = ToIndex(EMsgClass::Keyboard);
+		}
+
+		for (UINT msg = WM_MOUSEFIRST; msg <= WM_MOUSELAST; msg++)
+		{
+			table[msg] = ToIndex(EMsgClass::Mouse);
+		}
+
+		/* Non-client mouse messages. */
+		for (UINT msg = WM_NCMOUSEMOVE; msg <= WM_NCXBUTTONDBLCLK; msg++)
+		{
+			table[msg] = ToIndex(EMsgClass::Cursor);
+		}
+
+		table[WM_SETCURSOR]           = ToIndex(EMsgClass::Cursor);
+		table[WM_NCHITTEST]           = ToIndex(EMsgClass::Cursor);
+		table[WM_MOUSEACTIVATE]       = ToIndex(EMsgClass::Cursor);
+
+		table[WM_INPUT]               = ToIndex(EMsgClass::RawInput);
+		table[WM_INPUT_DEVICE_CHANGE] = ToIndex(EMsgClass::RawInput);
+
+		table[WM_ACTIVATE]            = ToIndex(EMsgClass::Focus);
+		table[WM_ACTIVATEAPP]         = ToIndex(EMsgClass::Focus);
+		table[WM_SETFOCUS]            = ToIndex(EMsgClass::Focus);
+		table[WM_KILLFOCUS]           = ToIndex(EMsgClass::Focus);
+
+		return table;
+	}();
+
+	uint32_t GetMsgClassIndex(UINT uMsg)
+	{
+		if (uMsg >= WM_USER)
+		{
+			return ToIndex(EMsgClass::User);
+		}
+
+		return s_ClassTable[uMsg];
+	}
+
+	EMsgClass GetMsgClass(UINT uMsg)
+	{
+		return static_cast<EMsgClass>(1 << GetMsgClassIndex(uMsg));
+	}
+}
@@ -0,0 +1,49 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  RiMsgClass.h
+/// Description  :  Classification of window messages for routing.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <windows.h>
+
+constexpr const uint32_t MSGCLASS_COUNT = 7;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Platform Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Platform
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EMsgClass Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EMsgClass : uint32_t
+	{
+		None     = 0,
+		Keyboard = 1 << 0, /* WM_KEYFIRST - WM_KEYLAST, includes WM_CHAR.                          */
+		Mouse    = 1 << 1, /* WM_MOUSEFIRST - WM_MOUSELAST.                                        */
+		RawInput = 1 << 2, /* WM_INPUT, WM_INPUT_DEVICE_CHANGE.                                    */
+		Cursor   = 1 << 3, /* WM_SETCURSOR, WM_NCHITTEST and non-client mouse messages.            */
+		Focus    = 1 << 4, /* WM_ACTIVATE, WM_ACTIVATEAPP, WM_SETFOCUS, WM_KILLFOCUS.              */
+		Window   = 1 << 5, /* Any other message below WM_USER.                                     */
+		User     = 1 << 6, /* WM_USER and above, includes the game only passthrough range.        */
+		All      = (1 << MSGCLASS_COUNT) - 1
+	};
+	DEFINE_ENUM_FLAG_OPERATORS(EMsgClass)
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetMsgClassIndex:
+	/// 	Returns the bit index of the class a message belongs to.
+	///----------------------------------------------------------------------------------------------------
+	uint32_t GetMsgClassIndex(UINT uMsg);
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetMsgClass:
+	/// 	Returns the class a message belongs to.
+	///----------------------------------------------------------------------------------------------------
+	EMsgClass GetMsgClass(UINT uMsg);
+}
@@ -27,20 +27,23 @@
 #include "Core/Logging/LogWriter.h"
 #include "Core/Settings/SettingsMgr.h"
 #include "Core/Versioning/Version.h"
-#include "Graphics/GrMetrics.h"
+#include "Graphics/GrFrameMetrics.h"
 #include "Graphics/GrWindow.h"
+#include "Graphics/Textures/TxD3D11Uploader.h"
 #include "Graphics/Textures/TxLoader.h"
 #include "GW2/ArcDPS/ArcApi.h"
 #include "GW2/BuildInfo/BuildInfoService.h"
 #include "GW2/Inputs/GameBinds/GbApi.h"
 #include "GW2/Multibox/Multibox.h"
 #include "GW2/Mumble/MblReader.h"
+#include "Hooks/HkRouter.h"
 #include "Hooks/Hooks.h"
 #include "Host/Addons/Addon.h"
 #include "Host/Config/CfgManager.h"
 #include "Host/Events/EvtApi.h"
 #include "Host/Library/LibManager.h"
 #include "Host/Loader/Loader.h"
+#include "Host/Resources/ResMonitor.h"
 #include "Index/IdxEnum.h"
 #include "Index/Index.h"
 #include "Inputs/InputBinds/IbApi.h"
@@ -48,6 +51,7 @@
 #include "Network/WebRequests/WreStorage.h"
 #include "Platform/RawInput/RiApi.h"
 #include "Platform/CrashHandler/CrashHandler.h"
+#include "Platform/CrashHandler/CrashSymbolizer.h"
 #include "Proxy/PxyEnum.h"
 #include "res/ResConst.h"
 #include "UI/UiContext.h"
@@ -125,6 +129,17 @@ namespace Raidcore::Nexus
 		static Core::CFileLogger writer = Core::CFileLogger(Core::ELogLevel::ALL, logpath);
 		logger.Register(&writer);
 
+		/* Arm the crash handler, symbols of a previous crash are resolved outside of it. */
+		ctx.CrashHandler();
+
+		Clockwork::Run<void>(Raidcore::Clockwork::ETaskPriority::Low, [](Clockwork::CancellationToken aToken)
+		{
+			if (Platform::CrashSymbolizer::Process(Index(EPath::CrashCapture), Index(EPath::CrashLog), Index(EPath::CrashStack)))
+			{
+				Runtime::Get().Logger().Warning(LOG_CHANNEL, "The previous session crashed. Details: %s", Index(EPath::CrashLog).string().c_str());
+			}
+		});
+
 		/* If running vanilla, do not initialize the hooks and leave the mutex unmodified. */
 		if (CmdLine::HasArgument("-ggvanilla"))
 		{
@@ -235,8 +250,8 @@ namespace Raidcore::Nexus
 	Platform::CrashHandler& Runtime::CrashHandler()
 	{
 		static Platform::CrashHandler s_CrashHandler{
-			Index(EPath::CrashLog),
-			Index(EPath::CrashStack)
+			Index(EPath::CrashCapture),
+			Index(EPath::CrashDump)
 		};
 		return s_CrashHandler;
 	}
@@ -247,6 +262,12 @@ namespace Raidcore::Nexus
 		return s_RawInputApi;
 	}
 
+	Hooks::WndProcRouter& Runtime::WndProcRouter()
+	{
+		static Hooks::WndProcRouter s_WndProcRouter{};
+		return s_WndProcRouter;
+	}
+
 	Host::ConfigMgr& Runtime::Config()
 	{
 		static Host::ConfigMgr s_ConfigMgr{
@@ -260,8 +281,10 @@ namespace Raidcore::Nexus
 	{
 		static Host::Loader s_Loader{
 			this->Logger(),
+			this->Settings(),
 			CAddon::Factory, /* FIXME: Register mapping. */
-			Index(EPath::DIR_ADDONS)
+			Index(EPath::DIR_ADDONS),
+			Index(EPath::DIR_ADDONCACHE)
 		};
 		return s_Loader;
 	}
@@ -275,6 +298,15 @@ namespace Raidcore::Nexus
 		return s_Library;
 	}
 
+	Host::ResourceMonitor& Runtime::Resources()
+	{
+		static Host::ResourceMonitor s_Resources{
+			this->DataLink(),
+			this->Loader()
+		};
+		return s_Resources;
+	}
+
 	Host::EventApi& Runtime::Events()
 	{
 		static Host::EventApi s_EventApi{
@@ -285,17 +317,25 @@ namespace Raidcore::Nexus
 
 	Graphics::TextureLoader& Runtime::TextureLoader()
 	{
+		static Graphics::D3D11TextureUploader s_TextureUploader{
+			this->GrWindow()
+		};
 		static Graphics::TextureLoader s_TextureLoader{
 			this->Logger(),
 			this->GrWindow(),
-			Index(EPath::DIR_TEXTURES)
+			s_TextureUploader,
+			this->Settings(),
+			Index(EPath::DIR_TEXTURES),
+			Index(EPath::DIR_TEXTURECACHE)
 		};
 		return s_TextureLoader;
 	}
 
-	Graphics::Metrics_t& Runtime::GrMetrics()
+	Graphics::FrameMetrics& Runtime::GrMetrics()
 	{
-		static Graphics::Metrics_t s_Metrics{};
+		static Graphics::FrameMetrics s_Metrics{
+			this->DataLink()
+		};
 		return s_Metrics;
 	}
 
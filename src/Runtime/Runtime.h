@@ -17,17 +17,19 @@
 #include "Core/Logging/LogApi.h"
 #include "Core/Settings/SettingsMgr.h"
 #include "Core/Versioning/Version.h"
-#include "Graphics/GrMetrics.h"
+#include "Graphics/GrFrameMetrics.h"
 #include "Graphics/GrWindow.h"
 #include "Graphics/Textures/TxLoader.h"
 #include "GW2/ArcDPS/ArcApi.h"
 #include "GW2/BuildInfo/BuildInfoService.h"
 #include "GW2/Inputs/GameBinds/GbApi.h"
 #include "GW2/Mumble/MblReader.h"
+#include "Hooks/HkRouter.h"
 #include "Host/Config/CfgManager.h"
 #include "Host/Events/EvtApi.h"
 #include "Host/Library/LibManager.h"
 #include "Host/Loader/Loader.h"
+#include "Host/Resources/ResMonitor.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "Network/Updater/Updater.h"
 #include "Network/WebRequests/WreStorage.h"
@@ -113,6 +115,12 @@ namespace Raidcore::Nexus
 		///----------------------------------------------------------------------------------------------------
 		Platform::RawInputApi& RawInput();
 
+		///----------------------------------------------------------------------------------------------------
+		/// WndProcRouter:
+		/// 	Returns the WndProc message router.
+		///----------------------------------------------------------------------------------------------------
+		Hooks::WndProcRouter& WndProcRouter();
+
 		///----------------------------------------------------------------------------------------------------
 		/// Config:
 		/// 	Returns the config instance.
@@ -131,6 +139,12 @@ namespace Raidcore::Nexus
 		///----------------------------------------------------------------------------------------------------
 		Host::LibraryMgr& Library();
 
+		///----------------------------------------------------------------------------------------------------
+		/// Resources:
+		/// 	Returns the resource monitor.
+		///----------------------------------------------------------------------------------------------------
+		Host::ResourceMonitor& Resources();
+
 		///----------------------------------------------------------------------------------------------------
 		/// Events:
 		/// 	Returns the event API instance.
@@ -145,9 +159,9 @@ namespace Raidcore::Nexus
 
 		///----------------------------------------------------------------------------------------------------
 		/// GrMetrics:
-		/// 	Returns the metrics.
+		/// 	Returns the frame metrics.
 		///----------------------------------------------------------------------------------------------------
-		Graphics::Metrics_t& GrMetrics();
+		Graphics::FrameMetrics& GrMetrics();
 
 		///----------------------------------------------------------------------------------------------------
 		/// GrWindow:
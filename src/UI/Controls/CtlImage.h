@@ -0,0 +1,70 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CtlImage.h
+/// Description  :  Draws textures, preferring their atlas copy.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include "imgui/imgui.h"
+
+#include "Graphics/Textures/TxTexture.h"
+#include "Util/Time.h"
+
+using namespace Raidcore::Nexus;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GUI Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GUI
+{
+	///----------------------------------------------------------------------------------------------------
+	/// Image:
+	/// 	Draws a texture. Consecutive atlas textures end up in one draw command.
+	///----------------------------------------------------------------------------------------------------
+	inline void Image(Graphics::Texture_t* aTexture, const ImVec2& aSize)
+	{
+		if (aTexture->AtlasResource)
+		{
+			/* The shared page does not tell the budget which texture was drawn. */
+			aTexture->LastUsed = Time::GetTimestampMs();
+
+			ImGui::Image(
+				aTexture->AtlasResource,
+				aSize,
+				ImVec2(aTexture->AtlasUV0[0], aTexture->AtlasUV0[1]),
+				ImVec2(aTexture->AtlasUV1[0], aTexture->AtlasUV1[1])
+			);
+			return;
+		}
+
+		ImGui::Image(aTexture->Resource, aSize);
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// ImageButton:
+	/// 	Draws a texture as button. Returns true if clicked.
+	///----------------------------------------------------------------------------------------------------
+	inline bool ImageButton(Graphics::Texture_t* aTexture, const ImVec2& aSize)
+	{
+		if (aTexture->AtlasResource)
+		{
+			aTexture->LastUsed = Time::GetTimestampMs();
+
+			/* The button id is derived from the resource, which is shared on the atlas. */
+			ImGui::PushID(aTexture);
+			bool clicked = ImGui::ImageButton(
+				aTexture->AtlasResource,
+				aSize,
+				ImVec2(aTexture->AtlasUV0[0], aTexture->AtlasUV0[1]),
+				ImVec2(aTexture->AtlasUV1[0], aTexture->AtlasUV1[1])
+			);
+			ImGui::PopID();
+			return clicked;
+		}
+
+		return ImGui::ImageButton(aTexture->Resource, aSize);
+	}
+}
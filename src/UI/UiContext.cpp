@@ -9,18 +9,21 @@
 #include "UiContext.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <d3d11.h>
 #include <filesystem>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <windows.h>
 
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_dx11.h"
 #include "imgui/imgui_impl_win32.h"
+#include "imgui/imgui_internal.h"
 
 #include "Core/DataLink/DlApi.h"
 #include "Core/Logging/LogApi.h"
@@ -36,6 +39,7 @@
 #include "Inputs/InputBinds/IbApi.h"
 #include "Inputs/InputBinds/IbEnum.h"
 #include "Memory/IRefCleaner.h"
+#include "Memory/ResourceLedger.h"
 #include "Mumble/Mumble.h"
 #include "res/ResConst.h"
 #include "Runtime/Runtime.h"
@@ -47,7 +51,9 @@
 #include "UiEnum.h"
 #include "UiFuncDefs.h"
 #include "UiInput.h"
+#include "UiScheduler.h"
 #include "Util/DLL.h"
+#include "Util/Time.h"
 #include "Views/Alerts/Alerts.h"
 #include "Views/MainWindow/MainWindow.h"
 #include "Views/QuickAccess/QuickAccess.h"
@@ -57,6 +63,15 @@ namespace Raidcore::Nexus::GUI
 {
 	constexpr const char* LOG_CHANNEL = "GUI";
 
+	/* Depth of renders on the calling thread. A callback deregistering itself must not wait on itself. */
+	static thread_local uint32_t s_RenderDepth = 0;
+
+	/* Frames are built for a while after any change, so hover states and animations can settle. */
+	constexpr const long long IDLE_SETTLE_MS = 500;
+
+	/* Frames are built at least this often, for changes that are not signaled, e.g. textures finishing loading. */
+	constexpr const long long IDLE_REFRESH_MS = 250;
+
 	/*static*/ void Context::OnInputBindPressed(const char* aIdentifier)
 	{
 		Runtime& ctx = Runtime::Get();
@@ -200,6 +215,10 @@ namespace Raidcore::Nexus::GUI
 	{
 		ImGui::CreateContext();
 
+		this->NexusLink = static_cast<NexusLinkData_t*>(aDataLink.Get(DL_NEXUS_LINK));
+		this->MumbleLink = static_cast<Mumble::Data*>(aDataLink.Get(DL_MUMBLE_LINK));
+		this->MumbleIdentity = static_cast<Mumble::Identity*>(aDataLink.Get(DL_MUMBLE_LINK_IDENTITY));
+
 		this->Language = new Localization(aLogger, aSettings, aEventApi);
 		this->Alerts = new CAlerts(aDataLink);
 		this->MainWindow = new CMainWindow();
@@ -219,6 +238,26 @@ namespace Raidcore::Nexus::GUI
 
 		this->StyleMgr->ApplyStyle();
 		this->LoadFonts();
+
+		this->Scheduler.SetBudget(this->Settings.Get<float>(OPT_RENDERBUDGET, 0.0f));
+		this->Scheduler.SetInterval(this->Settings.Get<uint32_t>(OPT_RENDERTHROTTLE, 0));
+
+		this->Settings.Subscribe<float>(OPT_RENDERBUDGET, [&](float aMilliseconds)
+		{
+			this->Scheduler.SetBudget(aMilliseconds);
+		});
+
+		this->Settings.Subscribe<uint32_t>(OPT_RENDERTHROTTLE, [&](uint32_t aFrames)
+		{
+			this->Scheduler.SetInterval(aFrames);
+		});
+
+		this->IsIdleSkipping = this->Settings.Get<bool>(OPT_UI_IDLEFRAMES, false);
+
+		this->Settings.Subscribe<bool>(OPT_UI_IDLEFRAMES, [&](bool aEnabled)
+		{
+			this->IsIdleSkipping = aEnabled;
+		});
 	}
 
 	Context::~Context()
@@ -288,6 +327,11 @@ namespace Raidcore::Nexus::GUI
 		ImGui_ImplDX11_Shutdown();
 		ImGui_ImplWin32_Shutdown();
 
+		/* The output of previous frames references the released font texture. */
+		this->RenderWindows.clear();
+		this->Scheduler.Reset();
+		this->HasDrawData = false;
+
 		if (this->GrWindow.RenderTarget)
 		{
 			this->GrWindow.RenderTarget->Release();
@@ -313,6 +357,8 @@ namespace Raidcore::Nexus::GUI
 			this->Shutdown();
 		}
 
+		bool wasInvalidated = this->IsInvalid;
+
 		if (this->IsInvalid)
 		{
 			this->UpdateDisplayInputBinds();
@@ -325,15 +371,51 @@ namespace Raidcore::Nexus::GUI
 			this->IsInvalid = false;
 		}
 
-		const std::lock_guard<std::mutex> lock(this->RenderMutex);
+		/* Held until the end of the frame, deregistering waits for it to be released. */
+		std::shared_ptr<const RenderSnapshot_t> snapshot = this->RenderSnapshot.load(std::memory_order_acquire);
 
-		/* pre-render callbacks */
-		for (GUI_RENDER callback : this->GetRenderCallbacks(ERenderType::PreRender))
+		s_RenderDepth++;
+		this->FrameCount++;
+
+		if (snapshot->Generation != this->ScheduledGeneration)
 		{
-			callback();
+			std::vector<GUI_RENDER> callbacks;
+
+			for (const std::vector<GUI_RENDER>& registry : snapshot->ByType)
+			{
+				callbacks.insert(callbacks.end(), registry.begin(), registry.end());
+			}
+
+			this->Scheduler.Prune(callbacks);
+
+			for (auto it = this->RenderWindows.begin(); it != this->RenderWindows.end();)
+			{
+				if (std::find(callbacks.begin(), callbacks.end(), it->first) == callbacks.end())
+				{
+					it = this->RenderWindows.erase(it);
+				}
+				else
+				{
+					it++;
+				}
+			}
+
+			this->ScheduledGeneration = snapshot->Generation;
 		}
 
-		if (this->IsInitialized)
+		/* pre-render callbacks */
+		this->InvokeCallbacks(snapshot->ByType[static_cast<uint32_t>(ERenderType::PreRender)], false);
+
+		if (this->IsInitialized && this->IsIdleFrame(*snapshot, wasInvalidated))
+		{
+			/* Nothing changed, ImGui still holds the draw data of the last built frame. */
+			this->GrWindow.DeviceContext->OMSetRenderTargets(1, &this->GrWindow.RenderTarget, NULL);
+			ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+			this->TextureService.Touch(this->DrawnTextures);
+			this->IdleFrames++;
+		}
+		else if (this->IsInitialized)
 		{
 			this->Input->FlushInput();
 
@@ -352,10 +434,7 @@ namespace Raidcore::Nexus::GUI
 				if (this->IsVisible)
 				{
 					/* draw addons*/
-					for (GUI_RENDER callback : this->GetRenderCallbacks(ERenderType::Render))
-					{
-						callback();
-					}
+					this->InvokeCallbacks(snapshot->ByType[static_cast<uint32_t>(ERenderType::Render)], true);
 
 					/* draw nexus windows */
 					this->Alerts->Render();
@@ -365,7 +444,9 @@ namespace Raidcore::Nexus::GUI
 			}
 			else
 			{
-				/* license agreement */
+				/* license agreement, never idle while shown */
+				this->LastActivity = Time::GetTimestampMs();
+
 				static CLicenseAgreementModal s_Modal = {};
 				static bool s_Opened = []
 				{
@@ -395,13 +476,33 @@ namespace Raidcore::Nexus::GUI
 			ImGui::Render();
 			this->GrWindow.DeviceContext->OMSetRenderTargets(1, &this->GrWindow.RenderTarget, NULL);
 			ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+			/* Everything drawn counts as used for the texture budget, also textures addons keep pointers to. */
+			this->DrawnTextures.clear();
+
+			ImDrawData* drawData = ImGui::GetDrawData();
+
+			for (int i = 0; drawData && i < drawData->CmdListsCount; i++)
+			{
+				for (const ImDrawCmd& cmd : drawData->CmdLists[i]->CmdBuffer)
+				{
+					if (this->DrawnTextures.empty() || this->DrawnTextures.back() != cmd.TextureId)
+					{
+						this->DrawnTextures.push_back(cmd.TextureId);
+					}
+				}
+			}
+
+			this->TextureService.Touch(this->DrawnTextures);
+
+			this->HasDrawData = true;
+			this->LastBuilt = Time::GetTimestampMs();
 		}
 
 		/* post-render callbacks */
-		for (GUI_RENDER callback : this->GetRenderCallbacks(ERenderType::PostRender))
-		{
-			callback();
-		}
+		this->InvokeCallbacks(snapshot->ByType[static_cast<uint32_t>(ERenderType::PostRender)], false);
+
+		s_RenderDepth--;
 	}
 
 	void Context::Register(ERenderType aRenderType, GUI_RENDER aRenderCallback)
@@ -454,68 +555,101 @@ namespace Raidcore::Nexus::GUI
 		}
 
 		targetRegistry->push_back(aRenderCallback);
+		this->RenderOwners.Add(aRenderCallback, aRenderCallback);
+
+		Memory::ResourceLedger::Get()->AddByAddress(aRenderCallback, Memory::EResource::RenderCallbacks, 1);
+
+		/* Nothing was removed, frames in flight do not need to finish. */
+		this->Publish();
 	}
 
 	void Context::Deregister(GUI_RENDER aRenderCallback)
 	{
 		if (!aRenderCallback) { return; }
 
-		const std::lock_guard<std::mutex> lock(this->RenderMutex);
+		std::shared_ptr<const RenderSnapshot_t> previous;
 
-		for (size_t i = 0; i < static_cast<uint32_t>(ERenderType::COUNT); i++)
 		{
-			std::vector<GUI_RENDER>& registry = this->Registry[i];
-			registry.erase(std::remove(registry.begin(), registry.end(), aRenderCallback), registry.end());
+			const std::lock_guard<std::mutex> lock(this->RenderMutex);
+
+			int64_t removed = 0;
+
+			for (size_t i = 0; i < static_cast<uint32_t>(ERenderType::COUNT); i++)
+			{
+				std::vector<GUI_RENDER>& registry = this->Registry[i];
+				size_t before = registry.size();
+
+				registry.erase(std::remove(registry.begin(), registry.end(), aRenderCallback), registry.end());
+
+				removed += static_cast<int64_t>(before - registry.size());
+			}
+
+			this->RenderOwners.Remove(aRenderCallback, aRenderCallback);
+
+			Memory::ResourceLedger::Get()->AddByAddress(aRenderCallback, Memory::EResource::RenderCallbacks, -removed);
+
+			previous = this->Publish();
 		}
+
+		this->WaitForRender(previous);
 	}
 
 	uint32_t Context::CleanupRefs(void* aStartAddress, void* aEndAddress)
 	{
 		uint32_t refCounter = 0;
 
-		const std::lock_guard<std::mutex> lock(this->RenderMutex);
+		std::shared_ptr<const RenderSnapshot_t> previous;
 
-		for (size_t i = 0; i < static_cast<uint32_t>(ERenderType::COUNT); i++)
 		{
-			for (GUI_RENDER renderCb : this->Registry[i])
+			const std::lock_guard<std::mutex> lock(this->RenderMutex);
+
+			for (GUI_RENDER renderCb : this->RenderOwners.Take(aStartAddress, aEndAddress))
 			{
-				if (renderCb >= aStartAddress && renderCb <= aEndAddress)
+				for (size_t i = 0; i < static_cast<uint32_t>(ERenderType::COUNT); i++)
 				{
-					this->Registry[i].erase(std::remove(this->Registry[i].begin(), this->Registry[i].end(), renderCb), this->Registry[i].end());
-					refCounter++;
+					std::vector<GUI_RENDER>& registry = this->Registry[i];
+					size_t before = registry.size();
+
+					registry.erase(std::remove(registry.begin(), registry.end(), renderCb), registry.end());
+
+					refCounter += static_cast<uint32_t>(before - registry.size());
 				}
 			}
+
+			if (refCounter == 0) { return 0; }
+
+			Memory::ResourceLedger::Get()->AddByAddress(aStartAddress, Memory::EResource::RenderCallbacks, -static_cast<int64_t>(refCounter));
+
+			previous = this->Publish();
 		}
 
+		/* The module is unloaded after this returns. */
+		this->WaitForRender(previous);
+
 		return refCounter;
 	}
 
-	const std::vector<GUI_RENDER>& Context::GetRenderCallbacks(ERenderType aRenderType) const
+	std::vector<GUI_RENDER> Context::GetRenderCallbacks(ERenderType aRenderType) const
 	{
-		switch (aRenderType)
+		if (aRenderType >= ERenderType::COUNT)
 		{
-			case ERenderType::PreRender:
-			{
-				return this->Registry[static_cast<uint32_t>(ERenderType::PreRender)];
-			}
-			case ERenderType::Render:
-			{
-				return this->Registry[static_cast<uint32_t>(ERenderType::Render)];
-			}
-			case ERenderType::PostRender:
-			{
-				return this->Registry[static_cast<uint32_t>(ERenderType::PostRender)];
-			}
-			case ERenderType::OptionsRender:
-			{
-				return this->Registry[static_cast<uint32_t>(ERenderType::OptionsRender)];
-			}
-			default:
-			{
-				// TODO: This should be a macro for a "no default case".
-				throw "No valid case for switch variable 'aRenderType'";
-			}
+			// TODO: This should be a macro for a "no default case".
+			throw "No valid case for switch variable 'aRenderType'";
 		}
+
+		std::shared_ptr<const RenderSnapshot_t> snapshot = this->RenderSnapshot.load(std::memory_order_acquire);
+
+		return snapshot->ByType[static_cast<uint32_t>(aRenderType)];
+	}
+
+	const std::unordered_map<GUI_RENDER, RenderStats_t>& Context::GetRenderStats() const
+	{
+		return this->Scheduler.GetStats();
+	}
+
+	uint64_t Context::GetIdleFrames() const
+	{
+		return this->IdleFrames;
 	}
 
 	void Context::Invalidate()
@@ -636,4 +770,188 @@ namespace Raidcore::Nexus::GUI
 		this->FontManager->ReplaceFont("FIRASANS_XL", 19.5f, RES_FONT_FIRASANS, GetCurrentModule(), Context::OnFontUpdate, nullptr);
 		if (!fontPath.empty()) { this->FontManager->ReplaceFont("FIRASANS_XL_MERGE", 19.5f, fontPath.string().c_str(), Context::OnFontUpdate, &config); }
 	}
+
+	std::shared_ptr<const RenderSnapshot_t> Context::Publish()
+	{
+		std::shared_ptr<RenderSnapshot_t> snapshot = std::make_shared<RenderSnapshot_t>();
+		snapshot->Generation = ++this->RenderGeneration;
+
+		for (size_t i = 0; i < static_cast<uint32_t>(ERenderType::COUNT); i++)
+		{
+			snapshot->ByType[i] = this->Registry[i];
+		}
+
+		return this->RenderSnapshot.exchange(snapshot, std::memory_order_acq_rel);
+	}
+
+	void Context::WaitForRender(std::shared_ptr<const RenderSnapshot_t>& aSnapshot)
+	{
+		/* Called from within a callback, the render holding the snapshot is further up this stack. */
+		if (s_RenderDepth > 0) { return; }
+
+		/* Removed callbacks may belong to a module about to be unloaded, let the frame in flight finish first. */
+		while (aSnapshot.use_count() > 1)
+		{
+			std::this_thread::yield();
+		}
+
+		aSnapshot.reset();
+	}
+
+	void Context::InvokeCallbacks(const std::vector<GUI_RENDER>& aCallbacks, bool aIsInFrame)
+	{
+		for (GUI_RENDER callback : aCallbacks)
+		{
+			if (!aIsInFrame)
+			{
+				auto start = std::chrono::steady_clock::now();
+				callback();
+				auto end = std::chrono::steady_clock::now();
+
+				this->Scheduler.Record(callback, this->FrameCount, std::chrono::duration<float, std::milli>(end - start).count(), false);
+				continue;
+			}
+
+			ImGuiContext& g = *GImGui;
+
+			std::vector<ImGuiWindow*>& windows = this->RenderWindows[callback];
+
+			/* Skipping is only possible, if the windows of the last run were shown last frame and are not in use. */
+			bool canSkip = !windows.empty();
+
+			for (ImGuiWindow* window : windows)
+			{
+				ImGuiWindow* root = window->RootWindow;
+
+				if (window->LastFrameActive != g.FrameCount - 1 ||
+					g.HoveredRootWindow == root ||
+					(g.NavWindow && g.NavWindow->RootWindow == root) ||
+					(g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == root) ||
+					(g.MovingWindow && g.MovingWindow->RootWindow == root))
+				{
+					canSkip = false;
+					break;
+				}
+			}
+
+			if (!this->Scheduler.ShouldRun(callback, this->FrameCount, canSkip))
+			{
+				/* Not beginning the windows keeps their draw lists, marking them active draws and hit tests them as before. */
+				for (ImGuiWindow* window : windows)
+				{
+					window->Active = true;
+					window->LastFrameActive = g.FrameCount;
+					window->LastTimeActive = static_cast<float>(g.Time);
+				}
+
+				continue;
+			}
+
+			/* Anything drawn outside of the callback's own windows is lost, when it is skipped. */
+			ImGuiWindow* fallbackWindow = g.CurrentWindow;
+			int fallbackVtx = fallbackWindow ? fallbackWindow->DrawList->VtxBuffer.Size : 0;
+			int backgroundVtx = g.BackgroundDrawList.VtxBuffer.Size;
+			int foregroundVtx = g.ForegroundDrawList.VtxBuffer.Size;
+			int firstWindow = g.WindowsActiveCount;
+
+			auto start = std::chrono::steady_clock::now();
+			callback();
+			auto end = std::chrono::steady_clock::now();
+
+			bool isReplayable = g.CurrentWindow == fallbackWindow &&
+				(!fallbackWindow || fallbackWindow->DrawList->VtxBuffer.Size == fallbackVtx) &&
+				g.BackgroundDrawList.VtxBuffer.Size == backgroundVtx &&
+				g.ForegroundDrawList.VtxBuffer.Size == foregroundVtx;
+
+			windows.clear();
+
+			for (ImGuiWindow* window : g.Windows)
+			{
+				if (window->LastFrameActive != g.FrameCount || window->BeginOrderWithinContext < firstWindow) { continue; }
+
+				/* Popups and tooltips depend on state of the frame they were opened in. */
+				if (window->Flags & (ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip))
+				{
+					isReplayable = false;
+					break;
+				}
+
+				windows.push_back(window);
+			}
+
+			if (!isReplayable)
+			{
+				windows.clear();
+			}
+
+			this->Scheduler.Record(
+				callback,
+				this->FrameCount,
+				std::chrono::duration<float, std::milli>(end - start).count(),
+				!windows.empty()
+			);
+		}
+	}
+
+	UiFrameState_t Context::GetFrameState() const
+	{
+		UiFrameState_t state{};
+		state.Width     = this->GrWindow.Width;
+		state.Height    = this->GrWindow.Height;
+		state.IsVisible = this->IsVisible;
+
+		state.TextureGeneration = this->TextureService.GetGeneration();
+
+		if (this->NexusLink)
+		{
+			state.Scaling    = this->NexusLink->Scaling;
+			state.IsGameplay = this->NexusLink->IsGameplay;
+		}
+
+		if (this->MumbleLink)
+		{
+			state.IsInCombat       = this->MumbleLink->Context.IsInCombat;
+			state.IsMapOpen        = this->MumbleLink->Context.IsMapOpen;
+			state.IsGameFocused    = this->MumbleLink->Context.IsGameFocused;
+			state.IsTextboxFocused = this->MumbleLink->Context.IsTextboxFocused;
+		}
+
+		if (this->MumbleIdentity)
+		{
+			state.UISize = static_cast<uint32_t>(this->MumbleIdentity->UISize);
+		}
+
+		return state;
+	}
+
+	bool Context::IsIdleFrame(const RenderSnapshot_t& aSnapshot, bool aWasInvalidated)
+	{
+		long long now = Time::GetTimestampMs();
+
+		/* Consumed every frame, so activity while skipping was disabled does not linger. */
+		bool hasInput = this->Input->ConsumeActivity();
+
+		UiFrameState_t state = this->GetFrameState();
+
+		if (aWasInvalidated || hasInput || state != this->LastFrameState)
+		{
+			this->LastActivity = now;
+			this->LastFrameState = state;
+		}
+
+		if (!this->IsIdleSkipping || !this->HasDrawData) { return false; }
+
+		/* Addons may draw something different every frame. */
+		if (!aSnapshot.ByType[static_cast<uint32_t>(ERenderType::Render)].empty()) { return false; }
+
+		/* Animated or frequently changing content. */
+		if (!this->Alerts->IsEmpty() || this->MainWindow->HasVisibleWindows()) { return false; }
+
+		if (ImGui::GetIO().WantTextInput || ImGui::IsAnyItemActive()) { return false; }
+
+		if (now - this->LastActivity < IDLE_SETTLE_MS) { return false; }
+		if (now - this->LastBuilt >= IDLE_REFRESH_MS)  { return false; }
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <windows.h>
 
@@ -22,6 +25,7 @@
 #include "Host/Events/EvtApi.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
 #include "UI/Services/Fonts/FontManager.h"
 #include "UI/Services/Localization/LoclApi.h"
 #include "UI/Services/QoL/EscapeClosing.h"
@@ -34,9 +38,12 @@
 #include "UiEnum.h"
 #include "UiFuncDefs.h"
 #include "UiInput.h"
+#include "UiScheduler.h"
 
 using namespace Raidcore::Nexus;
 
+struct ImGuiWindow;
+
 constexpr const char* KB_MENU = "KB_MENU";
 constexpr const char* KB_ADDONS = "KB_ADDONS";
 constexpr const char* KB_OPTIONS = "KB_OPTIONS";
@@ -50,6 +57,37 @@ constexpr const char* KB_TOGGLEHIDEUI = "KB_TOGGLEHIDEUI";
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::GUI
 {
+	///----------------------------------------------------------------------------------------------------
+	/// RenderSnapshot_t Struct
+	/// 	Immutable, the registered callbacks of each render type in registration order.
+	///----------------------------------------------------------------------------------------------------
+	struct RenderSnapshot_t
+	{
+		uint64_t                Generation;
+		std::vector<GUI_RENDER> ByType[static_cast<uint32_t>(ERenderType::COUNT)];
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// UiFrameState_t Struct
+	/// 	External state the UI depends on, a change wakes it from idling.
+	///----------------------------------------------------------------------------------------------------
+	struct UiFrameState_t
+	{
+		uint32_t Width;
+		uint32_t Height;
+		float    Scaling;
+		uint32_t UISize;
+		bool     IsGameplay;
+		bool     IsInCombat;
+		bool     IsMapOpen;
+		bool     IsGameFocused;
+		bool     IsTextboxFocused;
+		bool     IsVisible;
+		uint64_t TextureGeneration; /* Released textures may still be referenced by the last draw data. */
+
+		bool operator==(const UiFrameState_t&) const = default;
+	};
+
 	///----------------------------------------------------------------------------------------------------
 	/// Context Class
 	///----------------------------------------------------------------------------------------------------
@@ -126,6 +164,7 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		/// Deregister:
 		/// 	Deregisters the provided Render callback.
+		/// 	Returns once it is no longer invoked.
 		///----------------------------------------------------------------------------------------------------
 		void Deregister(GUI_RENDER aRenderCallback);
 
@@ -139,7 +178,19 @@ namespace Raidcore::Nexus::GUI
 		/// GetRenderCallbacks:
 		/// 	Returns a copy of the specified callbacks.
 		///----------------------------------------------------------------------------------------------------
-		const std::vector<GUI_RENDER>& GetRenderCallbacks(ERenderType aRenderType) const;
+		std::vector<GUI_RENDER> GetRenderCallbacks(ERenderType aRenderType) const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetRenderStats:
+		/// 	Returns the timings of all callbacks. Only valid on the render thread.
+		///----------------------------------------------------------------------------------------------------
+		const std::unordered_map<GUI_RENDER, RenderStats_t>& GetRenderStats() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetIdleFrames:
+		/// 	Returns the amount of frames the UI was drawn again instead of built.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetIdleFrames() const;
 
 		///----------------------------------------------------------------------------------------------------
 		/// Invalidate:
@@ -211,6 +262,11 @@ namespace Raidcore::Nexus::GUI
 		CMainWindow* MainWindow;
 		CQuickAccess* QuickAccess;
 
+		/* Links */
+		NexusLinkData_t* NexusLink;
+		Mumble::Data* MumbleLink;
+		Mumble::Identity* MumbleIdentity;
+
 		/* UI Services */
 		CFontManager* FontManager;
 		CEscapeClosing* EscapeClose;
@@ -223,7 +279,62 @@ namespace Raidcore::Nexus::GUI
 		bool                    IsVisible = true;
 		bool                    IsInvalid = true;
 
+		/* Writers only, rendering reads the snapshot. */
 		std::mutex              RenderMutex;
 		std::vector<GUI_RENDER> Registry[static_cast<uint32_t>(ERenderType::COUNT)];
+		Memory::OwnerIndex<GUI_RENDER> RenderOwners;
+		uint64_t                RenderGeneration = 0;
+
+		std::atomic<std::shared_ptr<const RenderSnapshot_t>> RenderSnapshot{ std::make_shared<const RenderSnapshot_t>() };
+
+		/* Render thread only. */
+		uint64_t                FrameCount = 0;
+		uint64_t                ScheduledGeneration = 0;
+		CRenderScheduler        Scheduler;
+		std::unordered_map<GUI_RENDER, std::vector<ImGuiWindow*>> RenderWindows; /* Windows of the last run, shown again when skipped. */
+
+		std::vector<void*>      DrawnTextures; /* Reused every frame. */
+
+		/* Idle frames, render thread only. */
+		bool                    IsIdleSkipping = false;
+		bool                    HasDrawData = false; /* The draw data of the last built frame is still valid. */
+		UiFrameState_t          LastFrameState{};
+		long long               LastActivity = 0;
+		long long               LastBuilt = 0;
+		uint64_t                IdleFrames = 0;
+
+		///----------------------------------------------------------------------------------------------------
+		/// Publish:
+		/// 	Builds a snapshot of the registry, swaps it in and returns the previous one.
+		/// 	Must be called with the lock held.
+		///----------------------------------------------------------------------------------------------------
+		std::shared_ptr<const RenderSnapshot_t> Publish();
+
+		///----------------------------------------------------------------------------------------------------
+		/// WaitForRender:
+		/// 	Waits until the given snapshot is no longer rendered on another thread.
+		/// 	Must be called without the lock held, callbacks may register while waited on.
+		///----------------------------------------------------------------------------------------------------
+		void WaitForRender(std::shared_ptr<const RenderSnapshot_t>& aSnapshot);
+
+		///----------------------------------------------------------------------------------------------------
+		/// InvokeCallbacks:
+		/// 	Invokes and times the callbacks. Only callbacks drawing into the current ImGui frame
+		/// 	are subject to throttling.
+		///----------------------------------------------------------------------------------------------------
+		void InvokeCallbacks(const std::vector<GUI_RENDER>& aCallbacks, bool aIsInFrame);
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetFrameState:
+		/// 	Returns the current external state the UI depends on.
+		///----------------------------------------------------------------------------------------------------
+		UiFrameState_t GetFrameState() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// IsIdleFrame:
+		/// 	Returns true if nothing changed for a while and the last frame can be drawn again
+		/// 	instead of building a new one.
+		///----------------------------------------------------------------------------------------------------
+		bool IsIdleFrame(const RenderSnapshot_t& aSnapshot, bool aWasInvalidated);
 	};
 }
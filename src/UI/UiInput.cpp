@@ -57,6 +57,22 @@ namespace Raidcore::Nexus::GUI
 
 		bool reqModsDown = (this->RequiredModifiers & activeModifiers) == this->RequiredModifiers;
 
+		/* Camera movement and keys the UI does not receive leave it unchanged. */
+		if (uMsg >= WM_MOUSEFIRST && uMsg <= WM_MOUSELAST)
+		{
+			if (!Inputs::IsCursorHidden())
+			{
+				this->HasActivity.store(true, std::memory_order_relaxed);
+			}
+		}
+		else if (uMsg >= WM_KEYFIRST && uMsg <= WM_KEYLAST)
+		{
+			if (io.WantTextInput || (wParam < 256 && io.KeysDown[wParam]))
+			{
+				this->HasActivity.store(true, std::memory_order_relaxed);
+			}
+		}
+
 		switch (uMsg)
 		{
 			/* Don't relay mouse movement to ImGui, if the cursor is hidden. */
@@ -219,6 +235,11 @@ namespace Raidcore::Nexus::GUI
 		}
 	}
 
+	bool CUiInput::ConsumeActivity()
+	{
+		return this->HasActivity.exchange(false, std::memory_order_relaxed);
+	}
+
 	bool CUiInput::PushInput(const InputEvent_t& aEvent)
 	{
 		const uint32_t write = this->WriteIndex.load(std::memory_order::relaxed);
@@ -65,6 +65,12 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		void FlushInput();
 
+		///----------------------------------------------------------------------------------------------------
+		/// ConsumeActivity:
+		/// 	Returns true if input relevant to the UI arrived since the last call.
+		///----------------------------------------------------------------------------------------------------
+		bool ConsumeActivity();
+
 		private:
 		Core::SettingsMgr& Settings;
 
@@ -79,6 +85,8 @@ namespace Raidcore::Nexus::GUI
 		std::atomic<uint32_t> WriteIndex{ 0 };
 		std::atomic<uint32_t> ReadIndex{ 0 };
 
+		std::atomic<bool>     HasActivity{ false };
+
 		///----------------------------------------------------------------------------------------------------
 		/// PushInput:
 		/// 	Pushes an input event to the ring buffer.
@@ -0,0 +1,148 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UiScheduler.cpp
+/// Description  :  Frame budgets and throttling of render callbacks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "UiScheduler.h"
+
+#include <algorithm>
+
+namespace Raidcore::Nexus::GUI
+{
+	/* Weight of the latest run in the moving average. */
+	constexpr const float AVERAGE_WEIGHT = 0.1f;
+
+	void CRenderScheduler::SetBudget(float aMilliseconds)
+	{
+		this->Budget = aMilliseconds > 0.0f ? aMilliseconds : 0.0f;
+
+		if (!this->CanThrottle())
+		{
+			this->Reset();
+		}
+	}
+
+	void CRenderScheduler::SetInterval(uint32_t aFrames)
+	{
+		this->Interval = aFrames;
+
+		if (!this->CanThrottle())
+		{
+			this->Reset();
+		}
+	}
+
+	bool CRenderScheduler::ShouldRun(GUI_RENDER aCallback, uint64_t aFrame, bool aCanSkip)
+	{
+		auto it = this->Stats.find(aCallback);
+
+		if (it == this->Stats.end()) { return true; }
+
+		RenderStats_t& stats = it->second;
+
+		if (!stats.IsThrottled) { return true; }
+
+		/* Interaction needs the callback every frame, it has to build up to being throttled again. */
+		if (!aCanSkip)
+		{
+			stats.IsThrottled = false;
+			stats.OverBudget = 0;
+			stats.InBudget = 0;
+			return true;
+		}
+
+		if (aFrame - stats.LastRun >= this->Interval) { return true; }
+
+		stats.Skips++;
+		return false;
+	}
+
+	void CRenderScheduler::Record(GUI_RENDER aCallback, uint64_t aFrame, float aMilliseconds, bool aIsReplayable)
+	{
+		RenderStats_t& stats = this->Stats[aCallback];
+
+		stats.History[stats.HistoryIndex] = aMilliseconds;
+		stats.HistoryIndex = (stats.HistoryIndex + 1) % RENDERSTATS_HISTORY;
+		stats.HistoryCount = std::min(stats.HistoryCount + 1, RENDERSTATS_HISTORY);
+
+		stats.Average = stats.Runs == 0
+			? aMilliseconds
+			: stats.Average + (aMilliseconds - stats.Average) * AVERAGE_WEIGHT;
+
+		stats.LastRun = aFrame;
+		stats.Runs++;
+		stats.IsReplayable = aIsReplayable;
+
+		if (!this->CanThrottle() || !aIsReplayable)
+		{
+			stats.OverBudget = 0;
+			stats.InBudget = 0;
+			stats.IsThrottled = false;
+			return;
+		}
+
+		if (aMilliseconds > this->Budget)
+		{
+			stats.OverBudget++;
+			stats.InBudget = 0;
+		}
+		else
+		{
+			stats.OverBudget = 0;
+
+			if (stats.IsThrottled)
+			{
+				stats.InBudget++;
+			}
+		}
+
+		if (!stats.IsThrottled && stats.OverBudget >= RENDERSCHED_THROTTLE_AFTER)
+		{
+			stats.IsThrottled = true;
+			stats.InBudget = 0;
+		}
+		else if (stats.IsThrottled && stats.InBudget >= RENDERSCHED_RECOVER_AFTER)
+		{
+			stats.IsThrottled = false;
+			stats.InBudget = 0;
+		}
+	}
+
+	void CRenderScheduler::Prune(const std::vector<GUI_RENDER>& aCallbacks)
+	{
+		for (auto it = this->Stats.begin(); it != this->Stats.end();)
+		{
+			if (std::find(aCallbacks.begin(), aCallbacks.end(), it->first) == aCallbacks.end())
+			{
+				it = this->Stats.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+	}
+
+	void CRenderScheduler::Reset()
+	{
+		for (auto& [callback, stats] : this->Stats)
+		{
+			stats.OverBudget = 0;
+			stats.InBudget = 0;
+			stats.IsThrottled = false;
+		}
+	}
+
+	const std::unordered_map<GUI_RENDER, RenderStats_t>& CRenderScheduler::GetStats() const
+	{
+		return this->Stats;
+	}
+
+	bool CRenderScheduler::CanThrottle() const
+	{
+		return this->Budget > 0.0f && this->Interval > 1;
+	}
+}
@@ -0,0 +1,124 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UiScheduler.h
+/// Description  :  Frame budgets and throttling of render callbacks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "UiFuncDefs.h"
+
+constexpr const uint32_t RENDERSTATS_HISTORY = 120;
+
+/* Consecutive runs over budget, before a callback is throttled. */
+constexpr const uint32_t RENDERSCHED_THROTTLE_AFTER = 30;
+
+/* Consecutive runs within budget, before a throttled callback runs every frame again. */
+constexpr const uint32_t RENDERSCHED_RECOVER_AFTER = 10;
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::GUI Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::GUI
+{
+	///----------------------------------------------------------------------------------------------------
+	/// RenderStats_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct RenderStats_t
+	{
+		float    History[RENDERSTATS_HISTORY]; /* Milliseconds per run, ring buffer. */
+		uint32_t HistoryIndex;                 /* Next write position, also the oldest entry. */
+		uint32_t HistoryCount;
+		float    Average;                      /* Moving average in milliseconds. */
+
+		uint32_t OverBudget;                   /* Consecutive runs over budget. */
+		uint32_t InBudget;                     /* Consecutive runs within budget, while throttled. */
+		uint64_t LastRun;                      /* Frame of the last run. */
+		uint64_t Runs;
+		uint64_t Skips;
+
+		bool     IsReplayable;                 /* Whether the output of the last run can be shown again. */
+		bool     IsThrottled;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// CRenderScheduler Class
+	/// 	Decides which callbacks run in a frame. Callbacks that are over budget for a while run only
+	/// 	every Nth frame, as long as they are not interacted with and their last output can be reused.
+	/// 	Does not measure time itself, the caller passes frame numbers and durations.
+	///----------------------------------------------------------------------------------------------------
+	class CRenderScheduler
+	{
+		public:
+		///----------------------------------------------------------------------------------------------------
+		/// ctor
+		///----------------------------------------------------------------------------------------------------
+		CRenderScheduler() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// dtor
+		///----------------------------------------------------------------------------------------------------
+		~CRenderScheduler() = default;
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetBudget:
+		/// 	Sets the budget per callback and frame in milliseconds. Zero disables throttling.
+		///----------------------------------------------------------------------------------------------------
+		void SetBudget(float aMilliseconds);
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetInterval:
+		/// 	Sets every how many frames throttled callbacks run. Zero or one disables throttling.
+		///----------------------------------------------------------------------------------------------------
+		void SetInterval(uint32_t aFrames);
+
+		///----------------------------------------------------------------------------------------------------
+		/// ShouldRun:
+		/// 	Returns true if the callback should run in the given frame.
+		/// 	- aCanSkip: False if the callback is interacted with or its last output is unavailable.
+		///----------------------------------------------------------------------------------------------------
+		bool ShouldRun(GUI_RENDER aCallback, uint64_t aFrame, bool aCanSkip);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Record:
+		/// 	Records a run of the callback.
+		/// 	- aIsReplayable: Whether the output can be shown again in frames the callback is skipped.
+		///----------------------------------------------------------------------------------------------------
+		void Record(GUI_RENDER aCallback, uint64_t aFrame, float aMilliseconds, bool aIsReplayable);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Prune:
+		/// 	Drops the stats of all callbacks not contained in the given list.
+		///----------------------------------------------------------------------------------------------------
+		void Prune(const std::vector<GUI_RENDER>& aCallbacks);
+
+		///----------------------------------------------------------------------------------------------------
+		/// Reset:
+		/// 	Lifts all throttling, e.g. after the output of previous frames was invalidated.
+		///----------------------------------------------------------------------------------------------------
+		void Reset();
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetStats:
+		/// 	Returns the stats of all callbacks.
+		///----------------------------------------------------------------------------------------------------
+		const std::unordered_map<GUI_RENDER, RenderStats_t>& GetStats() const;
+
+		private:
+		float                                         Budget   = 0.0f;
+		uint32_t                                      Interval = 0;
+		std::unordered_map<GUI_RENDER, RenderStats_t> Stats;
+
+		///----------------------------------------------------------------------------------------------------
+		/// CanThrottle:
+		/// 	Returns true if budget and interval are set.
+		///----------------------------------------------------------------------------------------------------
+		bool CanThrottle() const;
+	};
+}
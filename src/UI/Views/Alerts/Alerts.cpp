@@ -101,4 +101,11 @@ namespace Raidcore::Nexus::GUI
 			this->Queue.push_back(AlertMessage_t{ aType, aMessage });
 		}
 	}
+
+	bool CAlerts::IsEmpty()
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		return this->Queue.empty();
+	}
 }
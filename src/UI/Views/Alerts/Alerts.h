@@ -46,6 +46,12 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		void Notify(EAlertType aType, const char* aMessage);
 
+		///----------------------------------------------------------------------------------------------------
+		/// IsEmpty:
+		/// 	Returns true if no alert is queued or shown.
+		///----------------------------------------------------------------------------------------------------
+		bool IsEmpty();
+
 		private:
 		Core::DataLinkApi&          DataLink;
 
@@ -8,11 +8,14 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
 #include "Host/Addons/Addon.h"
+#include "Host/Config/Config.h"
 #include "Host/Library/LibAddon.h"
+#include "Host/Loader/LdrSnapshot.h"
 #include "UI/UiBinds.h"
 #include "Util/Strings.h"
 
@@ -25,9 +28,14 @@ using ArcExtensionDef_t = GW2::ArcDPS::ExtensionDef_t;
 ///----------------------------------------------------------------------------------------------------
 namespace Raidcore::Nexus::GUI
 {
+	///----------------------------------------------------------------------------------------------------
+	/// AddonListing_t Struct
+	/// 	Rendered from the snapshot it was listed from. The live addon is only resolved for actions.
+	///----------------------------------------------------------------------------------------------------
 	struct AddonListing_t
 	{
-		CAddon* Addon;
+		std::shared_ptr<const Host::AddonInfo_t>           Info;         /* Installed addon, if any. */
+		Host::Config_t*                                    Config;       /* Owned by the config manager. */
 
 		bool                                               HasLibDef;
 		Host::LibraryAddon_t                               LibraryDef;
@@ -50,10 +58,10 @@ namespace Raidcore::Nexus::GUI
 			}
 			else
 			{
-				if (this->Addon)
+				if (this->Info)
 				{
 					/* Use addon file location. */
-					id = this->Addon->GetLocation().string();
+					id = this->Info->Location.string();
 				}
 				else
 				{
@@ -67,9 +75,9 @@ namespace Raidcore::Nexus::GUI
 
 		inline uint32_t GetSig() const
 		{
-			if (this->Addon)
+			if (this->Info)
 			{
-				return this->Addon->GetSignature();
+				return this->Info->Signature;
 			}
 
 			if (this->HasLibDef)
@@ -82,9 +90,9 @@ namespace Raidcore::Nexus::GUI
 
 		inline std::string GetName() const
 		{
-			if (this->Addon)
+			if (this->Info)
 			{
-				return this->Addon->GetName();
+				return this->Info->Name;
 			}
 
 			if (this->HasLibDef)
@@ -97,9 +105,9 @@ namespace Raidcore::Nexus::GUI
 
 		inline std::string GetAuthor() const
 		{
-			if (this->Addon)
+			if (this->Info)
 			{
-				return this->Addon->GetAuthor();
+				return this->Info->Author;
 			}
 
 			if (this->HasLibDef)
@@ -112,9 +120,9 @@ namespace Raidcore::Nexus::GUI
 
 		inline std::string GetDesc() const
 		{
-			if (this->Addon)
+			if (this->Info)
 			{
-				return this->Addon->GetDescription();
+				return this->Info->Description;
 			}
 
 			if (this->HasLibDef)
@@ -127,12 +135,53 @@ namespace Raidcore::Nexus::GUI
 
 		inline std::string GetVersion() const
 		{
-			if (this->Addon)
+			if (this->Info)
 			{
-				return this->Addon->GetVersion();
+				return this->Info->Version;
 			}
 
 			return "";
 		}
+
+		inline bool IsLoaded() const
+		{
+			return this->Info && this->Info->State == Host::EAddonState::Loaded;
+		}
+
+		inline bool HasFlag(EAddonFlags aFlag) const
+		{
+			return this->Info && (static_cast<EAddonFlags>(this->Info->Flags) & aFlag) == aFlag;
+		}
+
+		inline bool SupportsLoading() const
+		{
+			return this->Info && (bool)(static_cast<EAddonInterfaces>(this->Info->Interfaces) & EAddonInterfaces::Nexus);
+		}
+
+		inline bool IsVersionDisabled() const
+		{
+			if (!this->Info || !this->Config) { return false; }
+
+			return !this->Config->DisableVersion.empty() && this->Config->DisableVersion == this->Info->MD5;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetAddon:
+		/// 	Returns the live addon, if it is still tracked. Locks the loader, only call on user actions.
+		///----------------------------------------------------------------------------------------------------
+		inline CAddon* GetAddon(Host::Loader& aLoader) const
+		{
+			if (!this->Info) { return nullptr; }
+
+			for (Host::IAddon* addon : aLoader.GetAddons())
+			{
+				if (addon == this->Info->Addon)
+				{
+					return dynamic_cast<CAddon*>(addon);
+				}
+			}
+
+			return nullptr;
+		}
 	};
 }
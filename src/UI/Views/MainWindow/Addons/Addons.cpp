@@ -8,6 +8,7 @@
 
 #include "Addons.h"
 
+#include <algorithm>
 #include <shellapi.h>
 
 #include "imgui/imgui.h"
@@ -17,9 +18,12 @@
 using namespace Raidcore::Nexus;
 
 #include "Host/Library/LibAddon.h"
+#include "Host/Resources/ResMonitor.h"
 #include "Index/Index.h"
 #include "CtlAddonToggle.h"
+#include "Memory/ResourceLedger.h"
 #include "res/ResConst.h"
+#include "UI/Controls/CtlImage.h"
 #include "Util/DLL.h"
 #include "Util/Strings.h"
 
@@ -153,11 +157,11 @@ namespace Raidcore::Nexus::GUI
 			statusBarCol = ImColor(85, 85, 85, 255);
 			drawStatusBar = true;
 
-			if (aAddonData.Addon && aAddonData.Addon->IsLoaded())
+			if (aAddonData.IsLoaded())
 			{
 				statusBarCol = ImColor(89, 172, 98, 255);
 			}
-			else if (aAddonData.Addon && aAddonData.Addon->IsVersionDisabled())
+			else if (aAddonData.IsVersionDisabled())
 			{
 				statusBarCol = ImColor(172, 89, 89, 255);
 				/* TODO: other error states. */
@@ -171,9 +175,9 @@ namespace Raidcore::Nexus::GUI
 			{
 				/* Name */
 				ImGui::Text(aAddonData.GetName().c_str());
-				if (aAddonData.Addon)
+				if (aAddonData.Info)
 				{
-					ImGui::TooltipGeneric(aAddonData.Addon->GetLocation().string().c_str());
+					ImGui::TooltipGeneric(aAddonData.Info->Location.string().c_str());
 				}
 
 				/* Version */
@@ -201,20 +205,14 @@ namespace Raidcore::Nexus::GUI
 			ImGui::SameLine();
 			ImGui::BeginGroup();
 			{
-				if (aAddonData.Addon)
+				if (aAddonData.Info)
 				{
-					if (aAddonData.Addon->SupportsLoading())
+					if (aAddonData.SupportsLoading())
 					{
 						/* Toggle Load */
-						if (ImGui::Button(AddonToggleCtl::GetButtonText(aAddonData.Addon).c_str(), ImVec2(btnWidth, 0)))
+						if (ImGui::Button(AddonToggleCtl::GetButtonText(aAddonData).c_str(), ImVec2(btnWidth, 0)))
 						{
-							/* Prompt if true, otherwise it already toggled now. */
-							if (AddonToggleCtl::Toggle(aAddonData.Addon))
-							{
-								Host::Config_t* config = aAddonData.Addon->GetConfig();
-
-								this->LoadConfirmationModal.SetTarget(config, aAddonData.GetName(), aAddonData.Addon->GetLocation());
-							}
+							this->ToggleAddon(aAddonData);
 						}
 
 						/* Configure */
@@ -260,8 +258,35 @@ namespace Raidcore::Nexus::GUI
 		}
 	}
 
+	void CAddonsWindow::ToggleAddon(const AddonListing_t& aAddonData)
+	{
+		CAddon* addon = aAddonData.GetAddon(Runtime::Get().Loader());
+
+		if (!addon) { return; }
+
+		/* Prompt if true, otherwise it already toggled now. */
+		if (AddonToggleCtl::Toggle(addon))
+		{
+			this->LoadConfirmationModal.SetTarget(addon->GetConfig(), aAddonData.GetName(), addon->GetLocation());
+		}
+	}
+
 	void CAddonsWindow::RenderContent()
 	{
+		static Host::LibraryMgr& libmgr = Runtime::Get().Library();
+		static Host::Loader& loader = Runtime::Get().Loader();
+
+		/* Addons changed state, e.g. an action started or finished. */
+		if (loader.GetGeneration() != this->AddonsGeneration)
+		{
+			this->IsInvalid = true;
+		}
+
+		if (!this->IsInvalid && libmgr.GetGeneration() != this->LibraryGeneration)
+		{
+			this->ApplyLibraryChanges();
+		}
+
 		if (this->IsInvalid)
 		{
 			static Runtime& ctx = Runtime::Get();
@@ -337,7 +362,7 @@ namespace Raidcore::Nexus::GUI
 			if (s_ClearIcon)
 			{
 				ImGui::SameLine();
-				if (ImGui::ImageButton(s_ClearIcon->Resource, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
+				if (GUI::ImageButton(s_ClearIcon, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
 				{
 					memset(s_SearchTerm, 0, 400);
 					this->SearchTerm = String::ToLower(s_SearchTerm);
@@ -351,7 +376,7 @@ namespace Raidcore::Nexus::GUI
 			if (viewModeIcon)
 			{
 				ImGui::SameLine();
-				if (ImGui::ImageButton(viewModeIcon->Resource, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
+				if (GUI::ImageButton(viewModeIcon, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
 				{
 					viewModeIcon = nullptr;
 					this->IsListMode = !this->IsListMode;
@@ -371,7 +396,7 @@ namespace Raidcore::Nexus::GUI
 					doPopHighlight = true;
 				}
 
-				if (ImGui::ImageButton(s_FilterIcon->Resource, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
+				if (GUI::ImageButton(s_FilterIcon, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
 				{
 					ImGui::OpenPopup("Filters");
 				}
@@ -506,6 +531,11 @@ namespace Raidcore::Nexus::GUI
 				/* Details view */
 				this->RenderDetails();
 			}
+			else if (this->IsResourcesView)
+			{
+				/* Resource usage */
+				this->RenderResources();
+			}
 			else if (this->Addons.size() == 0)
 			{
 				/* Nothing matching filter. */
@@ -539,9 +569,146 @@ namespace Raidcore::Nexus::GUI
 		ImGui::EndChild();
 	}
 
+	void CAddonsWindow::RenderResources()
+	{
+		Runtime& ctx = Runtime::Get();
+
+		std::vector<Host::ResourceOwner_t> report = ctx.Resources().GetReport();
+
+		constexpr uint32_t resCount = static_cast<uint32_t>(Memory::EResource::COUNT);
+
+		ImGuiTableFlags flags = ImGuiTableFlags_Sortable
+			| ImGuiTableFlags_SortTristate
+			| ImGuiTableFlags_RowBg
+			| ImGuiTableFlags_BordersInnerH
+			| ImGuiTableFlags_Resizable
+			| ImGuiTableFlags_SizingFixedFit
+			| ImGuiTableFlags_ScrollX
+			| ImGuiTableFlags_ScrollY;
+
+		uint64_t dropped = Memory::ResourceLedger::Get()->GetDroppedCount();
+
+		if (dropped > 0)
+		{
+			ImGui::TextDisabled("%llu updates were not accounted, all %u owner slots are taken.", dropped, RESLEDGER_MAXOWNERS);
+		}
+
+		if (!ImGui::BeginTable("table_resources_addons", resCount + 1, flags)) { return; }
+
+		ImGui::TableSetupScrollFreeze(1, 1);
+		ImGui::TableSetupColumn("Addon", ImGuiTableColumnFlags_NoHide, 0.0f, 0);
+
+		for (uint32_t res = 0; res < resCount; res++)
+		{
+			ImGuiTableColumnFlags colFlags = ImGuiTableColumnFlags_PreferSortDescending;
+
+			if (static_cast<Memory::EResource>(res) == Memory::EResource::TextureBytes)
+			{
+				colFlags |= ImGuiTableColumnFlags_DefaultSort;
+			}
+
+			ImGui::TableSetupColumn(Memory::ResourceLedger::ToString(static_cast<Memory::EResource>(res)), colFlags, 0.0f, res + 1);
+		}
+
+		ImGui::TableHeadersRow();
+
+		/* The report changes once per second, sorting the copy every frame is cheaper than caching it. */
+		ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+
+		if (sortSpecs && sortSpecs->SpecsCount > 0)
+		{
+			const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[0];
+			bool isDescending = spec.SortDirection == ImGuiSortDirection_Descending;
+
+			std::stable_sort(report.begin(), report.end(), [&spec, isDescending](const Host::ResourceOwner_t& lhs, const Host::ResourceOwner_t& rhs)
+			{
+				if (spec.ColumnUserID == 0)
+				{
+					return isDescending ? lhs.Name > rhs.Name : lhs.Name < rhs.Name;
+				}
+
+				Memory::EResource res = static_cast<Memory::EResource>(spec.ColumnUserID - 1);
+
+				return isDescending
+					? lhs.Usage.Get(res) > rhs.Usage.Get(res)
+					: lhs.Usage.Get(res) < rhs.Usage.Get(res);
+			});
+		}
+
+		/* Formats a value according to its resource. */
+		auto renderValue = [](Memory::EResource aResource, int64_t aValue)
+		{
+			switch (aResource)
+			{
+				case Memory::EResource::TextureBytes:
+				case Memory::EResource::DataLinkBytes:
+				case Memory::EResource::LogBytes:
+				{
+					ImGui::Text("%s", String::FormatByteSize(aValue > 0 ? static_cast<uint64_t>(aValue) : 0).c_str());
+					break;
+				}
+				case Memory::EResource::LoadTimeUs:
+				{
+					ImGui::Text("%.1f ms", aValue / 1000.0f);
+					break;
+				}
+				default:
+				{
+					ImGui::Text("%lld", aValue);
+					break;
+				}
+			}
+		};
+
+		for (const Host::ResourceOwner_t& owner : report)
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableSetColumnIndex(0);
+
+			if (owner.IsLoaded)
+			{
+				ImGui::Text("%s", owner.Name.c_str());
+			}
+			else
+			{
+				/* Unloaded addons keep their textures and shared memory. */
+				ImGui::TextDisabled("%s", owner.Name.c_str());
+			}
+
+			for (uint32_t res = 0; res < resCount; res++)
+			{
+				ImGui::TableSetColumnIndex(res + 1);
+				renderValue(static_cast<Memory::EResource>(res), owner.Usage.Values[res]);
+			}
+		}
+
+		std::vector<Memory::ResourceUsage_t> usage;
+		usage.reserve(report.size());
+
+		for (const Host::ResourceOwner_t& owner : report)
+		{
+			usage.push_back(owner.Usage);
+		}
+
+		Memory::ResourceUsage_t total = Memory::ResourceLedger::Sum(usage);
+
+		ImGui::TableNextRow();
+		ImGui::TableSetColumnIndex(0);
+		ImGui::TextDisabled("Total");
+
+		for (uint32_t res = 0; res < resCount; res++)
+		{
+			ImGui::TableSetColumnIndex(res + 1);
+			renderValue(static_cast<Memory::EResource>(res), total.Values[res]);
+		}
+
+		ImGui::EndTable();
+	}
+
 	void CAddonsWindow::RenderDetails()
 	{
-		assert(this->AddonData.Addon);
+		assert(this->AddonData.Info);
 
 		ImGuiStyle& style = ImGui::GetStyle();
 
@@ -564,7 +731,7 @@ namespace Raidcore::Nexus::GUI
 			if (chevronRt)
 			{
 				ImGui::SetCursorPos(ImVec2(initial.x, (ImGui::GetWindowHeight() - btnSz) / 2));
-				ImGui::Image(chevronRt->Resource, ImVec2(btnSz, btnSz));
+				GUI::Image(chevronRt, ImVec2(btnSz, btnSz));
 			}
 			else
 			{
@@ -593,10 +760,10 @@ namespace Raidcore::Nexus::GUI
 			}
 			else
 			{
-				if (this->AddonData.Addon)
+				if (this->AddonData.Info)
 				{
 					/* Use addon file location. */
-					id = this->AddonData.Addon->GetLocation().string();
+					id = this->AddonData.Info->Location.string();
 				}
 				else
 				{
@@ -620,7 +787,7 @@ namespace Raidcore::Nexus::GUI
 
 			if (ImGui::CollapsingHeader(headerStr.c_str(), ImGuiTreeNodeFlags_DefaultOpen))
 			{
-				Host::Config_t* config = this->AddonData.Addon->GetConfig();
+				Host::Config_t* config = this->AddonData.Config;
 				Host::ConfigMgr* cfgmgr = &ctx.Config();
 
 				/* TODO: Check Update Button */
@@ -702,7 +869,7 @@ namespace Raidcore::Nexus::GUI
 				ImGui::Text("((BTN: Check for Updates))");
 
 				/* Update Button */
-				if (this->AddonData.Addon->IsUpdateAvailable())
+				if (this->AddonData.HasFlag(EAddonFlags::UpdateAvailable))
 				{
 					ImGui::Text("((BTN: Update))");
 				}
@@ -753,7 +920,7 @@ namespace Raidcore::Nexus::GUI
 					}
 
 					/* Pre-releases Checkbox */
-					if (this->AddonData.Addon->SupportsPreReleases())
+					if (this->AddonData.Info->SupportsPreReleases)
 					{
 						if (ImGui::Checkbox((langApi->Translate("((000084))") + hashid).c_str(), &config->AllowPreReleases))
 						{
@@ -762,24 +929,29 @@ namespace Raidcore::Nexus::GUI
 					}
 
 					/* GitHub Button */
-					if (!this->AddonData.Addon->GetProjectPageURL().empty())
+					if (!this->AddonData.Info->ProjectPageURL.empty())
 					{
 						if (ImGui::Button((langApi->Translate("((000030))") + id).c_str()))
 						{
-							ShellExecuteA(0, 0, this->AddonData.Addon->GetProjectPageURL().c_str(), 0, 0, SW_SHOW);
+							ShellExecuteA(0, 0, this->AddonData.Info->ProjectPageURL.c_str(), 0, 0, SW_SHOW);
 						}
 					}
 
 					/* Disable until update Checkbox */
-					bool disableUntilUpdate = config->DisableVersion == this->AddonData.Addon->GetMD5().string();
+					bool disableUntilUpdate = this->AddonData.IsVersionDisabled();
 					if (ImGui::Checkbox((langApi->Translate("((000016))") + hashid).c_str(), &disableUntilUpdate))
 					{
 						this->Invalidate();
 
 						if (disableUntilUpdate)
 						{
-							config->DisableVersion = this->AddonData.Addon->GetMD5().string();
-							this->AddonData.Addon->Unload();
+							config->DisableVersion = this->AddonData.Info->MD5;
+
+							if (CAddon* addon = this->AddonData.GetAddon(ctx.Loader()))
+							{
+								addon->Unload();
+							}
+
 							skipOptions = true;
 						}
 						else
@@ -788,31 +960,19 @@ namespace Raidcore::Nexus::GUI
 						}
 						cfgmgr->SaveConfigs();
 					}
-					if (this->AddonData.Addon->IsStateLocked())
-					{
-						ImGui::TooltipGeneric(langApi->Translate("((IsStateLocked))"));
-					}
+					AddonToggleCtl::Tooltip(this->AddonData);
 
 					/* Uninstall Button */
 					if (ImGui::Button((langApi->Translate("((000018))") + hashid).c_str(), ImVec2(btnWidth, 0)))
 					{
-						this->UninstallConfirmationModal.SetTarget(this->AddonData.GetName(), this->AddonData.Addon->GetLocation());
-					}
-					if (this->AddonData.Addon->IsStateLocked())
-					{
-						ImGui::TooltipGeneric(langApi->Translate("((IsStateLocked))"));
+						this->UninstallConfirmationModal.SetTarget(this->AddonData.GetName(), this->AddonData.Info->Location);
 					}
+					AddonToggleCtl::Tooltip(this->AddonData);
 
 					/* Load/Unload Button */
-					if (ImGui::Button(AddonToggleCtl::GetButtonText(this->AddonData.Addon).c_str()))
+					if (ImGui::Button(AddonToggleCtl::GetButtonText(this->AddonData).c_str()))
 					{
-						/* Prompt if true, otherwise it already toggled now. */
-						if (AddonToggleCtl::Toggle(this->AddonData.Addon))
-						{
-							Host::Config_t* config = this->AddonData.Addon->GetConfig();
-
-							this->LoadConfirmationModal.SetTarget(config, this->AddonData.GetName(), this->AddonData.Addon->GetLocation());
-						}
+						this->ToggleAddon(this->AddonData);
 					}
 				}
 				else
@@ -822,7 +982,7 @@ namespace Raidcore::Nexus::GUI
 				}
 			}
 
-			if (this->AddonData.Addon && this->AddonData.Addon->IsLoaded())
+			if (this->AddonData.IsLoaded())
 			{
 				/* Addon binds table. */
 				if (this->AddonData.InputBinds.size() != 0)
@@ -972,12 +1132,20 @@ namespace Raidcore::Nexus::GUI
 				ImGui::SameLine();
 
 				/* Poll changes */
-				if (ImGui::ImageButton(s_ReloadIcon->Resource, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
+				if (GUI::ImageButton(s_ReloadIcon, ImVec2(ImGui::GetFontSize(), ImGui::GetFontSize())))
 				{
 					loader.NotifyChanges();
 				}
 			}
 
+			ImGui::SameLine();
+
+			/* Toggle resource usage */
+			if (ImGui::Button(this->IsResourcesView ? lang->Translate("((Addons))") : lang->Translate("((Resources))")))
+			{
+				this->IsResourcesView = !this->IsResourcesView;
+			}
+
 			aSize.y = ImGui::GetCursorPos().y;
 		}
 		ImGui::EndChild();
@@ -1039,19 +1207,33 @@ namespace Raidcore::Nexus::GUI
 		Context& uictx = ctx.UI();
 		Core::SettingsMgr& settingsctx = ctx.Settings();
 		Host::Loader& loader = ctx.Loader();
+		Host::ConfigMgr& cfgMgr = ctx.Config();
 		Host::LibraryMgr& libMgr = ctx.Library();
 
 		this->Filter = settingsctx.Get<EAddonsFilterFlags>(OPT_ADDONFILTERS, FILTER_INSTALLED);
 
-		for (Host::IAddon* addon : loader.GetAddons())
+		/* One consistent view of all addons, state changes while populating are picked up next frame. */
+		std::shared_ptr<const Host::AddonSnapshot_t> snapshot = loader.GetSnapshot();
+		this->AddonsGeneration = snapshot->Generation;
+
+		std::vector<GUI_RENDER> optionsRenders = uictx.GetRenderCallbacks(ERenderType::OptionsRender);
+
+		/* Listings hold their info, the addon itself may be deleted meanwhile and is only resolved for actions. */
+		for (const std::shared_ptr<const Host::AddonInfo_t>& info : snapshot->Addons)
 		{
+			if (info->IsDestroying) { continue; }
+
 			AddonListing_t addonlisting{};
-			addonlisting.Addon = dynamic_cast<CAddon*>(addon);
+			addonlisting.Info = info;
+
+			if (addonlisting.SupportsLoading())
+			{
+				addonlisting.Config = cfgMgr.GetConfig(info->Signature);
+			}
 
-			for (GUI_RENDER renderCb : uictx.GetRenderCallbacks(ERenderType::OptionsRender))
+			for (GUI_RENDER renderCb : optionsRenders)
 			{
-				Host::IAddon* owner = loader.GetOwner(renderCb);
-				if (addon == owner)
+				if (snapshot->FindOwner(renderCb) == info.get())
 				{
 					addonlisting.OptionsRender = renderCb;
 					break;
@@ -1060,27 +1242,32 @@ namespace Raidcore::Nexus::GUI
 
 			this->Addons.push_back(addonlisting);
 
-			if (this->HasContent && this->AddonData.GetSig() == addon->GetSignature())
+			if (this->HasContent && this->AddonData.GetSig() == info->Signature)
 			{
 				this->SetContent(addonlisting);
 			}
 		}
 
-		for (Host::LibraryAddon_t libaddon : libMgr.GetLibrary())
+		/* Installed listings by signature, instead of scanning all of them for every library addon. */
+		std::unordered_map<uint32_t, size_t> installed;
+		for (size_t i = 0; i < this->Addons.size(); i++)
 		{
-			bool installed = false;
+			installed.emplace(this->Addons[i].GetSig(), i);
+		}
 
-			for (AddonListing_t& addonlisting : this->Addons)
+		this->LibraryGeneration = libMgr.GetGeneration();
+
+		for (Host::LibraryAddon_t& libaddon : libMgr.GetLibrary())
+		{
+			auto it = installed.find(libaddon.Signature);
+
+			if (it != installed.end())
 			{
-				if (addonlisting.GetSig() == libaddon.Signature)
-				{
-					installed = true;
-					addonlisting.HasLibDef = true;
-					addonlisting.LibraryDef = libaddon;
-				}
+				AddonListing_t& addonlisting = this->Addons[it->second];
+				addonlisting.HasLibDef = true;
+				addonlisting.LibraryDef = libaddon;
 			}
-
-			if (!installed)
+			else
 			{
 				AddonListing_t addonlisting{};
 				addonlisting.HasLibDef = true;
@@ -1098,7 +1285,7 @@ namespace Raidcore::Nexus::GUI
 			if ((this->Filter & EAddonsFilterFlags::ShowEnabled) == EAddonsFilterFlags::ShowEnabled)
 			{
 				/* Has local addon and is loaded -> Enabled */
-				if (it->Addon && it->Addon->IsLoaded())
+				if (it->Info && it->IsLoaded())
 				{
 					matchesFilter = true;
 				}
@@ -1107,7 +1294,7 @@ namespace Raidcore::Nexus::GUI
 			if ((this->Filter & EAddonsFilterFlags::ShowDisabled) == EAddonsFilterFlags::ShowDisabled)
 			{
 				/* Has local addon and is not loaded -> Disabled */
-				if (it->Addon && !it->Addon->IsLoaded())
+				if (it->Info && !it->IsLoaded())
 				{
 					matchesFilter = true;
 				}
@@ -1116,7 +1303,7 @@ namespace Raidcore::Nexus::GUI
 			if ((this->Filter & EAddonsFilterFlags::ShowDownloadable) == EAddonsFilterFlags::ShowDownloadable)
 			{
 				/* Has no local addon, but a libdef -> Downloadable */
-				if (!it->Addon && it->HasLibDef)
+				if (!it->Info && it->HasLibDef)
 				{
 					matchesFilter = true;
 				}
@@ -1144,8 +1331,8 @@ namespace Raidcore::Nexus::GUI
 
 		std::sort(this->Addons.begin(), this->Addons.end(), [](AddonListing_t& lhs, AddonListing_t& rhs)
 		{
-			Host::Config_t* lhsConfig = lhs.Addon ? lhs.Addon->GetConfig() : nullptr;
-			Host::Config_t* rhsConfig = rhs.Addon ? rhs.Addon->GetConfig() : nullptr;
+			Host::Config_t* lhsConfig = lhs.Config;
+			Host::Config_t* rhsConfig = rhs.Config;
 
 			// 1. Addons without config first
 			if (lhsConfig == nullptr || rhsConfig == nullptr)
@@ -1181,4 +1368,76 @@ namespace Raidcore::Nexus::GUI
 			return String::ToLower(lhs.GetName()) < String::ToLower(rhs.GetName());
 		});
 	}
+
+	void CAddonsWindow::ApplyLibraryChanges()
+	{
+		Host::LibraryMgr& libMgr = Runtime::Get().Library();
+
+		Host::LibraryDiff_t diff{};
+		uint64_t generation = 0;
+
+		/* New listings have to be filtered and sorted, so additions and skipped generations repopulate. */
+		if (!libMgr.GetChanges(this->LibraryGeneration, diff, generation) || !diff.Added.empty())
+		{
+			this->IsInvalid = true;
+			return;
+		}
+
+		this->LibraryGeneration = generation;
+
+		for (uint32_t signature : diff.Changed)
+		{
+			Host::LibraryAddon_t libaddon{};
+
+			if (!libMgr.Find(signature, libaddon)) { continue; }
+
+			for (AddonListing_t& addonlisting : this->Addons)
+			{
+				if (addonlisting.HasLibDef && addonlisting.GetSig() == signature)
+				{
+					addonlisting.LibraryDef = libaddon;
+				}
+			}
+
+			if (this->HasContent && this->AddonData.HasLibDef && this->AddonData.GetSig() == signature)
+			{
+				this->AddonData.LibraryDef = libaddon;
+			}
+		}
+
+		for (uint32_t signature : diff.Removed)
+		{
+			for (auto it = this->Addons.begin(); it != this->Addons.end();)
+			{
+				if (!it->HasLibDef || it->GetSig() != signature)
+				{
+					it++;
+					continue;
+				}
+
+				/* Installed addons stay listed, only their library definition is gone. */
+				if (it->Info)
+				{
+					it->HasLibDef = false;
+					it++;
+					continue;
+				}
+
+				it = this->Addons.erase(it);
+				this->AddonsAmtUnfiltered--;
+			}
+
+			if (this->HasContent && this->AddonData.HasLibDef && this->AddonData.GetSig() == signature)
+			{
+				if (this->AddonData.Info)
+				{
+					this->AddonData.HasLibDef = false;
+				}
+				else
+				{
+					this->ClearContent();
+				}
+			}
+		}
+	}
 }
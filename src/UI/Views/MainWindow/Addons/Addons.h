@@ -55,8 +55,11 @@ namespace Raidcore::Nexus::GUI
 		std::string                 SearchTerm;
 		EAddonsFilterFlags          Filter;
 		bool                        IsListMode;
+		bool                        IsResourcesView = false;
 		std::vector<AddonListing_t> Addons;
 		uint32_t                    AddonsAmtUnfiltered;
+		uint64_t                    LibraryGeneration = 0;
+		uint64_t                    AddonsGeneration = 0;
 
 		/* Details */
 		std::mutex                  Mutex;
@@ -68,6 +71,12 @@ namespace Raidcore::Nexus::GUI
 
 		void AddonItem(AddonListing_t& aAddonData, float aWidth);
 
+		///----------------------------------------------------------------------------------------------------
+		/// ToggleAddon:
+		/// 	Loads or unloads the addon of the listing, or prompts to. Nothing, if it was deleted since.
+		///----------------------------------------------------------------------------------------------------
+		void ToggleAddon(const AddonListing_t& aAddonData);
+
 		void RenderContent() override;
 
 		///----------------------------------------------------------------------------------------------------
@@ -89,6 +98,12 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		void RenderDetails();
 
+		///----------------------------------------------------------------------------------------------------
+		/// RenderResources:
+		/// 	Renders the resource usage of all addons as a sortable table.
+		///----------------------------------------------------------------------------------------------------
+		void RenderResources();
+
 		///----------------------------------------------------------------------------------------------------
 		/// RenderActionsBar:
 		/// 	Renders the actions bar of the addons window.
@@ -100,5 +115,11 @@ namespace Raidcore::Nexus::GUI
 		void RenderInputBindsTable(const std::unordered_map<std::string, InputBindPacked_t>& aInputBinds);
 
 		void PopulateAddons();
+
+		///----------------------------------------------------------------------------------------------------
+		/// ApplyLibraryChanges:
+		/// 	Updates the listings whose library definitions changed, or repopulates if required.
+		///----------------------------------------------------------------------------------------------------
+		void ApplyLibraryChanges();
 	};
 }
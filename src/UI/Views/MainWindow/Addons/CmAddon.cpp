@@ -11,17 +11,18 @@
 #include "imgui/imgui.h"
 
 #include "CtlAddonToggle.h"
+#include "Runtime/Runtime.h"
 
 
 namespace Raidcore::Nexus::GUI
 {
 	void CAddonContextMenu::RenderContent()
 	{
-		if (this->Data->Addon)
+		if (this->Data.Info)
 		{
-			if (this->Data->Addon->SupportsLoading())
+			if (this->Data.SupportsLoading())
 			{
-				if (!this->Data->Addon->IsVersionDisabled())
+				if (!this->Data.IsVersionDisabled())
 				{
 					if (ImGui::Selectable("((Disable until Update))"))
 					{
@@ -29,18 +30,24 @@ namespace Raidcore::Nexus::GUI
 					}
 				}
 
-				if (this->Data->Addon->IsUpdateAvailable())
+				if (this->Data.HasFlag(EAddonFlags::UpdateAvailable))
 				{
 					if (ImGui::Selectable("((Update))"))
 					{
-						this->Data->Addon->Update();
+						if (CAddon* addon = this->Data.GetAddon(Runtime::Get().Loader()))
+						{
+							addon->Update();
+						}
 					}
 				}
 				else
 				{
 					if (ImGui::Selectable("((Check for Update))"))
 					{
-						this->Data->Addon->CheckUpdate();
+						if (CAddon* addon = this->Data.GetAddon(Runtime::Get().Loader()))
+						{
+							addon->CheckUpdate();
+						}
 					}
 				}
 
@@ -50,14 +57,14 @@ namespace Raidcore::Nexus::GUI
 			if (ImGui::Selectable("((Uninstall))"))
 			{
 				// TODO: This is a parent object.
-				//this->UninstallConfirmationModal.SetTarget(config, this->Data->GetName(), this->Data->Addon->GetLocation());
+				//this->UninstallConfirmationModal.SetTarget(config, this->Data.GetName(), this->Data.Info->Location);
 			}
 		}
 	}
 
 	void CAddonContextMenu::SetContent(AddonListing_t& aAddonData)
 	{
-		this->Data = &aAddonData;
+		this->Data = aAddonData;
 		this->OpenContextMenu();
 	}
 }
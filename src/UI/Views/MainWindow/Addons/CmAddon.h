@@ -35,6 +35,6 @@ namespace Raidcore::Nexus::GUI
 		void SetContent(AddonListing_t& aAddonData);
 
 		private:
-		AddonListing_t* Data{};
+		AddonListing_t Data{}; /* Copied, the listings are rebuilt while the menu is open. */
 	};
 }
@@ -16,6 +16,7 @@
 #include "Runtime/Runtime.h"
 using namespace Raidcore::Nexus;
 
+#include "AddonListing.h"
 #include "Host/Addons/Addon.h"
 
 ///----------------------------------------------------------------------------------------------------
@@ -31,18 +32,19 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		/// GetButtonText:
 		/// 	Returns the text of the toggle state button. E.g. "Load" or "Unload".
+		/// 	Rendered every frame, so only from the listing.
 		///----------------------------------------------------------------------------------------------------
-		inline std::string GetButtonText(CAddon* aAddon)
+		inline std::string GetButtonText(const AddonListing_t& aAddon)
 		{
 			std::string buttonText;
 			/* If addon is busy. */
-			if (aAddon->IsRunningAction())
+			if (aAddon.HasFlag(EAddonFlags::RunningAction))
 			{
 				buttonText = "...";
 			}
 			else /* Addon is not busy. */
 			{
-				if (aAddon->IsLoaded())
+				if (aAddon.IsLoaded())
 				{
 					buttonText = "((Unload))";
 				}
@@ -51,9 +53,9 @@ namespace Raidcore::Nexus::GUI
 					buttonText = "((Load))";
 				}
 
-				Host::Config_t* config = aAddon->GetConfig();
+				Host::Config_t* config = aAddon.Config;
 
-				if (config && aAddon->IsStateLocked() && (config->LastLoadState != aAddon->IsLoaded()))
+				if (config && aAddon.HasFlag(EAddonFlags::StateLocked) && (config->LastLoadState != aAddon.IsLoaded()))
 				{
 					buttonText.append("*");
 				}
@@ -116,9 +118,9 @@ namespace Raidcore::Nexus::GUI
 		/// Tooltip:
 		/// 	Renders a tooltip, if the associated element should have one.
 		///----------------------------------------------------------------------------------------------------
-		inline void Tooltip(CAddon* aAddon)
+		inline void Tooltip(const AddonListing_t& aAddon)
 		{
-			if (aAddon->IsStateLocked())
+			if (aAddon.HasFlag(EAddonFlags::StateLocked))
 			{
 				ImGui::TooltipGeneric("((IsStateLocked))");
 			}
@@ -8,6 +8,8 @@
 
 #include "Debug.h"
 
+#include <d3d11.h>
+#include <filesystem>
 #include <unordered_map>
 
 #include "imgui/imgui.h"
@@ -16,6 +18,7 @@
 #include "Runtime/Runtime.h"
 using namespace Raidcore::Nexus;
 
+#include "Host/Addons/Addon.h"
 #include "Host/Events/EvtApi.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "res/ResConst.h"
@@ -70,6 +73,8 @@ namespace Raidcore::Nexus::GUI
 		{
 			this->TabEvents();
 			this->TabInputBinds();
+			this->TabWndProc();
+			this->TabRender();
 			this->TabDataLink();
 			this->TabTextures();
 			this->TabQuickAccess();
@@ -185,6 +190,152 @@ namespace Raidcore::Nexus::GUI
 		ImGui::EndTabItem();
 	}
 
+	void CDebugWindow::TabWndProc()
+	{
+		if (!ImGui::BeginTabItem("WndProc"))
+		{
+			return;
+		}
+
+		if (ImGui::BeginChild("Content", ImVec2(ImGui::GetWindowContentRegionWidth(), 0.0f), false, ImGuiWindowFlags_NoBackground))
+		{
+			static const char* s_StageNames[] = { "Loader", "RawInput", "UI", "InputBinds", "GameBinds", "MouseResetFix" };
+			static const char* s_ClassNames[] = { "Keyboard", "Mouse", "RawInput", "Cursor", "Focus", "Window", "User" };
+
+			Runtime& ctx = Runtime::Get();
+			auto stageStats = ctx.WndProcRouter().GetStageStats();
+			auto messageCounts = ctx.WndProcRouter().GetMessageCounts();
+
+			if (ImGui::BeginTable("##WndProcStages", 5, ImGuiTableFlags_BordersInnerH))
+			{
+				ImGui::TableSetupColumn("Stage");
+				ImGui::TableSetupColumn("Calls");
+				ImGui::TableSetupColumn("Consumed");
+				ImGui::TableSetupColumn("Total (ms)");
+				ImGui::TableSetupColumn("Average (us)");
+				ImGui::TableHeadersRow();
+
+				for (size_t i = 0; i < stageStats.size(); i++)
+				{
+					const Hooks::WndProcStageStats_t& stats = stageStats[i];
+
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					ImGui::Text("%s", s_StageNames[i]);
+					ImGui::TableSetColumnIndex(1);
+					ImGui::Text("%llu", stats.Calls);
+					ImGui::TableSetColumnIndex(2);
+					ImGui::Text("%llu", stats.Consumed);
+					ImGui::TableSetColumnIndex(3);
+					ImGui::Text("%.2f", stats.TotalUs / 1000.0);
+					ImGui::TableSetColumnIndex(4);
+					ImGui::Text("%.2f", stats.Calls > 0 ? (double)stats.TotalUs / stats.Calls : 0.0);
+				}
+
+				ImGui::EndTable();
+			}
+
+			ImGui::Separator();
+
+			ImGui::TextDisabled("Messages per class:");
+			for (size_t i = 0; i < messageCounts.size(); i++)
+			{
+				ImGui::Text(""); ImGui::SameLine(); ImGui::TextDisabled("%s: %llu", s_ClassNames[i], messageCounts[i]);
+			}
+
+			ImGui::Separator();
+
+			std::vector<Platform::WndProcRegistration_t> callbacks = ctx.RawInput().GetRegistry();
+
+			ImGui::TextDisabled("Addon callbacks:");
+			for (const Platform::WndProcRegistration_t& entry : callbacks)
+			{
+				ImGui::Text(""); ImGui::SameLine(); ImGui::TextDisabled("Callback: %p | Classes: 0x%02X", entry.Callback, static_cast<uint32_t>(entry.Classes));
+			}
+		}
+		ImGui::EndChild();
+
+		ImGui::EndTabItem();
+	}
+
+	void CDebugWindow::TabRender()
+	{
+		if (!ImGui::BeginTabItem("Render"))
+		{
+			return;
+		}
+
+		if (ImGui::BeginChild("Content", ImVec2(ImGui::GetWindowContentRegionWidth(), 0.0f), false, ImGuiWindowFlags_NoBackground))
+		{
+			Runtime& ctx = Runtime::Get();
+			Host::Loader& loader = ctx.Loader();
+
+			ImGui::TextDisabled("Idle frames: %llu", ctx.UI().GetIdleFrames());
+
+			if (ImGui::BeginTable("##RenderCallbacks", 7, ImGuiTableFlags_BordersInnerH))
+			{
+				ImGui::TableSetupColumn("Addon");
+				ImGui::TableSetupColumn("Callback");
+				ImGui::TableSetupColumn("Average (ms)");
+				ImGui::TableSetupColumn("Peak (ms)");
+				ImGui::TableSetupColumn("Runs");
+				ImGui::TableSetupColumn("Skips");
+				ImGui::TableSetupColumn("History");
+				ImGui::TableHeadersRow();
+
+				for (const auto& [callback, stats] : ctx.UI().GetRenderStats())
+				{
+					CAddon* addon = dynamic_cast<CAddon*>(loader.GetOwner(callback));
+
+					float peak = 0.0f;
+					for (uint32_t i = 0; i < stats.HistoryCount; i++)
+					{
+						peak = max(peak, stats.History[i]);
+					}
+
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					ImGui::Text("%s", addon ? addon->GetName().c_str() : "(null)");
+					ImGui::TableSetColumnIndex(1);
+					ImGui::TextDisabled("%p", callback);
+					ImGui::TableSetColumnIndex(2);
+					ImGui::Text("%.3f", stats.Average);
+					ImGui::TableSetColumnIndex(3);
+					ImGui::Text("%.3f", peak);
+					ImGui::TableSetColumnIndex(4);
+					ImGui::Text("%llu", stats.Runs);
+					ImGui::TableSetColumnIndex(5);
+					if (stats.IsThrottled)
+					{
+						ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "%llu (Throttled)", stats.Skips);
+					}
+					else
+					{
+						ImGui::Text("%llu", stats.Skips);
+					}
+					ImGui::TableSetColumnIndex(6);
+					ImGui::PushID(callback);
+					ImGui::PlotLines(
+						"##History",
+						stats.History,
+						static_cast<int>(stats.HistoryCount),
+						stats.HistoryCount == RENDERSTATS_HISTORY ? static_cast<int>(stats.HistoryIndex) : 0,
+						nullptr,
+						0.0f,
+						FLT_MAX,
+						ImVec2(120.0f, ImGui::GetTextLineHeight())
+					);
+					ImGui::PopID();
+				}
+
+				ImGui::EndTable();
+			}
+		}
+		ImGui::EndChild();
+
+		ImGui::EndTabItem();
+	}
+
 	void CDebugWindow::TabDataLink()
 	{
 		if (!ImGui::BeginTabItem("DataLink"))
@@ -231,6 +382,7 @@ namespace Raidcore::Nexus::GUI
 
 		std::map<std::string, Graphics::Texture_t*>      texRegistry = Runtime::Get().TextureLoader().GetRegistry();
 		std::map<std::string, Graphics::QueuedTexture_t> texQueued = Runtime::Get().TextureLoader().GetQueuedTextures();
+		std::map<std::string, Graphics::TextureRecord_t> texRecords = Runtime::Get().TextureLoader().GetRecords();
 
 		static char texFilter[400] = {};
 		static int displayedTextures = 0;
@@ -246,6 +398,61 @@ namespace Raidcore::Nexus::GUI
 		ImGui::Text("Displaying %d of %d loaded textures:", displayedTextures, texRegistry.size());
 		ImGui::Text("Combined memory usage of displayed: %s", String::FormatByteSize(displayedMemUsage).c_str());
 
+		uint32_t atlasPages = 0;
+		uint32_t atlasTextures = 0;
+		Runtime::Get().TextureLoader().GetAtlasStats(atlasPages, atlasTextures);
+		ImGui::Text("Atlas: %u textures on %u pages", atlasTextures, atlasPages);
+
+		uint64_t texBudget = Runtime::Get().TextureLoader().GetBudget();
+		ImGui::Text(
+			"Video memory: %s of %s",
+			String::FormatByteSize(Runtime::Get().TextureLoader().GetResidentSize()).c_str(),
+			texBudget ? String::FormatByteSize(texBudget).c_str() : "unlimited"
+		);
+
+		if (ImGui::TreeNode("By owner"))
+		{
+			struct OwnerUsage_t
+			{
+				uint32_t Count;
+				uint32_t Evicted;
+				uint64_t Size;
+			};
+
+			std::map<void*, OwnerUsage_t> owners;
+
+			for (auto& [identifier, record] : texRecords)
+			{
+				OwnerUsage_t& usage = owners[record.Owner];
+				usage.Count++;
+
+				if (record.IsEvicted)
+				{
+					usage.Evicted++;
+				}
+				else
+				{
+					usage.Size += record.Size;
+				}
+			}
+
+			for (auto& [owner, usage] : owners)
+			{
+				std::string name = "Nexus";
+
+				if (owner)
+				{
+					char path[MAX_PATH]{};
+					GetModuleFileNameA(static_cast<HMODULE>(owner), path, MAX_PATH);
+					name = path[0] ? std::filesystem::path(path).filename().string() : std::format("{}", owner);
+				}
+
+				ImGui::Text("%s: %u textures (%u evicted), %s", name.c_str(), usage.Count, usage.Evicted, String::FormatByteSize(usage.Size).c_str());
+			}
+
+			ImGui::TreePop();
+		}
+
 		if (ImGui::BeginChild("Content", ImVec2(ImGui::GetWindowContentRegionWidth(), 0.0f), false, ImGuiWindowFlags_NoBackground))
 		{
 			float previewSize = ImGui::GetTextLineHeightWithSpacing() * 3;
@@ -340,10 +547,12 @@ namespace Raidcore::Nexus::GUI
 				ImGui::Text("Identifier: %s", identifier.c_str());
 
 				ImGui::SetCursorPos(ImVec2(xOffsetDetails, drawPos.y + ImGui::GetTextLineHeightWithSpacing()));
-				ImGui::TextDisabled("Dimensions: %dx%d", texture->Width, texture->Height);
+				auto record = texRecords.find(identifier);
+				bool isEvicted = record != texRecords.end() && record->second.IsEvicted;
+				ImGui::TextDisabled("Dimensions: %dx%d%s", texture->Width, texture->Height, isEvicted ? " (Evicted)" : "");
 
 				ImGui::SetCursorPos(ImVec2(xOffsetDetails, drawPos.y + ImGui::GetTextLineHeightWithSpacing() * 2));
-				ImGui::TextDisabled("Pointer: %p", texture->Resource);
+				ImGui::TextDisabled("Pointer: %p%s", texture->Resource, texture->AtlasResource ? " (Atlas)" : "");
 
 				drawPos.y += previewSize + style.ItemSpacing.y;
 			}
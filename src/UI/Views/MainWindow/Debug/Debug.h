@@ -37,6 +37,8 @@ namespace Raidcore::Nexus::GUI
 
 		void TabEvents();
 		void TabInputBinds();
+		void TabWndProc();
+		void TabRender();
 		void TabDataLink();
 		void TabTextures();
 		void TabQuickAccess();
@@ -446,4 +446,21 @@ namespace Raidcore::Nexus::GUI
 			}
 		}
 	}
+
+	bool CMainWindow::HasVisibleWindows()
+	{
+		if (this->IsVisible) { return true; }
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (ISubWindow* window : this->Windows)
+		{
+			if (window->IsPopOut())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
 }
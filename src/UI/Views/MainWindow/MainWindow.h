@@ -53,6 +53,8 @@ namespace Raidcore::Nexus::GUI
 
 		void Activate(const std::string& aWindowName = "");
 
+		bool HasVisibleWindows();
+
 		private:
 		std::mutex               Mutex{};
 		std::vector<ISubWindow*> Windows{};
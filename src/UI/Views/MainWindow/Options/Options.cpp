@@ -217,6 +217,45 @@ namespace Raidcore::Nexus::GUI
 						settingsctx->Set(OPT_DISABLEFESTIVEFLAIR, disableFestiveFlair);
 					}
 
+					static bool textureAtlas = settingsctx->Get<bool>(OPT_TEXTUREATLAS, false);
+					if (ImGui::Checkbox(langApi->Translate("((Experimental: Pack small icons into shared textures))"), &textureAtlas))
+					{
+						settingsctx->Set(OPT_TEXTUREATLAS, textureAtlas);
+					}
+
+					static int textureBudget = static_cast<int>(settingsctx->Get<uint32_t>(OPT_TEXTUREBUDGET, 0));
+					if (ImGui::InputInt(langApi->Translate("((Experimental: Texture memory budget in MB, 0 is unlimited))"), &textureBudget, 64, 256))
+					{
+						textureBudget = textureBudget < 0 ? 0 : textureBudget;
+						settingsctx->Set(OPT_TEXTUREBUDGET, static_cast<uint32_t>(textureBudget));
+					}
+
+					static float renderBudget = settingsctx->Get<float>(OPT_RENDERBUDGET, 0.0f);
+					if (ImGui::InputFloat(langApi->Translate("((Experimental: Frame budget per addon UI in ms, 0 is unlimited))"), &renderBudget, 0.5f, 1.0f, "%.1f"))
+					{
+						renderBudget = renderBudget < 0.0f ? 0.0f : renderBudget;
+						settingsctx->Set(OPT_RENDERBUDGET, renderBudget);
+					}
+
+					static int renderThrottle = static_cast<int>(settingsctx->Get<uint32_t>(OPT_RENDERTHROTTLE, 0));
+					if (ImGui::InputInt(langApi->Translate("((Experimental: Draw addon UIs over budget every Nth frame, 0 is off))"), &renderThrottle, 1, 5))
+					{
+						renderThrottle = renderThrottle < 0 ? 0 : renderThrottle;
+						settingsctx->Set(OPT_RENDERTHROTTLE, static_cast<uint32_t>(renderThrottle));
+					}
+
+					static bool skipIdleFrames = settingsctx->Get<bool>(OPT_UI_IDLEFRAMES, false);
+					if (ImGui::Checkbox(langApi->Translate("((Experimental: Reuse the last UI frame while nothing changes))"), &skipIdleFrames))
+					{
+						settingsctx->Set(OPT_UI_IDLEFRAMES, skipIdleFrames);
+					}
+
+					static bool shadowCopy = settingsctx->Get<bool>(OPT_LOADER_SHADOWCOPY, false);
+					if (ImGui::Checkbox(langApi->Translate("((Experimental: Load addons from copies, so they can be overwritten while loaded))"), &shadowCopy))
+					{
+						settingsctx->Set(OPT_LOADER_SHADOWCOPY, shadowCopy);
+					}
+
 					ImGui::EndGroupPanel();
 				}
 
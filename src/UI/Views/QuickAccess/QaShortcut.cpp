@@ -20,6 +20,7 @@ using namespace Raidcore::Nexus;
 #include "Host/Addons/Addon.h"
 #include "Inputs/InputBinds/IbConst.h"
 #include "res/ResConst.h"
+#include "UI/Controls/CtlImage.h"
 #include "UI/UiContext.h"
 #include "Util/DLL.h"
 
@@ -47,6 +48,10 @@ namespace Raidcore::Nexus::GUI
 		this->IconHoverID = aIconHoverID;
 		this->InputBindID = aInputBindID;
 		this->TooltipText = aTooltip;
+
+		/* Icons created later are passed in by OnTextureCreated. */
+		this->Icon = this->TextureService->Get(this->IconID.c_str());
+		this->IconHover = this->TextureService->Get(this->IconHoverID.c_str());
 	}
 
 	CShortcutIcon::~CShortcutIcon()
@@ -59,7 +64,6 @@ namespace Raidcore::Nexus::GUI
 
 	bool CShortcutIcon::Render()
 	{
-		if (!this->IsActive()) { return false; }
 		if (this->IsSuppressed) { return false; }
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
@@ -85,14 +89,7 @@ namespace Raidcore::Nexus::GUI
 			this->IsValid = true;
 		}
 
-		if (!(this->Icon && this->IconHover))
-		{
-			/* Get requested textures. */
-			this->Icon = this->TextureService->Get(this->IconID.c_str());
-			this->IconHover = this->TextureService->Get(this->IconHoverID.c_str());
-
-			return false;
-		}
+		if (!(this->Icon && this->IconHover)) { return false; }
 
 		ImGui::BeginGroup();
 
@@ -117,7 +114,7 @@ namespace Raidcore::Nexus::GUI
 
 		bool iconActive = false;
 		Graphics::Texture_t* icon = !this->IsHovering ? this->Icon : this->IconHover;
-		if (ImGui::ImageButton(icon->Resource, baseSizeUnscaled * this->NexusLink->Scaling))
+		if (GUI::ImageButton(icon, baseSizeUnscaled * this->NexusLink->Scaling))
 		{
 			this->PopNotifcation(QAKEY_GENERIC);
 			this->InputBindApi->Invoke(this->InputBindID);
@@ -129,7 +126,7 @@ namespace Raidcore::Nexus::GUI
 		{
 			ImGui::PushItemFlag(ImGuiItemFlags_Disabled, true);
 			ImGui::SetCursorPos(notifyPos);
-			ImGui::Image(notificationIcon->Resource, notifySizeUnscaled * this->NexusLink->Scaling);
+			GUI::Image(notificationIcon, notifySizeUnscaled * this->NexusLink->Scaling);
 			ImGui::PopItemFlag();
 		}
 
@@ -145,7 +142,7 @@ namespace Raidcore::Nexus::GUI
 			{
 				ImGui::PushItemFlag(ImGuiItemFlags_Disabled, true);
 				ImGui::SetCursorPos(ctxPos);
-				ImGui::Image(this->Textures[ETexIdx::HasContextMenu]->Resource, ctxSizeUnscaled * this->NexusLink->Scaling);
+				GUI::Image(this->Textures[ETexIdx::HasContextMenu], ctxSizeUnscaled * this->NexusLink->Scaling);
 				ImGui::PopItemFlag();
 			}
 		}
@@ -191,13 +188,21 @@ namespace Raidcore::Nexus::GUI
 		if (it == this->ContextItems.end())
 		{
 			this->ContextItems.emplace(aIdentifier, aContextItem);
+			this->ContextItemOwners.Add(aContextItem.Callback, aIdentifier);
 		}
 	}
 
 	void CShortcutIcon::RemoveContextItem(std::string aIdentifier)
 	{
 		const std::lock_guard<std::mutex> lock(this->Mutex);
-		this->ContextItems.erase(aIdentifier);
+
+		auto it = this->ContextItems.find(aIdentifier);
+
+		if (it != this->ContextItems.end())
+		{
+			this->ContextItemOwners.Remove(it->second.Callback, aIdentifier);
+			this->ContextItems.erase(it);
+		}
 	}
 
 	void CShortcutIcon::PushNotifcationSafe(std::string aKey)
@@ -229,6 +234,34 @@ namespace Raidcore::Nexus::GUI
 		return hasContextMenu || hasClickHandler;
 	}
 
+	bool CShortcutIcon::IsReady() const
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		return this->Icon && this->IconHover;
+	}
+
+	bool CShortcutIcon::OnTextureCreated(const std::string& aIdentifier, Graphics::Texture_t* aTexture)
+	{
+		bool used = false;
+
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		if (aIdentifier == this->IconID)
+		{
+			this->Icon = aTexture;
+			used = true;
+		}
+
+		/* Icon and hover icon may be the same texture. */
+		if (aIdentifier == this->IconHoverID)
+		{
+			this->IconHover = aTexture;
+			used = true;
+		}
+
+		return used;
+	}
+
 	void CShortcutIcon::SetSuppression(bool aSuppress)
 	{
 		this->IsSuppressed = aSuppress;
@@ -252,18 +285,9 @@ namespace Raidcore::Nexus::GUI
 
 		const std::lock_guard<std::mutex> lock(this->Mutex);
 
-		for (auto ctxItem = this->ContextItems.begin(); ctxItem != this->ContextItems.end();)
+		for (const std::string& identifier : this->ContextItemOwners.Take(aStartAddress, aEndAddress))
 		{
-			GUI_RENDER callback = ctxItem->second.Callback;
-			if (callback >= aStartAddress && callback <= aEndAddress)
-			{
-				refCounter++;
-				ctxItem = this->ContextItems.erase(ctxItem);
-			}
-			else
-			{
-				ctxItem++;
-			}
+			refCounter += static_cast<uint32_t>(this->ContextItems.erase(identifier));
 		}
 
 		return refCounter;
@@ -15,6 +15,7 @@
 
 #include "Core/NexusLink.h"
 #include "Memory/IRefCleaner.h"
+#include "Memory/OwnerIndex.h"
 #include "Core/DataLink/DlApi.h"
 #include "Inputs/InputBinds/IbApi.h"
 #include "Host/Loader/Loader.h"
@@ -103,6 +104,19 @@ namespace Raidcore::Nexus::GUI
 		///----------------------------------------------------------------------------------------------------
 		bool IsActive() const;
 
+		///----------------------------------------------------------------------------------------------------
+		/// IsReady:
+		/// 	Returns true if the icon and hover icon are created.
+		///----------------------------------------------------------------------------------------------------
+		bool IsReady() const;
+
+		///----------------------------------------------------------------------------------------------------
+		/// OnTextureCreated:
+		/// 	Takes the texture, if it is the icon or hover icon.
+		/// 	Returns true if it was used.
+		///----------------------------------------------------------------------------------------------------
+		bool OnTextureCreated(const std::string& aIdentifier, Graphics::Texture_t* aTexture);
+
 		///----------------------------------------------------------------------------------------------------
 		/// SetSuppression:
 		/// 	Sets whether the icon should be suppressed or not.
@@ -153,6 +167,7 @@ namespace Raidcore::Nexus::GUI
 		mutable std::mutex                   Mutex;
 		std::vector<std::string>             Notifications;
 		std::map<std::string, ContextItem_t> ContextItems;
+		Memory::OwnerIndex<std::string>      ContextItemOwners;
 
 		enum ETexIdx
 		{
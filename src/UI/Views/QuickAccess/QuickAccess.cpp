@@ -8,6 +8,8 @@
 
 #include "QuickAccess.h"
 
+#include <algorithm>
+
 #include "ImAnimate/ImAnimate.h"
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "imgui/imgui_internal.h"
@@ -79,6 +81,7 @@ namespace Raidcore::Nexus::GUI
 		this->Settings.Subscribe<EQaVisibility>(OPT_QAVISIBILITY, [&](EQaVisibility aVisibility)
 		{
 			this->Visibility = aVisibility;
+			this->IsVisibilityDirty = true;
 		});
 		this->Settings.Subscribe<bool>(OPT_QAONLYSHOWONHOVER, [&](bool aOnlyShowOnHover)
 		{
@@ -97,6 +100,22 @@ namespace Raidcore::Nexus::GUI
 
 				shortcut->SetSuppression(isSuppressed);
 			}
+
+			this->Invalidate();
+		});
+
+		/* Shortcuts are drawn once both their icons exist. */
+		this->TextureListener = this->TextureService.Subscribe([&](const std::string& aIdentifier, Graphics::Texture_t* aTexture)
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			for (auto& [id, shortcut] : this->Registry)
+			{
+				if (shortcut->OnTextureCreated(aIdentifier, aTexture))
+				{
+					this->Invalidate();
+				}
+			}
 		});
 
 		/* Preload default icons. */
@@ -150,6 +169,7 @@ namespace Raidcore::Nexus::GUI
 
 	CQuickAccess::~CQuickAccess()
 	{
+		this->TextureService.Unsubscribe(this->TextureListener);
 		this->EventApi.Unsubscribe(EV_ADDON_LOADED, CQuickAccess::OnAddonStateChanged);
 		this->EventApi.Unsubscribe(EV_ADDON_UNLOADED, CQuickAccess::OnAddonStateChanged);
 	}
@@ -160,65 +180,16 @@ namespace Raidcore::Nexus::GUI
 
 		if (this->IsInvalid)
 		{
-			this->UpdateNexusLink();
+			this->Rebuild();
 			this->IsInvalid = false;
 		}
 
 		this->NexusLink->QuickAccessMode = (int)this->Location;
 		this->NexusLink->QuickAccessIsVertical = this->VerticalLayout;
 
-		switch (this->Visibility)
-		{
-			/* continue rendering */
-			default:
-			case EQaVisibility::AlwaysShow: { break; }
-
-			case EQaVisibility::Gameplay:
-			{
-				/* don't render if not gameplay */
-				if (!this->NexusLink->IsGameplay)
-				{
-					return;
-				}
-
-				break;
-			}
-			case EQaVisibility::OutOfCombat:
-			{
-				/* don't render if not gameplay */
-				if (!this->NexusLink->IsGameplay)
-				{
-					return;
-				}
-
-				/* don't render if in combat */
-				if (this->MumbleLink->Context.IsInCombat)
-				{
-					return;
-				}
-
-				break;
-			}
-			case EQaVisibility::InCombat:
-			{
-				/* don't render if not gameplay */
-				if (!this->NexusLink->IsGameplay)
-				{
-					return;
-				}
-
-				/* don't render if out of combat */
-				if (!this->MumbleLink->Context.IsInCombat)
-				{
-					return;
-				}
-
-				break;
-			}
+		this->UpdateVisibility();
 
-			/* don't render*/
-			case EQaVisibility::Hide: { return; }
-		}
+		if (!this->IsShown) { return; }
 
 		uint32_t isActive = 0;
 
@@ -274,7 +245,7 @@ namespace Raidcore::Nexus::GUI
 			poppedStyles = true;
 			ImGui::PopStyleVar(1); // window padding
 
-			for (auto& [identifier, shortcut] : this->Registry)
+			for (CShortcutIcon* shortcut : this->Shortcuts)
 			{
 				isActive += shortcut->Render();
 
@@ -375,6 +346,8 @@ namespace Raidcore::Nexus::GUI
 				}
 			}
 
+			this->Shortcuts.erase(std::remove(this->Shortcuts.begin(), this->Shortcuts.end(), it->second), this->Shortcuts.end());
+
 			delete it->second;
 			this->Registry.erase(it);
 		}
@@ -536,18 +509,60 @@ namespace Raidcore::Nexus::GUI
 		}
 	}
 
-	void CQuickAccess::UpdateNexusLink()
+	void CQuickAccess::Rebuild()
 	{
 		int amtValid = 0;
 
+		this->Shortcuts.clear();
+
 		for (auto& [identifier, shortcut] : this->Registry)
 		{
-			if (shortcut->IsActive())
+			/* Refreshes the displayed input bind. */
+			shortcut->Invalidate();
+
+			if (!shortcut->IsActive())
 			{
-				amtValid++;
+				continue;
 			}
+
+			amtValid++;
+
+			bool isSuppressed = std::find(this->SuppressedShortcuts.begin(), this->SuppressedShortcuts.end(), identifier) != this->SuppressedShortcuts.end();
+
+			/* Icons still loading invalidate again, once created. */
+			if (isSuppressed || !shortcut->IsReady())
+			{
+				continue;
+			}
+
+			this->Shortcuts.push_back(shortcut);
 		}
 
 		this->NexusLink->QuickAccessIconsCount = amtValid;
 	}
-}
+
+	void CQuickAccess::UpdateVisibility()
+	{
+		bool isGameplay = this->NexusLink->IsGameplay;
+		bool isInCombat = this->MumbleLink->Context.IsInCombat;
+
+		if (!this->IsVisibilityDirty && isGameplay == this->WasGameplay && isInCombat == this->WasInCombat)
+		{
+			return;
+		}
+
+		this->IsVisibilityDirty = false;
+		this->WasGameplay = isGameplay;
+		this->WasInCombat = isInCombat;
+
+		switch (this->Visibility)
+		{
+			default:
+			case EQaVisibility::AlwaysShow:  { this->IsShown = true;                       break; }
+			case EQaVisibility::Gameplay:    { this->IsShown = isGameplay;                 break; }
+			case EQaVisibility::OutOfCombat: { this->IsShown = isGameplay && !isInCombat;  break; }
+			case EQaVisibility::InCombat:    { this->IsShown = isGameplay && isInCombat;   break; }
+			case EQaVisibility::Hide:        { this->IsShown = false;                      break; }
+		}
+	}
+}
\ No newline at end of file
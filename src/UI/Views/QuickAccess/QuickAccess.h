@@ -12,6 +12,7 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "imgui/imgui.h"
 
@@ -155,8 +156,10 @@ namespace Raidcore::Nexus::GUI
 
 		mutable std::mutex                    Mutex{};
 		std::map<std::string, CShortcutIcon*> Registry{};
+		std::vector<CShortcutIcon*>           Shortcuts{}; /* Drawn shortcuts in registry order, rebuilt on invalidation. */
 		std::map<std::string, ContextItem_t>  OrphanedCallbacks{};
 		std::vector<std::string>              SuppressedShortcuts{};
+		uint32_t                              TextureListener{};
 
 		bool                                  VerticalLayout { false };
 		EQaVisibility                         Visibility     { EQaVisibility::AlwaysShow };
@@ -166,6 +169,11 @@ namespace Raidcore::Nexus::GUI
 
 		float                                 Opacity{ 0.5f };
 
+		bool                                  IsShown          { true };
+		bool                                  IsVisibilityDirty{ true }; // Visibility setting changed
+		bool                                  WasGameplay      { false };
+		bool                                  WasInCombat      { false };
+
 		///----------------------------------------------------------------------------------------------------
 		/// WhereAreMyParents:
 		/// 	Returns orphaned context items to their parents.
@@ -173,9 +181,15 @@ namespace Raidcore::Nexus::GUI
 		void WhereAreMyParents();
 
 		///----------------------------------------------------------------------------------------------------
-		/// UpdateNexusLink:
-		/// 	Updates the nexus link shortcut icon count.
+		/// Rebuild:
+		/// 	Rebuilds the drawn shortcuts and updates the nexus link shortcut icon count.
+		///----------------------------------------------------------------------------------------------------
+		void Rebuild();
+
+		///----------------------------------------------------------------------------------------------------
+		/// UpdateVisibility:
+		/// 	Reevaluates the visibility setting, if it or the gameplay and combat state changed.
 		///----------------------------------------------------------------------------------------------------
-		void UpdateNexusLink();
+		void UpdateVisibility();
 	};
 }
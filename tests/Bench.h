@@ -0,0 +1,91 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  Bench.h
+/// Description  :  Timing and reporting helpers for the benchmarks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <vector>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	using BenchClock = std::chrono::steady_clock;
+
+	///----------------------------------------------------------------------------------------------------
+	/// ElapsedUs:
+	/// 	Returns the microseconds since the given time point.
+	///----------------------------------------------------------------------------------------------------
+	inline double ElapsedUs(BenchClock::time_point aStart)
+	{
+		return std::chrono::duration<double, std::micro>(BenchClock::now() - aStart).count();
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Percentile:
+	/// 	Returns the nearest rank percentile of sorted samples, aRank in [0, 1].
+	///----------------------------------------------------------------------------------------------------
+	inline double Percentile(const std::vector<double>& aSorted, double aRank)
+	{
+		if (aSorted.empty()) { return 0; }
+
+		size_t index = static_cast<size_t>(aRank * aSorted.size() + 0.999999);
+		return aSorted[(std::min)((std::max)(index, size_t{ 1 }), aSorted.size()) - 1];
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Report:
+	/// 	Prints p50, p99 and max of the samples.
+	///----------------------------------------------------------------------------------------------------
+	inline void Report(const char* aScenario, std::vector<double> aSamples, const char* aUnit)
+	{
+		if (aSamples.empty()) { return; }
+
+		std::sort(aSamples.begin(), aSamples.end());
+
+		std::printf(
+			"       %-32s %8zu samples, p50 %10.3f %s, p99 %10.3f %s, max %10.3f %s\n",
+			aScenario,
+			aSamples.size(),
+			Percentile(aSamples, 0.50), aUnit,
+			Percentile(aSamples, 0.99), aUnit,
+			aSamples.back(), aUnit
+		);
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Print:
+	/// 	Prints a free-form result line of a scenario.
+	///----------------------------------------------------------------------------------------------------
+	inline void Print(const char* aScenario, const char* aFormat, ...)
+	{
+		std::printf("       %-32s ", aScenario);
+
+		va_list args;
+		va_start(args, aFormat);
+		std::vprintf(aFormat, args);
+		va_end(args);
+
+		std::printf("\n");
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// DoNotOptimize:
+	/// 	Keeps the compiler from discarding a scalar result that is otherwise unused.
+	///----------------------------------------------------------------------------------------------------
+	template <typename T>
+	inline void DoNotOptimize(T aValue)
+	{
+		static volatile T s_Sink{};
+		s_Sink = aValue;
+	}
+}
@@ -0,0 +1,132 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  DlApiBench.cpp
+/// Description  :  Throughput of resolving resources from 16 readers while others are shared.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Core/DataLink/DlApi.h"
+
+using namespace Raidcore::Nexus::Core;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t READERS          = 16;
+constexpr const uint32_t GETS_PER_READER  = 100000;
+constexpr const uint32_t SHARED_PER_ROUND = 256;    /* Grows the handle table twice. */
+
+///----------------------------------------------------------------------------------------------------
+/// Run:
+/// 	Runs aRead on READERS threads at once, while resources are shared on another one.
+/// 	Returns the nanoseconds per lookup and the amount of resources shared meanwhile.
+///----------------------------------------------------------------------------------------------------
+template <typename F>
+static double Run(DataLinkApi& aDataLink, uint32_t aRound, uint32_t& aOutShared, F aRead)
+{
+	std::atomic<uint32_t> ready{ 0 };
+	std::atomic<uint32_t> done{ 0 };
+	std::atomic<bool> go{ false };
+	std::vector<std::thread> threads;
+
+	for (uint32_t t = 0; t < READERS; t++)
+	{
+		threads.emplace_back([&]()
+		{
+			ready++;
+			while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+			aRead();
+			done++;
+		});
+	}
+
+	/* Addons sharing their own resources, each also acquiring a handle. */
+	std::thread writer([&]()
+	{
+		ready++;
+		while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+		for (uint32_t i = 0; i < SHARED_PER_ROUND && done.load() != READERS; i++)
+		{
+			std::string identifier = "DL_BENCH_" + std::to_string(aRound) + "_" + std::to_string(i);
+			aDataLink.GetHandle(identifier.c_str());
+			aDataLink.Share(identifier.c_str(), 64);
+			aOutShared++;
+		}
+	});
+
+	while (ready.load() != READERS + 1) { std::this_thread::yield(); }
+
+	BenchClock::time_point start = BenchClock::now();
+	go.store(true, std::memory_order_release);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	double elapsedUs = ElapsedUs(start);
+
+	writer.join();
+
+	return elapsedUs * 1000.0 / (static_cast<double>(READERS) * GETS_PER_READER);
+}
+
+TEST(DataLink, ConcurrentGet)
+{
+	LogApi logger;
+	DataLinkApi dataLink(logger);
+
+	void* mumble = dataLink.Share("DL_MUMBLE_LINK", 5460);
+	ASSERT(mumble);
+
+	uint32_t handle = dataLink.GetHandle("DL_MUMBLE_LINK");
+	ASSERT(handle != DL_INVALID_HANDLE);
+
+	std::atomic<uint64_t> misses{ 0 };
+	uint32_t sharedByIdentifier = 0;
+	uint32_t sharedByHandle = 0;
+
+	double byIdentifier = Run(dataLink, 0, sharedByIdentifier, [&]()
+	{
+		for (uint32_t i = 0; i < GETS_PER_READER; i++)
+		{
+			if (dataLink.Get("DL_MUMBLE_LINK") != mumble) { misses++; }
+
+			/* On few cores the writer could otherwise only run once all readers finished. */
+			if (i % 4096 == 0) { std::this_thread::yield(); }
+		}
+	});
+
+	double byHandle = Run(dataLink, 1, sharedByHandle, [&]()
+	{
+		for (uint32_t i = 0; i < GETS_PER_READER; i++)
+		{
+			if (dataLink.GetByHandle(handle) != mumble) { misses++; }
+
+			/* On few cores the writer could otherwise only run once all readers finished. */
+			if (i % 4096 == 0) { std::this_thread::yield(); }
+		}
+	});
+
+	Print("Get", "%8.1f ns per lookup, %3u resources shared meanwhile", byIdentifier, sharedByIdentifier);
+	Print("GetByHandle", "%8.1f ns per lookup, %3u resources shared meanwhile", byHandle, sharedByHandle);
+	Print("throughput", "%.1f M lookups/s by identifier, %.1f M lookups/s by handle", 1000.0 / byIdentifier, 1000.0 / byHandle);
+
+	EXPECT(misses == 0);
+
+	/* Handles acquired before sharing resolve once shared, also after the table grew. */
+	for (uint32_t i = 0; i < sharedByHandle; i++)
+	{
+		std::string identifier = "DL_BENCH_1_" + std::to_string(i);
+		EXPECT(dataLink.GetByHandle(dataLink.GetHandle(identifier.c_str())) == dataLink.Get(identifier.c_str()));
+	}
+}
@@ -0,0 +1,210 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  DlVersionedTest.cpp
+/// Description  :  Tests for the sequence-versioned resource layout.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+
+#include "Core/DataLink/DlVersioned.h"
+
+using namespace Raidcore::Nexus::Core;
+
+namespace
+{
+	constexpr uint32_t PAYLOAD_WORDS = 64;
+
+	///----------------------------------------------------------------------------------------------------
+	/// Payload_t Struct
+	/// 	Every word holds the same version, a mix of two versions is a torn read.
+	///----------------------------------------------------------------------------------------------------
+	struct Payload_t
+	{
+		uint64_t Words[PAYLOAD_WORDS];
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// Resource_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct Resource_t
+	{
+		std::vector<uint64_t> Memory; /* uint64_t for alignment. */
+
+		Resource_t(uint32_t aBufferCount)
+		{
+			this->Memory.resize(GetVersionedSize(sizeof(Payload_t), aBufferCount) / sizeof(uint64_t) + 1, 0);
+		}
+
+		VersionedHeader_t* Header()
+		{
+			return reinterpret_cast<VersionedHeader_t*>(this->Memory.data());
+		}
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// Stress:
+	/// 	Writes versions as fast as possible while several readers verify every copy.
+	///----------------------------------------------------------------------------------------------------
+	void Stress(uint32_t aBufferCount)
+	{
+		constexpr uint32_t READERS = 4;
+		constexpr uint64_t VERSIONS = 200000;
+
+		Resource_t resource{ aBufferCount };
+		ASSERT(InitVersioned(resource.Header(), sizeof(Payload_t), aBufferCount));
+
+		std::atomic<bool> isDone = false;
+		std::atomic<uint32_t> started = 0;
+		std::atomic<uint64_t> torn = 0;
+		std::atomic<uint64_t> reads = 0;
+		std::atomic<uint64_t> regressions = 0;
+
+		std::vector<std::thread> readers;
+
+		for (uint32_t i = 0; i < READERS; i++)
+		{
+			readers.emplace_back([&]()
+			{
+				Payload_t copy{};
+				uint64_t last = 0;
+
+				started++;
+
+				while (!isDone.load(std::memory_order_relaxed))
+				{
+					if (!ReadVersioned(resource.Header(), &copy, sizeof(copy))) { continue; }
+
+					reads.fetch_add(1, std::memory_order_relaxed);
+
+					for (uint32_t w = 1; w < PAYLOAD_WORDS; w++)
+					{
+						if (copy.Words[w] != copy.Words[0])
+						{
+							torn.fetch_add(1, std::memory_order_relaxed);
+							break;
+						}
+					}
+
+					/* A single reader never observes an older version after a newer one. */
+					if (copy.Words[0] < last)
+					{
+						regressions.fetch_add(1, std::memory_order_relaxed);
+					}
+
+					last = copy.Words[0];
+				}
+			});
+		}
+
+		/* On few cores the writer could otherwise finish before any reader ran. */
+		while (started != READERS) { std::this_thread::yield(); }
+
+		for (uint64_t version = 1; version <= VERSIONS; version++)
+		{
+			if (version % 1024 == 0) { std::this_thread::yield(); }
+
+			Payload_t* payload = static_cast<Payload_t*>(BeginWrite(resource.Header()));
+
+			for (uint32_t w = 0; w < PAYLOAD_WORDS; w++)
+			{
+				payload->Words[w] = version;
+			}
+
+			EndWrite(resource.Header());
+		}
+
+		isDone = true;
+
+		for (std::thread& reader : readers)
+		{
+			reader.join();
+		}
+
+		EXPECT(torn == 0);
+		EXPECT(regressions == 0);
+		EXPECT(reads > 0);
+
+		Payload_t last{};
+		ASSERT(ReadVersioned(resource.Header(), &last, sizeof(last)));
+		EXPECT(last.Words[0] == VERSIONS);
+		EXPECT(last.Words[PAYLOAD_WORDS - 1] == VERSIONS);
+	}
+}
+
+TEST(Versioned, NoTornReadsSingleBuffered)
+{
+	Stress(1);
+}
+
+TEST(Versioned, NoTornReadsDoubleBuffered)
+{
+	Stress(2);
+}
+
+TEST(Versioned, DoubleBufferCarriesOverUnwrittenFields)
+{
+	Resource_t resource{ 2 };
+	ASSERT(InitVersioned(resource.Header(), sizeof(Payload_t), 2));
+
+	Payload_t* payload = static_cast<Payload_t*>(BeginWrite(resource.Header()));
+	payload->Words[0] = 1;
+	payload->Words[1] = 2;
+	EndWrite(resource.Header());
+
+	payload = static_cast<Payload_t*>(BeginWrite(resource.Header()));
+	payload->Words[1] = 3;
+	EndWrite(resource.Header());
+
+	Payload_t copy{};
+	ASSERT(ReadVersioned(resource.Header(), &copy, sizeof(copy)));
+	EXPECT(copy.Words[0] == 1);
+	EXPECT(copy.Words[1] == 3);
+}
+
+TEST(Versioned, InitRejectsDifferentLayout)
+{
+	Resource_t resource{ 2 };
+
+	EXPECT(InitVersioned(resource.Header(), sizeof(Payload_t), 2));
+	EXPECT(InitVersioned(resource.Header(), sizeof(Payload_t), 2));
+	EXPECT(!InitVersioned(resource.Header(), sizeof(Payload_t), 1));
+	EXPECT(!InitVersioned(resource.Header(), sizeof(Payload_t) - 8, 2));
+}
+
+TEST(Versioned, ReadIsClampedToPayload)
+{
+	Resource_t resource{ 1 };
+	ASSERT(InitVersioned(resource.Header(), sizeof(uint64_t), 1));
+
+	*static_cast<uint64_t*>(BeginWrite(resource.Header())) = 42;
+	EndWrite(resource.Header());
+
+	uint64_t copy[2] = { 0, 7 };
+	ASSERT(ReadVersioned(resource.Header(), copy, sizeof(copy)));
+	EXPECT(copy[0] == 42);
+	EXPECT(copy[1] == 7);
+}
+
+TEST(Versioned, SingleBufferFailsWhileWriting)
+{
+	Resource_t resource{ 1 };
+	ASSERT(InitVersioned(resource.Header(), sizeof(Payload_t), 1));
+
+	BeginWrite(resource.Header());
+
+	Payload_t copy{};
+	uint32_t retries = 0;
+	EXPECT(!ReadVersioned(resource.Header(), &copy, sizeof(copy), 4, &retries));
+	EXPECT(retries == 4);
+
+	EndWrite(resource.Header());
+	EXPECT(ReadVersioned(resource.Header(), &copy, sizeof(copy)));
+}
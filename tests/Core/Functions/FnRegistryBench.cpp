@@ -0,0 +1,143 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  FnRegistryBench.cpp
+/// Description  :  Throughput of querying and releasing functions from 1 to 16 threads.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Core/Functions/FnRegistry.h"
+
+using namespace Raidcore::Nexus::Core;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t PAIRS_PER_THREAD = 200000;
+
+static int s_Function = 0;
+
+///----------------------------------------------------------------------------------------------------
+/// LockedRegistry Struct
+/// 	The previous string path, a lookup and a reference count behind one mutex.
+///----------------------------------------------------------------------------------------------------
+struct LockedRegistry
+{
+	std::mutex                                Mutex;
+	std::unordered_map<std::string, uint64_t> RefCounts;
+
+	void* Query(const char* aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		auto it = this->RefCounts.find(aIdentifier);
+		if (it == this->RefCounts.end()) { return nullptr; }
+		it->second++;
+		return &s_Function;
+	}
+
+	void Release(const char* aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+		auto it = this->RefCounts.find(aIdentifier);
+		if (it != this->RefCounts.end()) { it->second--; }
+	}
+};
+
+///----------------------------------------------------------------------------------------------------
+/// Run:
+/// 	Runs aFunction on aThreads threads at once, returns the nanoseconds per query and release.
+///----------------------------------------------------------------------------------------------------
+template <typename F>
+static double Run(uint32_t aThreads, F aFunction)
+{
+	std::atomic<uint32_t> ready{ 0 };
+	std::atomic<bool> go{ false };
+	std::vector<std::thread> threads;
+
+	for (uint32_t t = 0; t < aThreads; t++)
+	{
+		threads.emplace_back([&, t]()
+		{
+			ready++;
+			while (!go.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+			aFunction(t);
+		});
+	}
+
+	while (ready.load() != aThreads) { std::this_thread::yield(); }
+
+	BenchClock::time_point start = BenchClock::now();
+	go.store(true, std::memory_order_release);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	return ElapsedUs(start) * 1000.0 / (static_cast<double>(aThreads) * PAIRS_PER_THREAD);
+}
+
+TEST(FuncRegistry, QueryContention)
+{
+	LogApi logger;
+	FuncRegistry registry(logger);
+	LockedRegistry locked;
+
+	/* Addons query a handful of shared functions, every thread hits the same one here. */
+	const char* identifier = "FN_SHARED";
+	ASSERT(registry.Register(identifier, &s_Function));
+	locked.RefCounts.emplace(identifier, 0);
+
+	uint32_t handle = registry.GetHandle(identifier);
+
+	for (uint32_t threads : { 1u, 2u, 4u, 8u, 16u })
+	{
+		double byHandle = Run(threads, [&](uint32_t)
+		{
+			for (uint32_t i = 0; i < PAIRS_PER_THREAD; i++)
+			{
+				DoNotOptimize(registry.QueryHandle(handle));
+				registry.ReleaseHandle(handle);
+			}
+		});
+
+		double byIdentifier = Run(threads, [&](uint32_t)
+		{
+			for (uint32_t i = 0; i < PAIRS_PER_THREAD; i++)
+			{
+				DoNotOptimize(registry.Query(identifier));
+				registry.Release(identifier);
+			}
+		});
+
+		double byMutex = Run(threads, [&](uint32_t)
+		{
+			for (uint32_t i = 0; i < PAIRS_PER_THREAD; i++)
+			{
+				DoNotOptimize(locked.Query(identifier));
+				locked.Release(identifier);
+			}
+		});
+
+		Print(
+			(std::to_string(threads) + " threads").c_str(),
+			"handle %8.1f ns, identifier %8.1f ns, mutex %8.1f ns per query and release",
+			byHandle,
+			byIdentifier,
+			byMutex
+		);
+	}
+
+	/* Balanced, the function can be deregistered and registered again right away. */
+	registry.Deregister(identifier, &s_Function);
+	EXPECT(registry.Register(identifier, &s_Function));
+}
@@ -0,0 +1,217 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  FnRegistryTest.cpp
+/// Description  :  Tests for the function registry and its lock-free queries.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Stubs.h"
+#include "Test.h"
+
+#include "Core/Functions/FnRegistry.h"
+
+using namespace Raidcore::Nexus::Core;
+using namespace Raidcore::Nexus::Tests;
+
+static int s_FunctionA = 0;
+static int s_FunctionB = 0;
+
+static void* const FUNCTION_A = &s_FunctionA;
+static void* const FUNCTION_B = &s_FunctionB;
+
+TEST(FuncRegistry, QueriesByIdentifierAndHandle)
+{
+	LogApi logger;
+	FuncRegistry registry(logger);
+
+	EXPECT(registry.Query("FN_A") == nullptr);
+
+	/* Handles are handed out before registering. */
+	uint32_t handle = registry.GetHandle("FN_A");
+	EXPECT(handle != FN_INVALID_HANDLE);
+	EXPECT(registry.GetHandle("FN_A") == handle);
+	EXPECT(registry.QueryHandle(handle) == nullptr);
+
+	EXPECT(registry.Register("FN_A", FUNCTION_A));
+	EXPECT(!registry.Register("FN_A", FUNCTION_B));
+
+	EXPECT(registry.Query("FN_A") == FUNCTION_A);
+	EXPECT(registry.QueryHandle(handle) == FUNCTION_A);
+	registry.Release("FN_A");
+	registry.ReleaseHandle(handle);
+
+	EXPECT(registry.QueryHandle(FN_INVALID_HANDLE) == nullptr);
+	EXPECT(registry.QueryHandle(handle + 100) == nullptr);
+}
+
+TEST(FuncRegistry, DeregisteredFunctionsWaitForTheirReferences)
+{
+	LogApi logger;
+	FuncRegistry registry(logger);
+
+	ASSERT(registry.Register("FN_A", FUNCTION_A));
+	EXPECT(registry.Query("FN_A") == FUNCTION_A);
+
+	/* Referenced, flagged but kept. No new references and no new registration. */
+	registry.Deregister("FN_A", FUNCTION_A);
+	EXPECT(registry.Query("FN_A") == nullptr);
+	EXPECT(!registry.Register("FN_A", FUNCTION_B));
+
+	registry.Release("FN_A");
+	EXPECT(registry.Register("FN_A", FUNCTION_B));
+	EXPECT(registry.Query("FN_A") == FUNCTION_B);
+	registry.Release("FN_A");
+
+	/* A release without a reference is reported, not wrapped around. */
+	uint32_t critical = GetCriticalLogs();
+	registry.Release("FN_A");
+	EXPECT(GetCriticalLogs() == critical + 1);
+	EXPECT(registry.Query("FN_A") == FUNCTION_B);
+	registry.Release("FN_A");
+}
+
+TEST(FuncRegistry, CleanupRetiresFunctionsInRange)
+{
+	LogApi logger;
+	FuncRegistry registry(logger);
+
+	char module[16] = {};
+
+	ASSERT(registry.Register("FN_A", &module[4]));
+	ASSERT(registry.Register("FN_B", FUNCTION_B));
+
+	EXPECT(registry.CleanupRefs(&module[0], &module[15]) == 1);
+	EXPECT(registry.Query("FN_A") == nullptr);
+	EXPECT(registry.Query("FN_B") == FUNCTION_B);
+	registry.Release("FN_B");
+}
+
+TEST(FuncRegistry, ConcurrentQueriesNeverReturnRetiredFunctions)
+{
+	constexpr uint32_t IDENTIFIERS = 8;
+	constexpr uint32_t VERSIONS    = 4;
+	constexpr uint32_t READERS     = 4;
+	constexpr uint32_t CYCLES      = 2000;
+
+	LogApi logger;
+	FuncRegistry registry(logger);
+	uint32_t critical = GetCriticalLogs();
+
+	/* Every function is a slot, retired once a newer version of its identifier was registered. */
+	static std::atomic<bool> s_Retired[IDENTIFIERS][VERSIONS];
+	std::string identifiers[IDENTIFIERS];
+	uint32_t handles[IDENTIFIERS];
+	uint32_t versions[IDENTIFIERS] = {};
+
+	for (uint32_t i = 0; i < IDENTIFIERS; i++)
+	{
+		identifiers[i] = "FN_STRESS_" + std::to_string(i);
+		handles[i] = registry.GetHandle(identifiers[i].c_str());
+
+		for (uint32_t v = 0; v < VERSIONS; v++)
+		{
+			s_Retired[i][v].store(true);
+		}
+
+		s_Retired[i][0].store(false);
+		ASSERT(registry.Register(identifiers[i].c_str(), &s_Retired[i][0]));
+	}
+
+	std::atomic<bool> isRunning{ true };
+	std::atomic<uint32_t> started{ 0 };
+	std::atomic<uint64_t> hits{ 0 };
+	std::atomic<uint64_t> violations{ 0 };
+
+	std::vector<std::thread> readers;
+
+	for (uint32_t r = 0; r < READERS; r++)
+	{
+		readers.emplace_back([&, r]()
+		{
+			uint32_t i = r;
+
+			started++;
+
+			while (isRunning.load(std::memory_order_relaxed))
+			{
+				i = (i + 1) % IDENTIFIERS;
+				bool byHandle = i & 1;
+
+				void* function = byHandle
+					? registry.QueryHandle(handles[i])
+					: registry.Query(identifiers[i].c_str());
+
+				if (!function) { continue; }
+
+				std::atomic<bool>* slot = static_cast<std::atomic<bool>*>(function);
+
+				/* Belongs to the queried identifier and stays live while referenced. */
+				if (slot < &s_Retired[i][0] || slot > &s_Retired[i][VERSIONS - 1]) { violations++; }
+				if (slot->load(std::memory_order_acquire))                       { violations++; }
+				std::this_thread::yield();
+				if (slot->load(std::memory_order_acquire))                       { violations++; }
+
+				hits++;
+
+				if (byHandle)
+				{
+					registry.ReleaseHandle(handles[i]);
+				}
+				else
+				{
+					registry.Release(identifiers[i].c_str());
+				}
+			}
+		});
+	}
+
+	while (started.load() != READERS) { std::this_thread::yield(); }
+
+	/* Deregisters and registers the next version as soon as the references are released. */
+	for (uint32_t cycle = 0; cycle < CYCLES; cycle++)
+	{
+		/* Lets the readers run in between on few cores. */
+		if (cycle % 16 == 0) { std::this_thread::yield(); }
+
+		uint32_t i = cycle % IDENTIFIERS;
+		uint32_t next = (versions[i] + 1) % VERSIONS;
+
+		registry.Deregister(identifiers[i].c_str(), &s_Retired[i][versions[i]]);
+
+		s_Retired[i][next].store(false, std::memory_order_release);
+
+		while (!registry.Register(identifiers[i].c_str(), &s_Retired[i][next]))
+		{
+			std::this_thread::yield();
+		}
+
+		s_Retired[i][versions[i]].store(true, std::memory_order_release);
+		versions[i] = next;
+	}
+
+	isRunning.store(false);
+
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+
+	EXPECT(violations.load() == 0);
+	EXPECT(hits.load() > 0);
+	EXPECT(GetCriticalLogs() == critical);
+
+	/* All references were released, every identifier can be registered again right away. */
+	for (uint32_t i = 0; i < IDENTIFIERS; i++)
+	{
+		registry.Deregister(identifiers[i].c_str(), &s_Retired[i][versions[i]]);
+		EXPECT(registry.Register(identifiers[i].c_str(), FUNCTION_A));
+	}
+}
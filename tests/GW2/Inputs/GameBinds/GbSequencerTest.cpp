@@ -0,0 +1,189 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GbSequencerTest.cpp
+/// Description  :  Tests for the game bind timer wheel and sequencer.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Test.h"
+
+#include "GW2/Inputs/GameBinds/GbSequencer.h"
+#include "GW2/Inputs/GameBinds/GbTimerWheel.h"
+
+using namespace Raidcore::Nexus::GW2;
+
+TEST(TimerWheel, ExpiresInDueOrderAcrossLevels)
+{
+	TimerWheel wheel{};
+	std::mt19937_64 rng(1);
+
+	std::vector<uint64_t> due;
+
+	for (uint64_t i = 0; i < 2000; i++)
+	{
+		/* Spread over all levels, including beyond the range. */
+		uint64_t tick = 1 + (rng() % (1ull << (2 + (i % 24))));
+		wheel.Schedule(tick, i);
+		due.push_back(tick);
+	}
+
+	EXPECT(wheel.Count() == due.size());
+
+	std::vector<TimerWheelEntry_t> expired;
+	uint64_t now = 0;
+	uint64_t last = 0;
+
+	while (wheel.Count() > 0)
+	{
+		uint64_t next = wheel.GetNextDueTick();
+		ASSERT(next > now);
+
+		/* Jumping straight to the next due tick expires it and nothing later. */
+		now = next;
+		expired.clear();
+		wheel.Advance(now, expired);
+
+		ASSERT(!expired.empty());
+
+		for (const TimerWheelEntry_t& entry : expired)
+		{
+			EXPECT(entry.DueTick == now);
+			EXPECT(entry.DueTick >= last);
+			EXPECT(due[entry.Payload] == entry.DueTick);
+			last = entry.DueTick;
+		}
+	}
+
+	EXPECT(wheel.GetNextDueTick() == UINT64_MAX);
+}
+
+TEST(TimerWheel, OverdueIsDueImmediately)
+{
+	TimerWheel wheel{ 100 };
+
+	wheel.Schedule(5000, 1);
+	EXPECT(wheel.GetNextDueTick() == 5000);
+
+	wheel.Schedule(50, 2);
+	EXPECT(wheel.GetNextDueTick() == 100);
+
+	std::vector<TimerWheelEntry_t> expired;
+	wheel.Advance(100, expired);
+
+	ASSERT(expired.size() == 1);
+	EXPECT(expired[0].Payload == 2);
+	EXPECT(wheel.GetNextDueTick() == 5000);
+}
+
+TEST(GameBindSequencer, ThousandSequencesBalanceHolds)
+{
+	constexpr uint32_t SEQUENCES = 1000;
+	constexpr uint32_t BINDS     = 8;
+
+	struct Event_t
+	{
+		EGameBinds      GameBind;
+		EGameBindAction Action;
+	};
+
+	std::mutex mutex;
+	std::vector<Event_t> events;
+
+	GameBindSequencer sequencer([&](EGameBinds aGameBind, EGameBindAction aAction)
+	{
+		const std::lock_guard<std::mutex> lock(mutex);
+		events.push_back(Event_t{ aGameBind, aAction });
+	});
+
+	std::mt19937 rng(2);
+
+	for (uint32_t i = 0; i < SEQUENCES; i++)
+	{
+		EGameBinds bind = static_cast<EGameBinds>(rng() % BINDS);
+
+		GameBindStep_t steps[] = {
+			{ bind, EGameBindAction::Press,   static_cast<uint32_t>(rng() % 20) },
+			{ bind, EGameBindAction::Release, static_cast<uint32_t>(rng() % 20) }
+		};
+
+		EXPECT(sequencer.Submit(steps, 2) != 0);
+	}
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+	while (sequencer.Count() > 0 && std::chrono::steady_clock::now() < deadline)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	ASSERT(sequencer.Count() == 0);
+
+	const std::lock_guard<std::mutex> lock(mutex);
+
+	/* Overlapping holds only send the outermost press and release, so per bind the sink strictly alternates. */
+	std::unordered_map<EGameBinds, bool> isHeld;
+
+	for (const Event_t& ev : events)
+	{
+		bool& held = isHeld[ev.GameBind];
+
+		EXPECT(held == (ev.Action == EGameBindAction::Release));
+		held = ev.Action == EGameBindAction::Press;
+	}
+
+	for (const auto& [bind, held] : isHeld)
+	{
+		EXPECT(!held);
+	}
+
+	EXPECT(!events.empty());
+}
+
+TEST(GameBindSequencer, CancelReleasesHeldBinds)
+{
+	std::mutex mutex;
+	std::vector<EGameBindAction> actions;
+
+	GameBindSequencer sequencer([&](EGameBinds, EGameBindAction aAction)
+	{
+		const std::lock_guard<std::mutex> lock(mutex);
+		actions.push_back(aAction);
+	});
+
+	GameBindStep_t steps[] = {
+		{ EGameBinds::MoveJump_SwimUp_FlyUp, EGameBindAction::Press,   0 },
+		{ EGameBinds::MoveJump_SwimUp_FlyUp, EGameBindAction::Release, 60000 }
+	};
+
+	uint64_t id = sequencer.Submit(steps, 2);
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+	while (std::chrono::steady_clock::now() < deadline)
+	{
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			if (!actions.empty()) { break; }
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT(sequencer.Cancel(id));
+	EXPECT(!sequencer.Cancel(id));
+
+	const std::lock_guard<std::mutex> lock(mutex);
+
+	ASSERT(actions.size() == 2);
+	EXPECT(actions[0] == EGameBindAction::Press);
+	EXPECT(actions[1] == EGameBindAction::Release);
+}
@@ -0,0 +1,169 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDeltaTest.cpp
+/// Description  :  Tests for the delta encoding of MumbleLink recording snapshots.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Test.h"
+
+#include "GW2/Mumble/MblDelta.h"
+
+using namespace Raidcore::Nexus::GW2;
+
+/* Roughly the size of a MumbleLink and NexusLink snapshot. */
+constexpr const size_t SNAPSHOT_SIZE = 5600;
+
+static std::vector<uint8_t> MakeSnapshot(uint32_t aSeed)
+{
+	std::vector<uint8_t> snapshot(SNAPSHOT_SIZE);
+	uint32_t state = aSeed * 2654435761u + 1;
+
+	for (uint8_t& b : snapshot)
+	{
+		state = state * 1664525 + 1013904223;
+		b = static_cast<uint8_t>(state >> 24);
+	}
+
+	return snapshot;
+}
+
+///----------------------------------------------------------------------------------------------------
+/// RoundTrip:
+/// 	Encodes aCurrent against aPrevious and decodes it on top of a copy of aPrevious.
+///----------------------------------------------------------------------------------------------------
+static bool RoundTrip(const std::vector<uint8_t>* aPrevious, const std::vector<uint8_t>& aCurrent, std::vector<uint8_t>& aOutEncoded)
+{
+	MumbleDelta::Encode(aPrevious ? aPrevious->data() : nullptr, aCurrent.data(), aCurrent.size(), aOutEncoded);
+
+	std::vector<uint8_t> decoded = aPrevious ? *aPrevious : std::vector<uint8_t>(aCurrent.size());
+
+	if (!MumbleDelta::Decode(aOutEncoded.data(), aOutEncoded.size(), decoded.data(), decoded.size())) { return false; }
+
+	return decoded == aCurrent;
+}
+
+TEST(MumbleDelta, KeyframesRoundTrip)
+{
+	std::vector<uint8_t> encoded;
+
+	/* Encoded against zeroes, decoded on top of a zeroed buffer. */
+	std::vector<uint8_t> snapshot = MakeSnapshot(1);
+	EXPECT(RoundTrip(nullptr, snapshot, encoded));
+	EXPECT(encoded.size() > SNAPSHOT_SIZE);
+
+	/* Mostly zero, like a MumbleLink before the game wrote its identity. */
+	std::vector<uint8_t> sparse(SNAPSHOT_SIZE);
+	sparse[0] = 1;
+	sparse[SNAPSHOT_SIZE - 1] = 2;
+	EXPECT(RoundTrip(nullptr, sparse, encoded));
+	EXPECT(encoded.size() < 16);
+}
+
+TEST(MumbleDelta, DeltasRoundTrip)
+{
+	std::vector<uint8_t> previous = MakeSnapshot(1);
+	std::vector<uint8_t> current = previous;
+	std::vector<uint8_t> encoded;
+
+	/* Identical snapshots are not written. */
+	EXPECT(!MumbleDelta::Encode(previous.data(), current.data(), current.size(), encoded));
+	EXPECT(encoded.empty());
+
+	/* A ticking counter and a moving position. */
+	current[4]++;
+	for (size_t i = 8; i < 20; i++) { current[i] ^= 0x5A; }
+	EXPECT(RoundTrip(&previous, current, encoded));
+	EXPECT(encoded.size() < 32);
+
+	/* Changes separated by short gaps are folded into one range. */
+	current = previous;
+	current[100] ^= 1;
+	current[102] ^= 1;
+	current[SNAPSHOT_SIZE - 1] ^= 1;
+	EXPECT(RoundTrip(&previous, current, encoded));
+
+	/* Everything changed. */
+	EXPECT(RoundTrip(&previous, MakeSnapshot(2), encoded));
+}
+
+TEST(MumbleDelta, ReplaysAStream)
+{
+	constexpr uint32_t KEYFRAME_INTERVAL = 10;
+
+	std::vector<uint8_t> recorded = MakeSnapshot(7);
+	std::vector<uint8_t> previous = recorded;
+	std::vector<uint8_t> replayed(SNAPSHOT_SIZE);
+	std::vector<uint8_t> encoded;
+
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		/* Changes a few fields per step. */
+		recorded[(i * 37) % SNAPSHOT_SIZE] ^= static_cast<uint8_t>(i | 1);
+		recorded[(i * 91) % SNAPSHOT_SIZE]++;
+
+		bool isKeyframe = i % KEYFRAME_INTERVAL == 0;
+
+		MumbleDelta::Encode(isKeyframe ? nullptr : previous.data(), recorded.data(), SNAPSHOT_SIZE, encoded);
+		previous = recorded;
+
+		if (isKeyframe)
+		{
+			std::memset(replayed.data(), 0, replayed.size());
+		}
+
+		ASSERT(MumbleDelta::Decode(encoded.data(), encoded.size(), replayed.data(), replayed.size()));
+		EXPECT(replayed == recorded);
+	}
+}
+
+TEST(MumbleDelta, RejectsTruncatedAndOversizedPayloads)
+{
+	std::vector<uint8_t> previous = MakeSnapshot(1);
+	std::vector<uint8_t> current = previous;
+	current[10] ^= 0xFF;
+	current[4000] ^= 0xFF;
+
+	std::vector<uint8_t> encoded;
+	ASSERT(MumbleDelta::Encode(previous.data(), current.data(), current.size(), encoded));
+
+	std::vector<uint8_t> buffer = previous;
+
+	/* Every cut short of the full payload ends inside a varint or a literal. */
+	for (size_t length = 1; length < encoded.size(); length++)
+	{
+		/* Except right between two ranges, which is a valid shorter payload. */
+		std::vector<uint8_t> decoded = previous;
+		bool isValid = MumbleDelta::Decode(encoded.data(), length, decoded.data(), decoded.size());
+
+		if (isValid)
+		{
+			EXPECT(decoded[10] == current[10]);
+			EXPECT(decoded[4000] == previous[4000]);
+		}
+	}
+
+	/* Ranges before the malformed one are already applied, the replay stops at the first failure. */
+	std::vector<uint8_t> cut(encoded.begin(), encoded.end() - 1);
+	EXPECT(!MumbleDelta::Decode(cut.data(), cut.size(), buffer.data(), buffer.size()));
+
+	/* Decoding into a smaller buffer, e.g. a recording of larger structures. */
+	EXPECT(!MumbleDelta::Decode(encoded.data(), encoded.size(), buffer.data(), 4000));
+
+	/* A skip past the end and an unterminated varint. */
+	std::vector<uint8_t> skip = { 0xFF, 0xFF, 0x03, 0x01, 0xAA };
+	EXPECT(!MumbleDelta::Decode(skip.data(), skip.size(), buffer.data(), buffer.size()));
+
+	std::vector<uint8_t> varint(12, 0xFF);
+	EXPECT(!MumbleDelta::Decode(varint.data(), varint.size(), buffer.data(), buffer.size()));
+
+	/* An empty payload changes nothing. */
+	buffer = previous;
+	EXPECT(MumbleDelta::Decode(nullptr, 0, buffer.data(), buffer.size()));
+	EXPECT(buffer == previous);
+}
@@ -0,0 +1,63 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblDerivedTest.cpp
+/// Description  :  Tests for the states derived from MumbleLink samples.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include "Test.h"
+
+#include "GW2/Mumble/MblDerived.h"
+
+using namespace Raidcore::Nexus::GW2;
+
+constexpr const uint32_t GAMEPLAY = static_cast<uint32_t>(EDerivedState::IsGameplay);
+constexpr const uint32_t MOVING   = static_cast<uint32_t>(EDerivedState::IsMoving);
+constexpr const uint32_t CAMERA   = static_cast<uint32_t>(EDerivedState::IsCameraMoving);
+
+TEST(DerivedTracker, GameplayFollowsTheTick)
+{
+	DerivedTracker tracker;
+	DerivedSample_t sample{};
+
+	EXPECT(tracker.Advance(sample) == 0);
+
+	sample.UITick = 1;
+	sample.FrameCount = 10;
+	EXPECT(tracker.Advance(sample) == GAMEPLAY);
+
+	/* Frames render, but the ui does not tick, e.g. in a loading screen. */
+	sample.FrameCount = 20;
+	EXPECT(tracker.Advance(sample) == 0);
+
+	sample.UITick = 2;
+	sample.FrameCount = 30;
+	EXPECT(tracker.Advance(sample) == GAMEPLAY);
+
+	/* The game is frozen, no frames and no ticks, it stays in gameplay. */
+	EXPECT(tracker.Advance(sample) == GAMEPLAY);
+	EXPECT(tracker.Get() == GAMEPLAY);
+}
+
+TEST(DerivedTracker, MovementIgnoresJitter)
+{
+	DerivedTracker tracker;
+	DerivedSample_t sample{};
+	tracker.Advance(sample);
+
+	sample.AvatarPosition[0] = 1.0f;
+	EXPECT(tracker.Advance(sample) == MOVING);
+	EXPECT(tracker.Advance(sample) == 0);
+
+	/* Below a thousandth. */
+	sample.AvatarPosition[0] = 1.0004f;
+	EXPECT(tracker.Advance(sample) == 0);
+
+	sample.CameraFront[2] = -0.5f;
+	sample.AvatarPosition[1] = 2.0f;
+	EXPECT(tracker.Advance(sample) == (MOVING | CAMERA));
+	EXPECT(tracker.Advance(sample) == 0);
+}
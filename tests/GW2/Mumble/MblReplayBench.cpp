@@ -0,0 +1,269 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  MblReplayBench.cpp
+/// Description  :  Records a synthetic one hour session and replays it through the derived states.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Core/NexusLink.h"
+#include "GW2/Mumble/MblDelta.h"
+#include "GW2/Mumble/MblDerived.h"
+
+using namespace Raidcore::Nexus::GW2;
+using namespace Raidcore::Nexus::Tests;
+
+#pragma pack(push, 1)
+///----------------------------------------------------------------------------------------------------
+/// SyntheticLink_t Struct
+/// 	Layout of the MumbleLink shared memory, with the game's wide strings.
+///----------------------------------------------------------------------------------------------------
+struct SyntheticLink_t
+{
+	uint32_t UIVersion;
+	uint32_t UITick;
+	float    AvatarPosition[3];
+	float    AvatarFront[3];
+	float    AvatarTop[3];
+	uint16_t Name[256];
+	float    CameraPosition[3];
+	float    CameraFront[3];
+	float    CameraTop[3];
+	uint16_t Identity[256];
+	uint32_t ContextLength;
+	uint8_t  Context[256];
+	uint16_t Description[2048];
+};
+#pragma pack(pop)
+
+constexpr const size_t   SNAPSHOT_SIZE      = sizeof(SyntheticLink_t) + sizeof(NexusLinkData_t);
+constexpr const uint32_t CAPTURE_INTERVAL   = 10;     /* ms, as the recorder captures.     */
+constexpr const uint32_t KEYFRAME_INTERVAL  = 600;    /* As MBLREC_KEYFRAME_INTERVAL.      */
+constexpr const uint32_t SESSION_MS         = 3600000;
+constexpr const uint64_t DERIVED_INTERVAL   = 100;    /* ms, as the reader derives states. */
+
+///----------------------------------------------------------------------------------------------------
+/// Recording_t Struct
+///----------------------------------------------------------------------------------------------------
+struct Recording_t
+{
+	struct Entry_t
+	{
+		uint32_t TimeOffsetMs;
+		uint64_t FrameCount;
+		bool     IsKeyframe;
+		size_t   Offset;
+		size_t   Size;
+	};
+
+	std::vector<Entry_t> Entries;
+	std::vector<uint8_t> Payload;
+	uint64_t             Skipped = 0;
+};
+
+///----------------------------------------------------------------------------------------------------
+/// Simulate:
+/// 	Writes the state of the game at the given time into the link.
+/// 	Every ten minutes: a loading screen, then phases of running, looking around and standing still.
+///----------------------------------------------------------------------------------------------------
+static void Simulate(uint32_t aTimeMs, SyntheticLink_t& aLink, NexusLinkData_t& aNexusLink, uint64_t& aFrameCount)
+{
+	uint32_t cycle = aTimeMs % 600000;
+	bool isLoading = cycle < 15000;
+
+	/* 60 fps, the ui ticks along unless in a loading screen. */
+	aFrameCount = aTimeMs / 16;
+
+	if (isLoading)
+	{
+		aNexusLink.IsGameplay = false;
+		return;
+	}
+
+	aLink.UITick = aTimeMs / 16;
+
+	uint32_t phase = (cycle / 5000) % 4;
+	float t = aTimeMs / 1000.0f;
+
+	if (phase == 0 || phase == 1)
+	{
+		aLink.AvatarPosition[0] = 100.0f + t * 7.0f;
+		aLink.AvatarPosition[2] = 50.0f + std::sin(t) * 3.0f;
+		aLink.CameraPosition[0] = aLink.AvatarPosition[0] - 5.0f;
+		aLink.CameraPosition[2] = aLink.AvatarPosition[2];
+	}
+
+	if (phase == 1 || phase == 2)
+	{
+		aLink.CameraFront[0] = std::cos(t * 0.5f);
+		aLink.CameraFront[2] = std::sin(t * 0.5f);
+	}
+
+	/* The identity is rewritten on map changes. */
+	if (cycle == 15000)
+	{
+		for (size_t i = 0; i < 200; i++)
+		{
+			aLink.Identity[i] = static_cast<uint16_t>('a' + (aTimeMs / 600000 + i) % 26);
+		}
+
+		aLink.Context[28] = static_cast<uint8_t>(aTimeMs / 600000);
+	}
+
+	aNexusLink.IsGameplay = true;
+}
+
+///----------------------------------------------------------------------------------------------------
+/// Record:
+/// 	Captures the session like the recorder, skipping unchanged snapshots.
+///----------------------------------------------------------------------------------------------------
+static Recording_t Record(double& aOutEncodeUs)
+{
+	Recording_t recording{};
+
+	std::vector<uint8_t> previous(SNAPSHOT_SIZE);
+	std::vector<uint8_t> current(SNAPSHOT_SIZE);
+	std::vector<uint8_t> encoded;
+
+	SyntheticLink_t link{};
+	NexusLinkData_t nexusLink{};
+	link.UIVersion = 2;
+	link.ContextLength = 48;
+	nexusLink.Width = 2560;
+	nexusLink.Height = 1440;
+	nexusLink.Scaling = 1.0f;
+
+	BenchClock::time_point start = BenchClock::now();
+
+	for (uint32_t time = 0; time < SESSION_MS; time += CAPTURE_INTERVAL)
+	{
+		uint64_t frameCount = 0;
+		Simulate(time, link, nexusLink, frameCount);
+
+		std::memcpy(current.data(), &link, sizeof(link));
+		std::memcpy(current.data() + sizeof(link), &nexusLink, sizeof(nexusLink));
+
+		bool isKeyframe = recording.Entries.size() % KEYFRAME_INTERVAL == 0;
+
+		if (!MumbleDelta::Encode(isKeyframe ? nullptr : previous.data(), current.data(), SNAPSHOT_SIZE, encoded) && !isKeyframe)
+		{
+			recording.Skipped++;
+			continue;
+		}
+
+		recording.Entries.push_back(Recording_t::Entry_t{ time, frameCount, isKeyframe, recording.Payload.size(), encoded.size() });
+		recording.Payload.insert(recording.Payload.end(), encoded.begin(), encoded.end());
+
+		previous.swap(current);
+	}
+
+	aOutEncodeUs = ElapsedUs(start);
+
+	return recording;
+}
+
+TEST(MumbleReplay, OneHourSession)
+{
+	double encodeUs = 0;
+	Recording_t recording = Record(encodeUs);
+
+	ASSERT(!recording.Entries.empty());
+
+	uint64_t captures = recording.Entries.size() + recording.Skipped;
+
+	Print(
+		"record",
+		"%llu captures, %zu written, %llu unchanged, %.1f MB (raw %.1f MB), %.1f ms",
+		captures,
+		recording.Entries.size(),
+		recording.Skipped,
+		recording.Payload.size() / 1048576.0,
+		captures * SNAPSHOT_SIZE / 1048576.0,
+		encodeUs / 1000.0
+	);
+
+	/* Replay as fast as possible, deriving on the recorded clock like MumbleReader::Replay. */
+	std::vector<uint8_t> snapshot(SNAPSHOT_SIZE);
+	std::vector<double> decodeUs;
+	std::vector<double> deriveUs;
+	decodeUs.reserve(recording.Entries.size());
+
+	DerivedTracker tracker;
+	uint64_t nextDerived = 0;
+	uint64_t lastTimeMs = 0;
+	uint64_t lastFrameCount = 0;
+	uint64_t ticks = 0;
+	uint64_t changes[3] = {};
+
+	BenchClock::time_point start = BenchClock::now();
+
+	for (const Recording_t::Entry_t& entry : recording.Entries)
+	{
+		/* The ticks until this snapshot see the previous one, as MumbleReader::Replay derives them. */
+		BenchClock::time_point deriveStart = BenchClock::now();
+
+		const SyntheticLink_t* link = reinterpret_cast<const SyntheticLink_t*>(snapshot.data());
+
+		for (; nextDerived < entry.TimeOffsetMs; nextDerived += DERIVED_INTERVAL)
+		{
+			DerivedSample_t sample{};
+			sample.UITick = link->UITick;
+			std::memcpy(sample.AvatarPosition, link->AvatarPosition, sizeof(sample.AvatarPosition));
+			std::memcpy(sample.CameraFront, link->CameraFront, sizeof(sample.CameraFront));
+			sample.FrameCount = InterpolateFrameCount(lastTimeMs, lastFrameCount, entry.TimeOffsetMs, entry.FrameCount, nextDerived);
+
+			uint32_t previous = tracker.Get();
+			uint32_t current = tracker.Advance(sample);
+
+			for (uint32_t bit = 0; bit < 3; bit++)
+			{
+				if (((previous ^ current) >> bit) & 1) { changes[bit]++; }
+			}
+
+			ticks++;
+		}
+
+		lastTimeMs = entry.TimeOffsetMs;
+		lastFrameCount = entry.FrameCount;
+
+		deriveUs.push_back(ElapsedUs(deriveStart));
+
+		BenchClock::time_point decodeStart = BenchClock::now();
+
+		if (entry.IsKeyframe)
+		{
+			std::memset(snapshot.data(), 0, snapshot.size());
+		}
+
+		ASSERT(MumbleDelta::Decode(recording.Payload.data() + entry.Offset, entry.Size, snapshot.data(), snapshot.size()));
+
+		decodeUs.push_back(ElapsedUs(decodeStart));
+	}
+
+	double replayUs = ElapsedUs(start);
+
+	Report("replay decode", decodeUs, "us");
+	Report("replay derive", deriveUs, "us");
+	Print(
+		"replay total",
+		"%.1f ms for %.0f min recorded, %llu derived ticks, changes: gameplay %llu, moving %llu, camera %llu",
+		replayUs / 1000.0,
+		recording.Entries.back().TimeOffsetMs / 60000.0,
+		ticks,
+		changes[0],
+		changes[1],
+		changes[2]
+	);
+
+	/* Gameplay starts after each of the six loading screens and ends with the next one. */
+	EXPECT(changes[0] == 11);
+	EXPECT(ticks >= SESSION_MS / DERIVED_INTERVAL - 1);
+}
@@ -0,0 +1,93 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameStatsBench.cpp
+/// Description  :  Cost per frame of the rolling frame statistics, compared to sorting the window.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Graphics/GrFrameStats.h"
+
+using namespace Raidcore::Nexus::Graphics;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t FRAMES           = 100000;
+constexpr const uint32_t COMPUTE_INTERVAL = 10;     /* As FrameMetrics::EndFrame. */
+
+///----------------------------------------------------------------------------------------------------
+/// NextInterval:
+/// 	Returns a frame interval around 60 fps with jitter and a hitch every 500 frames.
+///----------------------------------------------------------------------------------------------------
+static float NextInterval(uint32_t& aState)
+{
+	aState = aState * 1664525u + 1013904223u;
+
+	float jitter = static_cast<float>(aState >> 24) / 64.0f;
+
+	return (aState % 500 == 0) ? 80.0f + jitter : 14.0f + jitter;
+}
+
+TEST(FrameStats, CostPerFrame)
+{
+	/* Selecting the percentiles every COMPUTE_INTERVAL frames, as the service does. */
+	FrameStats stats;
+	std::vector<double> selectUs;
+	uint32_t hitches = 0;
+	uint32_t state = 1;
+
+	for (uint32_t frame = 0; frame < FRAMES; frame++)
+	{
+		float interval = NextInterval(state);
+
+		BenchClock::time_point start = BenchClock::now();
+
+		if (stats.Push(interval)) { hitches++; }
+
+		if ((frame + 1) % COMPUTE_INTERVAL == 0)
+		{
+			stats.ComputePercentiles();
+		}
+
+		selectUs.push_back(ElapsedUs(start));
+	}
+
+	/* Copying and sorting the whole window on every frame instead. */
+	std::vector<float> window(FRAMESTATS_CAPACITY);
+	std::vector<float> sorted;
+	std::vector<double> sortUs;
+	uint32_t head = 0;
+	uint32_t size = 0;
+	state = 1;
+
+	for (uint32_t frame = 0; frame < FRAMES; frame++)
+	{
+		float interval = NextInterval(state);
+
+		BenchClock::time_point start = BenchClock::now();
+
+		window[head] = interval;
+		head = (head + 1) % FRAMESTATS_CAPACITY;
+		size = std::min(size + 1, FRAMESTATS_CAPACITY);
+
+		sorted.assign(window.begin(), window.begin() + size);
+		std::sort(sorted.begin(), sorted.end());
+		DoNotOptimize(sorted[static_cast<size_t>(0.99f * (size - 1))]);
+
+		sortUs.push_back(ElapsedUs(start));
+	}
+
+	Report("push and select per frame", selectUs, "us");
+	Report("sort per frame", sortUs, "us");
+	Print("window", "%u frames, %u hitches, p50 %.2f ms, p99 %.2f ms, max %.2f ms", stats.Count(), hitches, stats.GetP50(), stats.GetP99(), stats.GetMax());
+
+	EXPECT(stats.Count() == FRAMESTATS_CAPACITY);
+	EXPECT(hitches > 0);
+	EXPECT(stats.GetP99() == sorted[static_cast<size_t>(0.99f * (size - 1))]);
+}
@@ -0,0 +1,115 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  GrFrameStatsTest.cpp
+/// Description  :  Tests for the rolling frame time statistics.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdint>
+
+#include "Test.h"
+
+#include "Graphics/GrFrameStats.h"
+
+using namespace Raidcore::Nexus::Graphics;
+
+TEST(FrameStats, PercentilesOfKnownDistribution)
+{
+	FrameStats stats{ 100 };
+
+	/* 1..100 ms, shuffled by a stride coprime to 100. */
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		stats.Push(static_cast<float>(((i * 37) % 100) + 1));
+	}
+
+	stats.ComputePercentiles();
+
+	EXPECT(stats.Count() == 100);
+	EXPECT(std::fabs(stats.GetAverage() - 50.5f) < 0.001f);
+	EXPECT(stats.GetP50() == 50.0f);
+	EXPECT(stats.GetP90() == 90.0f);
+	EXPECT(stats.GetP99() == 99.0f);
+	EXPECT(stats.GetMax() == 100.0f);
+}
+
+TEST(FrameStats, WindowEvictsOldestSamples)
+{
+	FrameStats stats{ 4 };
+
+	stats.Push(100.0f);
+	stats.Push(100.0f);
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		stats.Push(10.0f);
+	}
+
+	stats.ComputePercentiles();
+
+	EXPECT(stats.Count() == 4);
+	EXPECT(stats.GetAverage() == 10.0f);
+	EXPECT(stats.GetMax() == 10.0f);
+
+	/* The histogram only holds the window. */
+	const uint32_t* histogram = stats.GetHistogram();
+	uint32_t total = 0;
+
+	for (uint32_t i = 0; i < FRAMEMETRICS_HISTOGRAM_BUCKETS; i++)
+	{
+		total += histogram[i];
+	}
+
+	EXPECT(total == 4);
+	EXPECT(histogram[FrameStats::GetBucket(10.0f)] == 4);
+	EXPECT(histogram[FrameStats::GetBucket(100.0f)] == 0);
+}
+
+TEST(FrameStats, HitchesAgainstMedian)
+{
+	FrameStats stats{};
+
+	/* No baseline yet. */
+	EXPECT(!stats.Push(500.0f));
+
+	stats.Clear();
+
+	for (uint32_t i = 0; i < 60; i++)
+	{
+		stats.Push(16.0f);
+	}
+
+	stats.ComputePercentiles();
+
+	/* Needs to exceed both twice the median and the median plus the margin. */
+	EXPECT(!stats.Push(30.0f));
+	EXPECT(!stats.Push(32.0f));
+	EXPECT(stats.Push(33.0f));
+}
+
+TEST(FrameStats, BucketsClampToLast)
+{
+	EXPECT(FrameStats::GetBucket(0.0f) == 0);
+	EXPECT(FrameStats::GetBucket(FRAMEMETRICS_HISTOGRAM_WIDTH_MS * 3.5f) == 3);
+	EXPECT(FrameStats::GetBucket(10000.0f) == FRAMEMETRICS_HISTOGRAM_BUCKETS - 1);
+}
+
+TEST(FrameStats, ClearResetsEverything)
+{
+	FrameStats stats{ 8 };
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		stats.Push(20.0f);
+	}
+
+	stats.ComputePercentiles();
+	stats.Clear();
+
+	EXPECT(stats.Count() == 0);
+	EXPECT(stats.GetAverage() == 0);
+	EXPECT(stats.GetP50() == 0);
+	EXPECT(stats.GetHistogram()[FrameStats::GetBucket(20.0f)] == 0);
+}
@@ -0,0 +1,147 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasBench.cpp
+/// Description  :  Estimates the draw calls saved by the atlas on synthetic ImGui draw lists.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Graphics/Textures/TxAtlasLayout.h"
+
+using namespace Raidcore::Nexus::Graphics;
+using namespace Raidcore::Nexus::Tests;
+
+/* As in TxAtlas.h. */
+constexpr const uint32_t PAGESIZE = 1024;
+constexpr const uint32_t MAXPAGES = 4;
+constexpr const uint32_t MAXSIZE  = 64;
+constexpr const uint32_t PADDING  = 1;
+
+/* Text, frames and buttons all sample the font texture. */
+constexpr const uint32_t FONT = UINT32_MAX;
+
+///----------------------------------------------------------------------------------------------------
+/// Texture_t Struct
+///----------------------------------------------------------------------------------------------------
+struct Texture_t
+{
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t Page = UINT32_MAX; /* Atlas page or UINT32_MAX, if drawn standalone. */
+};
+
+///----------------------------------------------------------------------------------------------------
+/// CountDrawCalls:
+/// 	ImGui merges consecutive commands sampling the same texture in the same clip rect.
+/// 	A draw list is a sequence of textures, a clip rect change is FONT followed by itself.
+///----------------------------------------------------------------------------------------------------
+static uint32_t CountDrawCalls(const std::vector<uint32_t>& aDrawList, const std::vector<Texture_t>& aTextures, bool aUseAtlas)
+{
+	uint32_t calls = 0;
+	uint64_t previous = UINT64_MAX;
+
+	for (uint32_t texture : aDrawList)
+	{
+		/* Pages and standalone textures never share an id. */
+		uint64_t id = texture;
+
+		if (aUseAtlas && texture != FONT && aTextures[texture].Page != UINT32_MAX)
+		{
+			id = (1ull << 32) | aTextures[texture].Page;
+		}
+
+		if (id != previous) { calls++; }
+		previous = id;
+	}
+
+	return calls;
+}
+
+TEST(TextureAtlas, DrawCallEstimate)
+{
+	std::mt19937 rng{ 36 };
+
+	/* Shortcut icons, addon icons, a few larger banners that are never packed.
+	 * Only Nexus' own UI draws from the atlas, addons keep drawing their standalone textures. */
+	std::vector<Texture_t> textures;
+	for (uint32_t i = 0; i < 40; i++)  { textures.push_back(Texture_t{ 32, 32 }); }   /* QuickAccess, normal and hover. */
+	for (uint32_t i = 0; i < 120; i++) { textures.push_back(Texture_t{ 64, 64 }); }   /* Addon icons.                   */
+	for (uint32_t i = 0; i < 10; i++)  { textures.push_back(Texture_t{ 256, 128 }); } /* Banners.                       */
+
+	AtlasLayout layout{ PAGESIZE, MAXPAGES };
+	uint32_t packed = 0;
+
+	for (uint32_t i = 0; i < textures.size(); i++)
+	{
+		Texture_t& texture = textures[i];
+
+		if (texture.Width > MAXSIZE || texture.Height > MAXSIZE) { continue; }
+
+		uint32_t page = 0;
+		AtlasRect_t rect{};
+
+		if (layout.Place(reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1)), texture.Width + PADDING * 2, texture.Height + PADDING * 2, []() { return true; }, nullptr, page, rect))
+		{
+			texture.Page = page;
+			packed++;
+		}
+	}
+
+	Print("layout", "%u of %zu textures packed on %u pages", packed, textures.size(), layout.GetPageCount());
+
+	struct Scenario_t
+	{
+		const char*           Name;
+		std::vector<uint32_t> DrawList;
+	};
+
+	std::vector<Scenario_t> scenarios;
+
+	/* QuickAccess: 20 shortcuts in a row, some hovered. */
+	{
+		Scenario_t scenario{ "quick access bar" };
+		for (uint32_t i = 0; i < 20; i++)
+		{
+			scenario.DrawList.push_back(rng() % 8 == 0 ? 20 + i : i);
+		}
+		scenarios.push_back(scenario);
+	}
+
+	/* Addons window: every row an icon, then its name, description and buttons.
+	 * The font texture sits between any two icons, the atlas can not merge them. */
+	{
+		Scenario_t scenario{ "addons listing" };
+		for (uint32_t i = 0; i < 40; i++)
+		{
+			scenario.DrawList.push_back(40 + i);
+			scenario.DrawList.push_back(FONT);
+		}
+		scenarios.push_back(scenario);
+	}
+
+	uint32_t totalBefore = 0;
+	uint32_t totalAfter = 0;
+
+	for (const Scenario_t& scenario : scenarios)
+	{
+		uint32_t before = CountDrawCalls(scenario.DrawList, textures, false);
+		uint32_t after = CountDrawCalls(scenario.DrawList, textures, true);
+
+		totalBefore += before;
+		totalAfter += after;
+
+		Print(scenario.Name, "%4u draw calls, %4u with the atlas (-%.0f%%)", before, after, 100.0 * (before - after) / before);
+
+		EXPECT(after <= before);
+	}
+
+	Print("total", "%4u draw calls, %4u with the atlas (-%.0f%%)", totalBefore, totalAfter, 100.0 * (totalBefore - totalAfter) / totalBefore);
+}
@@ -0,0 +1,316 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxAtlasTest.cpp
+/// Description  :  Tests for the atlas packer and page management.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Test.h"
+
+#include "Graphics/Textures/TxAtlasLayout.h"
+#include "Graphics/Textures/TxAtlasPacker.h"
+
+using namespace Raidcore::Nexus::Graphics;
+
+namespace
+{
+	bool IsOverlapping(const AtlasRect_t& aLeft, const AtlasRect_t& aRight)
+	{
+		return aLeft.X < aRight.X + aRight.Width && aRight.X < aLeft.X + aLeft.Width
+			&& aLeft.Y < aRight.Y + aRight.Height && aRight.Y < aLeft.Y + aLeft.Height;
+	}
+
+	bool IsWithin(const AtlasRect_t& aRect, uint32_t aSize)
+	{
+		return aRect.X + aRect.Width <= aSize && aRect.Y + aRect.Height <= aSize;
+	}
+
+	bool IsDisjoint(const std::vector<AtlasRect_t>& aRects, uint32_t aSize)
+	{
+		for (size_t i = 0; i < aRects.size(); i++)
+		{
+			if (!IsWithin(aRects[i], aSize)) { return false; }
+
+			for (size_t j = i + 1; j < aRects.size(); j++)
+			{
+				if (IsOverlapping(aRects[i], aRects[j])) { return false; }
+			}
+		}
+
+		return true;
+	}
+
+	/* Distinct keys for the layout. */
+	void* Key(uintptr_t aIndex)
+	{
+		return reinterpret_cast<void*>(aIndex + 1);
+	}
+}
+
+TEST(AtlasPacker, RandomRectsDoNotOverlap)
+{
+	AtlasPacker packer{ 256, 256 };
+	std::mt19937 rng(3);
+
+	std::vector<AtlasRect_t> rects;
+	uint64_t area = 0;
+
+	for (uint32_t i = 0; i < 500; i++)
+	{
+		uint32_t w = 1 + rng() % 34;
+		uint32_t h = 1 + rng() % 34;
+
+		AtlasRect_t rect{};
+
+		if (!packer.Pack(w, h, rect)) { continue; }
+
+		EXPECT(rect.Width == w && rect.Height == h);
+		rects.push_back(rect);
+		area += static_cast<uint64_t>(w) * h;
+	}
+
+	EXPECT(IsDisjoint(rects, 256));
+	EXPECT(packer.GetUsedArea() == area);
+
+	/* A skyline should use most of the page for small icons. */
+	EXPECT(area > 256ull * 256 * 7 / 10);
+}
+
+TEST(AtlasPacker, UniformIconsFillThePage)
+{
+	AtlasPacker packer{ 128, 128 };
+	AtlasRect_t rect{};
+
+	for (uint32_t i = 0; i < 16; i++)
+	{
+		ASSERT(packer.Pack(32, 32, rect));
+	}
+
+	EXPECT(!packer.Pack(1, 1, rect));
+	EXPECT(packer.GetUsedArea() == 128ull * 128);
+}
+
+TEST(AtlasPacker, RejectsEmptyAndOversized)
+{
+	AtlasPacker packer{ 64, 64 };
+	AtlasRect_t rect{};
+
+	EXPECT(!packer.Pack(0, 8, rect));
+	EXPECT(!packer.Pack(8, 0, rect));
+	EXPECT(!packer.Pack(65, 8, rect));
+	EXPECT(!packer.Pack(8, 65, rect));
+	EXPECT(packer.Pack(64, 64, rect));
+	EXPECT(rect.X == 0 && rect.Y == 0);
+}
+
+TEST(AtlasPacker, ResetReclaimsEverything)
+{
+	AtlasPacker packer{ 64, 64 };
+	AtlasRect_t rect{};
+
+	ASSERT(packer.Pack(64, 64, rect));
+	EXPECT(!packer.Pack(1, 1, rect));
+
+	packer.Reset();
+
+	EXPECT(packer.GetUsedArea() == 0);
+	EXPECT(packer.Pack(64, 64, rect));
+}
+
+TEST(AtlasLayout, CreatesPagesOnDemandUpToTheLimit)
+{
+	AtlasLayout layout{ 64, 2 };
+	uint32_t created = 0;
+
+	auto create = [&]() { created++; return true; };
+
+	uint32_t page = 0;
+	AtlasRect_t rect{};
+
+	/* Four 32x32 fit a page. */
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		ASSERT(layout.Place(Key(i), 32, 32, create, nullptr, page, rect));
+		EXPECT(page == i / 4);
+	}
+
+	EXPECT(created == 2);
+	EXPECT(!layout.Place(Key(8), 32, 32, create, nullptr, page, rect));
+	EXPECT(created == 2);
+	EXPECT(layout.GetPageCount() == 2);
+	EXPECT(layout.GetEntryCount() == 8);
+}
+
+TEST(AtlasLayout, FailedPageCreationChangesNothing)
+{
+	AtlasLayout layout{ 64, 4 };
+
+	uint32_t page = 0;
+	AtlasRect_t rect{};
+
+	EXPECT(!layout.Place(Key(0), 16, 16, []() { return false; }, nullptr, page, rect));
+	EXPECT(layout.GetPageCount() == 0);
+	EXPECT(layout.GetEntryCount() == 0);
+}
+
+TEST(AtlasLayout, RemovingTheLastEntryResetsThePage)
+{
+	AtlasLayout layout{ 64, 1 };
+	auto create = []() { return true; };
+
+	uint32_t page = 0;
+	AtlasRect_t rect{};
+
+	ASSERT(layout.Place(Key(0), 64, 64, create, nullptr, page, rect));
+	EXPECT(!layout.Place(Key(1), 8, 8, create, nullptr, page, rect));
+
+	EXPECT(layout.Remove(Key(0)));
+	EXPECT(!layout.Remove(Key(0)));
+	EXPECT(layout.GetPage(0).Packer.GetUsedArea() == 0);
+
+	/* Reused without repacking or a new page. */
+	EXPECT(layout.Place(Key(1), 64, 64, create, nullptr, page, rect));
+	EXPECT(layout.GetPageCount() == 1);
+}
+
+TEST(AtlasLayout, RepackReclaimsRemovedSpace)
+{
+	AtlasLayout layout{ 64, 1 };
+	auto create = []() { return true; };
+
+	uint32_t page = 0;
+	AtlasRect_t rect{};
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		ASSERT(layout.Place(Key(i), 32, 32, create, nullptr, page, rect));
+	}
+
+	/* Frees a quarter, the skyline cannot reuse it without repacking. */
+	ASSERT(layout.Remove(Key(0)));
+
+	std::vector<AtlasMove_t> moves;
+	uint32_t repacks = 0;
+
+	auto repack = [&](uint32_t aPage, const std::vector<AtlasMove_t>& aMoves)
+	{
+		EXPECT(aPage == 0);
+		moves = aMoves;
+		repacks++;
+		return true;
+	};
+
+	ASSERT(layout.Place(Key(4), 32, 32, create, repack, page, rect));
+	EXPECT(repacks == 1);
+	EXPECT(moves.size() == 3);
+
+	/* The moves describe the layout of the page, plus the new entry. */
+	std::vector<AtlasRect_t> rects;
+
+	for (const AtlasMove_t& move : moves)
+	{
+		EXPECT(move.Key != Key(0));
+		EXPECT(move.From.Width == move.To.Width && move.From.Height == move.To.Height);
+		rects.push_back(move.To);
+	}
+
+	rects.push_back(rect);
+	EXPECT(IsDisjoint(rects, 64));
+
+	const AtlasLayoutPage_t& state = layout.GetPage(0);
+	EXPECT(state.Entries.size() == 4);
+	EXPECT(state.LiveArea == 4ull * 32 * 32);
+}
+
+TEST(AtlasLayout, FailedRepackKeepsThePage)
+{
+	AtlasLayout layout{ 64, 1 };
+	auto create = []() { return true; };
+
+	uint32_t page = 0;
+	AtlasRect_t rect{};
+
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		ASSERT(layout.Place(Key(i), 32, 32, create, nullptr, page, rect));
+	}
+
+	ASSERT(layout.Remove(Key(1)));
+
+	std::vector<AtlasRect_t> before;
+
+	for (const AtlasEntry_t& entry : layout.GetPage(0).Entries)
+	{
+		before.push_back(entry.Rect);
+	}
+
+	EXPECT(!layout.Place(Key(4), 32, 32, create, [](uint32_t, const std::vector<AtlasMove_t>&) { return false; }, page, rect));
+
+	const AtlasLayoutPage_t& state = layout.GetPage(0);
+	ASSERT(state.Entries.size() == before.size());
+
+	for (size_t i = 0; i < before.size(); i++)
+	{
+		EXPECT(state.Entries[i].Rect.X == before[i].X && state.Entries[i].Rect.Y == before[i].Y);
+	}
+}
+
+TEST(AtlasLayout, ChurnKeepsPagesConsistent)
+{
+	constexpr uint32_t PAGESIZE = 256;
+
+	AtlasLayout layout{ PAGESIZE, 3 };
+	std::mt19937 rng(4);
+
+	auto create = []() { return true; };
+	auto repack = [](uint32_t, const std::vector<AtlasMove_t>&) { return true; };
+
+	std::vector<uintptr_t> live;
+	uintptr_t next = 0;
+
+	for (uint32_t i = 0; i < 5000; i++)
+	{
+		if (!live.empty() && rng() % 3 == 0)
+		{
+			size_t idx = rng() % live.size();
+			EXPECT(layout.Remove(Key(live[idx])));
+			live.erase(live.begin() + idx);
+			continue;
+		}
+
+		uint32_t page = 0;
+		AtlasRect_t rect{};
+
+		if (layout.Place(Key(next), 2 + rng() % 65, 2 + rng() % 65, create, repack, page, rect))
+		{
+			live.push_back(next);
+		}
+
+		next++;
+	}
+
+	EXPECT(layout.GetEntryCount() == live.size());
+
+	for (uint32_t p = 0; p < layout.GetPageCount(); p++)
+	{
+		const AtlasLayoutPage_t& state = layout.GetPage(p);
+
+		std::vector<AtlasRect_t> rects;
+		uint64_t area = 0;
+
+		for (const AtlasEntry_t& entry : state.Entries)
+		{
+			rects.push_back(entry.Rect);
+			area += static_cast<uint64_t>(entry.Rect.Width) * entry.Rect.Height;
+		}
+
+		EXPECT(IsDisjoint(rects, PAGESIZE));
+		EXPECT(state.LiveArea == area);
+		EXPECT(state.Packer.GetUsedArea() >= area);
+	}
+}
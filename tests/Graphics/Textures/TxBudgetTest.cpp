@@ -0,0 +1,259 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxBudgetTest.cpp
+/// Description  :  Tests for the texture memory accounting and least recently used eviction.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Graphics/Textures/TxRecordingUploader.h"
+
+#include "Graphics/Textures/TxBudget.h"
+#include "Memory/ResourceLedger.h"
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Graphics;
+using namespace Raidcore::Nexus::Tests;
+
+static int s_Module = 0;
+
+/* Owner of all textures in these tests, the ledger is shared with the other tests. */
+static void* const MODULE = &s_Module;
+
+///----------------------------------------------------------------------------------------------------
+/// BudgetDriver Class
+/// 	Drives a budget like the texture loader: lookups touch, each frame restores, then evicts.
+///----------------------------------------------------------------------------------------------------
+class BudgetDriver
+{
+	public:
+	BudgetDriver(uint64_t aBudget)
+		: BudgetBytes(aBudget)
+	{
+	}
+
+	~BudgetDriver()
+	{
+		for (auto& [identifier, texture] : this->Registry)
+		{
+			this->Uploader.Release(texture.Resource);
+		}
+
+		this->Budget.Clear();
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Load:
+	/// 	Creates a square texture, as the loader creates a queued one.
+	///----------------------------------------------------------------------------------------------------
+	void Load(const std::string& aIdentifier, uint32_t aSize, long long aTime, uint64_t aCacheKey = 1)
+	{
+		std::vector<uint8_t> pixels(static_cast<size_t>(aSize) * aSize * 4, 0xFF);
+
+		Texture_t& texture = this->Registry[aIdentifier];
+		texture = Texture_t{ aSize, aSize, this->Uploader.Create(aSize, aSize, pixels.data()) };
+		texture.LastUsed = aTime;
+
+		this->Budget.Track(aIdentifier, &texture, TextureBudget::GetSize(aSize, aSize), MODULE, aCacheKey, TextureSource_t{});
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Get:
+	/// 	Looks up a texture, as TextureLoader::Get does.
+	///----------------------------------------------------------------------------------------------------
+	Texture_t* Get(const std::string& aIdentifier, long long aTime)
+	{
+		auto it = this->Registry.find(aIdentifier);
+
+		if (it == this->Registry.end()) { return nullptr; }
+
+		it->second.LastUsed = aTime;
+		return &it->second;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Advance:
+	/// 	Restores the textures used again, then evicts the least recently used ones over budget.
+	///----------------------------------------------------------------------------------------------------
+	void Advance(long long aTime)
+	{
+		for (const std::string& identifier : this->Budget.SelectRestores())
+		{
+			Texture_t& texture = this->Registry.at(identifier);
+			std::vector<uint8_t> pixels(static_cast<size_t>(texture.Width) * texture.Height * 4, 0xFF);
+
+			this->Uploader.Release(texture.Resource);
+			texture.Resource = this->Uploader.Create(texture.Width, texture.Height, pixels.data());
+
+			this->Budget.Track(identifier, &texture, TextureBudget::GetSize(texture.Width, texture.Height), nullptr, this->Budget.Find(identifier)->CacheKey, TextureSource_t{});
+			this->Restored.push_back(identifier);
+		}
+
+		std::vector<std::string> evictions = this->Budget.SelectEvictions(
+			this->BudgetBytes,
+			aTime,
+			TEXBUDGET_MINIDLE_MS,
+			[](const std::string& aIdentifier, const TextureRecord_t& aRecord)
+			{
+				return aRecord.CacheKey != 0;
+			}
+		);
+
+		for (const std::string& identifier : evictions)
+		{
+			/* Own placeholder per texture, as the loader creates. */
+			uint32_t transparent = 0;
+			Texture_t& texture = this->Registry.at(identifier);
+
+			this->Uploader.Release(texture.Resource);
+			texture.Resource = this->Uploader.Create(1, 1, reinterpret_cast<const uint8_t*>(&transparent));
+
+			this->Budget.SetEvicted(identifier, aTime);
+			this->Evicted.push_back(identifier);
+		}
+	}
+
+	uint64_t                         BudgetBytes;
+	RecordingUploader                Uploader;
+	TextureBudget                    Budget;
+	std::map<std::string, Texture_t> Registry;
+	std::vector<std::string>         Evicted;
+	std::vector<std::string>         Restored;
+};
+
+static int64_t GetLedger(Memory::EResource aResource)
+{
+	for (const Memory::ResourceUsage_t& usage : Memory::ResourceLedger::Get()->GetSnapshot())
+	{
+		if (usage.Owner == MODULE) { return usage.Get(aResource); }
+	}
+
+	return 0;
+}
+
+TEST(TextureBudget, EvictsLeastRecentlyUsedFirst)
+{
+	/* Room for two of the four 64x64 textures. */
+	BudgetDriver driver(2 * TextureBudget::GetSize(64, 64));
+
+	driver.Load("C", 64, 0);
+	driver.Load("A", 64, 0);
+	driver.Load("D", 64, 0);
+	driver.Load("B", 64, 0);
+
+	driver.Get("A", 1000);
+	driver.Get("B", 2000);
+	driver.Get("C", 3000);
+	driver.Get("D", 4000);
+
+	/* Everything was used within the idle time. */
+	driver.Advance(10000);
+	EXPECT(driver.Evicted.empty());
+
+	driver.Advance(4000 + TEXBUDGET_MINIDLE_MS);
+	ASSERT(driver.Evicted.size() == 2);
+	EXPECT(driver.Evicted[0] == "A");
+	EXPECT(driver.Evicted[1] == "B");
+
+	EXPECT(driver.Budget.GetResidentSize() == 2 * TextureBudget::GetSize(64, 64));
+	EXPECT(driver.Budget.Find("A")->IsEvicted);
+	EXPECT(!driver.Budget.Find("C")->IsEvicted);
+
+	/* Video memory follows: two textures and two placeholders. */
+	EXPECT(driver.Uploader.GetLiveCount() == 4);
+	EXPECT(driver.Uploader.GetLiveBytes() == 2 * TextureBudget::GetSize(64, 64) + 2 * TextureBudget::GetSize(1, 1));
+	EXPECT(driver.Uploader.GetUnknownReleases() == 0);
+}
+
+TEST(TextureBudget, EnforcesTheBudget)
+{
+	BudgetDriver driver(2 * TextureBudget::GetSize(128, 128));
+
+	driver.Load("large", 256, 0);
+	driver.Load("recent", 128, 50000);
+
+	for (int i = 0; i < 8; i++)
+	{
+		driver.Load("small" + std::to_string(i), 32, 2000 + i);
+	}
+
+	/* Not cached, it cannot be restored and is never evicted. */
+	driver.Load("uncached", 32, 0, 0);
+
+	/* "small0" is idle long enough too, but evicting stops as soon as the textures fit. */
+	driver.Advance(2000 + TEXBUDGET_MINIDLE_MS);
+	ASSERT(driver.Evicted.size() == 1);
+	EXPECT(driver.Evicted[0] == "large");
+	EXPECT(driver.Budget.GetResidentSize() <= driver.BudgetBytes);
+
+	/* Textures in use stay resident, even if that exceeds the budget. */
+	driver.Load("huge", 512, 40000);
+	EXPECT(driver.Budget.GetResidentSize() > driver.BudgetBytes);
+
+	driver.Advance(50000 + TEXBUDGET_MINIDLE_MS - 1);
+	ASSERT(driver.Evicted.size() == 10);
+	EXPECT(driver.Evicted[1] == "small0");
+	EXPECT(driver.Evicted[8] == "small7");
+	EXPECT(driver.Evicted[9] == "huge");
+	EXPECT(driver.Budget.GetResidentSize() <= driver.BudgetBytes);
+	EXPECT(!driver.Budget.Find("recent")->IsEvicted);
+	EXPECT(!driver.Budget.Find("uncached")->IsEvicted);
+
+	/* Unlimited. */
+	driver.BudgetBytes = 0;
+	driver.Load("another", 512, 0);
+	driver.Advance(1000000);
+	EXPECT(driver.Evicted.size() == 10);
+}
+
+TEST(TextureBudget, RestoresOnGet)
+{
+	BudgetDriver driver(TextureBudget::GetSize(64, 64));
+
+	driver.Load("A", 64, 0);
+	driver.Load("B", 64, 0);
+
+	int64_t bytes = GetLedger(Memory::EResource::TextureBytes);
+	EXPECT(GetLedger(Memory::EResource::Textures) == 2);
+
+	driver.Get("B", 1);
+	driver.Advance(TEXBUDGET_MINIDLE_MS + 1);
+
+	ASSERT(driver.Evicted.size() == 1);
+	EXPECT(driver.Evicted[0] == "A");
+	EXPECT(GetLedger(Memory::EResource::Textures) == 1);
+	EXPECT(GetLedger(Memory::EResource::TextureBytes) == bytes - static_cast<int64_t>(TextureBudget::GetSize(64, 64)));
+
+	/* Not looked up again, nothing comes back. */
+	driver.Advance(TEXBUDGET_MINIDLE_MS + 2);
+	EXPECT(driver.Restored.empty());
+	EXPECT(driver.Budget.SelectRestores().empty());
+
+	/* The holder keeps its pointer, the lookup brings the pixels back with the next frame. */
+	Texture_t* texture = driver.Get("A", TEXBUDGET_MINIDLE_MS + 3);
+	ASSERT(texture);
+	EXPECT(texture->Width == 64);
+
+	void* placeholder = texture->Resource;
+	driver.Advance(TEXBUDGET_MINIDLE_MS + 4);
+
+	ASSERT(driver.Restored.size() == 1);
+	EXPECT(driver.Restored[0] == "A");
+	EXPECT(driver.Get("A", TEXBUDGET_MINIDLE_MS + 4) == texture);
+	EXPECT(texture->Resource != placeholder);
+	EXPECT(!driver.Budget.Find("A")->IsEvicted);
+
+	/* The restore keeps the owner, back to budget "B" gives way, as it is idle the longest now. */
+	EXPECT(GetLedger(Memory::EResource::Textures) == 1);
+	ASSERT(driver.Evicted.size() == 2);
+	EXPECT(driver.Evicted[1] == "B");
+
+	EXPECT(driver.Uploader.GetLiveCount() == 2);
+	EXPECT(driver.Uploader.GetUnknownReleases() == 0);
+}
@@ -0,0 +1,111 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxDiskCacheBench.cpp
+/// Description  :  Cold and warm startup of a 500 icon set, decoded versus mapped from the disk cache.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+#include "Graphics/Textures/TxRequests.h"
+
+#include "Core/Logging/LogApi.h"
+#include "Graphics/Textures/TxDiskCache.h"
+#include "stb/stb_image.h"
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Graphics;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t ICONS     = 500;
+constexpr const uint32_t ICON_SIZE = 64;
+
+///----------------------------------------------------------------------------------------------------
+/// Startup:
+/// 	Loads every icon as the store does on a cache lookup, decoding and storing the misses.
+/// 	Returns the microseconds per icon, aOutTotalUs includes scanning the cache directory.
+///----------------------------------------------------------------------------------------------------
+static std::vector<double> Startup(const std::filesystem::path& aDirectory, const std::vector<std::vector<uint8_t>>& aIcons, double& aOutTotalUs, uint64_t& aOutHits)
+{
+	Core::LogApi logger;
+
+	BenchClock::time_point startupStart = BenchClock::now();
+
+	TextureDiskCache cache(logger, aDirectory);
+
+	std::vector<double> iconUs;
+
+	for (const std::vector<uint8_t>& icon : aIcons)
+	{
+		BenchClock::time_point start = BenchClock::now();
+
+		uint64_t key = TextureDiskCache::GetKey(icon.data(), icon.size());
+
+		CachedTexture_t cached{};
+
+		if (cache.Load(key, cached))
+		{
+			DoNotOptimize(cached.Data[0]);
+			TextureDiskCache::Release(cached.View);
+		}
+		else
+		{
+			int width = 0;
+			int height = 0;
+			int components = 0;
+			unsigned char* data = stbi_load_from_memory(icon.data(), static_cast<int>(icon.size()), &width, &height, &components, 4);
+
+			if (data)
+			{
+				cache.Store(key, static_cast<uint32_t>(width), static_cast<uint32_t>(height), data);
+				stbi_image_free(data);
+			}
+		}
+
+		iconUs.push_back(ElapsedUs(start));
+	}
+
+	aOutTotalUs = ElapsedUs(startupStart);
+	aOutHits = cache.GetHits();
+
+	return iconUs;
+}
+
+TEST(TextureDiskCache, ColdAndWarmStartup)
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "NexusDiskCacheBench";
+
+	std::error_code ec;
+	std::filesystem::remove_all(directory, ec);
+	std::filesystem::create_directories(directory);
+
+	std::vector<std::vector<uint8_t>> icons;
+
+	for (uint32_t i = 0; i < ICONS; i++)
+	{
+		icons.push_back(EncodePng(ICON_SIZE, ICON_SIZE, i));
+	}
+
+	double coldTotalUs = 0;
+	uint64_t coldHits = 0;
+	std::vector<double> coldUs = Startup(directory, icons, coldTotalUs, coldHits);
+
+	/* A new cache on the same directory, as on the next game start. */
+	double warmTotalUs = 0;
+	uint64_t warmHits = 0;
+	std::vector<double> warmUs = Startup(directory, icons, warmTotalUs, warmHits);
+
+	Report("cold, decode and store", coldUs, "us");
+	Report("warm, map", warmUs, "us");
+	Print("startup", "%u icons of %ux%u, cold %.1f ms, warm %.1f ms", ICONS, ICON_SIZE, ICON_SIZE, coldTotalUs / 1000.0, warmTotalUs / 1000.0);
+
+	EXPECT(coldHits == 0);
+	EXPECT(warmHits == ICONS);
+
+	std::filesystem::remove_all(directory, ec);
+}
@@ -0,0 +1,441 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxLoaderBench.cpp
+/// Description  :  Drives the texture loader headless and reports request-to-ready latency.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+#include "Graphics/Textures/TxRecordingUploader.h"
+#include "Graphics/Textures/TxRequests.h"
+
+#include "Core/Logging/LogApi.h"
+#include "Core/Settings/SettingsMgr.h"
+#include "Graphics/GrWindow.h"
+#include "Graphics/Textures/TxLoader.h"
+
+#pragma warning(push, 0)
+#include "httplib/httplib.h"
+#pragma warning(pop)
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Tests;
+
+///----------------------------------------------------------------------------------------------------
+/// HttpStub Class
+/// 	Serves generated PNGs on the loopback, /tex/<seed>.png and /stall, which never answers in time.
+///----------------------------------------------------------------------------------------------------
+class HttpStub
+{
+	public:
+	HttpStub()
+	{
+		this->Server.Get(R"(/tex/(\d+)\.png)", [](const httplib::Request& aRequest, httplib::Response& aResponse)
+		{
+			std::vector<uint8_t> png = EncodePng(32, 32, static_cast<uint32_t>(std::stoul(aRequest.matches[1])));
+			aResponse.set_content(reinterpret_cast<const char*>(png.data()), png.size(), "image/png");
+		});
+
+		this->Server.Get(R"(/stall/(\d+))", [this](const httplib::Request&, httplib::Response& aResponse)
+		{
+			/* Longer than the read timeout of the client. */
+			std::unique_lock<std::mutex> lock(this->Mutex);
+			this->ConVar.wait_for(lock, std::chrono::seconds(10), [this]() { return this->IsStopping; });
+			aResponse.status = 503;
+		});
+
+		this->Port = this->Server.bind_to_any_port("127.0.0.1");
+
+		this->Thread = std::thread([this]()
+		{
+			this->Server.listen_after_bind();
+		});
+
+		this->Server.wait_until_ready();
+	}
+
+	~HttpStub()
+	{
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			this->IsStopping = true;
+		}
+
+		this->ConVar.notify_all();
+		this->Server.stop();
+		this->Thread.join();
+	}
+
+	std::string GetRemote() const
+	{
+		return "http://127.0.0.1:" + std::to_string(this->Port);
+	}
+
+	private:
+	httplib::Server         Server;
+	std::thread             Thread;
+	int                     Port       = 0;
+
+	std::mutex              Mutex;
+	std::condition_variable ConVar;
+	bool                    IsStopping = false;
+};
+
+///----------------------------------------------------------------------------------------------------
+/// LoaderDriver Class
+/// 	Owns a texture loader on a recording uploader and advances it like the render thread would.
+///----------------------------------------------------------------------------------------------------
+class LoaderDriver
+{
+	public:
+	LoaderDriver()
+		: Root(CreateRoot())
+		, Settings(Root / "settings.json", Logger)
+		, Loader(Logger, Window, Uploader, Settings, Root / "overrides", Root / "cache")
+	{
+		ClearRequests();
+	}
+
+	~LoaderDriver()
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(this->Root, ec);
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// RunUntil:
+	/// 	Advances one frame per millisecond, until the condition is met or the timeout elapsed.
+	///----------------------------------------------------------------------------------------------------
+	bool RunUntil(const std::function<bool()>& aIsDone, std::chrono::milliseconds aTimeout = std::chrono::seconds(10))
+	{
+		BenchClock::time_point deadline = BenchClock::now() + aTimeout;
+
+		while (BenchClock::now() < deadline)
+		{
+			this->Loader.Advance();
+
+			if (aIsDone()) { return true; }
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		return false;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// WriteFile:
+	/// 	Writes a generated PNG and returns its path.
+	///----------------------------------------------------------------------------------------------------
+	std::filesystem::path WriteFile(uint32_t aSeed, uint32_t aSize = 32)
+	{
+		std::filesystem::path path = this->Root / "files" / (std::to_string(aSeed) + ".png");
+		std::filesystem::create_directories(path.parent_path());
+
+		std::vector<uint8_t> png = EncodePng(aSize, aSize, aSeed);
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(png.data()), png.size());
+
+		return path;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Shutdown:
+	/// 	Releases all textures. Returns true, if every created resource was released exactly once.
+	///----------------------------------------------------------------------------------------------------
+	bool Shutdown()
+	{
+		this->Loader.Shutdown();
+
+		return this->Uploader.GetLiveCount() == 0 && this->Uploader.GetUnknownReleases() == 0;
+	}
+
+	std::filesystem::path      Root;
+	Core::LogApi               Logger;
+	Graphics::Window_t         Window{};
+	RecordingUploader          Uploader;
+	Core::SettingsMgr          Settings;
+	Graphics::TextureLoader    Loader;
+
+	private:
+	static std::filesystem::path CreateRoot()
+	{
+		static std::atomic<uint32_t> s_Instance{ 0 };
+
+		std::filesystem::path root = std::filesystem::temp_directory_path() / ("NexusTextureBench_" + std::to_string(s_Instance++));
+
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+		std::filesystem::create_directories(root / "overrides");
+		std::filesystem::create_directories(root / "cache");
+
+		return root;
+	}
+};
+
+TEST(TextureLoader, FileLoads)
+{
+	LoaderDriver driver;
+
+	constexpr uint32_t count = 500;
+
+	std::vector<std::filesystem::path> paths;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		paths.push_back(driver.WriteFile(i));
+	}
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "FILE_" + std::to_string(i);
+		Track(identifier);
+		driver.Loader.Load(identifier.c_str(), paths[i].string().c_str(), OnReceive, false, nullptr);
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == count);
+	EXPECT(driver.Uploader.GetLiveBytes() == uint64_t{ count } * 32 * 32 * 4);
+	EXPECT(GetRequest("FILE_0").Texture && GetRequest("FILE_0").Texture->Width == 32);
+
+	ReportRequests("file");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, MemoryLoads)
+{
+	LoaderDriver driver;
+
+	constexpr uint32_t count = 500;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "MEM_" + std::to_string(i);
+		std::vector<uint8_t> png = EncodePng(32, 32, i);
+
+		Track(identifier);
+		driver.Loader.Load(identifier.c_str(), png.data(), png.size(), OnReceive, false, nullptr);
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == count);
+
+	ReportRequests("memory");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, RemoteLoads)
+{
+	HttpStub stub;
+	LoaderDriver driver;
+
+	constexpr uint32_t count = 100;
+
+	std::string remote = stub.GetRemote();
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "REMOTE_" + std::to_string(i);
+		std::string endpoint = "/tex/" + std::to_string(i) + ".png";
+
+		Track(identifier);
+		driver.Loader.Load(identifier.c_str(), remote.c_str(), endpoint.c_str(), OnReceive, false, nullptr);
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }, std::chrono::seconds(30)));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == count);
+	EXPECT(GetRequest("REMOTE_0").Texture != nullptr);
+
+	ReportRequests("remote");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, DuplicateRequests)
+{
+	HttpStub stub;
+	LoaderDriver driver;
+
+	std::string remote = stub.GetRemote();
+
+	Track("DUP");
+
+	/* Queued, later requests are dropped while the first one is in flight. */
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		driver.Loader.Load("DUP", remote.c_str(), "/tex/7.png", OnReceive, false, nullptr);
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == 1; }));
+
+	Graphics::Texture_t* texture = GetRequest("DUP").Texture;
+	ASSERT(texture != nullptr);
+
+	/* Created, later requests are answered right away. */
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		driver.Loader.Load("DUP", remote.c_str(), "/tex/7.png", OnReceive, false, nullptr);
+	}
+
+	EXPECT(GetRequest("DUP").Responses == 11);
+	EXPECT(GetRequest("DUP").Texture == texture);
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 1);
+
+	ReportRequests("duplicate");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, DeviceNotReady)
+{
+	LoaderDriver driver;
+
+	driver.Uploader.SetReady(false);
+
+	for (uint32_t i = 0; i < 20; i++)
+	{
+		std::string identifier = "LATE_" + std::to_string(i);
+		std::vector<uint8_t> png = EncodePng(16, 16, i);
+
+		Track(identifier);
+		driver.Loader.Load(identifier.c_str(), png.data(), png.size(), OnReceive, false, nullptr);
+	}
+
+	/* Kept queued, until the device exists. */
+	EXPECT(!driver.RunUntil([]() { return CountResponded() > 0; }, std::chrono::milliseconds(100)));
+	EXPECT(driver.Loader.GetQueuedTextures().size() == 20);
+
+	driver.Uploader.SetReady(true);
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == 20; }));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 20);
+
+	ReportRequests("device not ready");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, FailedUploads)
+{
+	LoaderDriver driver;
+
+	driver.Uploader.SetFailing(true);
+
+	std::vector<uint8_t> png = EncodePng(16, 16, 1);
+
+	Track("FAIL");
+	driver.Loader.Load("FAIL", png.data(), png.size(), OnReceive, false, nullptr);
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == 1; }));
+	EXPECT(GetRequest("FAIL").Texture == nullptr);
+	EXPECT(driver.RunUntil([&driver]() { return driver.Loader.GetQueuedTextures().empty(); }));
+	EXPECT(driver.Loader.GetRegistry().empty());
+
+	ReportRequests("failed upload");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureLoader, ShadowingUnderLoad)
+{
+	LoaderDriver driver;
+
+	constexpr uint32_t rounds = 50;
+	constexpr uint32_t load = 20;
+
+	std::vector<Graphics::Texture_t*> shadowed;
+
+	for (uint32_t round = 0; round <= rounds; round++)
+	{
+		/* Unrelated loads in flight, while the identifier is shadowed. */
+		for (uint32_t i = 0; i < load; i++)
+		{
+			std::string identifier = "LOAD_" + std::to_string(round) + "_" + std::to_string(i);
+			std::filesystem::path path = driver.WriteFile(1000 + round * load + i, 16);
+
+			Track(identifier);
+			driver.Loader.Load(identifier.c_str(), path.string().c_str(), OnReceive, false, nullptr);
+		}
+
+		std::vector<uint8_t> png = EncodePng(16, 16, round);
+
+		Track("SHADOW");
+		driver.Loader.Load("SHADOW", png.data(), png.size(), OnReceive, round > 0, nullptr);
+
+		ASSERT(driver.RunUntil([round]() { return GetRequest("SHADOW").Responses > 0 && CountResponded() == (round + 1) * load + 1; }));
+
+		shadowed.push_back(GetRequest("SHADOW").Texture);
+	}
+
+	ReportRequests("shadowing");
+
+	std::map<std::string, Graphics::Texture_t*> registry = driver.Loader.GetRegistry();
+
+	/* Every shadowed texture stays valid under its new identifier. */
+	EXPECT(registry.at("SHADOW") == shadowed.back());
+
+	for (uint32_t i = 1; i <= rounds; i++)
+	{
+		auto it = registry.find("SHADOW_" + std::to_string(i));
+
+		EXPECT(it != registry.end());
+	}
+
+	std::sort(shadowed.begin(), shadowed.end());
+	EXPECT(std::unique(shadowed.begin(), shadowed.end()) == shadowed.end());
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Release) == 0);
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureTimeout, StalledDownloadsAreDropped)
+{
+	HttpStub stub;
+	LoaderDriver driver;
+
+	/* Downloads run one after another, the last ones are still queued after the 60 s queue timeout. */
+	constexpr uint32_t count = 16;
+
+	std::string remote = stub.GetRemote();
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "STALL_" + std::to_string(i);
+		std::string endpoint = "/stall/" + std::to_string(i);
+
+		Track(identifier);
+		driver.Loader.Load(identifier.c_str(), remote.c_str(), endpoint.c_str(), OnReceive, false, nullptr);
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }, std::chrono::seconds(90)));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		EXPECT(GetRequest("STALL_" + std::to_string(i)).Texture == nullptr);
+	}
+
+	EXPECT(driver.RunUntil([&driver]() { return driver.Loader.GetQueuedTextures().empty(); }));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 0);
+
+	double latest = ReportRequests("stalled");
+
+	EXPECT(latest >= 60000);
+
+	EXPECT(driver.Shutdown());
+}
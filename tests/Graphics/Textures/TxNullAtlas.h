@@ -0,0 +1,58 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxNullAtlas.h
+/// Description  :  Texture atlas without pages, nothing is ever packed.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "Graphics/Textures/TxAtlasBase.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	///----------------------------------------------------------------------------------------------------
+	/// NullAtlas Class
+	/// 	Counts the textures offered and removed, the store falls back to the standalone resources.
+	///----------------------------------------------------------------------------------------------------
+	class NullAtlas : public virtual Graphics::ITextureAtlas
+	{
+		public:
+		bool Add(Graphics::Texture_t* aTexture, const uint8_t* aData) override
+		{
+			this->Adds++;
+			return false;
+		}
+
+		void Remove(Graphics::Texture_t* aTexture) override
+		{
+			this->Removes++;
+		}
+
+		void Clear() override {}
+
+		uint32_t GetPageCount() const override
+		{
+			return 0;
+		}
+
+		uint32_t GetSlotCount() const override
+		{
+			return 0;
+		}
+
+		uint64_t GetGeneration() const override
+		{
+			return 0;
+		}
+
+		uint32_t Adds    = 0;
+		uint32_t Removes = 0;
+	};
+}
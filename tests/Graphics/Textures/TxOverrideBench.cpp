@@ -0,0 +1,105 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrideBench.cpp
+/// Description  :  Compares the override index to probing the disk on every texture load.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Graphics/Textures/TxOverrideIndex.h"
+
+using namespace Raidcore::Nexus::Graphics;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t LOADS     = 5000;
+constexpr const uint32_t OVERRIDES = 10;
+
+TEST(TextureOverrides, IndexedLookups)
+{
+	std::filesystem::path root = std::filesystem::temp_directory_path() / "NexusOverrideBench";
+
+	std::error_code ec;
+	std::filesystem::remove_all(root, ec);
+	std::filesystem::create_directories(root / "addon");
+
+	/* Half top level, half sorted into a subfolder, as users do. */
+	for (uint32_t i = 0; i < OVERRIDES; i++)
+	{
+		std::filesystem::path path = (i % 2 ? root / "addon" : root) / ("TEX_" + std::to_string(i * (LOADS / OVERRIDES)) + ".png");
+		std::ofstream(path, std::ios::binary) << "image";
+	}
+
+	std::vector<std::string> identifiers;
+
+	for (uint32_t i = 0; i < LOADS; i++)
+	{
+		identifiers.push_back("TEX_" + std::to_string(i));
+	}
+
+	/* Before the index, every load checked for "<identifier>.png" in the directory. */
+	std::vector<double> probeUs;
+	uint32_t probeCalls = 0;
+	uint32_t probeHits = 0;
+
+	for (const std::string& identifier : identifiers)
+	{
+		BenchClock::time_point start = BenchClock::now();
+
+		probeCalls++;
+		if (std::filesystem::exists(root / (identifier + ".png"))) { probeHits++; }
+
+		probeUs.push_back(ElapsedUs(start));
+	}
+
+	/* The index walks the directory once, each load is a hash lookup. */
+	TextureOverrideIndex index;
+
+	BenchClock::time_point scanStart = BenchClock::now();
+	index.Scan(root);
+	double scanUs = ElapsedUs(scanStart);
+
+	std::vector<double> indexUs;
+	uint32_t indexHits = 0;
+
+	for (const std::string& identifier : identifiers)
+	{
+		BenchClock::time_point start = BenchClock::now();
+
+		std::filesystem::path path;
+		if (index.Find(identifier, path)) { indexHits++; }
+
+		indexUs.push_back(ElapsedUs(start));
+	}
+
+	Report("probe per load", probeUs, "us");
+	Report("index per load", indexUs, "us");
+	Print("probe", "%u loads, %u file system calls, %u of %u overrides found", LOADS, probeCalls, probeHits, OVERRIDES);
+	Print("index", "%u loads, 1 directory walk (%.1f us), %u of %u overrides found", LOADS, scanUs, indexHits, OVERRIDES);
+
+	/* The subfolder is only seen by the index. */
+	EXPECT(probeHits == OVERRIDES / 2);
+	EXPECT(indexHits == OVERRIDES);
+
+	/* A change rescans once, instead of every load touching the disk again. */
+	std::filesystem::remove(root / "TEX_0.png");
+
+	BenchClock::time_point rescanStart = BenchClock::now();
+	OverrideChanges_t changes = index.Scan(root);
+	double rescanUs = ElapsedUs(rescanStart);
+
+	Print("rescan", "%zu changed, %zu removed, %.1f us", changes.Changed.size(), changes.Removed.size(), rescanUs);
+
+	EXPECT(changes.Changed.empty());
+	EXPECT(changes.Removed.size() == 1);
+
+	std::filesystem::remove_all(root, ec);
+}
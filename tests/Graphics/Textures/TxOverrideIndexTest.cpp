@@ -0,0 +1,170 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxOverrideIndexTest.cpp
+/// Description  :  Tests for the index of the texture override files and its change detection.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Test.h"
+
+#include "Graphics/Textures/TxOverrideIndex.h"
+
+using namespace Raidcore::Nexus::Graphics;
+
+///----------------------------------------------------------------------------------------------------
+/// OverrideDirectory Class
+/// 	Temporary overrides directory, removed again with the test.
+///----------------------------------------------------------------------------------------------------
+class OverrideDirectory
+{
+	public:
+	OverrideDirectory()
+		: Root(std::filesystem::temp_directory_path() / "NexusOverrideIndex")
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(this->Root, ec);
+		std::filesystem::create_directories(this->Root);
+	}
+
+	~OverrideDirectory()
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(this->Root, ec);
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Write:
+	/// 	Writes a file relative to the directory with the given write time in seconds.
+	///----------------------------------------------------------------------------------------------------
+	std::filesystem::path Write(const std::string& aRelativePath, int aWriteTime = 0)
+	{
+		std::filesystem::path path = this->Root / aRelativePath;
+		std::filesystem::create_directories(path.parent_path());
+
+		std::ofstream(path, std::ios::binary | std::ios::trunc) << "image";
+
+		std::filesystem::last_write_time(path, std::filesystem::file_time_type(std::chrono::seconds(1000000 + aWriteTime)));
+
+		return path;
+	}
+
+	std::filesystem::path Root;
+};
+
+static bool Contains(const std::vector<std::string>& aIdentifiers, const std::string& aIdentifier)
+{
+	return std::find(aIdentifiers.begin(), aIdentifiers.end(), aIdentifier) != aIdentifiers.end();
+}
+
+TEST(TextureOverrideIndex, FindsCaseInsensitive)
+{
+	OverrideDirectory directory;
+
+	std::filesystem::path icon = directory.Write("ICON_Map.PNG");
+	directory.Write("readme.txt");
+
+	TextureOverrideIndex index;
+	OverrideChanges_t changes = index.Scan(directory.Root);
+
+	EXPECT(index.GetCount() == 1);
+	ASSERT(changes.Changed.size() == 1);
+	EXPECT(changes.Changed[0].first == "icon_map");
+	EXPECT(changes.Removed.empty());
+
+	std::filesystem::path path;
+	EXPECT(index.Find("icon_map", path));
+	EXPECT(path == icon);
+	EXPECT(index.Find("Icon_MAP", path));
+	EXPECT(!index.Find("readme", path));
+	EXPECT(!index.Find("icon", path));
+
+	/* Missing directories are empty. */
+	TextureOverrideIndex missing;
+	EXPECT(missing.Scan(directory.Root / "missing").Changed.empty());
+	EXPECT(!missing.Find("icon_map", path));
+}
+
+TEST(TextureOverrideIndex, PrefersShallowerFilesThenExtensionOrder)
+{
+	OverrideDirectory directory;
+
+	directory.Write("addon/deep/A.png");
+	std::filesystem::path shallow = directory.Write("addon/A.gif");
+
+	directory.Write("B.jpg");
+	std::filesystem::path png = directory.Write("B.png");
+
+	std::filesystem::path nested = directory.Write("addon/C.tga");
+
+	TextureOverrideIndex index;
+	index.Scan(directory.Root);
+
+	EXPECT(index.GetCount() == 3);
+
+	std::filesystem::path path;
+	EXPECT(index.Find("A", path) && path == shallow);
+	EXPECT(index.Find("B", path) && path == png);
+	EXPECT(index.Find("C", path) && path == nested);
+}
+
+TEST(TextureOverrideIndex, ReportsChangesAndRemovals)
+{
+	OverrideDirectory directory;
+
+	directory.Write("A.png");
+	directory.Write("B.png");
+	directory.Write("sub/C.png");
+
+	TextureOverrideIndex index;
+	EXPECT(index.Scan(directory.Root).Changed.size() == 3);
+
+	/* Nothing changed. */
+	OverrideChanges_t changes = index.Scan(directory.Root);
+	EXPECT(changes.Changed.empty());
+	EXPECT(changes.Removed.empty());
+
+	/* Modified, removed and a shallower file taking over. */
+	directory.Write("A.png", 1);
+	std::filesystem::remove(directory.Root / "B.png");
+	std::filesystem::path shallow = directory.Write("C.jpg");
+
+	changes = index.Scan(directory.Root);
+	EXPECT(changes.Changed.size() == 2);
+	EXPECT(changes.Removed.size() == 1);
+	EXPECT(Contains(changes.Removed, "b"));
+
+	std::filesystem::path path;
+	EXPECT(!index.Find("B", path));
+	EXPECT(index.Find("C", path) && path == shallow);
+
+	/* Falls back to the deeper file. */
+	std::filesystem::remove(shallow);
+
+	changes = index.Scan(directory.Root);
+	ASSERT(changes.Changed.size() == 1);
+	EXPECT(changes.Changed[0].first == "c");
+	EXPECT(changes.Removed.empty());
+
+	/* Renamed, the old identifier is removed. */
+	std::filesystem::rename(directory.Root / "A.png", directory.Root / "D.png");
+
+	changes = index.Scan(directory.Root);
+	ASSERT(changes.Changed.size() == 1);
+	EXPECT(changes.Changed[0].first == "d");
+	ASSERT(changes.Removed.size() == 1);
+	EXPECT(changes.Removed[0] == "a");
+
+	/* Everything gone. */
+	std::filesystem::remove_all(directory.Root);
+
+	changes = index.Scan(directory.Root);
+	EXPECT(changes.Removed.size() == 2);
+	EXPECT(index.GetCount() == 0);
+}
@@ -0,0 +1,193 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxRecordingUploader.h
+/// Description  :  Texture uploader without a device, recording every call.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Graphics/Textures/TxUploader.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	///----------------------------------------------------------------------------------------------------
+	/// EUploaderCall Enumeration
+	///----------------------------------------------------------------------------------------------------
+	enum class EUploaderCall : uint32_t
+	{
+		Create,
+		Release
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// UploaderCall_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct UploaderCall_t
+	{
+		EUploaderCall                         Kind;
+		void*                                 Resource;
+		uint32_t                              Width;
+		uint32_t                              Height;
+		uint64_t                              Bytes;
+		std::chrono::steady_clock::time_point Time;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// RecordingUploader Class
+	/// 	Hands out fake resource handles. They are never dereferenced by the loader, only compared.
+	///----------------------------------------------------------------------------------------------------
+	class RecordingUploader : public virtual Graphics::ITextureUploader
+	{
+		public:
+		bool IsReady() const override
+		{
+			return this->Ready;
+		}
+
+		ID3D11ShaderResourceView* Create(uint32_t aWidth, uint32_t aHeight, const uint8_t* aData) override
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			if (this->IsFailing || !aData || aWidth == 0 || aHeight == 0) { return nullptr; }
+
+			/* Touch every pixel, as the copy to the device would. */
+			uint64_t bytes = static_cast<uint64_t>(aWidth) * aHeight * 4;
+			uint8_t checksum = 0;
+
+			for (uint64_t i = 0; i < bytes; i++)
+			{
+				checksum ^= aData[i];
+			}
+
+			this->Checksum ^= checksum;
+
+			ID3D11ShaderResourceView* resource = reinterpret_cast<ID3D11ShaderResourceView*>(this->NextHandle);
+			this->NextHandle += 16;
+
+			this->Live.emplace(resource, bytes);
+			this->LiveBytes += bytes;
+			this->Calls.push_back(UploaderCall_t{ EUploaderCall::Create, resource, aWidth, aHeight, bytes, std::chrono::steady_clock::now() });
+
+			return resource;
+		}
+
+		void Release(ID3D11ShaderResourceView* aResource) override
+		{
+			if (!aResource) { return; }
+
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			auto it = this->Live.find(aResource);
+
+			if (it == this->Live.end())
+			{
+				this->UnknownReleases++;
+				return;
+			}
+
+			this->LiveBytes -= it->second;
+			this->Calls.push_back(UploaderCall_t{ EUploaderCall::Release, aResource, 0, 0, it->second, std::chrono::steady_clock::now() });
+			this->Live.erase(it);
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetReady:
+		/// 	Emulates a device that is not created yet or lost.
+		///----------------------------------------------------------------------------------------------------
+		void SetReady(bool aIsReady)
+		{
+			this->Ready = aIsReady;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// SetFailing:
+		/// 	Fails every Create, e.g. out of video memory.
+		///----------------------------------------------------------------------------------------------------
+		void SetFailing(bool aIsFailing)
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			this->IsFailing = aIsFailing;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCalls:
+		/// 	Returns all calls in order.
+		///----------------------------------------------------------------------------------------------------
+		std::vector<UploaderCall_t> GetCalls() const
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			return this->Calls;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetCount:
+		/// 	Returns the amount of calls of a kind.
+		///----------------------------------------------------------------------------------------------------
+		size_t GetCount(EUploaderCall aKind) const
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+
+			size_t count = 0;
+
+			for (const UploaderCall_t& call : this->Calls)
+			{
+				if (call.Kind == aKind) { count++; }
+			}
+
+			return count;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetLiveCount:
+		/// 	Returns the amount of created and not yet released resources.
+		///----------------------------------------------------------------------------------------------------
+		size_t GetLiveCount() const
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			return this->Live.size();
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetLiveBytes:
+		/// 	Returns the pixel bytes of all live resources.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetLiveBytes() const
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			return this->LiveBytes;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// GetUnknownReleases:
+		/// 	Returns the amount of releases of handles that were not live, e.g. double releases.
+		///----------------------------------------------------------------------------------------------------
+		uint64_t GetUnknownReleases() const
+		{
+			const std::lock_guard<std::mutex> lock(this->Mutex);
+			return this->UnknownReleases;
+		}
+
+		private:
+		mutable std::mutex                                      Mutex;
+		std::atomic<bool>                                       Ready           = true;
+		bool                                                    IsFailing       = false;
+		uintptr_t                                               NextHandle      = 0x10000;
+		std::unordered_map<ID3D11ShaderResourceView*, uint64_t> Live;
+		uint64_t                                                LiveBytes       = 0;
+		uint64_t                                                UnknownReleases = 0;
+		uint8_t                                                 Checksum        = 0;
+		std::vector<UploaderCall_t>                             Calls;
+	};
+}
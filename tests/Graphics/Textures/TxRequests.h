@@ -0,0 +1,255 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxRequests.h
+/// Description  :  Generated PNGs and request-to-ready tracking for the texture benchmarks.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Bench.h"
+#include "Graphics/Textures/TxTexture.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	///----------------------------------------------------------------------------------------------------
+	/// Crc32:
+	/// 	Returns the CRC of a PNG chunk.
+	///----------------------------------------------------------------------------------------------------
+	inline uint32_t Crc32(const uint8_t* aData, size_t aSize)
+	{
+		static uint32_t s_Table[256] = {};
+
+		if (s_Table[1] == 0)
+		{
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t c = i;
+
+				for (int k = 0; k < 8; k++)
+				{
+					c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+				}
+
+				s_Table[i] = c;
+			}
+		}
+
+		uint32_t crc = 0xFFFFFFFF;
+
+		for (size_t i = 0; i < aSize; i++)
+		{
+			crc = s_Table[(crc ^ aData[i]) & 0xFF] ^ (crc >> 8);
+		}
+
+		return crc ^ 0xFFFFFFFF;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// EncodePng:
+	/// 	Returns an RGBA8 PNG with stored deflate blocks, distinct per seed.
+	///----------------------------------------------------------------------------------------------------
+	inline std::vector<uint8_t> EncodePng(uint32_t aWidth, uint32_t aHeight, uint32_t aSeed)
+	{
+		auto put32 = [](std::vector<uint8_t>& aOut, uint32_t aValue)
+		{
+			aOut.push_back(static_cast<uint8_t>(aValue >> 24));
+			aOut.push_back(static_cast<uint8_t>(aValue >> 16));
+			aOut.push_back(static_cast<uint8_t>(aValue >> 8));
+			aOut.push_back(static_cast<uint8_t>(aValue));
+		};
+
+		auto chunk = [&put32](std::vector<uint8_t>& aOut, const char* aType, const std::vector<uint8_t>& aData)
+		{
+			put32(aOut, static_cast<uint32_t>(aData.size()));
+
+			size_t start = aOut.size();
+			aOut.insert(aOut.end(), aType, aType + 4);
+			aOut.insert(aOut.end(), aData.begin(), aData.end());
+
+			put32(aOut, Crc32(aOut.data() + start, aOut.size() - start));
+		};
+
+		std::vector<uint8_t> raw;
+		raw.reserve(static_cast<size_t>(aHeight) * (aWidth * 4 + 1));
+
+		for (uint32_t y = 0; y < aHeight; y++)
+		{
+			raw.push_back(0); /* No filter. */
+
+			for (uint32_t x = 0; x < aWidth; x++)
+			{
+				raw.push_back(static_cast<uint8_t>(x + aSeed));
+				raw.push_back(static_cast<uint8_t>(y + (aSeed >> 8)));
+				raw.push_back(static_cast<uint8_t>(aSeed >> 16));
+				raw.push_back(0xFF);
+			}
+		}
+
+		std::vector<uint8_t> zlib{ 0x78, 0x01 };
+
+		for (size_t offset = 0; offset < raw.size() || offset == 0;)
+		{
+			uint16_t length = static_cast<uint16_t>((std::min)(raw.size() - offset, size_t{ 65535 }));
+			bool isFinal = offset + length == raw.size();
+
+			zlib.push_back(isFinal ? 1 : 0);
+			zlib.push_back(static_cast<uint8_t>(length));
+			zlib.push_back(static_cast<uint8_t>(length >> 8));
+			zlib.push_back(static_cast<uint8_t>(~length));
+			zlib.push_back(static_cast<uint8_t>(~length >> 8));
+			zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+
+			offset += length;
+
+			if (isFinal) { break; }
+		}
+
+		uint32_t a = 1;
+		uint32_t b = 0;
+
+		for (uint8_t byte : raw)
+		{
+			a = (a + byte) % 65521;
+			b = (b + a) % 65521;
+		}
+
+		put32(zlib, (b << 16) | a);
+
+		std::vector<uint8_t> header;
+		put32(header, aWidth);
+		put32(header, aHeight);
+		header.insert(header.end(), { 8 /* Bit depth */, 6 /* RGBA */, 0, 0, 0 });
+
+		std::vector<uint8_t> png{ 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+		chunk(png, "IHDR", header);
+		chunk(png, "IDAT", zlib);
+		chunk(png, "IEND", {});
+
+		return png;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Request_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct Request_t
+	{
+		std::chrono::steady_clock::time_point Requested;
+		std::chrono::steady_clock::time_point Ready;
+		Graphics::Texture_t*                  Texture;
+		uint32_t                              Responses;
+	};
+
+	inline std::mutex                                 s_RequestMutex;
+	inline std::unordered_map<std::string, Request_t> s_Requests;
+
+	///----------------------------------------------------------------------------------------------------
+	/// Track:
+	/// 	Starts the clock of a request.
+	///----------------------------------------------------------------------------------------------------
+	inline void Track(const std::string& aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(s_RequestMutex);
+		s_Requests[aIdentifier] = Request_t{ std::chrono::steady_clock::now(), {}, nullptr, 0 };
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// OnReceive:
+	/// 	Receive callback of all tracked requests, stops their clock with the first response.
+	///----------------------------------------------------------------------------------------------------
+	inline void OnReceive(const char* aIdentifier, Graphics::Texture_t* aTexture)
+	{
+		const std::lock_guard<std::mutex> lock(s_RequestMutex);
+
+		Request_t& request = s_Requests[aIdentifier];
+
+		if (request.Responses++ == 0)
+		{
+			request.Ready = std::chrono::steady_clock::now();
+		}
+
+		request.Texture = aTexture;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetRequest:
+	/// 	Returns a copy of a tracked request.
+	///----------------------------------------------------------------------------------------------------
+	inline Request_t GetRequest(const std::string& aIdentifier)
+	{
+		const std::lock_guard<std::mutex> lock(s_RequestMutex);
+
+		auto it = s_Requests.find(aIdentifier);
+
+		return it != s_Requests.end() ? it->second : Request_t{};
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// ClearRequests:
+	/// 	Forgets all tracked requests, e.g. left over by a test that aborted.
+	///----------------------------------------------------------------------------------------------------
+	inline void ClearRequests()
+	{
+		const std::lock_guard<std::mutex> lock(s_RequestMutex);
+		s_Requests.clear();
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// CountResponded:
+	/// 	Returns the amount of tracked requests that received a texture or nullptr.
+	///----------------------------------------------------------------------------------------------------
+	inline size_t CountResponded()
+	{
+		const std::lock_guard<std::mutex> lock(s_RequestMutex);
+
+		size_t count = 0;
+
+		for (const auto& [identifier, request] : s_Requests)
+		{
+			if (request.Responses > 0) { count++; }
+		}
+
+		return count;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// ReportRequests:
+	/// 	Prints the request-to-ready latency of all responded requests and clears them.
+	/// 	Returns the highest latency in ms.
+	///----------------------------------------------------------------------------------------------------
+	inline double ReportRequests(const char* aScenario)
+	{
+		std::vector<double> latencies;
+
+		{
+			const std::lock_guard<std::mutex> lock(s_RequestMutex);
+
+			for (const auto& [identifier, request] : s_Requests)
+			{
+				if (request.Responses == 0) { continue; }
+
+				latencies.push_back(std::chrono::duration<double, std::milli>(request.Ready - request.Requested).count());
+			}
+
+			s_Requests.clear();
+		}
+
+		if (latencies.empty()) { return 0; }
+
+		Report(aScenario, latencies, "ms");
+
+		return *std::max_element(latencies.begin(), latencies.end());
+	}
+}
@@ -0,0 +1,302 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxStoreBench.cpp
+/// Description  :  Drives the texture store headless and reports request-to-ready latency.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+#include "Graphics/Textures/TxStoreDriver.h"
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Tests;
+
+TEST(TextureStore, FileLoads)
+{
+	StoreDriver driver;
+
+	constexpr uint32_t count = 500;
+
+	std::vector<std::filesystem::path> paths;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		paths.push_back(driver.WriteFile(i));
+	}
+
+	/* Cold, every file is decoded and written to the disk cache. */
+	std::vector<double> coldUs;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "COLD_" + std::to_string(i);
+		Track(identifier);
+
+		BenchClock::time_point start = BenchClock::now();
+		driver.LoadFile(identifier, paths[i]);
+		coldUs.push_back(ElapsedUs(start));
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == count);
+	EXPECT(driver.Uploader.GetLiveBytes() == uint64_t{ count } * 32 * 32 * 4);
+	EXPECT(GetRequest("COLD_0").Texture && GetRequest("COLD_0").Texture->Width == 32);
+	EXPECT(driver.Store.GetDiskCache().GetMisses() == count);
+
+	Report("file cold load", coldUs, "us");
+	ReportRequests("file cold");
+
+	/* Warm, the same files under new identifiers are mapped from the disk cache. */
+	std::vector<double> warmUs;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "WARM_" + std::to_string(i);
+		Track(identifier);
+
+		BenchClock::time_point start = BenchClock::now();
+		driver.LoadFile(identifier, paths[i]);
+		warmUs.push_back(ElapsedUs(start));
+	}
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }));
+	EXPECT(driver.Store.GetDiskCache().GetHits() == count);
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 2 * count);
+
+	Report("file warm load", warmUs, "us");
+	ReportRequests("file warm");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, MemoryLoads)
+{
+	StoreDriver driver;
+
+	constexpr uint32_t count = 500;
+
+	std::vector<double> loadUs;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "MEM_" + std::to_string(i);
+		std::vector<uint8_t> png = EncodePng(32, 32, i);
+
+		Track(identifier);
+
+		BenchClock::time_point start = BenchClock::now();
+		driver.LoadMemory(identifier, png);
+		loadUs.push_back(ElapsedUs(start));
+	}
+
+	/* Everything queued is created with the next frame. */
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }, 1));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == count);
+
+	Report("memory load", loadUs, "us");
+	ReportRequests("memory");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, DeviceNotReady)
+{
+	StoreDriver driver;
+
+	driver.Uploader.SetReady(false);
+
+	for (uint32_t i = 0; i < 20; i++)
+	{
+		std::string identifier = "LATE_" + std::to_string(i);
+
+		Track(identifier);
+		driver.LoadMemory(identifier, EncodePng(16, 16, i));
+	}
+
+	/* Kept queued, until the device exists. */
+	EXPECT(!driver.RunUntil([]() { return CountResponded() > 0; }, 10));
+	EXPECT(driver.Store.GetQueuedTextures().size() == 20);
+
+	driver.Uploader.SetReady(true);
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == 20; }, 1));
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 20);
+
+	ReportRequests("device not ready");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, FailedUploads)
+{
+	StoreDriver driver;
+
+	driver.Uploader.SetFailing(true);
+
+	Track("FAIL");
+	driver.LoadMemory("FAIL", EncodePng(16, 16, 1));
+
+	EXPECT(driver.RunUntil([]() { return CountResponded() == 1; }));
+	EXPECT(GetRequest("FAIL").Texture == nullptr);
+	EXPECT(driver.RunUntil([&driver]() { return driver.Store.GetQueuedTextures().empty(); }));
+	EXPECT(driver.Store.GetRegistry().empty());
+
+	ReportRequests("failed upload");
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, ShadowingUnderLoad)
+{
+	StoreDriver driver;
+
+	constexpr uint32_t rounds = 50;
+	constexpr uint32_t load = 20;
+
+	std::vector<Graphics::Texture_t*> shadowed;
+
+	for (uint32_t round = 0; round <= rounds; round++)
+	{
+		/* Unrelated loads in flight, while the identifier is shadowed. */
+		for (uint32_t i = 0; i < load; i++)
+		{
+			std::string identifier = "LOAD_" + std::to_string(round) + "_" + std::to_string(i);
+
+			Track(identifier);
+			driver.LoadFile(identifier, driver.WriteFile(1000 + round * load + i, 16));
+		}
+
+		Track("SHADOW");
+
+		if (round > 0)
+		{
+			driver.Store.ShadowTexture("SHADOW");
+		}
+
+		driver.LoadMemory("SHADOW", EncodePng(16, 16, round));
+
+		ASSERT(driver.RunUntil([round]() { return GetRequest("SHADOW").Responses > 0 && CountResponded() == (round + 1) * load + 1; }));
+
+		shadowed.push_back(GetRequest("SHADOW").Texture);
+	}
+
+	ReportRequests("shadowing");
+
+	std::map<std::string, Graphics::Texture_t*> registry = driver.Store.GetRegistry();
+
+	/* Every shadowed texture stays valid under its new identifier. */
+	EXPECT(registry.at("SHADOW") == shadowed.back());
+
+	for (uint32_t i = 1; i <= rounds; i++)
+	{
+		EXPECT(registry.find("SHADOW_" + std::to_string(i)) != registry.end());
+	}
+
+	std::sort(shadowed.begin(), shadowed.end());
+	EXPECT(std::unique(shadowed.begin(), shadowed.end()) == shadowed.end());
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Release) == 0);
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, EvictAndRestore)
+{
+	StoreDriver driver;
+
+	constexpr uint32_t count = 200;
+	constexpr uint32_t resident = 50;
+
+	driver.Store.SetBudget(resident * Graphics::TextureBudget::GetSize(64, 64));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		driver.LoadFile("EVICT_" + std::to_string(i), driver.WriteFile(i, 64));
+	}
+
+	ASSERT(driver.RunUntil([&driver]() { return driver.Store.GetQueuedTextures().empty(); }));
+
+	/* Idle long enough, everything over budget is swapped for a placeholder. */
+	driver.Time += TEXBUDGET_MINIDLE_MS;
+	driver.Frame();
+
+	EXPECT(driver.Store.GetResidentSize() <= driver.Store.GetBudget());
+
+	std::vector<Graphics::Texture_t*> evicted;
+
+	for (const auto& [identifier, record] : driver.Store.GetRecords())
+	{
+		if (record.IsEvicted) { evicted.push_back(driver.Store.Get(identifier.c_str(), driver.Time + 1)); }
+	}
+
+	ASSERT(evicted.size() >= count - resident);
+
+	/* Looked up again, the pixels are mapped from the disk cache with the next frame. */
+	std::vector<void*> placeholders;
+
+	for (Graphics::Texture_t* texture : evicted)
+	{
+		placeholders.push_back(texture->Resource);
+	}
+
+	BenchClock::time_point start = BenchClock::now();
+	driver.Frame();
+	double restoreUs = ElapsedUs(start);
+
+	size_t restored = 0;
+
+	for (size_t i = 0; i < evicted.size(); i++)
+	{
+		if (evicted[i]->Resource != placeholders[i]) { restored++; }
+	}
+
+	EXPECT(restored == evicted.size());
+	EXPECT(driver.Reloads.empty());
+
+	Print("restore", "%zu textures in one frame, %.1f us each", restored, restoreUs / restored);
+
+	EXPECT(driver.Uploader.GetUnknownReleases() == 0);
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, StalledDownloadsAreDropped)
+{
+	StoreDriver driver;
+
+	constexpr uint32_t count = 16;
+
+	/* Never served, the store only sees the time pass. */
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string identifier = "STALL_" + std::to_string(i);
+
+		Track(identifier);
+		EXPECT(driver.Store.Enqueue(identifier.c_str(), "http://127.0.0.1/stall/" + std::to_string(i), OnReceive, nullptr, driver.Time));
+	}
+
+	EXPECT(!driver.RunUntil([]() { return CountResponded() > 0; }, 10));
+
+	driver.Time += TEXSTORE_QUEUE_TIMEOUT_MS;
+
+	/* Marked invalid with the first frame past the timeout, dispatched and dropped with the next. */
+	EXPECT(driver.RunUntil([]() { return CountResponded() == count; }, 2));
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		EXPECT(GetRequest("STALL_" + std::to_string(i)).Texture == nullptr);
+	}
+
+	EXPECT(driver.Store.GetQueuedTextures().empty());
+	EXPECT(driver.Uploader.GetCount(EUploaderCall::Create) == 0);
+
+	ReportRequests("stalled");
+
+	EXPECT(driver.Shutdown());
+}
@@ -0,0 +1,188 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxStoreDriver.h
+/// Description  :  Feeds a texture store like the loader and advances it like the render thread.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Graphics/Textures/TxNullAtlas.h"
+#include "Graphics/Textures/TxRecordingUploader.h"
+#include "Graphics/Textures/TxRequests.h"
+
+#include "Core/Logging/LogApi.h"
+#include "Graphics/Textures/TxStore.h"
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	constexpr const long long STOREDRIVER_FRAME_MS = 16;
+
+	///----------------------------------------------------------------------------------------------------
+	/// StoreDriver Class
+	/// 	Owns a texture store on a recording uploader. The clock only moves with each frame.
+	///----------------------------------------------------------------------------------------------------
+	class StoreDriver
+	{
+		public:
+		StoreDriver()
+			: Root(CreateRoot())
+			, Store(Logger, Uploader, Atlas, Root / "cache")
+		{
+			ClearRequests();
+		}
+
+		~StoreDriver()
+		{
+			this->Store.Shutdown();
+
+			std::error_code ec;
+			std::filesystem::remove_all(this->Root, ec);
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// LoadFile:
+		/// 	Queues a file, as TextureLoader::Load does on the calling thread.
+		///----------------------------------------------------------------------------------------------------
+		void LoadFile(const std::string& aIdentifier, const std::filesystem::path& aPath)
+		{
+			this->Store.Enqueue(aIdentifier.c_str(), OnReceive, nullptr, this->Time);
+
+			if (!this->Store.DecodeFile(aIdentifier.c_str(), aPath, this->Time))
+			{
+				this->Store.DispatchTexture(aIdentifier, nullptr, OnReceive);
+				this->Store.Dequeue(aIdentifier.c_str());
+			}
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// LoadMemory:
+		/// 	Queues encoded image data, as TextureLoader::Load does on the calling thread.
+		///----------------------------------------------------------------------------------------------------
+		void LoadMemory(const std::string& aIdentifier, const std::vector<uint8_t>& aData)
+		{
+			this->Store.Enqueue(aIdentifier.c_str(), OnReceive, nullptr, this->Time);
+			this->Store.Decode(aIdentifier.c_str(), aData.data(), aData.size(), Graphics::TextureSource_t{ Graphics::ETextureSource::Memory }, this->Time);
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Frame:
+		/// 	Advances the clock by one frame and the store, then decodes the evicted files and overrides
+		/// 	again, as TextureLoader::Advance does.
+		///----------------------------------------------------------------------------------------------------
+		void Frame()
+		{
+			this->Time += STOREDRIVER_FRAME_MS;
+
+			std::vector<std::pair<std::string, Graphics::Texture_t*>> created;
+			std::vector<std::string> reloads;
+
+			this->Store.Advance(this->Time, created, reloads);
+
+			for (const std::string& identifier : reloads)
+			{
+				Graphics::TextureSource_t source = this->Store.GetSource(identifier);
+
+				bool isDecoded = false;
+
+				if (!source.Override.empty())
+				{
+					isDecoded = this->Store.DecodeFile(identifier.c_str(), source.Override, source, this->Time);
+				}
+				else if (source.Kind == Graphics::ETextureSource::File)
+				{
+					isDecoded = this->Store.DecodeFile(identifier.c_str(), source.Path, source, this->Time);
+				}
+
+				if (!isDecoded)
+				{
+					this->Store.Dequeue(identifier.c_str());
+				}
+
+				this->Reloads.push_back(identifier);
+			}
+
+			this->Created += created.size();
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// RunUntil:
+		/// 	Advances frames, until the condition is met or the maximum amount of frames ran.
+		///----------------------------------------------------------------------------------------------------
+		bool RunUntil(const std::function<bool()>& aIsDone, uint32_t aMaxFrames = 100)
+		{
+			for (uint32_t i = 0; i < aMaxFrames; i++)
+			{
+				this->Frame();
+
+				if (aIsDone()) { return true; }
+			}
+
+			return false;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// WriteFile:
+		/// 	Writes a generated PNG and returns its path.
+		///----------------------------------------------------------------------------------------------------
+		std::filesystem::path WriteFile(uint32_t aSeed, uint32_t aSize = 32)
+		{
+			std::filesystem::path path = this->Root / "files" / (std::to_string(aSeed) + ".png");
+			std::filesystem::create_directories(path.parent_path());
+
+			std::vector<uint8_t> png = EncodePng(aSize, aSize, aSeed);
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(png.data()), png.size());
+
+			return path;
+		}
+
+		///----------------------------------------------------------------------------------------------------
+		/// Shutdown:
+		/// 	Releases all textures. Returns true, if every created resource was released exactly once.
+		///----------------------------------------------------------------------------------------------------
+		bool Shutdown()
+		{
+			this->Store.Shutdown();
+
+			return this->Uploader.GetLiveCount() == 0 && this->Uploader.GetUnknownReleases() == 0;
+		}
+
+		std::filesystem::path    Root;
+		Core::LogApi             Logger;
+		RecordingUploader        Uploader;
+		NullAtlas                Atlas;
+		Graphics::TextureStore   Store;
+
+		long long                Time    = 0;
+		size_t                   Created = 0;
+		std::vector<std::string> Reloads;
+
+		private:
+		static std::filesystem::path CreateRoot()
+		{
+			static std::atomic<uint32_t> s_Instance{ 0 };
+
+			std::filesystem::path root = std::filesystem::temp_directory_path() / ("NexusTextureStore_" + std::to_string(s_Instance++));
+
+			std::error_code ec;
+			std::filesystem::remove_all(root, ec);
+			std::filesystem::create_directories(root / "cache");
+
+			return root;
+		}
+	};
+}
@@ -0,0 +1,162 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  TxStoreTest.cpp
+/// Description  :  Tests for the texture store, its queue timeout, restores and hot swaps.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+#include "Graphics/Textures/TxStoreDriver.h"
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Tests;
+
+TEST(TextureStore, DropsStalledEntries)
+{
+	StoreDriver driver;
+
+	Track("STALL");
+	EXPECT(driver.Store.Enqueue("STALL", "http://127.0.0.1/stall", OnReceive, nullptr, driver.Time));
+
+	/* Requested again while queued, no second download. */
+	EXPECT(!driver.Store.Enqueue("STALL", "http://127.0.0.1/stall", OnReceive, nullptr, driver.Time));
+
+	std::string url;
+	EXPECT(driver.Store.TakeDownload("STALL", url));
+	EXPECT(url == "http://127.0.0.1/stall");
+	EXPECT(!driver.Store.TakeDownload("STALL", url));
+
+	driver.Time = TEXSTORE_QUEUE_TIMEOUT_MS - STOREDRIVER_FRAME_MS;
+	driver.Frame();
+	EXPECT(CountResponded() == 0);
+
+	driver.Frame();
+	driver.Frame();
+
+	EXPECT(GetRequest("STALL").Responses == 1);
+	EXPECT(GetRequest("STALL").Texture == nullptr);
+	EXPECT(driver.Store.GetQueuedTextures().empty());
+	EXPECT(driver.Store.GetRegistry().empty());
+}
+
+TEST(TextureStore, RestoresFromTheSource)
+{
+	StoreDriver driver;
+
+	driver.Store.SetBudget(Graphics::TextureBudget::GetSize(32, 32));
+
+	driver.LoadFile("A", driver.WriteFile(1));
+	driver.LoadFile("B", driver.WriteFile(2));
+
+	ASSERT(driver.RunUntil([&driver]() { return driver.Store.GetQueuedTextures().empty(); }));
+
+	Graphics::Texture_t* texture = driver.Store.Get("A", 0);
+	ASSERT(texture);
+
+	driver.Store.Get("B", TEXBUDGET_MINIDLE_MS);
+	driver.Time = TEXBUDGET_MINIDLE_MS;
+	driver.Frame();
+
+	ASSERT(driver.Store.GetRecords().at("A").IsEvicted);
+
+	void* placeholder = texture->Resource;
+
+	/* The cached pixels are gone, the file is decoded again. */
+	std::filesystem::remove_all(driver.Root / "cache");
+
+	driver.Store.Get("A", driver.Time + 1);
+	driver.Frame();
+
+	ASSERT(driver.Reloads.size() == 1);
+	EXPECT(driver.Reloads[0] == "A");
+	EXPECT(texture->Resource == placeholder);
+
+	driver.Frame();
+
+	/* The holder keeps its pointer. */
+	EXPECT(driver.Store.Get("A", driver.Time) == texture);
+	EXPECT(texture->Resource != placeholder);
+	EXPECT(texture->Width == 32);
+	EXPECT(!driver.Store.GetRecords().at("A").IsEvicted);
+	EXPECT(driver.Uploader.GetUnknownReleases() == 0);
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, RestoresOverridesOfMemoryTextures)
+{
+	StoreDriver driver;
+
+	driver.Store.SetBudget(Graphics::TextureBudget::GetSize(32, 32));
+
+	/* The caller's memory cannot be decoded again, but the override that replaced it can. */
+	std::filesystem::path overridePath = driver.WriteFile(1);
+
+	Graphics::TextureSource_t source{ Graphics::ETextureSource::Memory };
+	source.Override = overridePath;
+
+	driver.Store.Enqueue("A", OnReceive, nullptr, driver.Time);
+	ASSERT(driver.Store.DecodeFile("A", overridePath, source, driver.Time));
+	driver.LoadMemory("B", EncodePng(32, 32, 2));
+
+	ASSERT(driver.RunUntil([&driver]() { return driver.Store.GetQueuedTextures().empty(); }));
+	EXPECT(driver.Store.GetSource("A").Override == overridePath);
+
+	Graphics::Texture_t* texture = driver.Store.Get("A", 0);
+	ASSERT(texture);
+
+	driver.Store.Get("B", TEXBUDGET_MINIDLE_MS);
+	driver.Time = TEXBUDGET_MINIDLE_MS;
+	driver.Frame();
+
+	ASSERT(driver.Store.GetRecords().at("A").IsEvicted);
+
+	void* placeholder = texture->Resource;
+	std::filesystem::remove_all(driver.Root / "cache");
+
+	driver.Store.Get("A", driver.Time + 1);
+	driver.Frame();
+	driver.Frame();
+
+	ASSERT(driver.Reloads.size() == 1);
+	EXPECT(texture->Resource != placeholder);
+	EXPECT(!driver.Store.GetRecords().at("A").IsEvicted);
+	EXPECT(driver.Store.GetSource("A").Kind == Graphics::ETextureSource::Memory);
+
+	EXPECT(driver.Shutdown());
+}
+
+TEST(TextureStore, HotSwapsInPlace)
+{
+	StoreDriver driver;
+
+	driver.LoadFile("Icon_Map", driver.WriteFile(1));
+	ASSERT(driver.RunUntil([&driver]() { return driver.Store.GetQueuedTextures().empty(); }));
+
+	Graphics::Texture_t* texture = driver.Store.Get("Icon_Map", driver.Time);
+	ASSERT(texture);
+
+	void* previous = texture->Resource;
+
+	/* The overrides are indexed in lowercase. */
+	std::vector<std::string> identifiers = driver.Store.BeginHotSwap("icon_map");
+	ASSERT(identifiers.size() == 1);
+	EXPECT(identifiers[0] == "Icon_Map");
+	EXPECT(driver.Store.BeginHotSwap("icon_other").empty());
+
+	ASSERT(driver.Store.DecodeFile("Icon_Map", driver.WriteFile(2, 64), driver.Time));
+	driver.Frame();
+
+	EXPECT(driver.Store.Get("Icon_Map", driver.Time) == texture);
+	EXPECT(texture->Resource != previous);
+	EXPECT(texture->Width == 64);
+	EXPECT(driver.Store.GetRegistry().size() == 1);
+	EXPECT(driver.Uploader.GetLiveCount() == 1);
+
+	EXPECT(driver.Shutdown());
+}
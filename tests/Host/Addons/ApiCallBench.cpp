@@ -0,0 +1,116 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ApiCallBench.cpp
+/// Description  :  Overhead of calling hot addon API entries through the function table.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+
+#include "Bench.h"
+#include "Test.h"
+#include "Graphics/Textures/TxStoreDriver.h"
+
+#include "Core/DataLink/DlApi.h"
+
+using namespace Raidcore::Nexus;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t CALLS = 1000000;
+
+/* The services the entries forward to, set once like the API builder does. */
+static Core::DataLinkApi*       s_DataLinkApi  = nullptr;
+static Graphics::TextureStore*  s_TextureStore = nullptr;
+static long long                s_Time         = 0;
+
+/* Same shape as the entries of ApiBuilder.cpp, which needs Windows to build. */
+namespace DataLink
+{
+	static void* Get(const char* aIdentifier)
+	{
+		return s_DataLinkApi->Get(aIdentifier);
+	}
+
+	static void* GetByHandle(uint32_t aHandle)
+	{
+		return s_DataLinkApi->GetByHandle(aHandle);
+	}
+}
+
+namespace TextureLoader
+{
+	static Graphics::Texture_t* Get(const char* aIdentifier)
+	{
+		return s_TextureStore->Get(aIdentifier, s_Time);
+	}
+}
+
+///----------------------------------------------------------------------------------------------------
+/// ApiTable_t Struct
+/// 	The hot entries as an addon sees them, built once in static storage.
+///----------------------------------------------------------------------------------------------------
+struct ApiTable_t
+{
+	void*                (*DataLink_Get)(const char* aIdentifier);
+	void*                (*DataLink_GetByHandle)(uint32_t aHandle);
+	Graphics::Texture_t* (*Textures_Get)(const char* aIdentifier);
+};
+
+static const ApiTable_t s_Api = { DataLink::Get, DataLink::GetByHandle, TextureLoader::Get };
+
+///----------------------------------------------------------------------------------------------------
+/// Measure:
+/// 	Returns the nanoseconds per call of aCall.
+///----------------------------------------------------------------------------------------------------
+template <typename F>
+static double Measure(F aCall)
+{
+	BenchClock::time_point start = BenchClock::now();
+
+	for (uint32_t i = 0; i < CALLS; i++)
+	{
+		DoNotOptimize(aCall());
+	}
+
+	return ElapsedUs(start) * 1000.0 / CALLS;
+}
+
+TEST(ApiCalls, HotEntries)
+{
+	StoreDriver driver;
+	driver.LoadMemory("ICON_QUICKACCESS", EncodePng(32, 32, 1));
+	ASSERT(driver.RunUntil([&driver]() { return driver.Store.Get("ICON_QUICKACCESS", driver.Time) != nullptr; }));
+
+	Core::DataLinkApi dataLink(driver.Logger);
+	void* mumble = dataLink.Share("DL_MUMBLE_LINK", 5460);
+	uint32_t handle = dataLink.GetHandle("DL_MUMBLE_LINK");
+
+	s_DataLinkApi = &dataLink;
+	s_TextureStore = &driver.Store;
+	s_Time = driver.Time;
+
+	/* Read through a volatile pointer, as an addon calling into the table cannot inline. */
+	const ApiTable_t* volatile api = &s_Api;
+
+	double getDirect    = Measure([&]() { return dataLink.Get("DL_MUMBLE_LINK"); });
+	double getApi       = Measure([&]() { return api->DataLink_Get("DL_MUMBLE_LINK"); });
+	double handleDirect = Measure([&]() { return dataLink.GetByHandle(handle); });
+	double handleApi    = Measure([&]() { return api->DataLink_GetByHandle(handle); });
+	double texDirect    = Measure([&]() { return driver.Store.Get("ICON_QUICKACCESS", driver.Time); });
+	double texApi       = Measure([&]() { return api->Textures_Get("ICON_QUICKACCESS"); });
+
+	Print("DataLink Get", "direct %6.1f ns, through the table %6.1f ns", getDirect, getApi);
+	Print("DataLink GetByHandle", "direct %6.1f ns, through the table %6.1f ns", handleDirect, handleApi);
+	Print("Textures Get", "direct %6.1f ns, through the table %6.1f ns", texDirect, texApi);
+
+	EXPECT(api->DataLink_Get("DL_MUMBLE_LINK") == mumble);
+	EXPECT(api->DataLink_GetByHandle(handle) == mumble);
+	EXPECT(api->Textures_Get("ICON_QUICKACCESS") == driver.Store.Get("ICON_QUICKACCESS", driver.Time));
+
+	s_DataLinkApi = nullptr;
+	s_TextureStore = nullptr;
+
+	EXPECT(driver.Shutdown());
+}
@@ -0,0 +1,161 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LibCatalogTest.cpp
+/// Description  :  Tests for merging the library sources and the changes between generations.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+
+#include "Host/Library/LibCatalog.h"
+
+using namespace Raidcore::Nexus::Host;
+
+constexpr const uint32_t STUB_ENTRIES = 5000;
+
+///----------------------------------------------------------------------------------------------------
+/// StubSource:
+/// 	Parses the definitions of a source, as LibraryMgr::Fetch does with the response.
+/// 	Signatures start at aFirst, names are prefixed, so overlapping sources can be told apart.
+///----------------------------------------------------------------------------------------------------
+static std::vector<LibraryAddon_t> StubSource(uint32_t aFirst, uint32_t aCount, const std::string& aPrefix)
+{
+	json libJSON = json::array();
+
+	for (uint32_t i = 0; i < aCount; i++)
+	{
+		uint32_t signature = aFirst + i;
+
+		libJSON.push_back({
+			{ "id",          signature },
+			{ "name",        "Addon " + std::to_string(signature) },
+			{ "author",      aPrefix },
+			{ "description", aPrefix + " definition of " + std::to_string(signature) },
+			{ "download",    "https://github.com/" + aPrefix + "/" + std::to_string(signature) }
+		});
+	}
+
+	std::vector<LibraryAddon_t> addons;
+	addons.reserve(libJSON.size());
+
+	for (json& addonJSON : libJSON)
+	{
+		addons.push_back(addonJSON);
+	}
+
+	return addons;
+}
+
+static bool Contains(const std::vector<uint32_t>& aSignatures, uint32_t aSignature)
+{
+	return std::find(aSignatures.begin(), aSignatures.end(), aSignature) != aSignatures.end();
+}
+
+TEST(LibraryCatalog, EarlierSourcesTakePrecedence)
+{
+	LibraryCatalog catalog;
+
+	EXPECT(catalog.AddSource("https://a/library"));
+	EXPECT(catalog.AddSource("https://b/library"));
+	EXPECT(!catalog.AddSource("https://a/library"));
+
+	/* Half of the second source is also listed by the first. Set in reverse, the order of adding counts. */
+	catalog.SetDefinitions("https://b/library", StubSource(STUB_ENTRIES / 2, STUB_ENTRIES, "b"));
+	catalog.SetDefinitions("https://a/library", StubSource(0, STUB_ENTRIES, "a"));
+
+	EXPECT(catalog.Merge());
+	EXPECT(catalog.GetGeneration() == 1);
+	EXPECT(catalog.GetLibrary().size() == STUB_ENTRIES + STUB_ENTRIES / 2);
+
+	const LibraryAddon_t* shared = catalog.Find(STUB_ENTRIES - 1);
+	ASSERT(shared);
+	EXPECT(shared->Author == "a");
+
+	const LibraryAddon_t* onlyB = catalog.Find(STUB_ENTRIES + 1);
+	ASSERT(onlyB);
+	EXPECT(onlyB->Author == "b");
+
+	const LibraryAddon_t* byName = catalog.FindByName("ADDON 42");
+	ASSERT(byName);
+	EXPECT(byName->Signature == 42);
+
+	EXPECT(!catalog.Find(STUB_ENTRIES * 2));
+	EXPECT(!catalog.FindByName("Addon"));
+
+	/* Sources that never delivered are skipped. */
+	EXPECT(catalog.AddSource("https://c/library"));
+	EXPECT(!catalog.Merge());
+	EXPECT(catalog.GetDefinitionCount("https://c/library") == 0);
+	EXPECT(catalog.GetDefinitionCount("https://a/library") == STUB_ENTRIES);
+}
+
+TEST(LibraryCatalog, RecordsChangesBetweenGenerations)
+{
+	LibraryCatalog catalog;
+	catalog.AddSource("https://a/library");
+	catalog.AddSource("https://b/library");
+
+	catalog.SetDefinitions("https://a/library", StubSource(0, STUB_ENTRIES, "a"));
+	EXPECT(catalog.Merge());
+
+	LibraryDiff_t diff{};
+	uint64_t generation = 0;
+
+	EXPECT(catalog.GetChanges(0, diff, generation));
+	EXPECT(generation == 1);
+	EXPECT(diff.Added.size() == STUB_ENTRIES);
+	EXPECT(diff.Changed.empty());
+	EXPECT(diff.Removed.empty());
+
+	/* Identical results do not advance the generation. */
+	catalog.SetDefinitions("https://a/library", StubSource(0, STUB_ENTRIES, "a"));
+	EXPECT(!catalog.Merge());
+	EXPECT(catalog.GetGeneration() == 1);
+
+	/* Shifted by 10 and one definition edited. */
+	std::vector<LibraryAddon_t> next = StubSource(10, STUB_ENTRIES, "a");
+	next[100].Description = "Edited";
+	catalog.SetDefinitions("https://a/library", std::move(next));
+
+	EXPECT(catalog.Merge());
+
+	EXPECT(catalog.GetChanges(1, diff, generation));
+	EXPECT(generation == 2);
+	EXPECT(diff.Added.size() == 10);
+	EXPECT(Contains(diff.Added, STUB_ENTRIES + 9));
+	EXPECT(diff.Removed.size() == 10);
+	EXPECT(Contains(diff.Removed, 0));
+	ASSERT(diff.Changed.size() == 1);
+	EXPECT(diff.Changed[0] == 110);
+
+	/* A later source only fills the gaps, entries shadowed by the first are no change. */
+	catalog.SetDefinitions("https://b/library", StubSource(0, STUB_ENTRIES, "b"));
+	EXPECT(catalog.Merge());
+
+	EXPECT(catalog.GetChanges(2, diff, generation));
+	EXPECT(diff.Added.size() == 10);
+	EXPECT(Contains(diff.Added, 0));
+	EXPECT(diff.Changed.empty());
+	EXPECT(diff.Removed.empty());
+
+	/* Readers more than one generation behind fetch in full. */
+	EXPECT(!catalog.GetChanges(1, diff, generation));
+	EXPECT(generation == 3);
+	EXPECT(!catalog.GetChanges(3, diff, generation));
+
+	/* A source delivering nothing removes what only it listed. */
+	catalog.SetDefinitions("https://a/library", {});
+	EXPECT(catalog.Merge());
+
+	EXPECT(catalog.GetChanges(3, diff, generation));
+	EXPECT(diff.Removed.size() == 10);
+	EXPECT(Contains(diff.Removed, STUB_ENTRIES + 9));
+	EXPECT(diff.Changed.size() == STUB_ENTRIES - 10);
+	EXPECT(catalog.Find(42)->Author == "b");
+}
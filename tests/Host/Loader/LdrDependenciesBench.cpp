@@ -0,0 +1,159 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrDependenciesBench.cpp
+/// Description  :  Scheduling of synthetic addon definitions with the dependency graph.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Host/Loader/LdrDependencies.h"
+
+using namespace Raidcore::Nexus::Host;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t ADDONS           = 500;
+constexpr const uint32_t LAYERS           = 10;     /* Depth of the deepest dependency chain. */
+constexpr const uint32_t MAX_DEPENDENCIES = 3;
+constexpr const uint32_t RUNS             = 20;
+constexpr const uint32_t SIGNATURE_BASE   = 0x10000;
+
+///----------------------------------------------------------------------------------------------------
+/// Declare:
+/// 	Declares ADDONS synthetic addons in LAYERS layers, each depending on up to MAX_DEPENDENCIES
+/// 	addons of earlier layers, one of them optional. The first layer has no dependencies.
+/// 	If aWithCycle, the first addon also depends on the last one.
+///----------------------------------------------------------------------------------------------------
+static void Declare(DependencyGraph& aGraph, bool aWithCycle)
+{
+	constexpr const uint32_t perLayer = ADDONS / LAYERS;
+
+	uint32_t seed = 0x2545F491;
+
+	for (uint32_t i = 0; i < ADDONS; i++)
+	{
+		uint32_t layer = i / perLayer;
+
+		std::vector<Dependency_t> dependencies;
+
+		for (uint32_t d = 0; layer > 0 && d < MAX_DEPENDENCIES; d++)
+		{
+			/* Deterministic xorshift, so every run declares the same graph. */
+			seed ^= seed << 13;
+			seed ^= seed >> 17;
+			seed ^= seed << 5;
+
+			/* The first one is always on the previous layer, so every layer is a wave. */
+			uint32_t target = d == 0
+				? (layer - 1) * perLayer + seed % perLayer
+				: seed % (layer * perLayer);
+
+			dependencies.push_back(Dependency_t{ SIGNATURE_BASE + target, Version_t(1, 0, 0, 0), {}, d == MAX_DEPENDENCIES - 1 });
+		}
+
+		if (aWithCycle && i == 0)
+		{
+			dependencies.push_back(Dependency_t{ SIGNATURE_BASE + ADDONS - 1, {}, {}, false });
+		}
+
+		aGraph.Declare(SIGNATURE_BASE + i, Version_t(1, 2, 0, 0), dependencies);
+	}
+}
+
+TEST(DependencyGraph, SyntheticScheduling)
+{
+	std::vector<double> declareUs;
+	std::vector<double> wavesUs;
+	std::vector<double> unloadUs;
+	std::vector<double> cyclesUs;
+	std::vector<double> checkUs;
+	std::vector<double> dependentsUs;
+	std::vector<double> cycleDetectUs;
+
+	std::vector<std::vector<uint32_t>> waves;
+	uint32_t satisfied = 0;
+	uint32_t cyclic = 0;
+	size_t cycleLength = 0;
+
+	for (uint32_t run = 0; run < RUNS; run++)
+	{
+		DependencyGraph graph;
+
+		BenchClock::time_point start = BenchClock::now();
+		Declare(graph, false);
+		declareUs.push_back(ElapsedUs(start));
+
+		start = BenchClock::now();
+		waves = graph.GetWaves();
+		wavesUs.push_back(ElapsedUs(start));
+
+		start = BenchClock::now();
+		DoNotOptimize(graph.GetUnloadOrder().size());
+		unloadUs.push_back(ElapsedUs(start));
+
+		start = BenchClock::now();
+		DoNotOptimize(graph.GetCycles().size());
+		cyclesUs.push_back(ElapsedUs(start));
+
+		/* Load wave by wave, checking each addon before it loads, as the loader threads do. */
+		satisfied = 0;
+		start = BenchClock::now();
+		for (const std::vector<uint32_t>& wave : waves)
+		{
+			for (uint32_t signature : wave)
+			{
+				if (graph.Check(signature) == EDependencyState::Satisfied) { satisfied++; }
+			}
+
+			for (uint32_t signature : wave)
+			{
+				graph.SetLoaded(signature, true);
+			}
+		}
+		checkUs.push_back(ElapsedUs(start));
+
+		/* Unloading any addon first looks up its dependents. */
+		start = BenchClock::now();
+		for (uint32_t i = 0; i < ADDONS; i++)
+		{
+			DoNotOptimize(graph.GetDependents(SIGNATURE_BASE + i).size());
+		}
+		dependentsUs.push_back(ElapsedUs(start));
+
+		/* The same graph, closed into a cycle by the first addon depending on the last. */
+		DependencyGraph cycleGraph;
+		Declare(cycleGraph, true);
+
+		start = BenchClock::now();
+		std::vector<std::vector<uint32_t>> cycles = cycleGraph.GetCycles();
+		cycleDetectUs.push_back(ElapsedUs(start));
+
+		cycleLength = cycles.empty() ? 0 : cycles[0].size();
+
+		cyclic = 0;
+		for (uint32_t i = 0; i < ADDONS; i++)
+		{
+			if (cycleGraph.Check(SIGNATURE_BASE + i) == EDependencyState::Cycle) { cyclic++; }
+		}
+	}
+
+	Report("declare all", declareUs, "us");
+	Report("waves", wavesUs, "us");
+	Report("unload order", unloadUs, "us");
+	Report("cycles, acyclic graph", cyclesUs, "us");
+	Report("check, wave by wave", checkUs, "us");
+	Report("dependents of each", dependentsUs, "us");
+	Report("cycles, one cycle", cycleDetectUs, "us");
+	Print("schedule", "%u addons in %zu waves instead of %u serialized loads, cycle of %zu, %u addons blocked by it", ADDONS, waves.size(), ADDONS, cycleLength, cyclic);
+
+	EXPECT(waves.size() == LAYERS);
+	EXPECT(satisfied == ADDONS);
+	/* The path starts and ends with the first addon, all of the cycle is blocked. */
+	EXPECT(cycleLength > 2);
+	EXPECT(cyclic >= cycleLength - 1);
+}
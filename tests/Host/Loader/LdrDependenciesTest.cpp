@@ -0,0 +1,218 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrDependenciesTest.cpp
+/// Description  :  Tests for the dependency graph of addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+
+#include "Host/Loader/LdrDependencies.h"
+
+using namespace Raidcore::Nexus::Host;
+
+constexpr const uint32_t ADDON_A = 0xA;
+constexpr const uint32_t ADDON_B = 0xB;
+constexpr const uint32_t ADDON_C = 0xC;
+constexpr const uint32_t ADDON_D = 0xD;
+constexpr const uint32_t ADDON_E = 0xE;
+
+static Dependency_t Requires(uint32_t aSignature, Version_t aMin = {}, Version_t aMax = {})
+{
+	return Dependency_t{ aSignature, aMin, aMax, false };
+}
+
+static Dependency_t Optional(uint32_t aSignature, Version_t aMin = {}, Version_t aMax = {})
+{
+	return Dependency_t{ aSignature, aMin, aMax, true };
+}
+
+TEST(DependencyGraph, OrdersDiamondInWaves)
+{
+	/* D depends on B and C, which both depend on A. */
+	DependencyGraph graph;
+	graph.Declare(ADDON_D, Version_t(1, 0, 0, 0), { Requires(ADDON_B), Requires(ADDON_C) });
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+	graph.Declare(ADDON_C, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), {});
+
+	std::vector<std::vector<uint32_t>> waves = graph.GetWaves();
+	ASSERT(waves.size() == 3);
+	EXPECT(waves[0] == std::vector<uint32_t>({ ADDON_A }));
+	EXPECT(waves[1] == std::vector<uint32_t>({ ADDON_B, ADDON_C }));
+	EXPECT(waves[2] == std::vector<uint32_t>({ ADDON_D }));
+
+	EXPECT(graph.GetUnloadOrder() == std::vector<uint32_t>({ ADDON_D, ADDON_B, ADDON_C, ADDON_A }));
+
+	EXPECT(graph.GetDependents(ADDON_A) == std::vector<uint32_t>({ ADDON_B, ADDON_C }));
+	EXPECT(graph.GetDependents(ADDON_B) == std::vector<uint32_t>({ ADDON_D }));
+	EXPECT(graph.GetDependents(ADDON_D).empty());
+}
+
+TEST(DependencyGraph, PendingUntilDependenciesLoad)
+{
+	DependencyGraph graph;
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), {});
+
+	uint32_t blocker = 0;
+	EXPECT(graph.Check(ADDON_A) == EDependencyState::Satisfied);
+	EXPECT(graph.Check(ADDON_B, &blocker) == EDependencyState::Pending);
+	EXPECT(blocker == ADDON_A);
+
+	graph.SetLoaded(ADDON_A, true);
+	EXPECT(graph.IsLoaded(ADDON_A));
+	EXPECT(graph.Check(ADDON_B, &blocker) == EDependencyState::Satisfied);
+	EXPECT(blocker == 0);
+
+	/* Reloading the dependency makes the dependent wait again. */
+	graph.SetLoaded(ADDON_A, false);
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Pending);
+
+	/* Declaring again, e.g. after an update, keeps the loaded state. */
+	graph.SetLoaded(ADDON_A, true);
+	graph.Declare(ADDON_A, Version_t(1, 1, 0, 0), {});
+	EXPECT(graph.IsLoaded(ADDON_A));
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+}
+
+TEST(DependencyGraph, MissingAndOptionalDependencies)
+{
+	DependencyGraph graph;
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Optional(ADDON_C), Requires(ADDON_A) });
+
+	uint32_t blocker = 0;
+	EXPECT(graph.Check(ADDON_B, &blocker) == EDependencyState::Missing);
+	EXPECT(blocker == ADDON_A);
+
+	/* Undeclared addons are not part of the graph. */
+	EXPECT(graph.Check(ADDON_E) == EDependencyState::Satisfied);
+	EXPECT(!graph.IsLoaded(ADDON_E));
+
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), {});
+	graph.SetLoaded(ADDON_A, true);
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+
+	/* A present optional dependency orders the load. */
+	graph.Declare(ADDON_C, Version_t(1, 0, 0, 0), {});
+	EXPECT(graph.Check(ADDON_B, &blocker) == EDependencyState::Pending);
+	EXPECT(blocker == ADDON_C);
+
+	graph.Remove(ADDON_C);
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+
+	graph.Remove(ADDON_A);
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Missing);
+}
+
+TEST(DependencyGraph, VersionRanges)
+{
+	DependencyGraph graph;
+	graph.Declare(ADDON_A, Version_t(2, 0, 0, 0), {});
+	graph.SetLoaded(ADDON_A, true);
+
+	/* Min is inclusive, max exclusive. */
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A, Version_t(2, 0, 0, 0), Version_t(3, 0, 0, 0)) });
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+
+	uint32_t blocker = 0;
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A, Version_t(1, 0, 0, 0), Version_t(2, 0, 0, 0)) });
+	EXPECT(graph.Check(ADDON_B, &blocker) == EDependencyState::VersionMismatch);
+	EXPECT(blocker == ADDON_A);
+
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A, Version_t(2, 0, 0, 1)) });
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::VersionMismatch);
+
+	/* Incompatible optional dependencies are ignored, also for ordering. */
+	graph.SetLoaded(ADDON_A, false);
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Optional(ADDON_A, Version_t(3, 0, 0, 0)) });
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+	EXPECT(graph.GetDependents(ADDON_A).empty());
+	EXPECT(graph.GetWaves().size() == 1);
+}
+
+TEST(DependencyGraph, DetectsCycles)
+{
+	/* A -> B -> C -> A, D depends on the cycle, E is independent. */
+	DependencyGraph graph;
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), { Requires(ADDON_B) });
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_C) });
+	graph.Declare(ADDON_C, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+	graph.Declare(ADDON_D, Version_t(1, 0, 0, 0), { Requires(ADDON_C) });
+	graph.Declare(ADDON_E, Version_t(1, 0, 0, 0), {});
+
+	uint32_t blocker = 0;
+	EXPECT(graph.Check(ADDON_A, &blocker) == EDependencyState::Cycle);
+	EXPECT(blocker == ADDON_A);
+
+	/* Not part of the cycle itself, so it has none to report. */
+	EXPECT(graph.Check(ADDON_D, &blocker) == EDependencyState::Cycle);
+	EXPECT(blocker == ADDON_D);
+	EXPECT(graph.Check(ADDON_E) == EDependencyState::Satisfied);
+
+	EXPECT(graph.GetCycle(ADDON_A) == std::vector<uint32_t>({ ADDON_A, ADDON_B, ADDON_C, ADDON_A }));
+	EXPECT(graph.GetCycle(ADDON_D).empty());
+
+	std::vector<std::vector<uint32_t>> cycles = graph.GetCycles();
+	ASSERT(cycles.size() == 1);
+	EXPECT(cycles[0].size() == 4);
+
+	/* Only E can load, the rest is still unloaded in some order. */
+	std::vector<std::vector<uint32_t>> waves = graph.GetWaves();
+	ASSERT(waves.size() == 1);
+	EXPECT(waves[0] == std::vector<uint32_t>({ ADDON_E }));
+	EXPECT(graph.GetUnloadOrder().size() == 5);
+
+	EXPECT(DependencyGraph::ToString(cycles[0]) == "0x0000000A -> 0x0000000B -> 0x0000000C -> 0x0000000A");
+
+	/* Breaking the cycle lets everything load. */
+	graph.Declare(ADDON_C, Version_t(1, 0, 0, 0), {});
+	EXPECT(graph.GetCycles().empty());
+	EXPECT(graph.GetWaves().size() == 3);
+}
+
+TEST(DependencyGraph, SelfDependencyIsCycle)
+{
+	DependencyGraph graph;
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+
+	EXPECT(graph.Check(ADDON_A) == EDependencyState::Cycle);
+	EXPECT(graph.GetCycle(ADDON_A) == std::vector<uint32_t>({ ADDON_A, ADDON_A }));
+	EXPECT(std::string(DependencyGraph::ToString(EDependencyState::Cycle)) == "Dependency cycle");
+}
+
+TEST(DependencyGraph, TransitiveDependentsForReload)
+{
+	/* Reloading A unloads B, which unloads C. Each is loaded again once its dependency is. */
+	DependencyGraph graph;
+	graph.Declare(ADDON_A, Version_t(1, 0, 0, 0), {});
+	graph.Declare(ADDON_B, Version_t(1, 0, 0, 0), { Requires(ADDON_A) });
+	graph.Declare(ADDON_C, Version_t(1, 0, 0, 0), { Requires(ADDON_B) });
+
+	for (uint32_t sig : { ADDON_A, ADDON_B, ADDON_C })
+	{
+		graph.SetLoaded(sig, true);
+	}
+
+	EXPECT(graph.GetDependents(ADDON_A) == std::vector<uint32_t>({ ADDON_B }));
+	EXPECT(graph.GetDependents(ADDON_B) == std::vector<uint32_t>({ ADDON_C }));
+
+	for (uint32_t sig : { ADDON_C, ADDON_B, ADDON_A })
+	{
+		graph.SetLoaded(sig, false);
+	}
+
+	EXPECT(graph.Check(ADDON_C) == EDependencyState::Pending);
+
+	graph.SetLoaded(ADDON_A, true);
+	EXPECT(graph.Check(ADDON_B) == EDependencyState::Satisfied);
+	EXPECT(graph.Check(ADDON_C) == EDependencyState::Pending);
+
+	graph.SetLoaded(ADDON_B, true);
+	EXPECT(graph.Check(ADDON_C) == EDependencyState::Satisfied);
+}
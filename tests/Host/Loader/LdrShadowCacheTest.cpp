@@ -0,0 +1,221 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrShadowCacheTest.cpp
+/// Description  :  Tests for the content addressed copies of addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+
+#include "Host/Loader/LdrShadowCache.h"
+
+using namespace Raidcore::Nexus::Host;
+
+///----------------------------------------------------------------------------------------------------
+/// TempDir Class
+/// 	Directory below the system temp directory, deleted with all contents on destruction.
+///----------------------------------------------------------------------------------------------------
+class TempDir
+{
+	public:
+	TempDir(const char* aName)
+	{
+		this->Path = std::filesystem::temp_directory_path() / (std::string("NexusTests_") + aName);
+
+		std::error_code ec;
+		std::filesystem::remove_all(this->Path, ec);
+		std::filesystem::create_directories(this->Path / "addons", ec);
+	}
+
+	~TempDir()
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(this->Path, ec);
+	}
+
+	std::filesystem::path Path;
+};
+
+static void WriteFile(const std::filesystem::path& aPath, const std::string& aContent)
+{
+	std::ofstream file(aPath, std::ios::binary | std::ios::trunc);
+	file << aContent;
+}
+
+static std::string ReadFile(const std::filesystem::path& aPath)
+{
+	std::ifstream file(aPath, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static MD5_t MakeMD5(uint8_t aSeed)
+{
+	std::vector<uint8_t> bytes(MD5_LENGTH);
+
+	for (uint8_t i = 0; i < MD5_LENGTH; i++)
+	{
+		bytes[i] = static_cast<uint8_t>(aSeed + i);
+	}
+
+	return MD5_t(bytes);
+}
+
+static size_t CountFiles(const std::filesystem::path& aDirectory)
+{
+	std::error_code ec;
+	size_t count = 0;
+
+	for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(aDirectory, ec))
+	{
+		if (entry.is_regular_file(ec)) { count++; }
+	}
+
+	return count;
+}
+
+TEST(ShadowCache, NamesCopiesByContent)
+{
+	TempDir dir("ShadowNames");
+	ShadowCache cache(dir.Path / "shadow");
+
+	std::filesystem::path copy = cache.GetPath(dir.Path / "addons" / "Addon.dll", MakeMD5(0x10));
+
+	/* The original name stays recognizable. */
+	EXPECT(copy.parent_path() == dir.Path / "shadow");
+	EXPECT(copy.filename().string().rfind("Addon.", 0) == 0);
+	EXPECT(copy.extension() == ".dll");
+
+	EXPECT(copy != cache.GetPath(dir.Path / "addons" / "Addon.dll", MakeMD5(0x20)));
+	EXPECT(copy != cache.GetPath(dir.Path / "addons" / "Other.dll", MakeMD5(0x10)));
+}
+
+TEST(ShadowCache, CopiesOnceAndCountsReferences)
+{
+	TempDir dir("ShadowRefs");
+	ShadowCache cache(dir.Path / "shadow");
+
+	std::filesystem::path source = dir.Path / "addons" / "Addon.dll";
+	WriteFile(source, "version 1");
+
+	/* The shadow directory is created on demand. */
+	std::filesystem::path first = cache.Acquire(source, MakeMD5(1));
+	ASSERT(!first.empty());
+	EXPECT(ReadFile(first) == "version 1");
+
+	std::filesystem::path second = cache.Acquire(source, MakeMD5(1));
+	EXPECT(second == first);
+	EXPECT(CountFiles(dir.Path / "shadow") == 1);
+
+	/* The original can be overwritten while the copy is in use. */
+	WriteFile(source, "version 2!");
+	EXPECT(ReadFile(first) == "version 1");
+
+	cache.Release(first);
+	EXPECT(cache.Collect() == 0);
+	EXPECT(std::filesystem::exists(first));
+
+	cache.Release(second);
+	EXPECT(cache.Collect() == 1);
+	EXPECT(!std::filesystem::exists(first));
+}
+
+TEST(ShadowCache, ChangedFilesGetNewCopies)
+{
+	TempDir dir("ShadowChanged");
+	ShadowCache cache(dir.Path / "shadow");
+
+	std::filesystem::path source = dir.Path / "addons" / "Addon.dll";
+	WriteFile(source, "version 1");
+
+	std::filesystem::path v1 = cache.Acquire(source, MakeMD5(1));
+	ASSERT(!v1.empty());
+
+	/* Reloaded after an update, the old copy is still loaded until the old module is freed. */
+	WriteFile(source, "version 2!");
+	std::filesystem::path v2 = cache.Acquire(source, MakeMD5(2));
+	ASSERT(!v2.empty());
+
+	EXPECT(v1 != v2);
+	EXPECT(ReadFile(v1) == "version 1");
+	EXPECT(ReadFile(v2) == "version 2!");
+
+	cache.Release(v1);
+	EXPECT(cache.Collect() == 1);
+	EXPECT(!std::filesystem::exists(v1));
+	EXPECT(std::filesystem::exists(v2));
+}
+
+TEST(ShadowCache, ReplacesTruncatedCopies)
+{
+	TempDir dir("ShadowTruncated");
+	ShadowCache cache(dir.Path / "shadow");
+
+	std::filesystem::path source = dir.Path / "addons" / "Addon.dll";
+	WriteFile(source, "complete content");
+
+	/* E.g. left by a crash before the rename existed. */
+	std::filesystem::create_directories(dir.Path / "shadow");
+	WriteFile(cache.GetPath(source, MakeMD5(1)), "compl");
+
+	std::filesystem::path copy = cache.Acquire(source, MakeMD5(1));
+	ASSERT(!copy.empty());
+	EXPECT(ReadFile(copy) == "complete content");
+}
+
+TEST(ShadowCache, FailsForMissingSource)
+{
+	TempDir dir("ShadowMissing");
+	ShadowCache cache(dir.Path / "shadow");
+
+	EXPECT(cache.Acquire(dir.Path / "addons" / "Missing.dll", MakeMD5(1)).empty());
+
+	/* Releasing unknown copies is harmless. */
+	cache.Release(dir.Path / "shadow" / "Missing.dll");
+}
+
+TEST(ShadowCache, CollectsLeftovers)
+{
+	TempDir dir("ShadowLeftovers");
+
+	std::filesystem::path source = dir.Path / "addons" / "Addon.dll";
+	WriteFile(source, "content");
+
+	/* Copies of a previous session and an interrupted copy. */
+	std::filesystem::create_directories(dir.Path / "shadow");
+	WriteFile(dir.Path / "shadow" / "Old.00000000000000000000000000000000.dll", "old");
+	WriteFile(dir.Path / "shadow" / "Addon.dll.partial", "cont");
+
+	ShadowCache cache(dir.Path / "shadow");
+
+	std::filesystem::path copy = cache.Acquire(source, MakeMD5(1));
+	ASSERT(!copy.empty());
+
+	/* The first collection after start sweeps everything unreferenced. */
+	EXPECT(cache.Collect() == 2);
+	EXPECT(CountFiles(dir.Path / "shadow") == 1);
+	EXPECT(std::filesystem::exists(copy));
+
+	/* Nothing released since, nothing to do. */
+	WriteFile(dir.Path / "shadow" / "Stray.dll", "stray");
+	EXPECT(cache.Collect() == 0);
+
+	cache.Release(copy);
+	EXPECT(cache.Collect() == 2);
+	EXPECT(CountFiles(dir.Path / "shadow") == 0);
+}
+
+TEST(ShadowCache, CollectsWithoutDirectory)
+{
+	TempDir dir("ShadowNoDir");
+	ShadowCache cache(dir.Path / "shadow");
+
+	EXPECT(cache.Collect() == 0);
+	EXPECT(!std::filesystem::exists(dir.Path / "shadow"));
+}
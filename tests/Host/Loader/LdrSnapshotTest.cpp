@@ -0,0 +1,299 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  LdrSnapshotTest.cpp
+/// Description  :  Tests for the immutable snapshots of tracked addons.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+
+#include "Host/Loader/LdrSnapshot.h"
+
+using namespace Raidcore::Nexus::Host;
+
+/* Only used as identities, the snapshots never dereference them. */
+static int s_AddonA = 0;
+static int s_AddonB = 0;
+
+static IAddon* const ADDON_A = reinterpret_cast<IAddon*>(&s_AddonA);
+static IAddon* const ADDON_B = reinterpret_cast<IAddon*>(&s_AddonB);
+
+static AddonInfo_t MakeInfo(IAddon* aAddon, uint32_t aSignature, EAddonState aState = EAddonState::NotLoaded)
+{
+	AddonInfo_t info{};
+	info.Addon     = aAddon;
+	info.Signature = aSignature;
+	info.Name      = "Addon " + std::to_string(aSignature);
+	info.State     = aState;
+	return info;
+}
+
+TEST(AddonSnapshots, PublishesTrackedAddonsOnly)
+{
+	AddonSnapshots snapshots;
+
+	EXPECT(!snapshots.Publish(MakeInfo(ADDON_A, 1)));
+	EXPECT(snapshots.GetGeneration() == 0);
+	EXPECT(snapshots.Get()->Addons.empty());
+
+	snapshots.Track(ADDON_A);
+	EXPECT(snapshots.Publish(MakeInfo(ADDON_A, 1)));
+	EXPECT(snapshots.GetGeneration() == 1);
+
+	/* Unchanged, no new generation. */
+	EXPECT(!snapshots.Publish(MakeInfo(ADDON_A, 1)));
+	EXPECT(snapshots.GetGeneration() == 1);
+
+	EXPECT(snapshots.Publish(MakeInfo(ADDON_A, 1, EAddonState::Loaded)));
+	EXPECT(snapshots.GetGeneration() == 2);
+	ASSERT(snapshots.Get()->Find(1) != nullptr);
+	EXPECT(snapshots.Get()->Find(1)->State == EAddonState::Loaded);
+}
+
+TEST(AddonSnapshots, HeldSnapshotsStayUnchanged)
+{
+	AddonSnapshots snapshots;
+	snapshots.Track(ADDON_A);
+	snapshots.Track(ADDON_B);
+	snapshots.Publish(MakeInfo(ADDON_A, 1));
+	snapshots.Publish(MakeInfo(ADDON_B, 2));
+
+	std::shared_ptr<const AddonSnapshot_t> held = snapshots.Get();
+
+	snapshots.Publish(MakeInfo(ADDON_A, 1, EAddonState::Loaded));
+	snapshots.Remove(ADDON_B);
+
+	EXPECT(held->Addons.size() == 2);
+	EXPECT(held->Find(1)->State == EAddonState::NotLoaded);
+	EXPECT(snapshots.Get()->Addons.size() == 1);
+	EXPECT(snapshots.Get()->Generation == held->Generation + 2);
+}
+
+TEST(AddonSnapshots, RemovedAddonsCannotPublishAgain)
+{
+	AddonSnapshots snapshots;
+	snapshots.Track(ADDON_A);
+	snapshots.Publish(MakeInfo(ADDON_A, 1, EAddonState::Loaded));
+
+	/* Removed before deleting, its thread still publishes while it unloads. */
+	EXPECT(snapshots.Remove(ADDON_A));
+	EXPECT(!snapshots.Publish(MakeInfo(ADDON_A, 1, EAddonState::NotLoaded)));
+	EXPECT(snapshots.Get()->Find(1) == nullptr);
+	EXPECT(!snapshots.Remove(ADDON_A));
+
+	/* The same address may be reused by a new addon. */
+	snapshots.Track(ADDON_A);
+	EXPECT(snapshots.Publish(MakeInfo(ADDON_A, 3)));
+	EXPECT(snapshots.Get()->Find(3) != nullptr);
+}
+
+TEST(AddonSnapshots, IgnoresDestroyingAddons)
+{
+	AddonSnapshots snapshots;
+	snapshots.Track(ADDON_A);
+	snapshots.Publish(MakeInfo(ADDON_A, 1));
+
+	AddonInfo_t destroying = MakeInfo(ADDON_A, 1, EAddonState::None);
+	destroying.IsDestroying = true;
+
+	uint64_t generation = snapshots.GetGeneration();
+	EXPECT(!snapshots.Publish(destroying));
+	EXPECT(snapshots.GetGeneration() == generation);
+	EXPECT(snapshots.Get()->Find(1)->State == EAddonState::NotLoaded);
+}
+
+TEST(AddonSnapshots, ClearUntracksAll)
+{
+	AddonSnapshots snapshots;
+	snapshots.Track(ADDON_A);
+	snapshots.Track(ADDON_B);
+	snapshots.Publish(MakeInfo(ADDON_A, 1));
+
+	snapshots.Clear();
+	EXPECT(snapshots.Get()->Addons.empty());
+
+	EXPECT(!snapshots.Publish(MakeInfo(ADDON_A, 1)));
+	EXPECT(!snapshots.Publish(MakeInfo(ADDON_B, 2)));
+
+	/* Nothing left to clear, no new generation. */
+	uint64_t generation = snapshots.GetGeneration();
+	snapshots.Clear();
+	EXPECT(snapshots.GetGeneration() == generation);
+}
+
+TEST(AddonSnapshots, FindsOwnerByModuleRange)
+{
+	static char s_Module[64] = {};
+
+	AddonSnapshots snapshots;
+	snapshots.Track(ADDON_A);
+	snapshots.Track(ADDON_B);
+
+	AddonInfo_t loaded = MakeInfo(ADDON_A, 1, EAddonState::Loaded);
+	loaded.Module     = s_Module;
+	loaded.ModuleSize = sizeof(s_Module);
+	snapshots.Publish(loaded);
+	snapshots.Publish(MakeInfo(ADDON_B, 2));
+
+	std::shared_ptr<const AddonSnapshot_t> snapshot = snapshots.Get();
+	EXPECT(snapshot->FindOwner(&s_Module[0]) == snapshot->Find(1));
+	EXPECT(snapshot->FindOwner(&s_Module[63]) == snapshot->Find(1));
+	EXPECT(snapshot->FindOwner(&s_Module[0] + sizeof(s_Module)) == nullptr);
+	EXPECT(snapshot->FindOwner(nullptr) == nullptr);
+	EXPECT(snapshot->Find(0) == nullptr);
+}
+
+TEST(AddonSnapshots, ConcurrentReadersSeeConsistentGenerations)
+{
+	constexpr uint32_t WRITERS = 2;
+	constexpr uint32_t READERS = 4;
+	constexpr uint32_t ADDONS  = 8;     /* Per writer. */
+	constexpr uint32_t ROUNDS  = 2000;
+
+	static int s_Addons[WRITERS][ADDONS] = {};
+
+	AddonSnapshots snapshots;
+
+	std::atomic<bool> isDone = false;
+	std::atomic<uint32_t> started = 0;
+	std::atomic<uint64_t> reads = 0;
+	std::atomic<uint64_t> regressions = 0;
+	std::atomic<uint64_t> mutations = 0;
+
+	std::vector<std::thread> threads;
+
+	for (uint32_t i = 0; i < READERS; i++)
+	{
+		threads.emplace_back([&]()
+		{
+			uint64_t last = 0;
+
+			started++;
+
+			while (!isDone.load(std::memory_order_relaxed))
+			{
+				std::shared_ptr<const AddonSnapshot_t> held = snapshots.Get();
+
+				/* A single reader never observes an older generation after a newer one. */
+				if (held->Generation < last)
+				{
+					regressions.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				last = held->Generation;
+
+				std::vector<AddonInfo_t> copy;
+
+				for (const std::shared_ptr<const AddonInfo_t>& info : held->Addons)
+				{
+					copy.push_back(*info);
+				}
+
+				/* Let the writers publish, while the snapshot is held. */
+				std::this_thread::yield();
+
+				if (copy.size() != held->Addons.size())
+				{
+					mutations.fetch_add(1, std::memory_order_relaxed);
+				}
+				else
+				{
+					for (size_t a = 0; a < copy.size(); a++)
+					{
+						if (!(copy[a] == *held->Addons[a]) || copy[a].Name != "Addon " + std::to_string(copy[a].Signature))
+						{
+							mutations.fetch_add(1, std::memory_order_relaxed);
+							break;
+						}
+					}
+				}
+
+				if (snapshots.GetGeneration() < last)
+				{
+					regressions.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				reads.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+	}
+
+	/* On few cores the writers could otherwise finish before any reader ran. */
+	while (started != READERS) { std::this_thread::yield(); }
+
+	std::vector<std::thread> writers;
+
+	for (uint32_t w = 0; w < WRITERS; w++)
+	{
+		writers.emplace_back([&, w]()
+		{
+			for (uint32_t round = 0; round < ROUNDS; round++)
+			{
+				uint32_t slot = round % ADDONS;
+				IAddon* addon = reinterpret_cast<IAddon*>(&s_Addons[w][slot]);
+				uint32_t signature = w * ADDONS + slot + 1;
+
+				/* Discovered, loaded, unloaded and removed, like the loader does on a hot-reload. */
+				snapshots.Track(addon);
+				snapshots.Publish(MakeInfo(addon, signature));
+				snapshots.Publish(MakeInfo(addon, signature, EAddonState::Loaded));
+
+				if (round % 3 == 0)
+				{
+					snapshots.Publish(MakeInfo(addon, signature, EAddonState::NotLoaded));
+					snapshots.Remove(addon);
+				}
+
+				if (round % 64 == 0) { std::this_thread::yield(); }
+			}
+		});
+	}
+
+	for (std::thread& writer : writers)
+	{
+		writer.join();
+	}
+
+	isDone = true;
+
+	for (std::thread& reader : threads)
+	{
+		reader.join();
+	}
+
+	EXPECT(regressions == 0);
+	EXPECT(mutations == 0);
+	EXPECT(reads > 0);
+
+	/* Every addon is tracked exactly once, whatever the interleaving. */
+	std::shared_ptr<const AddonSnapshot_t> last = snapshots.Get();
+	EXPECT(last->Generation == snapshots.GetGeneration());
+
+	for (uint32_t w = 0; w < WRITERS; w++)
+	{
+		for (uint32_t slot = 0; slot < ADDONS; slot++)
+		{
+			uint32_t signature = w * ADDONS + slot + 1;
+			const AddonInfo_t* info = last->Find(signature);
+
+			/* The last round of a slot decides, whether it was removed. */
+			uint32_t lastRound = ROUNDS - ADDONS + slot;
+			bool isRemoved = lastRound % 3 == 0;
+
+			EXPECT((info == nullptr) == isRemoved);
+
+			if (info)
+			{
+				EXPECT(info->State == EAddonState::Loaded);
+			}
+		}
+	}
+}
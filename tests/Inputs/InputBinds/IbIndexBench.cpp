@@ -0,0 +1,127 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  IbIndexBench.cpp
+/// Description  :  Cost of registering and rebinding InputBinds with 1 to 2000 binds registered.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Inputs/InputBinds/IbIndex.h"
+
+using namespace Raidcore::Nexus::Input;
+using namespace Raidcore::Nexus::Tests;
+
+static InputBind_t MakeBind(uint32_t aIndex)
+{
+	return InputBind_t(aIndex & 1, aIndex & 2, aIndex & 4, EInputDevice::Keyboard, static_cast<unsigned short>(1 + (aIndex >> 3)));
+}
+
+///----------------------------------------------------------------------------------------------------
+/// RebuildIndex:
+/// 	The previous approach, the whole lookup is rebuilt from the registry on every change.
+///----------------------------------------------------------------------------------------------------
+static void RebuildIndex(const std::map<std::string, IbMapping_t>& aRegistry, std::unordered_map<uint64_t, uint32_t>& aIndex)
+{
+	aIndex.clear();
+	aIndex.reserve(aRegistry.size());
+
+	uint32_t i = 0;
+	for (auto& [identifier, mapping] : aRegistry)
+	{
+		if (mapping.Bind == InputBind_t{}) { continue; }
+		aIndex.emplace(mapping.Bind.Pack(), i++);
+	}
+}
+
+TEST(InputBindIndex, RegisterAndRebind)
+{
+	for (uint32_t count : { 1u, 10u, 100u, 500u, 1000u, 2000u })
+	{
+		std::vector<std::string> identifiers;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			identifiers.push_back("KB_ADDON_" + std::to_string(i));
+		}
+
+		/* Registering all binds one by one, as addons do on load. */
+		std::map<std::string, IbMapping_t> registry;
+		CInputBindIndex index;
+
+		BenchClock::time_point start = BenchClock::now();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			IbMapping_t mapping{};
+			mapping.Bind = MakeBind(i);
+			registry.emplace(identifiers[i], mapping);
+			index.Insert(identifiers[i], mapping.Bind);
+		}
+		double incrementalUs = ElapsedUs(start);
+
+		std::map<std::string, IbMapping_t> rebuiltRegistry;
+		std::unordered_map<uint64_t, uint32_t> rebuilt;
+
+		start = BenchClock::now();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			IbMapping_t mapping{};
+			mapping.Bind = MakeBind(i);
+			rebuiltRegistry.emplace(identifiers[i], mapping);
+			RebuildIndex(rebuiltRegistry, rebuilt);
+		}
+		double rebuildUs = ElapsedUs(start);
+
+		/* Rebinding to a free key and back, as in the bind dialog. */
+		std::vector<double> setUs;
+		std::vector<double> setRebuildUs;
+		std::vector<double> findUs;
+
+		for (uint32_t i = 0; i < 1000; i++)
+		{
+			uint32_t target = (i * 7919) % count;
+			const std::string& identifier = identifiers[target];
+
+			for (InputBind_t bind : { MakeBind(count + 8), MakeBind(target) })
+			{
+				IbMapping_t& mapping = registry[identifier];
+				InputBind_t prev = mapping.Bind;
+
+				BenchClock::time_point setStart = BenchClock::now();
+				mapping.Bind = bind;
+				index.Erase(identifier, prev, registry);
+				index.Insert(identifier, bind);
+				setUs.push_back(ElapsedUs(setStart));
+
+				setStart = BenchClock::now();
+				rebuiltRegistry[identifier].Bind = bind;
+				RebuildIndex(rebuiltRegistry, rebuilt);
+				setRebuildUs.push_back(ElapsedUs(setStart));
+			}
+
+			BenchClock::time_point findStart = BenchClock::now();
+			DoNotOptimize(index.Find(MakeBind(i % count)));
+			findUs.push_back(ElapsedUs(findStart));
+		}
+
+		std::string scenario = std::to_string(count) + " binds";
+
+		Print((scenario + " register").c_str(), "incremental %10.1f us, rebuild %10.1f us", incrementalUs, rebuildUs);
+		Report((scenario + " set").c_str(), setUs, "us");
+		Report((scenario + " set rebuild").c_str(), setRebuildUs, "us");
+		Report((scenario + " find").c_str(), findUs, "us");
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			ASSERT(index.Find(MakeBind(i)) != UINT32_MAX);
+			EXPECT(index.GetIdentifier(index.Find(MakeBind(i))) == identifiers[i]);
+		}
+	}
+}
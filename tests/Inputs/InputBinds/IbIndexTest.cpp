@@ -0,0 +1,159 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  IbIndexTest.cpp
+/// Description  :  Tests for the lookup from InputBind_t to identifier.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "Test.h"
+
+#include "Inputs/InputBinds/IbIndex.h"
+
+using namespace Raidcore::Nexus::Input;
+
+static InputBind_t Key(unsigned short aCode, bool aCtrl = false)
+{
+	return InputBind_t(false, aCtrl, false, EInputDevice::Keyboard, aCode);
+}
+
+static std::string FindIdentifier(const CInputBindIndex& aIndex, const InputBind_t& aInputBind)
+{
+	uint32_t index = aIndex.Find(aInputBind);
+	return index == UINT32_MAX ? "" : aIndex.GetIdentifier(index);
+}
+
+///----------------------------------------------------------------------------------------------------
+/// Set:
+/// 	Changes the registry and the index the way CInputBindApi::Set does.
+///----------------------------------------------------------------------------------------------------
+static void Set(std::map<std::string, IbMapping_t>& aRegistry, CInputBindIndex& aIndex, const std::string& aIdentifier, InputBind_t aInputBind)
+{
+	auto it = aRegistry.find(aIdentifier);
+
+	if (it == aRegistry.end())
+	{
+		IbMapping_t mapping{};
+		mapping.Bind = aInputBind;
+		aRegistry.emplace(aIdentifier, mapping);
+		aIndex.Insert(aIdentifier, aInputBind);
+		return;
+	}
+
+	InputBind_t prev = it->second.Bind;
+	it->second.Bind = aInputBind;
+
+	if (prev != aInputBind)
+	{
+		aIndex.Erase(aIdentifier, prev, aRegistry);
+		aIndex.Insert(aIdentifier, aInputBind);
+	}
+}
+
+static void Delete(std::map<std::string, IbMapping_t>& aRegistry, CInputBindIndex& aIndex, const std::string& aIdentifier)
+{
+	auto it = aRegistry.find(aIdentifier);
+
+	if (it == aRegistry.end()) { return; }
+
+	InputBind_t prev = it->second.Bind;
+	aRegistry.erase(it);
+	aIndex.Erase(aIdentifier, prev, aRegistry);
+}
+
+TEST(InputBindIndex, FindsAndForgetsBinds)
+{
+	std::map<std::string, IbMapping_t> registry;
+	CInputBindIndex index;
+
+	Set(registry, index, "KB_A", Key(30));
+	Set(registry, index, "KB_B", Key(30, true));
+
+	EXPECT(FindIdentifier(index, Key(30)) == "KB_A");
+	EXPECT(FindIdentifier(index, Key(30, true)) == "KB_B");
+	EXPECT(index.Find(Key(31)) == UINT32_MAX);
+
+	/* Rebinding frees the previous combination. */
+	Set(registry, index, "KB_A", Key(31));
+	EXPECT(index.Find(Key(30)) == UINT32_MAX);
+	EXPECT(FindIdentifier(index, Key(31)) == "KB_A");
+
+	Delete(registry, index, "KB_A");
+	EXPECT(index.Find(Key(31)) == UINT32_MAX);
+
+	/* Unbound identifiers are never found. */
+	Set(registry, index, "KB_C", InputBind_t{});
+	EXPECT(index.Find(InputBind_t{}) == UINT32_MAX);
+}
+
+TEST(InputBindIndex, FirstInRegistryOrderWinsDuplicates)
+{
+	std::map<std::string, IbMapping_t> registry;
+	CInputBindIndex index;
+
+	/* Loaded from a config that assigned the same keys twice. */
+	Set(registry, index, "KB_C", Key(30));
+	Set(registry, index, "KB_B", Key(30));
+	Set(registry, index, "KB_D", Key(30));
+	EXPECT(FindIdentifier(index, Key(30)) == "KB_B");
+
+	/* Removing a loser keeps the winner. */
+	Delete(registry, index, "KB_D");
+	EXPECT(FindIdentifier(index, Key(30)) == "KB_B");
+
+	/* Removing the winner hands it to the next one. */
+	Set(registry, index, "KB_B", Key(40));
+	EXPECT(FindIdentifier(index, Key(30)) == "KB_C");
+	EXPECT(FindIdentifier(index, Key(40)) == "KB_B");
+
+	Delete(registry, index, "KB_C");
+	EXPECT(index.Find(Key(30)) == UINT32_MAX);
+}
+
+TEST(InputBindIndex, MatchesARebuildAfterRandomChanges)
+{
+	std::map<std::string, IbMapping_t> registry;
+	CInputBindIndex index;
+
+	uint32_t state = 12345;
+	auto next = [&state](uint32_t aBound)
+	{
+		state = state * 1664525 + 1013904223;
+		return (state >> 8) % aBound;
+	};
+
+	for (uint32_t i = 0; i < 5000; i++)
+	{
+		std::string identifier = "KB_" + std::to_string(next(64));
+
+		/* Few keys, so duplicates are common. */
+		if (next(8) == 0)
+		{
+			Delete(registry, index, identifier);
+		}
+		else
+		{
+			Set(registry, index, identifier, next(10) == 0 ? InputBind_t{} : Key(static_cast<unsigned short>(1 + next(16)), next(2) == 0));
+		}
+
+		/* What iterating the ordered registry finds. */
+		for (unsigned short code = 1; code <= 16; code++)
+		{
+			for (bool ctrl : { false, true })
+			{
+				std::string expected;
+
+				for (auto& [id, mapping] : registry)
+				{
+					if (mapping.Bind == Key(code, ctrl)) { expected = id; break; }
+				}
+
+				ASSERT(FindIdentifier(index, Key(code, ctrl)) == expected);
+			}
+		}
+	}
+}
@@ -0,0 +1,58 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  Main.cpp
+/// Description  :  Runs the registered tests. An optional argument filters by suite.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+#include "Test.h"
+
+using namespace Raidcore::Nexus::Tests;
+
+int main(int argc, char* argv[])
+{
+	const char* filter = argc > 1 ? argv[1] : nullptr;
+
+	int ran = 0;
+	int failed = 0;
+
+	for (const TestCase_t& test : GetTests())
+	{
+		if (filter && std::strcmp(filter, test.Suite) != 0) { continue; }
+
+		GetFailures() = 0;
+
+		try
+		{
+			test.Function();
+		}
+		catch (const AssertionFailed_t&)
+		{
+		}
+		catch (const std::exception& ex)
+		{
+			Fail(test.Suite, 0, ex.what());
+		}
+
+		ran++;
+
+		if (GetFailures() > 0)
+		{
+			failed++;
+			std::printf("[FAIL] %s.%s\n", test.Suite, test.Name);
+		}
+		else
+		{
+			std::printf("[ OK ] %s.%s\n", test.Suite, test.Name);
+		}
+	}
+
+	std::printf("%d tests, %d failed.\n", ran, failed);
+
+	return failed > 0 ? 1 : 0;
+}
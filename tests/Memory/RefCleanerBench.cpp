@@ -0,0 +1,122 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  RefCleanerBench.cpp
+/// Description  :  Cleanup cost of hot-reloading one synthetic addon among 100.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Stubs.h"
+#include "Test.h"
+
+#include "Core/Functions/FnRegistry.h"
+#include "Memory/RefCleanerContext.h"
+#include "Platform/RawInput/RiApi.h"
+
+using namespace Raidcore::Nexus::Core;
+using namespace Raidcore::Nexus::Memory;
+using namespace Raidcore::Nexus::Platform;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t ADDONS         = 100;
+constexpr const size_t   MODULE_SIZE    = 4096;
+constexpr const uint32_t RELOADS        = 200;
+constexpr const uint32_t RELOADED_ADDON = ADDONS / 2;
+
+/* The synthetic module images, callbacks are addresses within them and never invoked. */
+static char s_Image[ADDONS * MODULE_SIZE];
+
+static char* GetModule(uint32_t aAddon)
+{
+	return &s_Image[aAddon * MODULE_SIZE];
+}
+
+///----------------------------------------------------------------------------------------------------
+/// RegisterAddon:
+/// 	Registers the functions and the WndProc callback of an addon, as it does on load.
+///----------------------------------------------------------------------------------------------------
+static void RegisterAddon(FuncRegistry& aRegistry, RawInputApi& aWndProcs, uint32_t aAddon, uint32_t aFunctions)
+{
+	char* module = GetModule(aAddon);
+
+	for (uint32_t i = 0; i < aFunctions; i++)
+	{
+		std::string identifier = "ADDON_" + std::to_string(aAddon) + "_FN_" + std::to_string(i);
+		aRegistry.Register(identifier.c_str(), module + i * 8);
+	}
+
+	aWndProcs.Register(reinterpret_cast<WNDPROC_CALLBACK>(module + MODULE_SIZE / 2));
+}
+
+///----------------------------------------------------------------------------------------------------
+/// HotReload:
+/// 	Loads all addons, then unloads and loads one of them again and again.
+/// 	Returns the microseconds of each cleanup.
+///----------------------------------------------------------------------------------------------------
+static std::vector<double> HotReload(uint32_t aFunctions, RefCleanupReport_t& aOutReport)
+{
+	LogApi logger;
+	FuncRegistry functions(logger);
+	RawInputApi wndProcs;
+
+	for (uint32_t addon = 0; addon < ADDONS; addon++)
+	{
+		RegisterAddon(functions, wndProcs, addon, aFunctions);
+	}
+
+	std::vector<double> cleanupUs;
+	char* module = GetModule(RELOADED_ADDON);
+
+	for (uint32_t i = 0; i < RELOADS; i++)
+	{
+		BenchClock::time_point start = BenchClock::now();
+		aOutReport = RefCleanerContext::Get()->CleanupRefs(module, module + MODULE_SIZE - 1);
+		cleanupUs.push_back(ElapsedUs(start));
+
+		RegisterAddon(functions, wndProcs, RELOADED_ADDON, aFunctions);
+	}
+
+	return cleanupUs;
+}
+
+TEST(RefCleaner, HotReloadOneOfHundred)
+{
+	/* Few functions per addon, as most export, and a registry a hundred times the size. */
+	for (uint32_t functions : { 20u, 200u })
+	{
+		/* Without resolvable modules every entry is matched by range, as every registry scanned before. */
+		UnmapModules();
+
+		RefCleanupReport_t scanReport{};
+		std::vector<double> scanUs = HotReload(functions, scanReport);
+
+		for (uint32_t addon = 0; addon < ADDONS; addon++)
+		{
+			MapModule(GetModule(addon), MODULE_SIZE);
+		}
+
+		RefCleanupReport_t indexReport{};
+		std::vector<double> indexUs = HotReload(functions, indexReport);
+
+		UnmapModules();
+
+		std::string entries = std::to_string(ADDONS * (functions + 1)) + " entries";
+
+		Report((entries + ", range scan").c_str(), scanUs, "us");
+		Report((entries + ", owner index").c_str(), indexUs, "us");
+
+		/* Both find exactly the entries of the reloaded addon. */
+		EXPECT(scanReport.Total == functions + 1);
+		EXPECT(indexReport.Total == functions + 1);
+
+		for (const RefCleanupResult_t& result : indexReport.Components)
+		{
+			Print(result.Component.c_str(), "%u references", result.Count);
+		}
+	}
+}
@@ -0,0 +1,254 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  ResourceLedgerTest.cpp
+/// Description  :  Tests for the per module resource accounting.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Test.h"
+
+#include "Memory/ResourceLedger.h"
+
+using namespace Raidcore::Nexus::Memory;
+
+static int s_ModuleA = 0;
+static int s_ModuleB = 0;
+static int s_ModuleC = 0;
+
+static void* const MODULE_A = &s_ModuleA;
+static void* const MODULE_B = &s_ModuleB;
+static void* const MODULE_C = &s_ModuleC;
+
+static const ResourceUsage_t* FindOwner(const std::vector<ResourceUsage_t>& aUsage, void* aOwner)
+{
+	for (const ResourceUsage_t& entry : aUsage)
+	{
+		if (entry.Owner == aOwner) { return &entry; }
+	}
+
+	return nullptr;
+}
+
+TEST(ResourceLedger, AccountsPerOwner)
+{
+	ResourceLedger ledger;
+	ledger.Add(MODULE_A, EResource::Events, 3);
+	ledger.Add(MODULE_A, EResource::Events, -1);
+	ledger.Add(MODULE_B, EResource::Textures, 2);
+	ledger.Set(MODULE_B, EResource::LoadTimeUs, 1500);
+	ledger.Set(MODULE_B, EResource::LoadTimeUs, 1200);
+
+	std::vector<ResourceUsage_t> usage = ledger.GetSnapshot();
+	ASSERT(usage.size() == 2);
+
+	const ResourceUsage_t* a = FindOwner(usage, MODULE_A);
+	const ResourceUsage_t* b = FindOwner(usage, MODULE_B);
+	ASSERT(a && b);
+
+	EXPECT(a->Get(EResource::Events) == 2);
+	EXPECT(a->Get(EResource::Textures) == 0);
+	EXPECT(b->Get(EResource::Textures) == 2);
+	EXPECT(b->Get(EResource::LoadTimeUs) == 1200);
+
+	/* Not attributable to a module is an owner too. */
+	ledger.Add(nullptr, EResource::LogMessages, 1);
+	EXPECT(FindOwner(ledger.GetSnapshot(), nullptr) != nullptr);
+}
+
+TEST(ResourceLedger, ReleasingUnknownOwnersClaimsNothing)
+{
+	ResourceLedger ledger;
+	ledger.Add(MODULE_A, EResource::Events, -1);
+	ledger.Set(MODULE_A, EResource::Events, 0);
+
+	EXPECT(ledger.GetSnapshot().empty());
+
+	/* Ignored, not counted somewhere else. */
+	ledger.Add(MODULE_A, EResource::COUNT, 1);
+	ledger.Set(MODULE_A, EResource::COUNT, 1);
+	EXPECT(ledger.GetSnapshot().empty());
+}
+
+TEST(ResourceLedger, OmitsOwnersWithoutUsage)
+{
+	ResourceLedger ledger;
+	ledger.Add(MODULE_A, EResource::InputBinds, 1);
+	ledger.Add(MODULE_B, EResource::InputBinds, 1);
+
+	/* All released, without an unload. The slot is kept. */
+	ledger.Add(MODULE_A, EResource::InputBinds, -1);
+
+	std::vector<ResourceUsage_t> usage = ledger.GetSnapshot();
+	ASSERT(usage.size() == 1);
+	EXPECT(usage[0].Owner == MODULE_B);
+
+	ledger.Add(MODULE_A, EResource::InputBinds, 1);
+	EXPECT(ledger.GetSnapshot().size() == 2);
+}
+
+TEST(ResourceLedger, DropsUsageWithoutSlotsLeft)
+{
+	ResourceLedger ledger;
+	std::vector<int> modules(RESLEDGER_MAXOWNERS + 1);
+
+	for (int& module : modules)
+	{
+		ledger.Add(&module, EResource::Events, 1);
+	}
+
+	std::vector<ResourceUsage_t> usage = ledger.GetSnapshot();
+	EXPECT(usage.size() == RESLEDGER_MAXOWNERS);
+	EXPECT(FindOwner(usage, &modules.back()) == nullptr);
+	EXPECT(ledger.GetDroppedCount() == 1);
+
+	/* Owners that have a slot keep accounting. */
+	ledger.Add(&modules.front(), EResource::Events, 1);
+	EXPECT(FindOwner(ledger.GetSnapshot(), &modules.front())->Get(EResource::Events) == 2);
+	EXPECT(ledger.GetDroppedCount() == 1);
+
+	/* Releases were never accounted, so they are not dropped. */
+	ledger.Add(&modules.back(), EResource::Events, -1);
+	ledger.Set(&modules.back(), EResource::LoadTimeUs, 10);
+	EXPECT(ledger.GetDroppedCount() == 2);
+
+	/* An unload frees a slot for the next module. */
+	EXPECT(ledger.Retire(&modules.front(), &modules.front()) == 1);
+	ledger.Add(&modules.back(), EResource::Events, 1);
+
+	usage = ledger.GetSnapshot();
+	EXPECT(usage.size() == RESLEDGER_MAXOWNERS);
+	EXPECT(FindOwner(usage, &modules.front()) == nullptr);
+	EXPECT(FindOwner(usage, &modules.back()) != nullptr);
+	EXPECT(ledger.GetDroppedCount() == 2);
+}
+
+TEST(ResourceLedger, RetiresOnUnload)
+{
+	int module[64]{};
+	void* start = &module[0];
+	void* end = &module[63];
+
+	ResourceLedger ledger;
+	ledger.Add(start, EResource::Events, 2);
+	ledger.Add(start, EResource::LogMessages, 10);
+	ledger.Set(start, EResource::LoadTimeUs, 1500);
+	ledger.Add(MODULE_A, EResource::Events, 1);
+
+	/* Usage of other modules is untouched. */
+	EXPECT(ledger.Retire(start, end) == 1);
+	EXPECT(ledger.GetSnapshot().size() == 1);
+	EXPECT(FindOwner(ledger.GetSnapshot(), MODULE_A)->Get(EResource::Events) == 1);
+
+	/* Releasing after the unload does not bring it back. */
+	ledger.Add(start, EResource::Events, -2);
+	EXPECT(ledger.GetSnapshot().size() == 1);
+	EXPECT(ledger.Retire(start, end) == 0);
+
+	/* Textures and shared memory outlive the module and stay attributed to it. */
+	ledger.Add(start, EResource::Textures, 2);
+	ledger.Add(start, EResource::TextureBytes, 4096);
+	ledger.Add(start, EResource::InputBinds, 3);
+
+	EXPECT(ledger.Retire(start, end) == 1);
+
+	const ResourceUsage_t* kept = FindOwner(ledger.GetSnapshot(), start);
+	ASSERT(kept);
+	EXPECT(kept->Get(EResource::Textures) == 2);
+	EXPECT(kept->Get(EResource::TextureBytes) == 4096);
+	EXPECT(kept->Get(EResource::InputBinds) == 0);
+
+	/* Released later, the slot is freed with the next unload of the range. */
+	ledger.Add(start, EResource::Textures, -2);
+	ledger.Add(start, EResource::TextureBytes, -4096);
+
+	EXPECT(ledger.Retire(start, end) == 1);
+	EXPECT(ledger.Retire(start, end) == 0);
+
+	/* Loaded again, it starts fresh in the freed slot. */
+	ledger.Add(start, EResource::Events, 1);
+	EXPECT(FindOwner(ledger.GetSnapshot(), start)->Get(EResource::Events) == 1);
+	EXPECT(FindOwner(ledger.GetSnapshot(), start)->Get(EResource::LogMessages) == 0);
+
+	/* Unattributed usage never belongs to a module. */
+	ledger.Add(nullptr, EResource::Events, 1);
+	EXPECT(ledger.Retire(nullptr, nullptr) == 0);
+	EXPECT(FindOwner(ledger.GetSnapshot(), nullptr) != nullptr);
+}
+
+TEST(ResourceLedger, ConcurrentWritersClaimOneSlotEach)
+{
+	ResourceLedger ledger;
+	std::vector<std::thread> threads;
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		threads.emplace_back([&ledger]()
+		{
+			for (uint32_t n = 0; n < 1000; n++)
+			{
+				ledger.Add(MODULE_A, EResource::Events, 1);
+				ledger.Add(MODULE_B, EResource::LogBytes, 2);
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	std::vector<ResourceUsage_t> usage = ledger.GetSnapshot();
+	ASSERT(usage.size() == 2);
+	EXPECT(FindOwner(usage, MODULE_A)->Get(EResource::Events) == 8000);
+	EXPECT(FindOwner(usage, MODULE_B)->Get(EResource::LogBytes) == 16000);
+}
+
+TEST(ResourceLedger, SumsAndSorts)
+{
+	ResourceLedger ledger;
+	ledger.Add(MODULE_A, EResource::TextureBytes, 100);
+	ledger.Add(MODULE_B, EResource::TextureBytes, 300);
+	ledger.Add(MODULE_C, EResource::TextureBytes, 100);
+	ledger.Add(MODULE_C, EResource::HttpRequests, 5);
+
+	std::vector<ResourceUsage_t> usage = ledger.GetSnapshot();
+
+	ResourceUsage_t total = ResourceLedger::Sum(usage);
+	EXPECT(total.Owner == nullptr);
+	EXPECT(total.Get(EResource::TextureBytes) == 500);
+	EXPECT(total.Get(EResource::HttpRequests) == 5);
+	EXPECT(total.Get(EResource::Events) == 0);
+
+	ResourceLedger::Sort(usage, EResource::TextureBytes, true);
+	ASSERT(usage.size() == 3);
+	EXPECT(usage[0].Owner == MODULE_B);
+
+	/* Equal values are ordered by owner, so rows do not swap between frames. */
+	void* lo = MODULE_A < MODULE_C ? MODULE_A : MODULE_C;
+	void* hi = MODULE_A < MODULE_C ? MODULE_C : MODULE_A;
+	EXPECT(usage[1].Owner == lo);
+	EXPECT(usage[2].Owner == hi);
+
+	ResourceLedger::Sort(usage, EResource::TextureBytes, false);
+	EXPECT(usage[0].Owner == lo);
+	EXPECT(usage[1].Owner == hi);
+	EXPECT(usage[2].Owner == MODULE_B);
+
+	EXPECT(ResourceLedger::Sum({}).Get(EResource::TextureBytes) == 0);
+}
+
+TEST(ResourceLedger, NamesEveryResource)
+{
+	for (uint32_t res = 0; res < static_cast<uint32_t>(EResource::COUNT); res++)
+	{
+		EXPECT(std::string(ResourceLedger::ToString(static_cast<EResource>(res))) != "Unknown");
+	}
+
+	EXPECT(std::string(ResourceLedger::ToString(EResource::COUNT)) == "Unknown");
+}
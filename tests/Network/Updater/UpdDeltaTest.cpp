@@ -0,0 +1,230 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UpdDeltaTest.cpp
+/// Description  :  Tests for the delta patch applier on synthetic binaries.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Test.h"
+
+#include "Network/Updater/UpdDelta.h"
+
+using namespace Raidcore::Nexus::Network;
+
+///----------------------------------------------------------------------------------------------------
+/// PatchWriter Class
+/// 	Builds a patch instruction by instruction.
+///----------------------------------------------------------------------------------------------------
+class PatchWriter
+{
+	public:
+	PatchWriter(uint64_t aSourceSize, uint64_t aTargetSize)
+	{
+		DeltaHeader_t header{};
+		header.Magic = DELTAPATCH_MAGIC;
+		header.Version = DELTAPATCH_VERSION;
+		header.SourceSize = aSourceSize;
+		header.TargetSize = aTargetSize;
+
+		this->Data.resize(sizeof(DeltaHeader_t));
+		memcpy(this->Data.data(), &header, sizeof(DeltaHeader_t));
+	}
+
+	PatchWriter& Copy(uint32_t aSourceOffset, uint32_t aLength)
+	{
+		this->Data.push_back(static_cast<uint8_t>(EDeltaOp::Copy));
+		this->U32(aSourceOffset);
+		this->U32(aLength);
+		return *this;
+	}
+
+	PatchWriter& Insert(const std::vector<uint8_t>& aBytes)
+	{
+		this->Data.push_back(static_cast<uint8_t>(EDeltaOp::Insert));
+		this->U32(static_cast<uint32_t>(aBytes.size()));
+		this->Data.insert(this->Data.end(), aBytes.begin(), aBytes.end());
+		return *this;
+	}
+
+	PatchWriter& Add(uint32_t aSourceOffset, const std::vector<uint8_t>& aDeltas)
+	{
+		this->Data.push_back(static_cast<uint8_t>(EDeltaOp::Add));
+		this->U32(aSourceOffset);
+		this->U32(static_cast<uint32_t>(aDeltas.size()));
+		this->Data.insert(this->Data.end(), aDeltas.begin(), aDeltas.end());
+		return *this;
+	}
+
+	PatchWriter& U32(uint32_t aValue)
+	{
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			this->Data.push_back(static_cast<uint8_t>(aValue >> (i * 8)));
+		}
+		return *this;
+	}
+
+	std::vector<uint8_t> Data;
+};
+
+///----------------------------------------------------------------------------------------------------
+/// MakeSource:
+/// 	Returns a deterministic pseudo random binary.
+///----------------------------------------------------------------------------------------------------
+static std::vector<uint8_t> MakeSource(size_t aSize)
+{
+	std::vector<uint8_t> source(aSize);
+	uint32_t state = 0x12345678;
+
+	for (uint8_t& b : source)
+	{
+		state = state * 1664525 + 1013904223;
+		b = static_cast<uint8_t>(state >> 24);
+	}
+
+	return source;
+}
+
+static EDeltaResult Apply(const std::vector<uint8_t>& aSource, const std::vector<uint8_t>& aPatch, std::vector<uint8_t>& aOutTarget)
+{
+	return DeltaPatch::Apply(aSource.data(), aSource.size(), aPatch.data(), aPatch.size(), aOutTarget);
+}
+
+TEST(DeltaPatch, RebuildsShiftedBinary)
+{
+	std::vector<uint8_t> source = MakeSource(4096);
+
+	/* New function inserted at 1000, the code after it shifted with relocated addresses. */
+	std::vector<uint8_t> expected(source.begin(), source.begin() + 1000);
+	std::vector<uint8_t> inserted = { 0x48, 0x89, 0x5C, 0x24, 0x08, 0xC3 };
+	expected.insert(expected.end(), inserted.begin(), inserted.end());
+
+	std::vector<uint8_t> deltas(3096);
+
+	for (size_t i = 0; i < deltas.size(); i++)
+	{
+		deltas[i] = (i % 64 == 0) ? 0x06 : 0x00;
+		expected.push_back(static_cast<uint8_t>(source[1000 + i] + deltas[i]));
+	}
+
+	PatchWriter patch(source.size(), expected.size());
+	patch.Copy(0, 1000).Insert(inserted).Add(1000, deltas);
+
+	std::vector<uint8_t> target;
+	EXPECT(Apply(source, patch.Data, target) == EDeltaResult::Success);
+	EXPECT(target == expected);
+}
+
+TEST(DeltaPatch, RejectsInvalidHeaders)
+{
+	std::vector<uint8_t> source = MakeSource(64);
+	std::vector<uint8_t> target;
+
+	PatchWriter patch(source.size(), 64);
+	patch.Copy(0, 64);
+
+	std::vector<uint8_t> truncated(patch.Data.begin(), patch.Data.begin() + sizeof(DeltaHeader_t) - 1);
+	EXPECT(Apply(source, truncated, target) == EDeltaResult::InvalidHeader);
+
+	std::vector<uint8_t> badMagic = patch.Data;
+	badMagic[0] ^= 0xFF;
+	EXPECT(Apply(source, badMagic, target) == EDeltaResult::InvalidHeader);
+
+	std::vector<uint8_t> otherSource = MakeSource(65);
+	EXPECT(Apply(otherSource, patch.Data, target) == EDeltaResult::SourceMismatch);
+
+	EXPECT(DeltaPatch::Apply(source.data(), source.size(), nullptr, 0, target) == EDeltaResult::InvalidHeader);
+}
+
+TEST(DeltaPatch, RejectsHugeTargetsBeforeAllocating)
+{
+	std::vector<uint8_t> source = MakeSource(64);
+	std::vector<uint8_t> target;
+
+	/* Would throw or exhaust memory if reserved. */
+	PatchWriter huge(source.size(), UINT64_MAX);
+	huge.Copy(0, 64);
+	EXPECT(Apply(source, huge.Data, target) == EDeltaResult::TargetTooLarge);
+	EXPECT(target.capacity() == 0);
+
+	PatchWriter above(source.size(), DELTAPATCH_MAXSIZE + 1);
+	above.Copy(0, 64);
+	EXPECT(Apply(source, above.Data, target) == EDeltaResult::TargetTooLarge);
+
+	/* At the bound it is accepted, but has to be filled exactly. */
+	PatchWriter at(source.size(), DELTAPATCH_MAXSIZE);
+	at.Copy(0, 64);
+	EXPECT(Apply(source, at.Data, target) == EDeltaResult::TargetMismatch);
+}
+
+TEST(DeltaPatch, RejectsOutOfRangeInstructions)
+{
+	std::vector<uint8_t> source = MakeSource(64);
+	std::vector<uint8_t> target;
+
+	PatchWriter pastEnd(source.size(), 64);
+	pastEnd.Copy(32, 33);
+	EXPECT(Apply(source, pastEnd.Data, target) == EDeltaResult::OutOfRange);
+
+	/* Offset + length wraps around 32 bits. */
+	PatchWriter wrap(source.size(), 64);
+	wrap.Copy(0xFFFFFFF0, 0x20);
+	EXPECT(Apply(source, wrap.Data, target) == EDeltaResult::OutOfRange);
+
+	PatchWriter addPastEnd(source.size(), 64);
+	addPastEnd.Add(60, std::vector<uint8_t>(8));
+	EXPECT(Apply(source, addPastEnd.Data, target) == EDeltaResult::OutOfRange);
+
+	/* More output than the header announced. */
+	PatchWriter overflow(source.size(), 64);
+	overflow.Copy(0, 64).Copy(0, 1);
+	EXPECT(Apply(source, overflow.Data, target) == EDeltaResult::OutOfRange);
+	EXPECT(target.size() == 64);
+}
+
+TEST(DeltaPatch, RejectsTruncatedAndUnknownInstructions)
+{
+	std::vector<uint8_t> source = MakeSource(64);
+	std::vector<uint8_t> target;
+
+	PatchWriter shortOperand(source.size(), 64);
+	shortOperand.Copy(0, 64);
+	shortOperand.Data.resize(shortOperand.Data.size() - 2);
+	EXPECT(Apply(source, shortOperand.Data, target) == EDeltaResult::Truncated);
+
+	PatchWriter shortInsert(source.size(), 16);
+	shortInsert.Insert(std::vector<uint8_t>(16, 0xAA));
+	shortInsert.Data.resize(shortInsert.Data.size() - 1);
+	EXPECT(Apply(source, shortInsert.Data, target) == EDeltaResult::Truncated);
+
+	PatchWriter unknown(source.size(), 64);
+	unknown.Data.push_back(0x7F);
+	EXPECT(Apply(source, unknown.Data, target) == EDeltaResult::InvalidOp);
+
+	PatchWriter zero(source.size(), 64);
+	zero.Data.push_back(0x00);
+	EXPECT(Apply(source, zero.Data, target) == EDeltaResult::InvalidOp);
+}
+
+TEST(DeltaPatch, RequiresExactTargetSize)
+{
+	std::vector<uint8_t> source = MakeSource(64);
+	std::vector<uint8_t> target;
+
+	PatchWriter shortTarget(source.size(), 64);
+	shortTarget.Copy(0, 63);
+	EXPECT(Apply(source, shortTarget.Data, target) == EDeltaResult::TargetMismatch);
+
+	/* An empty target is valid. */
+	PatchWriter empty(source.size(), 0);
+	EXPECT(Apply(source, empty.Data, target) == EDeltaResult::Success);
+	EXPECT(target.empty());
+
+	EXPECT(std::string(DeltaPatch::ToString(EDeltaResult::TargetTooLarge)) == "Target too large");
+}
@@ -0,0 +1,231 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  CrashCaptureTest.cpp
+/// Description  :  Tests for the crash capture format and its symbolization on a synthetic module map.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "Test.h"
+
+#include "Platform/CrashHandler/CrashCapture.h"
+
+using namespace Raidcore::Nexus::Platform;
+
+///----------------------------------------------------------------------------------------------------
+/// MakeCapture:
+/// 	Returns a valid capture of two adjacent modules and one after a gap:
+/// 	  0x10000 - 0x11000 C:\Game\Gw2-64.exe
+/// 	  0x11000 - 0x11800 C:\Game\addons\Addon.dll
+/// 	  0x20000 - 0x20100 /tmp/other.so
+///----------------------------------------------------------------------------------------------------
+static std::unique_ptr<CrashCapture_t> MakeCapture()
+{
+	std::unique_ptr<CrashCapture_t> capture = std::make_unique<CrashCapture_t>();
+	memset(capture.get(), 0, sizeof(CrashCapture_t));
+
+	capture->Magic = CRASHCAPTURE_MAGIC;
+	capture->Version = CRASHCAPTURE_VERSION;
+	capture->Machine = CRASHCAPTURE_MACHINE_AMD64;
+	capture->ExceptionCode = 0xC0000005;
+	capture->ExceptionAddress = 0x11010;
+
+	const struct { uint64_t Base; uint32_t Size; const char* Path; } modules[] = {
+		{ 0x10000, 0x1000, "C:\\Game\\Gw2-64.exe" },
+		{ 0x11000, 0x0800, "C:\\Game\\addons\\Addon.dll" },
+		{ 0x20000, 0x0100, "/tmp/other.so" }
+	};
+
+	for (const auto& mod : modules)
+	{
+		CrashModule_t& entry = capture->Modules[capture->ModuleCount++];
+		entry.Base = mod.Base;
+		entry.Size = mod.Size;
+		entry.TimeDateStamp = 0x5F000000;
+		strncpy(entry.Path, mod.Path, sizeof(entry.Path) - 1);
+	}
+
+	return capture;
+}
+
+TEST(CrashCapture, ValidatesHeaderAndCounts)
+{
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+	EXPECT(CrashCapture::IsValid(*capture));
+
+	capture->Magic = 0;
+	EXPECT(!CrashCapture::IsValid(*capture));
+	capture->Magic = CRASHCAPTURE_MAGIC;
+
+	capture->Version = CRASHCAPTURE_VERSION + 1;
+	EXPECT(!CrashCapture::IsValid(*capture));
+	capture->Version = CRASHCAPTURE_VERSION;
+
+	capture->FrameCount = CRASHCAPTURE_MAXFRAMES + 1;
+	EXPECT(!CrashCapture::IsValid(*capture));
+	capture->FrameCount = CRASHCAPTURE_MAXFRAMES;
+	EXPECT(CrashCapture::IsValid(*capture));
+
+	capture->RegisterCount = CRASHCAPTURE_MAXREGISTERS + 1;
+	EXPECT(!CrashCapture::IsValid(*capture));
+	capture->RegisterCount = 0;
+
+	capture->ModuleCount = CRASHCAPTURE_MAXMODULES + 1;
+	EXPECT(!CrashCapture::IsValid(*capture));
+	capture->ModuleCount = 3;
+
+	/* A torn write leaves a path without terminator. */
+	memset(capture->Modules[1].Path, 'A', sizeof(capture->Modules[1].Path));
+	EXPECT(!CrashCapture::IsValid(*capture));
+}
+
+TEST(CrashCapture, FindsModulesByAddress)
+{
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+
+	EXPECT(CrashCapture::FindModule(*capture, 0x10000) == &capture->Modules[0]);
+	EXPECT(CrashCapture::FindModule(*capture, 0x10FFF) == &capture->Modules[0]);
+
+	/* The end is excluded, adjacent modules do not overlap. */
+	EXPECT(CrashCapture::FindModule(*capture, 0x11000) == &capture->Modules[1]);
+	EXPECT(CrashCapture::FindModule(*capture, 0x117FF) == &capture->Modules[1]);
+
+	/* Gaps, before the first and after the last module. */
+	EXPECT(CrashCapture::FindModule(*capture, 0x11800) == nullptr);
+	EXPECT(CrashCapture::FindModule(*capture, 0x1FFFF) == nullptr);
+	EXPECT(CrashCapture::FindModule(*capture, 0x0) == nullptr);
+	EXPECT(CrashCapture::FindModule(*capture, 0x20100) == nullptr);
+	EXPECT(CrashCapture::FindModule(*capture, UINT64_MAX) == nullptr);
+
+	/* Modules past the count are not searched. */
+	capture->ModuleCount = 2;
+	EXPECT(CrashCapture::FindModule(*capture, 0x20000) == nullptr);
+}
+
+TEST(CrashCapture, NamesRegistersAndFiles)
+{
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+
+	EXPECT(std::string(CrashCapture::GetRegisterName(CRASHCAPTURE_MACHINE_AMD64, 0)) == "RIP");
+	EXPECT(std::string(CrashCapture::GetRegisterName(CRASHCAPTURE_MACHINE_AMD64, 16)) == "R15");
+	EXPECT(CrashCapture::GetRegisterName(CRASHCAPTURE_MACHINE_AMD64, 17) == nullptr);
+	EXPECT(std::string(CrashCapture::GetRegisterName(CRASHCAPTURE_MACHINE_I386, 8)) == "EDI");
+	EXPECT(CrashCapture::GetRegisterName(CRASHCAPTURE_MACHINE_I386, 9) == nullptr);
+	EXPECT(CrashCapture::GetRegisterName(0, 0) == nullptr);
+
+	EXPECT(std::string(CrashCapture::GetFileName(capture->Modules[0])) == "Gw2-64.exe");
+	EXPECT(std::string(CrashCapture::GetFileName(capture->Modules[1])) == "Addon.dll");
+	EXPECT(std::string(CrashCapture::GetFileName(capture->Modules[2])) == "other.so");
+}
+
+TEST(CrashCapture, ReadsOnlyCompleteCaptures)
+{
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "NexusTests_CrashCapture.bin";
+	std::error_code ec;
+	std::filesystem::remove(path, ec);
+
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+	std::unique_ptr<CrashCapture_t> read = std::make_unique<CrashCapture_t>();
+
+	EXPECT(!CrashCapture::Read(path, *read));
+
+	/* Truncated, e.g. the process was killed while writing. */
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(capture.get()), sizeof(CrashCapture_t) / 2);
+	}
+	EXPECT(!CrashCapture::Read(path, *read));
+
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(capture.get()), sizeof(CrashCapture_t));
+	}
+	EXPECT(CrashCapture::Read(path, *read));
+	EXPECT(memcmp(read.get(), capture.get(), sizeof(CrashCapture_t)) == 0);
+
+	capture->Magic = 0;
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(capture.get()), sizeof(CrashCapture_t));
+	}
+	EXPECT(!CrashCapture::Read(path, *read));
+
+	std::filesystem::remove(path, ec);
+}
+
+TEST(CrashCapture, WritesResolvedAndUnresolvedFrames)
+{
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+
+	capture->Frames[0] = 0x11010; /* Addon, resolved with a line. */
+	capture->Frames[1] = 0x10420; /* Game, resolved without a line. */
+	capture->Frames[2] = 0x20010; /* Other, unresolved. */
+	capture->Frames[3] = 0x30000; /* No module. */
+	capture->FrameCount = 4;
+
+	capture->Registers[0] = 0x11010;
+	capture->RegisterCount = 1;
+
+	uint32_t calls = 0;
+
+	std::ostringstream log;
+	std::ostringstream stack;
+
+	CrashCapture::WriteLog(*capture, [&calls](uint64_t aAddress, CrashSymbol_t& aSymbol)
+	{
+		calls++;
+
+		if (aAddress == 0x11010)
+		{
+			aSymbol.Function = "Addon::Render";
+			aSymbol.File = "C:\\src\\Addon.cpp";
+			aSymbol.Line = 42;
+		}
+		else if (aAddress == 0x10420)
+		{
+			aSymbol.Function = "WinMain";
+		}
+	}, log, stack);
+
+	EXPECT(calls == 4);
+
+	std::string text = log.str();
+	EXPECT(text.find("Exception: 0xC0000005\n") != std::string::npos);
+	EXPECT(text.find("C:\\src\\Addon.cpp@Addon::Render on line 42\n") != std::string::npos);
+	EXPECT(text.find("C:\\Game\\Gw2-64.exe@WinMain\n") != std::string::npos);
+	EXPECT(text.find("/tmp/other.so@0x10\n") != std::string::npos);
+	EXPECT(text.find("(unknown)@0x30000\n") != std::string::npos);
+	EXPECT(text.find("RIP: 0x0000000000011010\n") != std::string::npos);
+	EXPECT(text.find("0x0000000000011000 5F000000 C:\\Game\\addons\\Addon.dll\n") != std::string::npos);
+
+	/* One line per frame, the loader matches them against the addon paths. */
+	EXPECT(stack.str() == "C:\\Game\\addons\\Addon.dll\nC:\\Game\\Gw2-64.exe\n/tmp/other.so\n\n");
+}
+
+TEST(CrashCapture, WritesOffsetsWithoutSymbols)
+{
+	std::unique_ptr<CrashCapture_t> capture = MakeCapture();
+
+	capture->IsFirstChance = 1;
+	capture->Frames[0] = 0x117FF;
+	capture->FrameCount = 1;
+
+	std::ostringstream log;
+	std::ostringstream stack;
+
+	CrashCapture::WriteLog(*capture, nullptr, log, stack);
+
+	std::string text = log.str();
+	EXPECT(text.find("Exception: 0xC0000005 (First chance)\n") != std::string::npos);
+	EXPECT(text.find("C:\\Game\\addons\\Addon.dll@0x7FF\n") != std::string::npos);
+	EXPECT(text.find(" on line ") == std::string::npos);
+	EXPECT(stack.str() == "C:\\Game\\addons\\Addon.dll\n");
+}
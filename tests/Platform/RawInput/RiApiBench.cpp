@@ -0,0 +1,205 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  RiApiBench.cpp
+/// Description  :  Overhead per window message with 30 addon callbacks, routed and unrouted.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "Hooks/HkRouter.h"
+#include "Platform/RawInput/RiApi.h"
+
+using namespace Raidcore::Nexus::Hooks;
+using namespace Raidcore::Nexus::Platform;
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t MESSAGES  = 200000;
+constexpr const uint32_t CALLBACKS = 30;
+
+static std::atomic<uint64_t> s_Invocations{ 0 };
+
+/* Distinct addresses, registering the same callback twice only merges its classes. */
+template <uint32_t N>
+static UINT Callback(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	s_Invocations.store(s_Invocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	return 1;
+}
+
+template <uint32_t... N>
+static std::array<WNDPROC_CALLBACK, sizeof...(N)> MakeCallbacks(std::integer_sequence<uint32_t, N...>)
+{
+	return { &Callback<N>... };
+}
+
+static UINT PassOn(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+{
+	DoNotOptimize(uMsg);
+	return 1;
+}
+
+///----------------------------------------------------------------------------------------------------
+/// LockedWndProc Struct
+/// 	The previous dispatch, every callback invoked under the mutex for every message.
+///----------------------------------------------------------------------------------------------------
+struct LockedWndProc
+{
+	std::mutex                    Mutex;
+	std::vector<WNDPROC_CALLBACK> Registry;
+
+	UINT WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
+	{
+		const std::lock_guard<std::mutex> lock(this->Mutex);
+
+		for (WNDPROC_CALLBACK wndprocCb : this->Registry)
+		{
+			if (wndprocCb(hWnd, uMsg, wParam, lParam) == 0) { return 0; }
+		}
+
+		return 1;
+	}
+};
+
+///----------------------------------------------------------------------------------------------------
+/// MakeStream:
+/// 	Returns a message stream dominated by mouse movement, raw input and cursor queries, as in game.
+///----------------------------------------------------------------------------------------------------
+static std::vector<UINT> MakeStream()
+{
+	std::vector<UINT> stream;
+	stream.reserve(MESSAGES);
+
+	uint32_t state = 1;
+
+	for (uint32_t i = 0; i < MESSAGES; i++)
+	{
+		state = state * 1664525u + 1013904223u;
+		uint32_t roll = (state >> 16) % 100;
+
+		if      (roll < 45) { stream.push_back(WM_MOUSEMOVE); }
+		else if (roll < 70) { stream.push_back(WM_INPUT); }
+		else if (roll < 85) { stream.push_back(WM_SETCURSOR); }
+		else if (roll < 90) { stream.push_back(roll % 2 ? WM_KEYDOWN : WM_KEYUP); }
+		else if (roll < 92) { stream.push_back(WM_CHAR); }
+		else if (roll < 95) { stream.push_back(WM_LBUTTONDOWN); }
+		else if (roll < 98) { stream.push_back(WM_TIMER); }
+		else                { stream.push_back(WM_USER + 1); }
+	}
+
+	return stream;
+}
+
+TEST(WndProc, MessageStream)
+{
+	std::vector<UINT> stream = MakeStream();
+	std::array<WNDPROC_CALLBACK, CALLBACKS> callbacks = MakeCallbacks(std::make_integer_sequence<uint32_t, CALLBACKS>{});
+
+	LockedWndProc locked;
+	RawInputApi api;
+
+	/* A third still registers for everything, the rest filter for input, as hotkey and overlay addons do. */
+	for (uint32_t i = 0; i < CALLBACKS; i++)
+	{
+		EMsgClass classes = i % 3 == 0 ? EMsgClass::All
+			: i % 3 == 1 ? EMsgClass::Keyboard
+			: EMsgClass::Keyboard | EMsgClass::Mouse;
+
+		locked.Registry.push_back(callbacks[i]);
+		api.Register(callbacks[i], classes);
+	}
+
+	WndProcRouter router;
+	router.Route(EWndProcStage::Loader,        EMsgClass::User);
+	router.Route(EWndProcStage::RawInput,      EMsgClass::All);
+	router.Route(EWndProcStage::UI,            EMsgClass::Keyboard | EMsgClass::Mouse);
+	router.Route(EWndProcStage::InputBinds,    EMsgClass::Keyboard | EMsgClass::Mouse | EMsgClass::Focus);
+	router.Route(EWndProcStage::GameBinds,     EMsgClass::User);
+	router.Route(EWndProcStage::MouseResetFix, EMsgClass::Mouse | EMsgClass::Focus);
+
+	HWND hWnd = nullptr;
+
+	/* Every stage and every callback saw every message. */
+	s_Invocations = 0;
+	BenchClock::time_point lockedStart = BenchClock::now();
+
+	for (UINT uMsg : stream)
+	{
+		PassOn(hWnd, uMsg, 0, 0);
+		locked.WndProc(hWnd, uMsg, 0, 0);
+		PassOn(hWnd, uMsg, 0, 0);
+		PassOn(hWnd, uMsg, 0, 0);
+		PassOn(hWnd, uMsg, 0, 0);
+		PassOn(hWnd, uMsg, 0, 0);
+	}
+
+	double lockedNs = ElapsedUs(lockedStart) * 1000.0 / MESSAGES;
+	uint64_t lockedCalls = s_Invocations;
+
+	/* Routed by class, the callbacks from the snapshot. */
+	s_Invocations = 0;
+	BenchClock::time_point routedStart = BenchClock::now();
+
+	for (UINT uMsg : stream)
+	{
+		uint32_t stages = router.Begin(uMsg);
+
+		if (router.Dispatch(stages, EWndProcStage::Loader,        [&]() { return PassOn(hWnd, uMsg, 0, 0); })) { continue; }
+		if (router.Dispatch(stages, EWndProcStage::RawInput,      [&]() { return api.WndProc(hWnd, uMsg, 0, 0); })) { continue; }
+		if (router.Dispatch(stages, EWndProcStage::UI,            [&]() { return PassOn(hWnd, uMsg, 0, 0); })) { continue; }
+		if (router.Dispatch(stages, EWndProcStage::InputBinds,    [&]() { return PassOn(hWnd, uMsg, 0, 0); })) { continue; }
+		router.Dispatch(stages, EWndProcStage::GameBinds,         [&]() { return PassOn(hWnd, uMsg, 0, 0); });
+		router.Dispatch(stages, EWndProcStage::MouseResetFix,     [&]() { return PassOn(hWnd, uMsg, 0, 0); });
+	}
+
+	double routedNs = ElapsedUs(routedStart) * 1000.0 / MESSAGES;
+	uint64_t routedCalls = s_Invocations;
+
+	/* The snapshot alone, without the router and its counters. */
+	BenchClock::time_point snapshotStart = BenchClock::now();
+
+	for (UINT uMsg : stream)
+	{
+		api.WndProc(hWnd, uMsg, 0, 0);
+	}
+
+	double snapshotNs = ElapsedUs(snapshotStart) * 1000.0 / MESSAGES;
+
+	/* The router times every stage it dispatches to, two counter reads each. */
+	BenchClock::time_point clockStart = BenchClock::now();
+
+	for (uint32_t i = 0; i < MESSAGES; i++)
+	{
+		LARGE_INTEGER count;
+		QueryPerformanceCounter(&count);
+		DoNotOptimize(count.QuadPart);
+	}
+
+	double clockNs = ElapsedUs(clockStart) * 1000.0 / MESSAGES;
+
+	Print("unrouted, locked", "%7.1f ns per message, %6.2f callbacks per message", lockedNs, static_cast<double>(lockedCalls) / MESSAGES);
+	Print("routed, snapshot", "%7.1f ns per message, %6.2f callbacks per message", routedNs, static_cast<double>(routedCalls) / MESSAGES);
+	Print("snapshot only", "%7.1f ns per message", snapshotNs);
+	Print("stage timing", "%7.1f ns per counter read", clockNs);
+
+	std::array<WndProcStageStats_t, static_cast<uint32_t>(EWndProcStage::COUNT)> stats = router.GetStageStats();
+
+	EXPECT(lockedCalls == static_cast<uint64_t>(MESSAGES) * CALLBACKS);
+	EXPECT(routedCalls < lockedCalls);
+	EXPECT(stats[static_cast<uint32_t>(EWndProcStage::RawInput)].Calls == MESSAGES);
+	EXPECT(stats[static_cast<uint32_t>(EWndProcStage::Loader)].Calls < MESSAGES / 10);
+
+	/* Raw input only reaches the callbacks registered for everything. */
+	s_Invocations = 0;
+	api.WndProc(hWnd, WM_INPUT, 0, 0);
+	EXPECT(s_Invocations == CALLBACKS / 3);
+}
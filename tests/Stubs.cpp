@@ -0,0 +1,112 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  Stubs.cpp
+/// Description  :  Stand-ins for the platform dependent functions the portable units link against.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include "Stubs.h"
+
+#include <atomic>
+#include <cstdarg>
+#include <fstream>
+#include <map>
+
+#include "Core/Logging/LogApi.h"
+#include "Graphics/Textures/TxFileMapping.h"
+#include "Memory/OwnerIndex.h"
+
+static std::atomic<uint32_t> s_CriticalLogs{ 0 };
+
+/* Base address by end address of the mapped modules. */
+static std::map<uintptr_t, uintptr_t> s_Modules;
+
+namespace Raidcore::Nexus::Tests
+{
+	uint32_t GetCriticalLogs()
+	{
+		return s_CriticalLogs.load();
+	}
+
+	void MapModule(void* aBase, size_t aSize)
+	{
+		s_Modules[reinterpret_cast<uintptr_t>(aBase) + aSize] = reinterpret_cast<uintptr_t>(aBase);
+	}
+
+	void UnmapModules()
+	{
+		s_Modules.clear();
+	}
+}
+
+/* Messages are dropped, the real LogApi needs the Util submodule for its timestamps. */
+namespace Raidcore::Nexus::Core
+{
+	LogApi::~LogApi() {}
+
+	void LogApi::Register(ILogger* aLogger) {}
+
+	void LogApi::Deregister(ILogger* aLogger) {}
+
+	void LogApi::Critical(const std::string& aChannel, const char* aFmt, ...)
+	{
+		s_CriticalLogs++;
+	}
+
+	void LogApi::Warning(const std::string& aChannel, const char* aFmt, ...) {}
+
+	void LogApi::Info(const std::string& aChannel, const char* aFmt, ...) {}
+
+	void LogApi::Debug(const std::string& aChannel, const char* aFmt, ...) {}
+
+	void LogApi::Trace(const std::string& aChannel, const char* aFmt, ...) {}
+
+	void LogApi::Log(ELogLevel aLogLevel, std::string aChannel, const char* aFmt, ...) {}
+
+	void LogApi::LogV(ELogLevel aLogLevel, std::string aChannel, const char* aFmt, va_list aArgs) {}
+
+	void LogApi::LogUnformatted(ELogLevel aLogLevel, std::string aChannel, const char* aMsg) {}
+}
+
+/* Unless mapped by a test, no modules are loaded and every address is unowned and only matched by range. */
+namespace Raidcore::Nexus::Memory
+{
+	void* GetOwnerModule(void* aAddress)
+	{
+		auto it = s_Modules.upper_bound(reinterpret_cast<uintptr_t>(aAddress));
+
+		if (it == s_Modules.end() || reinterpret_cast<uintptr_t>(aAddress) < it->second) { return nullptr; }
+
+		return reinterpret_cast<void*>(it->second);
+	}
+}
+
+/* No file mappings, the whole file is read into memory. */
+namespace Raidcore::Nexus::Graphics
+{
+	void* MapFile(const std::filesystem::path& aPath, uint64_t& aOutSize)
+	{
+		std::ifstream file(aPath, std::ios::binary | std::ios::ate);
+
+		if (!file) { return nullptr; }
+
+		aOutSize = static_cast<uint64_t>(file.tellg());
+		file.seekg(0);
+
+		uint8_t* view = new uint8_t[aOutSize > 0 ? aOutSize : 1];
+
+		if (!file.read(reinterpret_cast<char*>(view), aOutSize))
+		{
+			delete[] view;
+			return nullptr;
+		}
+
+		return view;
+	}
+
+	void UnmapFile(void* aView)
+	{
+		delete[] static_cast<uint8_t*>(aView);
+	}
+}
@@ -0,0 +1,37 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  Stubs.h
+/// Description  :  Stand-ins for the platform dependent functions the portable units link against.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	///----------------------------------------------------------------------------------------------------
+	/// GetCriticalLogs:
+	/// 	Returns the amount of critical messages logged through any LogApi.
+	///----------------------------------------------------------------------------------------------------
+	uint32_t GetCriticalLogs();
+
+	///----------------------------------------------------------------------------------------------------
+	/// MapModule:
+	/// 	Makes GetOwnerModule resolve addresses within the range to aBase, as if a module was loaded.
+	/// 	Not synchronized, map before registering from other threads.
+	///----------------------------------------------------------------------------------------------------
+	void MapModule(void* aBase, size_t aSize);
+
+	///----------------------------------------------------------------------------------------------------
+	/// UnmapModules:
+	/// 	Removes all modules mapped with MapModule.
+	///----------------------------------------------------------------------------------------------------
+	void UnmapModules();
+}
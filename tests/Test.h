@@ -0,0 +1,90 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  Test.h
+/// Description  :  Minimal test registry and assertions for the portable units.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+///----------------------------------------------------------------------------------------------------
+/// Raidcore::Nexus::Tests Namespace
+///----------------------------------------------------------------------------------------------------
+namespace Raidcore::Nexus::Tests
+{
+	typedef void (*TESTFUNC)();
+
+	///----------------------------------------------------------------------------------------------------
+	/// TestCase_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct TestCase_t
+	{
+		const char* Suite;
+		const char* Name;
+		TESTFUNC    Function;
+	};
+
+	///----------------------------------------------------------------------------------------------------
+	/// AssertionFailed_t Struct
+	/// 	Thrown by ASSERT to abort the current test.
+	///----------------------------------------------------------------------------------------------------
+	struct AssertionFailed_t {};
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetTests:
+	/// 	Returns all registered tests.
+	///----------------------------------------------------------------------------------------------------
+	inline std::vector<TestCase_t>& GetTests()
+	{
+		static std::vector<TestCase_t> s_Tests;
+		return s_Tests;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// GetFailures:
+	/// 	Returns the amount of failed checks of the current test.
+	///----------------------------------------------------------------------------------------------------
+	inline int& GetFailures()
+	{
+		static int s_Failures = 0;
+		return s_Failures;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Fail:
+	/// 	Reports a failed check.
+	///----------------------------------------------------------------------------------------------------
+	inline void Fail(const char* aFile, int aLine, const char* aExpression)
+	{
+		GetFailures()++;
+		std::fprintf(stderr, "%s(%d): check failed: %s\n", aFile, aLine, aExpression);
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Registrar_t Struct
+	///----------------------------------------------------------------------------------------------------
+	struct Registrar_t
+	{
+		Registrar_t(const char* aSuite, const char* aName, TESTFUNC aFunction)
+		{
+			GetTests().push_back(TestCase_t{ aSuite, aName, aFunction });
+		}
+	};
+}
+
+#define TEST(suite, name)                                                                                   \
+	static void Test_##suite##_##name();                                                                    \
+	static Raidcore::Nexus::Tests::Registrar_t s_Test_##suite##_##name(#suite, #name, &Test_##suite##_##name); \
+	static void Test_##suite##_##name()
+
+/* Records the failure and continues. */
+#define EXPECT(expr)                                                                                        \
+	do { if (!(expr)) { Raidcore::Nexus::Tests::Fail(__FILE__, __LINE__, #expr); } } while (false)
+
+/* Records the failure and aborts the test. */
+#define ASSERT(expr)                                                                                        \
+	do { if (!(expr)) { Raidcore::Nexus::Tests::Fail(__FILE__, __LINE__, #expr); throw Raidcore::Nexus::Tests::AssertionFailed_t{}; } } while (false)
@@ -0,0 +1,143 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UiIdleBench.cpp
+/// Description  :  CPU per frame of building an idle UI with headless ImGui, versus skipping it.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Bench.h"
+#include "Test.h"
+
+#include "imgui/imgui.h"
+
+using namespace Raidcore::Nexus::Tests;
+
+constexpr const uint32_t  FRAMES          = 6000;
+constexpr const long long FRAME_MS        = 16;
+constexpr const long long IDLE_REFRESH_MS = 250;    /* As GUI::Context, an idle UI is still built this often. */
+constexpr const uint32_t  SHORTCUTS       = 30;
+
+///----------------------------------------------------------------------------------------------------
+/// BuildFrame:
+/// 	Builds what is left of the UI while idling, the QuickAccess bar with its shortcuts.
+/// 	Mirrors the window flags and style of CQuickAccess::Render.
+///----------------------------------------------------------------------------------------------------
+static void BuildFrame()
+{
+	ImGui::NewFrame();
+
+	ImGuiWindowFlags flags
+		= ImGuiWindowFlags_AlwaysAutoResize
+		| ImGuiWindowFlags_NoResize
+		| ImGuiWindowFlags_NoCollapse
+		| ImGuiWindowFlags_NoBackground
+		| ImGuiWindowFlags_NoTitleBar
+		| ImGuiWindowFlags_NoSavedSettings;
+
+	ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+	ImGui::SetNextWindowPos(ImVec2(400.0f, 0));
+
+	if (ImGui::Begin("QuickAccess", 0, flags))
+	{
+		for (uint32_t i = 0; i < SHORTCUTS; i++)
+		{
+			ImGui::PushID(static_cast<int>(i));
+			ImGui::ImageButton((ImTextureID)(intptr_t)(i + 1), ImVec2(32.0f, 32.0f), ImVec2(0, 0), ImVec2(1, 1), 0);
+
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("Shortcut %u", i);
+			}
+
+			ImGui::PopID();
+			ImGui::SameLine();
+		}
+
+		DoNotOptimize(ImGui::IsWindowHovered());
+	}
+	ImGui::End();
+
+	ImGui::PopStyleVar();
+
+	ImGui::Render();
+}
+
+TEST(UiIdle, CpuPerFrame)
+{
+	ImGui::CreateContext();
+
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+	io.DeltaTime = FRAME_MS / 1000.0f;
+	io.IniFilename = nullptr;
+
+	unsigned char* pixels = nullptr;
+	int width = 0;
+	int height = 0;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+	/* Settle the window size first. */
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		BuildFrame();
+	}
+
+	/* Every frame built, as before. */
+	std::vector<double> builtUs;
+
+	for (uint32_t frame = 0; frame < FRAMES; frame++)
+	{
+		BenchClock::time_point start = BenchClock::now();
+		BuildFrame();
+		builtUs.push_back(ElapsedUs(start));
+	}
+
+	uint32_t vertices = static_cast<uint32_t>(ImGui::GetDrawData()->TotalVtxCount);
+
+	/* Idle frames replay the last draw data, the backend submits the same lists either way. */
+	std::vector<double> skippedUs;
+	uint32_t built = 0;
+	long long lastBuilt = -IDLE_REFRESH_MS;
+
+	for (uint32_t frame = 0; frame < FRAMES; frame++)
+	{
+		long long now = frame * FRAME_MS;
+
+		BenchClock::time_point start = BenchClock::now();
+
+		if (now - lastBuilt >= IDLE_REFRESH_MS)
+		{
+			BuildFrame();
+			lastBuilt = now;
+			built++;
+		}
+
+		DoNotOptimize(ImGui::GetDrawData()->TotalVtxCount);
+
+		skippedUs.push_back(ElapsedUs(start));
+	}
+
+	double builtTotal = 0;
+	double skippedTotal = 0;
+
+	for (double us : builtUs)   { builtTotal += us; }
+	for (double us : skippedUs) { skippedTotal += us; }
+
+	Report("built every frame", builtUs, "us");
+	Report("idle skipping", skippedUs, "us");
+	Print("idle", "%u of %u frames built, %u vertices, %.2f us saved per frame on average", built, FRAMES, vertices, (builtTotal - skippedTotal) / FRAMES);
+
+	EXPECT(vertices > 0);
+	EXPECT(static_cast<uint32_t>(ImGui::GetDrawData()->TotalVtxCount) == vertices);
+
+	/* The first frame at or past each refresh interval is built. */
+	uint32_t interval = static_cast<uint32_t>(IDLE_REFRESH_MS / FRAME_MS + 1);
+	EXPECT(built == (FRAMES + interval - 1) / interval);
+
+	ImGui::DestroyContext();
+}
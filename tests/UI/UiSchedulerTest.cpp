@@ -0,0 +1,281 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  UiSchedulerTest.cpp
+/// Description  :  Tests for the render callback scheduler on a fake frame clock.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Test.h"
+
+#include "UI/UiScheduler.h"
+
+using namespace Raidcore::Nexus::GUI;
+
+static void RenderA() {}
+static void RenderB() {}
+
+///----------------------------------------------------------------------------------------------------
+/// FakeClock Class
+/// 	Advances frames and reports a fixed duration per callback instead of measuring.
+///----------------------------------------------------------------------------------------------------
+class FakeClock
+{
+	public:
+	FakeClock(CRenderScheduler& aScheduler)
+		: Scheduler(aScheduler)
+	{}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Frame:
+	/// 	Runs one frame of the given callbacks, returns those that ran.
+	///----------------------------------------------------------------------------------------------------
+	std::vector<GUI_RENDER> Frame(const std::vector<GUI_RENDER>& aCallbacks, bool aCanSkip = true, bool aIsReplayable = true)
+	{
+		std::vector<GUI_RENDER> ran;
+
+		for (GUI_RENDER callback : aCallbacks)
+		{
+			if (!this->Scheduler.ShouldRun(callback, this->Current, aCanSkip)) { continue; }
+
+			this->Scheduler.Record(callback, this->Current, this->Durations[callback], aIsReplayable);
+			ran.push_back(callback);
+		}
+
+		this->Current++;
+		return ran;
+	}
+
+	///----------------------------------------------------------------------------------------------------
+	/// Frames:
+	/// 	Runs the given amount of frames, returns how often the callback ran.
+	///----------------------------------------------------------------------------------------------------
+	uint32_t Frames(GUI_RENDER aCallback, uint32_t aCount, bool aCanSkip = true, bool aIsReplayable = true)
+	{
+		uint32_t runs = 0;
+
+		for (uint32_t i = 0; i < aCount; i++)
+		{
+			runs += static_cast<uint32_t>(this->Frame({ aCallback }, aCanSkip, aIsReplayable).size());
+		}
+
+		return runs;
+	}
+
+	std::unordered_map<GUI_RENDER, float> Durations;
+	uint64_t                              Current = 1;
+
+	private:
+	CRenderScheduler&                     Scheduler;
+};
+
+static const RenderStats_t& StatsOf(const CRenderScheduler& aScheduler, GUI_RENDER aCallback)
+{
+	return aScheduler.GetStats().at(aCallback);
+}
+
+TEST(RenderScheduler, RunsEverythingWithoutBudget)
+{
+	CRenderScheduler scheduler;
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 50.0f;
+
+	EXPECT(clock.Frames(RenderA, 100) == 100);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(StatsOf(scheduler, RenderA).Runs == 100);
+	EXPECT(StatsOf(scheduler, RenderA).Skips == 0);
+
+	/* A budget alone does not throttle, the interval has to be set too. */
+	scheduler.SetBudget(1.0f);
+	scheduler.SetInterval(1);
+	EXPECT(clock.Frames(RenderA, 100) == 100);
+}
+
+TEST(RenderScheduler, ThrottlesAfterConsecutiveRunsOverBudget)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(4);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+	clock.Durations[RenderB] = 1.0f;
+
+	for (uint32_t i = 0; i < RENDERSCHED_THROTTLE_AFTER - 1; i++)
+	{
+		EXPECT(clock.Frame({ RenderA, RenderB }).size() == 2);
+	}
+
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+
+	/* The last run over budget throttles A, B stays within budget. */
+	EXPECT(clock.Frame({ RenderA, RenderB }).size() == 2);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(!StatsOf(scheduler, RenderB).IsThrottled);
+
+	/* A runs every 4th frame from now on. */
+	std::vector<uint32_t> ranA;
+
+	for (uint32_t i = 0; i < 12; i++)
+	{
+		std::vector<GUI_RENDER> ran = clock.Frame({ RenderA, RenderB });
+		EXPECT(ran.back() == RenderB);
+
+		if (ran.size() == 2)
+		{
+			ranA.push_back(i);
+		}
+	}
+
+	EXPECT(ranA == std::vector<uint32_t>({ 3, 7, 11 }));
+	EXPECT(StatsOf(scheduler, RenderA).Skips == 9);
+	EXPECT(StatsOf(scheduler, RenderB).Skips == 0);
+}
+
+TEST(RenderScheduler, FastRunRestartsOverBudgetCount)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(4);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER - 1);
+
+	/* A single run within budget restarts the count. */
+	clock.Durations[RenderA] = 1.0f;
+	clock.Frames(RenderA, 1);
+	EXPECT(StatsOf(scheduler, RenderA).OverBudget == 0);
+
+	clock.Durations[RenderA] = 5.0f;
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER - 1);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+
+	clock.Frames(RenderA, 1);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+}
+
+TEST(RenderScheduler, RecoversAfterRunsWithinBudget)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(3);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+
+	/* Throttled runs within budget count towards recovery, skipped frames do not. */
+	clock.Durations[RenderA] = 1.0f;
+	uint32_t runs = clock.Frames(RenderA, (RENDERSCHED_RECOVER_AFTER - 1) * 3);
+	EXPECT(runs == RENDERSCHED_RECOVER_AFTER - 1);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+
+	clock.Frames(RenderA, 3);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(clock.Frames(RenderA, 10) == 10);
+}
+
+TEST(RenderScheduler, InteractionLiftsThrottling)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(8);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+
+	/* Hovered, it runs every frame and has to build up to being throttled again. */
+	EXPECT(clock.Frames(RenderA, 1, false) == 1);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(StatsOf(scheduler, RenderA).OverBudget == 1);
+
+	EXPECT(clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER - 2) == RENDERSCHED_THROTTLE_AFTER - 2);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	clock.Frames(RenderA, 1);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+}
+
+TEST(RenderScheduler, NeverThrottlesUnreplayableOutput)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(4);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+
+	EXPECT(clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER * 2, true, false) == RENDERSCHED_THROTTLE_AFTER * 2);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(!StatsOf(scheduler, RenderA).IsReplayable);
+	EXPECT(StatsOf(scheduler, RenderA).OverBudget == 0);
+}
+
+TEST(RenderScheduler, ResetAndDisablingLiftThrottling)
+{
+	CRenderScheduler scheduler;
+	scheduler.SetBudget(2.0f);
+	scheduler.SetInterval(4);
+
+	FakeClock clock(scheduler);
+	clock.Durations[RenderA] = 5.0f;
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+
+	scheduler.Reset();
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(StatsOf(scheduler, RenderA).OverBudget == 0);
+
+	clock.Frames(RenderA, RENDERSCHED_THROTTLE_AFTER);
+	EXPECT(StatsOf(scheduler, RenderA).IsThrottled);
+
+	scheduler.SetBudget(0.0f);
+	EXPECT(!StatsOf(scheduler, RenderA).IsThrottled);
+	EXPECT(clock.Frames(RenderA, 10) == 10);
+}
+
+TEST(RenderScheduler, KeepsHistoryAndAverage)
+{
+	CRenderScheduler scheduler;
+	FakeClock clock(scheduler);
+
+	clock.Durations[RenderA] = 10.0f;
+	clock.Frames(RenderA, 1);
+	EXPECT(StatsOf(scheduler, RenderA).Average == 10.0f);
+
+	/* Moves a tenth towards the latest run. */
+	clock.Durations[RenderA] = 20.0f;
+	clock.Frames(RenderA, 1);
+	EXPECT(StatsOf(scheduler, RenderA).Average == 11.0f);
+
+	clock.Frames(RenderA, RENDERSTATS_HISTORY);
+	const RenderStats_t& stats = StatsOf(scheduler, RenderA);
+	EXPECT(stats.HistoryCount == RENDERSTATS_HISTORY);
+	EXPECT(stats.HistoryIndex == 2);
+	EXPECT(stats.History[0] == 20.0f);
+	EXPECT(stats.LastRun == clock.Current - 1);
+}
+
+TEST(RenderScheduler, PrunesRemovedCallbacks)
+{
+	CRenderScheduler scheduler;
+	FakeClock clock(scheduler);
+	clock.Frame({ RenderA, RenderB });
+
+	EXPECT(scheduler.GetStats().size() == 2);
+
+	scheduler.Prune({ RenderB });
+	EXPECT(scheduler.GetStats().size() == 1);
+	EXPECT(scheduler.GetStats().count(RenderB) == 1);
+
+	scheduler.Prune({});
+	EXPECT(scheduler.GetStats().empty());
+}
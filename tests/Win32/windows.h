@@ -0,0 +1,119 @@
+///----------------------------------------------------------------------------------------------------
+/// Copyright (c) Raidcore.GG - All rights reserved.
+///
+/// Name         :  windows.h
+/// Description  :  Stand-in for the Win32 declarations the benched units use.
+/// 	Only on the include path of non-Windows builds. File mappings always fail.
+/// Authors      :  K. Bieniek
+///----------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+typedef unsigned int  UINT;
+typedef unsigned long DWORD;
+typedef int           BOOL;
+typedef void*         HANDLE;
+typedef void*         HWND;
+typedef void*         LPVOID;
+typedef const void*   LPCVOID;
+typedef const char*   LPCSTR;
+typedef uintptr_t     WPARAM;
+typedef intptr_t      LPARAM;
+typedef intptr_t      LRESULT;
+
+typedef union _LARGE_INTEGER
+{
+	int64_t QuadPart;
+} LARGE_INTEGER;
+
+/* Nanoseconds of the steady clock as performance counter. */
+inline BOOL QueryPerformanceFrequency(LARGE_INTEGER* aFrequency)
+{
+	aFrequency->QuadPart = 1000000000;
+	return 1;
+}
+
+inline BOOL QueryPerformanceCounter(LARGE_INTEGER* aCount)
+{
+	aCount->QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	return 1;
+}
+
+#define FALSE                0
+#define INVALID_HANDLE_VALUE ((HANDLE)(intptr_t)-1)
+#define PAGE_READWRITE       0x04
+#define FILE_MAP_ALL_ACCESS  0x000F001F
+
+inline DWORD GetCurrentProcessId()
+{
+	return 1;
+}
+
+inline DWORD GetLastError()
+{
+	return 0;
+}
+
+inline HANDLE OpenFileMappingA(DWORD aAccess, BOOL aInherit, LPCSTR aName)
+{
+	return nullptr;
+}
+
+inline HANDLE CreateFileMappingA(HANDLE aFile, void* aAttributes, DWORD aProtect, DWORD aSizeHigh, DWORD aSizeLow, LPCSTR aName)
+{
+	return nullptr;
+}
+
+inline LPVOID MapViewOfFile(HANDLE aMapping, DWORD aAccess, DWORD aOffsetHigh, DWORD aOffsetLow, size_t aSize)
+{
+	return nullptr;
+}
+
+inline BOOL UnmapViewOfFile(LPCVOID aView)
+{
+	return 0;
+}
+
+inline BOOL CloseHandle(HANDLE aHandle)
+{
+	return 0;
+}
+
+#define DEFINE_ENUM_FLAG_OPERATORS(ENUMTYPE)                                                                                                             \
+inline constexpr ENUMTYPE operator|(ENUMTYPE a, ENUMTYPE b) noexcept { return ENUMTYPE(std::underlying_type_t<ENUMTYPE>(a) | std::underlying_type_t<ENUMTYPE>(b)); } \
+inline constexpr ENUMTYPE operator&(ENUMTYPE a, ENUMTYPE b) noexcept { return ENUMTYPE(std::underlying_type_t<ENUMTYPE>(a) & std::underlying_type_t<ENUMTYPE>(b)); } \
+inline constexpr ENUMTYPE operator^(ENUMTYPE a, ENUMTYPE b) noexcept { return ENUMTYPE(std::underlying_type_t<ENUMTYPE>(a) ^ std::underlying_type_t<ENUMTYPE>(b)); } \
+inline constexpr ENUMTYPE operator~(ENUMTYPE a) noexcept { return ENUMTYPE(~std::underlying_type_t<ENUMTYPE>(a)); }                                     \
+inline ENUMTYPE& operator|=(ENUMTYPE& a, ENUMTYPE b) noexcept { return a = a | b; }                                                                     \
+inline ENUMTYPE& operator&=(ENUMTYPE& a, ENUMTYPE b) noexcept { return a = a & b; }                                                                     \
+inline ENUMTYPE& operator^=(ENUMTYPE& a, ENUMTYPE b) noexcept { return a = a ^ b; }
+
+#define WM_ACTIVATE            0x0006
+#define WM_SETFOCUS            0x0007
+#define WM_KILLFOCUS           0x0008
+#define WM_PAINT               0x000F
+#define WM_ACTIVATEAPP         0x001C
+#define WM_SETCURSOR           0x0020
+#define WM_MOUSEACTIVATE       0x0021
+#define WM_NCHITTEST           0x0084
+#define WM_NCMOUSEMOVE         0x00A0
+#define WM_NCXBUTTONDBLCLK     0x00AD
+#define WM_INPUT_DEVICE_CHANGE 0x00FE
+#define WM_INPUT               0x00FF
+#define WM_KEYFIRST            0x0100
+#define WM_KEYDOWN             0x0100
+#define WM_KEYUP               0x0101
+#define WM_CHAR                0x0102
+#define WM_KEYLAST             0x0109
+#define WM_TIMER               0x0113
+#define WM_MOUSEFIRST          0x0200
+#define WM_MOUSEMOVE           0x0200
+#define WM_LBUTTONDOWN         0x0201
+#define WM_LBUTTONUP           0x0202
+#define WM_MOUSEWHEEL          0x020A
+#define WM_MOUSELAST           0x020E
+#define WM_USER                0x0400